@@ -1,4 +1,3 @@
-
 /*
  *
  *    Copyright (c) 2025 Project CHIP Authors
@@ -19,28 +18,91 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <media-controller.h>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 // Default Media Controller
+//
+// Media is handed to each registered transport by a worker thread of its own,
+// through a bounded queue of reference-counted packets, so that a slow viewer
+// never stalls the capture thread or the other viewers. A viewer whose queue
+// fills up drops video until the next keyframe, and then skips its backlog.
 class DefaultMediaController : public MediaController
 {
 public:
+    // Maximum number of packets queued for a transport before it starts dropping media.
+    static constexpr size_t kMaxQueuedPackets = 512;
+
+    // Per-viewer delivery metrics
+    struct ViewerStats
+    {
+        uint64_t sentPackets    = 0;
+        uint64_t droppedPackets = 0;
+        size_t queuedPackets    = 0;
+        // Time between the distribution of the last sent packet and its hand-off to the transport
+        std::chrono::microseconds lag{ 0 };
+        std::chrono::microseconds maxLag{ 0 };
+    };
+
     DefaultMediaController() {}
-    virtual ~DefaultMediaController() {}
+    virtual ~DefaultMediaController();
     // Transports register themselves with the media-controller for receiving
     // media from stream sources.
     void RegisterTransport(Transport * transport, uint16_t videoStreamID, uint16_t audioStreamID) override;
     // Transports must first unregister from the media-controller when they are
-    // getting destroyed.
+    // getting destroyed. No media is handed to the transport once this returns.
     void UnregisterTransport(Transport * transport) override;
-    // Media controller goes through registered transports and dispatches media
-    // if the transport is ready.
+    // Media controller goes through registered transports and queues media
+    // for them, it is sent once the transport is ready.
     void DistributeVideo(const char * data, size_t size, uint16_t videoStreamID) override;
     void DistributeAudio(const char * data, size_t size, uint16_t audioStreamID) override;
 
+    // Returns false if the transport is not registered.
+    bool GetViewerStats(Transport * transport, ViewerStats & stats);
+
 private:
-    std::vector<Connection> mConnections;
+    struct MediaPacket
+    {
+        std::vector<char> data;
+        uint16_t streamID;
+        bool isVideo;
+        // The packet starts a random access point of the video stream
+        bool isKeyFrame;
+        std::chrono::steady_clock::time_point distributionTime;
+    };
+
+    class Viewer
+    {
+    public:
+        Viewer(const Connection & connection);
+        ~Viewer();
+
+        const Connection & GetConnection() const { return mConnection; }
+        void Enqueue(const std::shared_ptr<const MediaPacket> & packet);
+        ViewerStats GetStats();
+
+    private:
+        void Run();
+
+        Connection mConnection;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::deque<std::shared_ptr<const MediaPacket>> mQueue;
+        bool mStopping           = false;
+        bool mWaitingForKeyFrame = false;
+        ViewerStats mStats;
+        std::thread mThread;
+    };
+
+    static bool IsH264RtpKeyFrame(const uint8_t * data, size_t size);
+    void Distribute(const std::shared_ptr<const MediaPacket> & packet);
+
+    std::vector<std::unique_ptr<Viewer>> mViewers;
     std::mutex mConnectionsMutex;
 };
@@ -17,46 +17,263 @@
  */
 #include "default-media-controller.h"
 #include <algorithm>
+#include <iterator>
 #include <lib/support/logging/CHIPLogging.h>
 
+namespace {
+
+// H.264 NAL unit types (RFC 6184)
+constexpr uint8_t kNalTypeIdr   = 5;
+constexpr uint8_t kNalTypeSps   = 7;
+constexpr uint8_t kNalTypeStapA = 24;
+constexpr uint8_t kNalTypeFuA   = 28;
+
+constexpr size_t kRtpHeaderSize = 12;
+
+bool IsKeyFrameNalType(uint8_t nalType)
+{
+    return nalType == kNalTypeIdr || nalType == kNalTypeSps;
+}
+
+} // namespace
+
+DefaultMediaController::Viewer::Viewer(const Connection & connection) : mConnection(connection)
+{
+    mThread = std::thread(&Viewer::Run, this);
+}
+
+DefaultMediaController::Viewer::~Viewer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_one();
+    if (mThread.joinable())
+    {
+        mThread.join();
+    }
+}
+
+void DefaultMediaController::Viewer::Enqueue(const std::shared_ptr<const MediaPacket> & packet)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (packet->isVideo)
+        {
+            if (mWaitingForKeyFrame)
+            {
+                if (!packet->isKeyFrame)
+                {
+                    mStats.droppedPackets++;
+                    return;
+                }
+
+                // Skip the backlog so that the viewer catches up from the keyframe.
+                mStats.droppedPackets += mQueue.size();
+                mQueue.clear();
+                mWaitingForKeyFrame = false;
+            }
+            else if (mQueue.size() >= kMaxQueuedPackets)
+            {
+                // The next video packets cannot be decoded without this one, drop them until the next keyframe.
+                ChipLogProgress(Camera, "Viewer lagging on videoStreamID=%u, dropping video until the next keyframe",
+                                mConnection.videoStreamID);
+                mStats.droppedPackets++;
+                mWaitingForKeyFrame = true;
+                return;
+            }
+        }
+        else if (mQueue.size() >= kMaxQueuedPackets)
+        {
+            mStats.droppedPackets++;
+            return;
+        }
+
+        mQueue.push_back(packet);
+    }
+    mCondition.notify_one();
+}
+
+DefaultMediaController::ViewerStats DefaultMediaController::Viewer::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ViewerStats stats   = mStats;
+    stats.queuedPackets = mQueue.size();
+    return stats;
+}
+
+void DefaultMediaController::Viewer::Run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mCondition.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+        if (mStopping)
+        {
+            break;
+        }
+
+        std::shared_ptr<const MediaPacket> packet = std::move(mQueue.front());
+        mQueue.pop_front();
+        lock.unlock();
+
+        Transport * transport = mConnection.transport;
+        bool sent             = false;
+        if (packet->isVideo && transport->CanSendVideo())
+        {
+            transport->SendVideo(packet->data.data(), packet->data.size(), packet->streamID);
+            sent = true;
+        }
+        else if (!packet->isVideo && transport->CanSendAudio())
+        {
+            transport->SendAudio(packet->data.data(), packet->data.size(), packet->streamID);
+            sent = true;
+        }
+
+        auto lag = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                         packet->distributionTime);
+        lock.lock();
+        if (sent)
+        {
+            mStats.sentPackets++;
+            mStats.lag    = lag;
+            mStats.maxLag = std::max(mStats.maxLag, lag);
+        }
+        else
+        {
+            mStats.droppedPackets++;
+        }
+    }
+}
+
+DefaultMediaController::~DefaultMediaController()
+{
+    std::lock_guard<std::mutex> lock(mConnectionsMutex);
+    mViewers.clear();
+}
+
 void DefaultMediaController::RegisterTransport(Transport * transport, uint16_t videoStreamID, uint16_t audioStreamID)
 {
     ChipLogProgress(Camera, "Registering transport: videoStreamID=%u, audioStreamID=%u", videoStreamID, audioStreamID);
 
     std::lock_guard<std::mutex> lock(mConnectionsMutex);
-    mConnections.push_back({ transport, videoStreamID, audioStreamID });
+    mViewers.push_back(std::make_unique<Viewer>(Connection{ transport, videoStreamID, audioStreamID }));
 
-    ChipLogProgress(Camera, "Transport registered successfully. Total connections: %u", (unsigned) mConnections.size());
+    ChipLogProgress(Camera, "Transport registered successfully. Total connections: %u", (unsigned) mViewers.size());
 }
 
 void DefaultMediaController::UnregisterTransport(Transport * transport)
 {
-    std::lock_guard<std::mutex> lock(mConnectionsMutex);
-    mConnections.erase(std::remove_if(mConnections.begin(), mConnections.end(),
-                                      [transport](const Connection & c) { return c.transport == transport; }),
-                       mConnections.end());
+    std::vector<std::unique_ptr<Viewer>> removed;
+    {
+        std::lock_guard<std::mutex> lock(mConnectionsMutex);
+        auto it = std::stable_partition(mViewers.begin(), mViewers.end(), [transport](const std::unique_ptr<Viewer> & v) {
+            return v->GetConnection().transport != transport;
+        });
+        std::move(it, mViewers.end(), std::back_inserter(removed));
+        mViewers.erase(it, mViewers.end());
+    }
+
+    // Stopping a viewer waits for the packet being sent to the transport, if any; do it without blocking distribution.
+    removed.clear();
 }
 
-void DefaultMediaController::DistributeVideo(const char * data, size_t size, uint16_t videoStreamID)
+bool DefaultMediaController::GetViewerStats(Transport * transport, ViewerStats & stats)
 {
     std::lock_guard<std::mutex> lock(mConnectionsMutex);
-    for (const Connection & connection : mConnections)
+    for (const auto & viewer : mViewers)
     {
-        if (connection.videoStreamID == videoStreamID && connection.transport && connection.transport->CanSendVideo())
+        if (viewer->GetConnection().transport == transport)
         {
-            connection.transport->SendVideo(data, size, videoStreamID);
+            stats = viewer->GetStats();
+            return true;
         }
     }
+    return false;
 }
 
-void DefaultMediaController::DistributeAudio(const char * data, size_t size, uint16_t audioStreamID)
+bool DefaultMediaController::IsH264RtpKeyFrame(const uint8_t * data, size_t size)
+{
+    if (size <= kRtpHeaderSize)
+    {
+        return false;
+    }
+
+    // Skip the CSRC list and the header extension, if any
+    size_t offset = kRtpHeaderSize + 4 * (data[0] & 0x0f);
+    if ((data[0] & 0x10) != 0)
+    {
+        if (size < offset + 4)
+        {
+            return false;
+        }
+        offset += 4 + 4 * ((static_cast<size_t>(data[offset + 2]) << 8) | data[offset + 3]);
+    }
+    if (size <= offset)
+    {
+        return false;
+    }
+
+    const uint8_t * payload = data + offset;
+    size_t payloadSize      = size - offset;
+    uint8_t nalType         = payload[0] & 0x1f;
+
+    if (nalType == kNalTypeFuA)
+    {
+        // Only the first fragment of a keyframe NAL unit starts the keyframe
+        return payloadSize > 1 && (payload[1] & 0x80) != 0 && IsKeyFrameNalType(payload[1] & 0x1f);
+    }
+
+    if (nalType == kNalTypeStapA)
+    {
+        // Aggregated NAL units, each prefixed by its 16-bit size
+        for (size_t i = 1; i + 2 < payloadSize;)
+        {
+            size_t nalSize = (static_cast<size_t>(payload[i]) << 8) | payload[i + 1];
+            if (nalSize == 0)
+            {
+                break;
+            }
+            if (IsKeyFrameNalType(payload[i + 2] & 0x1f))
+            {
+                return true;
+            }
+            i += 2 + nalSize;
+        }
+        return false;
+    }
+
+    return IsKeyFrameNalType(nalType);
+}
+
+void DefaultMediaController::Distribute(const std::shared_ptr<const MediaPacket> & packet)
 {
     std::lock_guard<std::mutex> lock(mConnectionsMutex);
-    for (const Connection & connection : mConnections)
+    for (const auto & viewer : mViewers)
     {
-        if (connection.audioStreamID == audioStreamID && connection.transport && connection.transport->CanSendAudio())
+        const Connection & connection = viewer->GetConnection();
+        uint16_t streamID             = packet->isVideo ? connection.videoStreamID : connection.audioStreamID;
+        if (streamID == packet->streamID && connection.transport)
         {
-            connection.transport->SendAudio(data, size, audioStreamID);
+            viewer->Enqueue(packet);
         }
     }
 }
+
+void DefaultMediaController::DistributeVideo(const char * data, size_t size, uint16_t videoStreamID)
+{
+    // The packet is copied once, and shared by the queues of all viewers of the stream.
+    auto packet = std::make_shared<MediaPacket>(MediaPacket{
+        std::vector<char>(data, data + size), videoStreamID, true,
+        IsH264RtpKeyFrame(reinterpret_cast<const uint8_t *>(data), size), std::chrono::steady_clock::now() });
+    Distribute(packet);
+}
+
+void DefaultMediaController::DistributeAudio(const char * data, size_t size, uint16_t audioStreamID)
+{
+    auto packet = std::make_shared<MediaPacket>(
+        MediaPacket{ std::vector<char>(data, data + size), audioStreamID, false, false, std::chrono::steady_clock::now() });
+    Distribute(packet);
+}
@@ -0,0 +1,741 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchmarkCommand.h"
+
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <app/data-model/EncodableToTLV.h>
+
+#include <algorithm>
+#include <fstream>
+#include <inttypes.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace {
+
+constexpr uint16_t kDefaultNodeCount      = 1;
+constexpr uint16_t kDefaultSessions       = 1;
+constexpr uint32_t kDefaultRate           = 10;
+constexpr uint16_t kDefaultConcurrency    = 1;
+constexpr uint16_t kDefaultMaxOutstanding = 64;
+constexpr uint16_t kDefaultDuration       = 10;
+constexpr uint16_t kDefaultWarmup         = 2;
+
+// Time allowed to establish the sessions, and for the operations in flight to complete once the measurement is over.
+constexpr uint16_t kConnectTimeoutSeconds = 30;
+constexpr uint16_t kDrainTimeoutSeconds   = 30;
+
+// In the closed-loop mode, sessions whose operations failed to start are topped up at this interval.
+constexpr System::Clock::Milliseconds32 kClosedLoopTickInterval(100);
+
+constexpr uint64_t kMicrosecondsPerSecond64 = chip::kMicrosecondsPerSecond;
+
+constexpr char kModeOpen[]   = "open";
+constexpr char kModeClosed[] = "closed";
+
+uint64_t NowUs()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+} // namespace
+
+BenchmarkCommand::BenchmarkCommand(const char * commandName, CredentialIssuerCommands * credIssuerCommands,
+                                   const char * helpText) :
+    CHIPCommand(commandName, credIssuerCommands, helpText)
+{}
+
+void BenchmarkCommand::AddTargetArguments()
+{
+    AddArgument("node-id", 0, UINT64_MAX, &mNodeId,
+                "The node id of the first node, the next ones (see node-count) have the following node ids.");
+    AddArgument("endpoint-id", 0, UINT16_MAX, &mEndpointId);
+    AddArgument("cluster-id", 0, UINT32_MAX, &mClusterId);
+}
+
+void BenchmarkCommand::AddLoadArguments()
+{
+    AddArgument("node-count", 1, UINT16_MAX, &mNodeCount, "Number of nodes to run the workload against. Defaults to 1.");
+    AddArgument("sessions", 1, UINT16_MAX, &mSessions,
+                "Number of sessions to each node, each one from its own commissioner. Defaults to 1.");
+    AddArgument("mode", &mMode,
+                "closed: each session keeps concurrency operations in flight. open: operations are started at rate per second, "
+                "whether or not the previous ones completed. Defaults to closed.");
+    AddArgument("rate", 1, UINT32_MAX, &mRate, "Open loop: operations started per second, across all sessions. Defaults to 10.");
+    AddArgument("concurrency", 1, UINT16_MAX, &mConcurrency, "Closed loop: operations in flight per session. Defaults to 1.");
+    AddArgument("max-outstanding", 1, UINT16_MAX, &mMaxOutstanding,
+                "Open loop: operations in flight per session above which due operations are skipped. Defaults to 64.");
+    AddArgument("duration", 1, UINT16_MAX, &mDuration, "Length of the measurement, in seconds. Defaults to 10.");
+    AddArgument("warmup", 0, UINT16_MAX, &mWarmup,
+                "Time the workload runs for before it is measured, in seconds. Defaults to 2.");
+    AddArgument("json-output", &mJsonOutput, "File to write the results to, as JSON.");
+}
+
+System::Clock::Timeout BenchmarkCommand::GetWaitDuration() const
+{
+    uint32_t seconds = kConnectTimeoutSeconds + mWarmup.ValueOr(kDefaultWarmup) + mDuration.ValueOr(kDefaultDuration) +
+        kDrainTimeoutSeconds;
+    return System::Clock::Seconds16(static_cast<uint16_t>(std::min<uint32_t>(seconds, UINT16_MAX)));
+}
+
+bool BenchmarkCommand::IsOpenLoop() const
+{
+    return mMode.HasValue() && strcmp(mMode.Value(), kModeOpen) == 0;
+}
+
+CHIP_ERROR BenchmarkCommand::RunCommand()
+{
+    VerifyOrReturnError(mPhase == Phase::kIdle, CHIP_ERROR_INCORRECT_STATE);
+    if (mMode.HasValue() && strcmp(mMode.Value(), kModeOpen) != 0 && strcmp(mMode.Value(), kModeClosed) != 0)
+    {
+        ChipLogError(chipTool, "Unknown mode '%s', expected '%s' or '%s'", mMode.Value(), kModeOpen, kModeClosed);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::vector<ChipDeviceCommissioner *> commissioners;
+    ReturnErrorOnFailure(GetCurrentCommissioners(mSessions.ValueOr(kDefaultSessions), commissioners));
+
+    mLatency.Reset();
+    mStarted = mSucceeded = mFailed = mSkipped = 0;
+    mErrors.clear();
+    mIssued     = 0;
+    mNextWorker = 0;
+
+    mWorkers.clear();
+    for (auto * commissioner : commissioners)
+    {
+        for (uint16_t i = 0; i < mNodeCount.ValueOr(kDefaultNodeCount); i++)
+        {
+            mWorkers.push_back(std::make_unique<Worker>(*this, commissioner, mNodeId + i));
+        }
+    }
+
+    ChipLogProgress(chipTool, "Benchmark: establishing %u sessions", static_cast<unsigned>(mWorkers.size()));
+    mPhase              = Phase::kConnecting;
+    mPendingConnections = mWorkers.size();
+    // Sessions may be established synchronously, so iterate over a snapshot in case the last one ends the connecting phase.
+    size_t workerCount = mWorkers.size();
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        CHIP_ERROR err = mWorkers[i]->Connect();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipTool, "Benchmark: failed to connect: %" CHIP_ERROR_FORMAT, err.Format());
+            OnWorkerConnected(false);
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void BenchmarkCommand::OnWorkerConnected(bool connected)
+{
+    VerifyOrReturn(mPhase == Phase::kConnecting && mPendingConnections > 0);
+    if (--mPendingConnections > 0)
+    {
+        return;
+    }
+
+    size_t connectedCount = std::count_if(mWorkers.begin(), mWorkers.end(), [](auto & worker) { return worker->IsConnected(); });
+    if (connectedCount == 0)
+    {
+        ChipLogError(chipTool, "Benchmark: no session could be established");
+        mPhase = Phase::kIdle;
+        SetCommandExitStatus(CHIP_ERROR_NOT_CONNECTED);
+        return;
+    }
+
+    ChipLogProgress(chipTool, "Benchmark: %u of %u sessions established", static_cast<unsigned>(connectedCount),
+                    static_cast<unsigned>(mWorkers.size()));
+    StartLoad();
+}
+
+void BenchmarkCommand::StartLoad()
+{
+    mLoadStartUs    = NowUs();
+    mMeasureStartUs = mLoadStartUs + mWarmup.ValueOr(kDefaultWarmup) * kMicrosecondsPerSecond64;
+    mMeasureEndUs   = mMeasureStartUs + mDuration.ValueOr(kDefaultDuration) * kMicrosecondsPerSecond64;
+    mPhase          = Phase::kRunning;
+
+    auto runTime = System::Clock::Milliseconds32(static_cast<uint32_t>((mMeasureEndUs - mLoadStartUs) / 1000));
+    LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(runTime, OnPhaseTimer, this));
+
+    ChipLogProgress(chipTool, "Benchmark: running the %s workload in %s loop", GetName(), IsOpenLoop() ? kModeOpen : kModeClosed);
+    OnTickTimer(&DeviceLayer::SystemLayer(), this);
+}
+
+void BenchmarkCommand::IssueDueOperations()
+{
+    uint64_t rate = mRate.ValueOr(kDefaultRate);
+    uint64_t now  = std::min(NowUs(), mMeasureEndUs);
+    uint64_t due  = (now - mLoadStartUs) * rate / kMicrosecondsPerSecond64;
+
+    while (mIssued < due)
+    {
+        // Latencies are measured from the time the operation was due, not from the time the timer fired.
+        uint64_t startUs = mLoadStartUs + mIssued * kMicrosecondsPerSecond64 / rate;
+        mIssued++;
+
+        Worker * worker = nullptr;
+        for (size_t i = 0; i < mWorkers.size() && worker == nullptr; i++)
+        {
+            Worker * candidate = mWorkers[mNextWorker].get();
+            mNextWorker        = (mNextWorker + 1) % mWorkers.size();
+            if (candidate->IsConnected())
+            {
+                worker = candidate;
+            }
+        }
+
+        if (worker == nullptr || worker->GetOutstanding() >= mMaxOutstanding.ValueOr(kDefaultMaxOutstanding))
+        {
+            if (startUs >= mMeasureStartUs)
+            {
+                mSkipped++;
+            }
+            continue;
+        }
+
+        // Failures to start are recorded by the worker.
+        worker->StartOperation(startUs);
+    }
+}
+
+void BenchmarkCommand::TopUp(Worker & worker)
+{
+    while (mPhase == Phase::kRunning && worker.IsConnected() && worker.GetOutstanding() < mConcurrency.ValueOr(kDefaultConcurrency))
+    {
+        // Failures to start are recorded by the worker, and the slot is retried at the next tick.
+        VerifyOrReturn(worker.StartOperation(NowUs()) == CHIP_NO_ERROR);
+    }
+}
+
+void BenchmarkCommand::OnOperationStarted(uint64_t startUs)
+{
+    if (startUs >= mMeasureStartUs && startUs < mMeasureEndUs)
+    {
+        mStarted++;
+    }
+}
+
+void BenchmarkCommand::RecordFailureToStart(uint64_t startUs, CHIP_ERROR error)
+{
+    ChipLogError(chipTool, "Benchmark: failed to start an operation: %" CHIP_ERROR_FORMAT, error.Format());
+    if (startUs >= mMeasureStartUs && startUs < mMeasureEndUs)
+    {
+        mFailed++;
+        mErrors[error.AsString()]++;
+    }
+}
+
+void BenchmarkCommand::OnOperationComplete(Worker & worker, uint64_t startUs, CHIP_ERROR error)
+{
+    if (startUs >= mMeasureStartUs && startUs < mMeasureEndUs)
+    {
+        if (error == CHIP_NO_ERROR)
+        {
+            mSucceeded++;
+            mLatency.Record(NowUs() - startUs);
+        }
+        else
+        {
+            mFailed++;
+            mErrors[error.AsString()]++;
+        }
+    }
+
+    if (mPhase == Phase::kRunning && !IsOpenLoop())
+    {
+        TopUp(worker);
+    }
+    else if (mPhase == Phase::kDraining)
+    {
+        MaybeFinishDraining();
+    }
+}
+
+void BenchmarkCommand::MaybeFinishDraining()
+{
+    for (auto & worker : mWorkers)
+    {
+        VerifyOrReturn(worker->GetOutstanding() == 0);
+    }
+
+    // Finish from a timer rather than from the callback of the last operation, which is still running.
+    DeviceLayer::SystemLayer().CancelTimer(OnFinishTimer, this);
+    LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(System::Clock::kZero, OnFinishTimer, this));
+}
+
+void BenchmarkCommand::OnTickTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * command = static_cast<BenchmarkCommand *>(appState);
+    VerifyOrReturn(command->mPhase == Phase::kRunning);
+
+    System::Clock::Milliseconds32 interval = kClosedLoopTickInterval;
+    if (command->IsOpenLoop())
+    {
+        command->IssueDueOperations();
+        // Wake up about once per operation, within the granularity of the system timers.
+        uint32_t rate = command->mRate.ValueOr(kDefaultRate);
+        interval      = System::Clock::Milliseconds32(std::clamp<uint32_t>(1000 / rate, 1, 100));
+    }
+    else
+    {
+        for (auto & worker : command->mWorkers)
+        {
+            command->TopUp(*worker);
+        }
+    }
+
+    LogErrorOnFailure(systemLayer->StartTimer(interval, OnTickTimer, appState));
+}
+
+void BenchmarkCommand::OnPhaseTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * command = static_cast<BenchmarkCommand *>(appState);
+    VerifyOrReturn(command->mPhase == Phase::kRunning);
+
+    if (command->IsOpenLoop())
+    {
+        // Start the operations that became due since the last tick.
+        command->IssueDueOperations();
+    }
+
+    ChipLogProgress(chipTool, "Benchmark: measurement over, waiting for the operations in flight");
+    command->mPhase = Phase::kDraining;
+    systemLayer->CancelTimer(OnTickTimer, appState);
+    LogErrorOnFailure(systemLayer->StartTimer(System::Clock::Seconds16(kDrainTimeoutSeconds), OnFinishTimer, appState));
+    command->MaybeFinishDraining();
+}
+
+void BenchmarkCommand::OnFinishTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * command = static_cast<BenchmarkCommand *>(appState);
+    VerifyOrReturn(command->mPhase == Phase::kDraining);
+    command->Finish();
+}
+
+void BenchmarkCommand::Finish()
+{
+    mPhase = Phase::kIdle;
+
+    Json::Value report = BuildReport();
+    ChipLogProgress(chipTool, "Benchmark %s: %" PRIu64 " operations succeeded, %" PRIu64 " failed, %" PRIu64 " skipped, %" PRIu64
+                    " unfinished", GetName(), mSucceeded, mFailed, mSkipped, mStarted - mSucceeded - mFailed);
+    ChipLogProgress(chipTool, "  throughput: %.1f operations/s", report["throughput"].asDouble());
+    ChipLogProgress(chipTool,
+                    "  latency (us): min %" PRIu64 " p50 %" PRIu64 " p90 %" PRIu64 " p99 %" PRIu64 " max %" PRIu64 " mean %" PRIu64,
+                    mLatency.GetMin(), mLatency.GetPercentile(50), mLatency.GetPercentile(90), mLatency.GetPercentile(99),
+                    mLatency.GetMax(), mLatency.GetMean());
+    for (auto & error : mErrors)
+    {
+        ChipLogProgress(chipTool, "  error: %s (%" PRIu64 ")", error.first.c_str(), error.second);
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (mJsonOutput.HasValue())
+    {
+        std::ofstream output(mJsonOutput.Value());
+        output << report.toStyledString();
+        output.close();
+        if (!output)
+        {
+            ChipLogError(chipTool, "Benchmark: failed to write the results to %s", mJsonOutput.Value());
+            err = CHIP_ERROR_WRITE_FAILED;
+        }
+    }
+
+    // Tear down the operations that did not complete, and the subscriptions that were kept.
+    for (auto & worker : mWorkers)
+    {
+        worker->ReleaseAll();
+    }
+
+    SetCommandExitStatus(err);
+}
+
+Json::Value BenchmarkCommand::BuildReport()
+{
+    size_t connectedCount = std::count_if(mWorkers.begin(), mWorkers.end(), [](auto & worker) { return worker->IsConnected(); });
+    uint16_t duration     = mDuration.ValueOr(kDefaultDuration);
+
+    Json::Value report;
+    report["workload"]           = GetName();
+    report["mode"]               = IsOpenLoop() ? kModeOpen : kModeClosed;
+    report["nodes"]              = mNodeCount.ValueOr(kDefaultNodeCount);
+    report["sessions"]           = Json::UInt64(mWorkers.size());
+    report["connected_sessions"] = Json::UInt64(connectedCount);
+    if (IsOpenLoop())
+    {
+        report["target_rate"]     = mRate.ValueOr(kDefaultRate);
+        report["max_outstanding"] = mMaxOutstanding.ValueOr(kDefaultMaxOutstanding);
+    }
+    else
+    {
+        report["concurrency"] = mConcurrency.ValueOr(kDefaultConcurrency);
+    }
+    report["warmup_s"]   = mWarmup.ValueOr(kDefaultWarmup);
+    report["duration_s"] = duration;
+    report["started"]    = Json::UInt64(mStarted);
+    report["succeeded"]  = Json::UInt64(mSucceeded);
+    report["failed"]     = Json::UInt64(mFailed);
+    report["skipped"]    = Json::UInt64(mSkipped);
+    report["unfinished"] = Json::UInt64(mStarted - mSucceeded - mFailed);
+    report["throughput"] = static_cast<double>(mSucceeded) / duration;
+    report["latency_us"] = mLatency.ToJson();
+
+    Json::Value errors(Json::objectValue);
+    for (auto & error : mErrors)
+    {
+        errors[error.first] = Json::UInt64(error.second);
+    }
+    report["errors"] = errors;
+
+    AddToReport(report);
+    return report;
+}
+
+void BenchmarkCommand::Shutdown()
+{
+    DeviceLayer::SystemLayer().CancelTimer(OnPhaseTimer, this);
+    DeviceLayer::SystemLayer().CancelTimer(OnTickTimer, this);
+    DeviceLayer::SystemLayer().CancelTimer(OnFinishTimer, this);
+    mWorkers.clear();
+    mPhase = Phase::kIdle;
+
+    CHIPCommand::Shutdown();
+}
+
+BenchmarkCommand::Worker::Worker(BenchmarkCommand & command, ChipDeviceCommissioner * commissioner, NodeId nodeId) :
+    mCommand(command), mCommissioner(commissioner), mNodeId(nodeId), mOnConnectedCallback(OnConnected, this),
+    mOnConnectionFailureCallback(OnConnectionFailure, this)
+{}
+
+BenchmarkCommand::Worker::~Worker()
+{
+    mOnConnectedCallback.Cancel();
+    mOnConnectionFailureCallback.Cancel();
+}
+
+CHIP_ERROR BenchmarkCommand::Worker::Connect()
+{
+    return mCommissioner->GetConnectedDevice(mNodeId, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+}
+
+void BenchmarkCommand::Worker::OnConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                           const SessionHandle & sessionHandle)
+{
+    auto * worker         = static_cast<Worker *>(context);
+    worker->mExchangeMgr = &exchangeMgr;
+    worker->mSession.Grab(sessionHandle);
+    worker->mCommand.OnWorkerConnected(true);
+}
+
+void BenchmarkCommand::Worker::OnConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    ChipLogError(chipTool, "Benchmark: failed to establish a session to 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                 ChipLogValueX64(peerId.GetNodeId()), error.Format());
+    static_cast<Worker *>(context)->mCommand.OnWorkerConnected(false);
+}
+
+CHIP_ERROR BenchmarkCommand::Worker::StartOperation(uint64_t startUs)
+{
+    mCommand.OnOperationStarted(startUs);
+
+    std::unique_ptr<Operation> operation = mCommand.NewOperation(*this, startUs);
+    Optional<SessionHandle> session      = mSession.Get();
+    CHIP_ERROR err                       = CHIP_ERROR_NOT_CONNECTED;
+    if (operation && session.HasValue())
+    {
+        err = operation->Send(*mExchangeMgr, session.Value());
+    }
+    else if (!operation)
+    {
+        err = CHIP_ERROR_NO_MEMORY;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        // The operation did not go out, so no callback of the interaction will follow: record the failure
+        // without refilling the slot, which would just fail again.
+        mCommand.RecordFailureToStart(startUs, err);
+        return err;
+    }
+
+    mOutstanding++;
+    mOperations.push_back(std::move(operation));
+    return CHIP_NO_ERROR;
+}
+
+void BenchmarkCommand::Worker::OnOperationComplete(uint64_t startUs, CHIP_ERROR error)
+{
+    mOutstanding--;
+    mCommand.OnOperationComplete(*this, startUs, error);
+}
+
+void BenchmarkCommand::Worker::ReleaseOperation(Operation & operation)
+{
+    mOperations.remove_if([&operation](auto & item) { return item.get() == &operation; });
+}
+
+void BenchmarkCommand::Worker::ReleaseAll()
+{
+    mOperations.clear();
+    mOutstanding = 0;
+}
+
+void BenchmarkCommand::Operation::Complete(CHIP_ERROR error)
+{
+    VerifyOrReturn(!mCompleted);
+    mCompleted = true;
+    mWorker.OnOperationComplete(mStartUs, error);
+}
+
+void BenchmarkCommand::Operation::Release()
+{
+    mWorker.ReleaseOperation(*this);
+}
+
+/////////// Read /////////
+
+class BenchmarkReadCommand::ReadOperation : public BenchmarkCommand::Operation, public ReadClient::Callback
+{
+public:
+    ReadOperation(BenchmarkReadCommand & command, Worker & worker, uint64_t startUs) :
+        Operation(worker, startUs), mCommand(command), mPath(command.mEndpointId, command.mClusterId, command.mAttributeId)
+    {}
+
+    CHIP_ERROR Send(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                               ReadClient::InteractionType::Read);
+
+        ReadPrepareParams params(session);
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+        params.mIsFabricFiltered            = mCommand.mFabricFiltered.ValueOr(true);
+        return mClient->SendRequest(params);
+    }
+
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        if (!status.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(ReadClient * client) override
+    {
+        Complete(mError);
+        Release();
+    }
+
+private:
+    BenchmarkReadCommand & mCommand;
+    AttributePathParams mPath;
+    std::unique_ptr<ReadClient> mClient;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<BenchmarkCommand::Operation> BenchmarkReadCommand::NewOperation(Worker & worker, uint64_t startUs)
+{
+    return std::make_unique<ReadOperation>(*this, worker, startUs);
+}
+
+/////////// Write /////////
+
+class BenchmarkWriteCommand::WriteOperation : public BenchmarkCommand::Operation, public WriteClient::Callback
+{
+public:
+    WriteOperation(BenchmarkWriteCommand & command, Worker & worker, uint64_t startUs) :
+        Operation(worker, startUs), mCommand(command)
+    {}
+
+    CHIP_ERROR Send(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mClient = std::make_unique<WriteClient>(&exchangeMgr, this, NullOptional);
+
+        AttributePathParams path(mCommand.mEndpointId, mCommand.mClusterId, mCommand.mAttributeId);
+        ReturnErrorOnFailure(mClient->EncodeAttribute(path, mCommand.mAttributeValue));
+        return mClient->SendWriteRequest(session);
+    }
+
+    void OnResponse(const WriteClient * client, const ConcreteDataAttributePath & path, StatusIB status) override
+    {
+        if (!status.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(const WriteClient * client, CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(WriteClient * client) override
+    {
+        Complete(mError);
+        Release();
+    }
+
+private:
+    BenchmarkWriteCommand & mCommand;
+    std::unique_ptr<WriteClient> mClient;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<BenchmarkCommand::Operation> BenchmarkWriteCommand::NewOperation(Worker & worker, uint64_t startUs)
+{
+    return std::make_unique<WriteOperation>(*this, worker, startUs);
+}
+
+/////////// Invoke /////////
+
+class BenchmarkInvokeCommand::InvokeOperation : public BenchmarkCommand::Operation, public CommandSender::ExtendableCallback
+{
+public:
+    InvokeOperation(BenchmarkInvokeCommand & command, Worker & worker, uint64_t startUs) :
+        Operation(worker, startUs), mCommand(command)
+    {}
+
+    CHIP_ERROR Send(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mSender = std::make_unique<CommandSender>(this, &exchangeMgr);
+
+        CommandPathParams path(mCommand.mEndpointId, /* group id */ 0, mCommand.mClusterId, mCommand.mCommandId,
+                               CommandPathFlags::kEndpointIdValid);
+        // The payload is arbitrary, so whether the command needs a timed invoke is left to the server to check.
+        DataModel::EncodableType<CustomArgument> payload(mCommand.mPayload);
+        CommandSender::AddRequestDataParameters addRequestDataParams;
+        ReturnErrorOnFailure(mSender->AddRequestData(path, payload, addRequestDataParams));
+        return mSender->SendCommandRequest(session);
+    }
+
+    void OnResponse(CommandSender * sender, const CommandSender::ResponseData & responseData) override
+    {
+        if (!responseData.statusIB.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = responseData.statusIB.ToChipError();
+        }
+    }
+
+    void OnError(const CommandSender * sender, const CommandSender::ErrorData & errorData) override { mError = errorData.error; }
+
+    void OnDone(CommandSender * sender) override
+    {
+        Complete(mError);
+        Release();
+    }
+
+private:
+    BenchmarkInvokeCommand & mCommand;
+    std::unique_ptr<CommandSender> mSender;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<BenchmarkCommand::Operation> BenchmarkInvokeCommand::NewOperation(Worker & worker, uint64_t startUs)
+{
+    return std::make_unique<InvokeOperation>(*this, worker, startUs);
+}
+
+/////////// Subscribe /////////
+
+class BenchmarkSubscribeCommand::SubscribeOperation : public BenchmarkCommand::Operation, public ReadClient::Callback
+{
+public:
+    SubscribeOperation(BenchmarkSubscribeCommand & command, Worker & worker, uint64_t startUs) :
+        Operation(worker, startUs), mCommand(command), mPath(command.mEndpointId, command.mClusterId, command.mAttributeId)
+    {}
+
+    CHIP_ERROR Send(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                               ReadClient::InteractionType::Subscribe);
+
+        ReadPrepareParams params(session);
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+        params.mMinIntervalFloorSeconds     = mCommand.mMinInterval;
+        params.mMaxIntervalCeilingSeconds   = mCommand.mMaxInterval;
+        // The subscriptions established by the previous operations must stay in place.
+        params.mKeepSubscriptions = true;
+        return mClient->SendRequest(params);
+    }
+
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        if (!status.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnReportEnd() override
+    {
+        // The priming report comes before the subscription is established, and is part of its latency.
+        if (mEstablished)
+        {
+            mCommand.mReports++;
+        }
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId subscriptionId) override
+    {
+        mEstablished = true;
+        Complete(mError);
+    }
+
+    void OnError(CHIP_ERROR error) override
+    {
+        if (mError == CHIP_NO_ERROR)
+        {
+            mError = error;
+        }
+    }
+
+    void OnDone(ReadClient * client) override
+    {
+        // A no-op if the subscription was established.
+        Complete(mError == CHIP_NO_ERROR ? CHIP_ERROR_INCORRECT_STATE : mError);
+        Release();
+    }
+
+private:
+    BenchmarkSubscribeCommand & mCommand;
+    AttributePathParams mPath;
+    std::unique_ptr<ReadClient> mClient;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+    bool mEstablished = false;
+};
+
+std::unique_ptr<BenchmarkCommand::Operation> BenchmarkSubscribeCommand::NewOperation(Worker & worker, uint64_t startUs)
+{
+    return std::make_unique<SubscribeOperation>(*this, worker, startUs);
+}
+
+void BenchmarkSubscribeCommand::AddToReport(Json::Value & report)
+{
+    report["subscription_reports"] = Json::UInt64(mReports);
+    mReports                       = 0;
+}
@@ -0,0 +1,275 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+#include "LatencyHistogram.h"
+
+#include <app/AttributePathParams.h>
+#include <app/OperationalSessionSetup.h>
+#include <transport/Session.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Drives a sustained interaction model workload against one or more nodes, and reports the throughput and
+// latency distribution observed.
+//
+// The workload runs over one CASE session per node and per commissioner: with sessions > 1, the commissioners
+// using the node ids following the one of the current identity are used as well, so the nodes must grant them
+// access.
+//
+// In the closed-loop mode, each session keeps `concurrency` operations in flight, and starts a new one as soon
+// as one completes. In the open-loop mode, operations are started at `rate` per second across all sessions,
+// whether or not the previous ones completed; their latency is measured from the time they were due, so that a
+// slow device does not hide its backlog. Operations that are due while a session already has `max-outstanding`
+// operations in flight are skipped and counted as such.
+class BenchmarkCommand : public CHIPCommand
+{
+public:
+    BenchmarkCommand(const char * commandName, CredentialIssuerCommands * credIssuerCommands, const char * helpText);
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override;
+    void Shutdown() override;
+
+protected:
+    class Operation;
+
+    class Worker
+    {
+    public:
+        Worker(BenchmarkCommand & command, ChipDeviceCommissioner * commissioner, chip::NodeId nodeId);
+        ~Worker();
+
+        CHIP_ERROR Connect();
+        bool IsConnected() const { return static_cast<bool>(mSession); }
+        CHIP_ERROR StartOperation(uint64_t startUs);
+        void OnOperationComplete(uint64_t startUs, CHIP_ERROR error);
+        void ReleaseOperation(Operation & operation);
+        void ReleaseAll();
+
+        size_t GetOutstanding() const { return mOutstanding; }
+
+    private:
+        static void OnConnected(void * context, chip::Messaging::ExchangeManager & exchangeMgr,
+                                const chip::SessionHandle & sessionHandle);
+        static void OnConnectionFailure(void * context, const chip::ScopedNodeId & peerId, CHIP_ERROR error);
+
+        BenchmarkCommand & mCommand;
+        ChipDeviceCommissioner * mCommissioner;
+        chip::NodeId mNodeId;
+        chip::Callback::Callback<chip::OnDeviceConnected> mOnConnectedCallback;
+        chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+        chip::Messaging::ExchangeManager * mExchangeMgr = nullptr;
+        chip::SessionHolder mSession;
+        std::list<std::unique_ptr<Operation>> mOperations;
+        size_t mOutstanding = 0;
+    };
+
+    // A single interaction with a node, owned by its worker until Release() is called.
+    class Operation
+    {
+    public:
+        Operation(Worker & worker, uint64_t startUs) : mWorker(worker), mStartUs(startUs) {}
+        virtual ~Operation() = default;
+
+        virtual CHIP_ERROR Send(chip::Messaging::ExchangeManager & exchangeMgr, const chip::SessionHandle & session) = 0;
+
+    protected:
+        // Records the outcome of the operation, and frees its slot in the workload. Only the first call has an effect.
+        void Complete(CHIP_ERROR error);
+
+        // Destroys the operation. It must be the last thing done by the operation.
+        void Release();
+
+    private:
+        Worker & mWorker;
+        const uint64_t mStartUs;
+        bool mCompleted = false;
+    };
+
+    virtual std::unique_ptr<Operation> NewOperation(Worker & worker, uint64_t startUs) = 0;
+
+    // Adds workload-specific figures to the report.
+    virtual void AddToReport(Json::Value & report) {}
+
+    // Adds the arguments selecting the nodes and the cluster, which come first, and the arguments describing the load,
+    // which come after the workload-specific ones.
+    void AddTargetArguments();
+    void AddLoadArguments();
+
+    chip::EndpointId mEndpointId;
+    chip::ClusterId mClusterId;
+
+private:
+    enum class Phase
+    {
+        kIdle,
+        kConnecting,
+        kRunning,
+        kDraining,
+    };
+
+    bool IsOpenLoop() const;
+    void OnWorkerConnected(bool connected);
+    void StartLoad();
+    void IssueDueOperations();
+    void TopUp(Worker & worker);
+    void OnOperationStarted(uint64_t startUs);
+    void RecordFailureToStart(uint64_t startUs, CHIP_ERROR error);
+    void OnOperationComplete(Worker & worker, uint64_t startUs, CHIP_ERROR error);
+    void MaybeFinishDraining();
+    void Finish();
+    Json::Value BuildReport();
+
+    static void OnPhaseTimer(chip::System::Layer * systemLayer, void * appState);
+    static void OnTickTimer(chip::System::Layer * systemLayer, void * appState);
+    static void OnFinishTimer(chip::System::Layer * systemLayer, void * appState);
+
+    chip::NodeId mNodeId;
+    chip::Optional<uint16_t> mNodeCount;
+    chip::Optional<uint16_t> mSessions;
+    chip::Optional<char *> mMode;
+    chip::Optional<uint32_t> mRate;
+    chip::Optional<uint16_t> mConcurrency;
+    chip::Optional<uint16_t> mMaxOutstanding;
+    chip::Optional<uint16_t> mDuration;
+    chip::Optional<uint16_t> mWarmup;
+    chip::Optional<char *> mJsonOutput;
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    Phase mPhase               = Phase::kIdle;
+    size_t mPendingConnections = 0;
+    size_t mNextWorker         = 0;
+
+    // Times are in microseconds of the monotonic clock.
+    uint64_t mLoadStartUs    = 0;
+    uint64_t mMeasureStartUs = 0;
+    uint64_t mMeasureEndUs   = 0;
+    uint64_t mIssued         = 0;
+
+    // Figures of the operations started during the measurement window.
+    LatencyHistogram mLatency;
+    uint64_t mStarted   = 0;
+    uint64_t mSucceeded = 0;
+    uint64_t mFailed    = 0;
+    uint64_t mSkipped   = 0;
+    std::map<std::string, uint64_t> mErrors;
+};
+
+class BenchmarkReadCommand : public BenchmarkCommand
+{
+public:
+    BenchmarkReadCommand(CredentialIssuerCommands * credIssuerCommands) :
+        BenchmarkCommand("read", credIssuerCommands, "Read an attribute repeatedly and report the read latency.")
+    {
+        AddTargetArguments();
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId);
+        AddArgument("fabric-filtered", 0, 1, &mFabricFiltered,
+                    "Boolean indicating whether to do a fabric-filtered read. Defaults to true.");
+        AddLoadArguments();
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(Worker & worker, uint64_t startUs) override;
+
+private:
+    class ReadOperation;
+
+    chip::AttributeId mAttributeId;
+    chip::Optional<bool> mFabricFiltered;
+};
+
+class BenchmarkWriteCommand : public BenchmarkCommand
+{
+public:
+    BenchmarkWriteCommand(CredentialIssuerCommands * credIssuerCommands) :
+        BenchmarkCommand("write", credIssuerCommands, "Write an attribute repeatedly and report the write latency.")
+    {
+        AddTargetArguments();
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId);
+        AddArgument("attribute-value", &mAttributeValue, "The value to write, in the format used by write-by-id.");
+        AddLoadArguments();
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(Worker & worker, uint64_t startUs) override;
+
+private:
+    class WriteOperation;
+
+    chip::AttributeId mAttributeId;
+    CustomArgument mAttributeValue;
+};
+
+class BenchmarkInvokeCommand : public BenchmarkCommand
+{
+public:
+    BenchmarkInvokeCommand(CredentialIssuerCommands * credIssuerCommands) :
+        BenchmarkCommand("invoke", credIssuerCommands, "Invoke a command repeatedly and report the invoke latency.")
+    {
+        AddTargetArguments();
+        AddArgument("command-id", 0, UINT32_MAX, &mCommandId);
+        AddArgument("payload", &mPayload, "The command fields, in the format used by command-by-id.");
+        AddLoadArguments();
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(Worker & worker, uint64_t startUs) override;
+
+private:
+    class InvokeOperation;
+
+    chip::CommandId mCommandId;
+    CustomArgument mPayload;
+};
+
+class BenchmarkSubscribeCommand : public BenchmarkCommand
+{
+public:
+    BenchmarkSubscribeCommand(CredentialIssuerCommands * credIssuerCommands) :
+        BenchmarkCommand("subscribe", credIssuerCommands,
+                         "Establish subscriptions to an attribute repeatedly and report the time to establish them, up to the "
+                         "subscription response. Established subscriptions are kept until the end of the run, and the reports "
+                         "they receive are counted.")
+    {
+        AddTargetArguments();
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId);
+        AddArgument("min-interval", 0, UINT16_MAX, &mMinInterval);
+        AddArgument("max-interval", 0, UINT16_MAX, &mMaxInterval);
+        AddLoadArguments();
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(Worker & worker, uint64_t startUs) override;
+    void AddToReport(Json::Value & report) override;
+
+private:
+    class SubscribeOperation;
+
+    chip::AttributeId mAttributeId;
+    uint16_t mMinInterval;
+    uint16_t mMaxInterval;
+    uint64_t mReports = 0;
+};
@@ -0,0 +1,35 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "commands/benchmark/BenchmarkCommand.h"
+#include "commands/common/Commands.h"
+
+void registerCommandsBenchmark(Commands & commands, CredentialIssuerCommands * credsIssuerConfig)
+{
+    const char * clusterName      = "Benchmark";
+    commands_list clusterCommands = {
+        make_unique<BenchmarkReadCommand>(credsIssuerConfig),      //
+        make_unique<BenchmarkWriteCommand>(credsIssuerConfig),     //
+        make_unique<BenchmarkInvokeCommand>(credsIssuerConfig),    //
+        make_unique<BenchmarkSubscribeCommand>(credsIssuerConfig), //
+    };
+
+    commands.RegisterCommandSet(clusterName, clusterCommands, "Commands for measuring the throughput and latency of a workload.");
+}
@@ -0,0 +1,138 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+
+constexpr double kReportedPercentiles[]   = { 50, 90, 99, 99.9 };
+constexpr const char * kPercentileNames[] = { "p50", "p90", "p99", "p999" };
+
+unsigned MostSignificantBit(uint64_t value)
+{
+    unsigned msb = 0;
+    while (value >>= 1)
+    {
+        msb++;
+    }
+    return msb;
+}
+
+} // namespace
+
+size_t LatencyHistogram::BucketIndex(uint64_t value)
+{
+    if (value < kSubBucketCount)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    // The kSubBucketBits bits below the most significant one select the sub-bucket.
+    unsigned shift = MostSignificantBit(value) - kSubBucketBits;
+    uint64_t sub   = (value >> shift) - kSubBucketCount;
+    return static_cast<size_t>((shift + 1) * kSubBucketCount + sub);
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+
+    unsigned shift = static_cast<unsigned>(index / kSubBucketCount - 1);
+    uint64_t sub   = index % kSubBucketCount;
+    uint64_t lower = (kSubBucketCount + sub) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::Record(uint64_t valueUs)
+{
+    mCounts[BucketIndex(valueUs)]++;
+    mCount++;
+    mSum += valueUs;
+    mMin = std::min(mMin, valueUs);
+    mMax = std::max(mMax, valueUs);
+}
+
+void LatencyHistogram::Reset()
+{
+    std::fill(mCounts.begin(), mCounts.end(), 0);
+    mCount = 0;
+    mSum   = 0;
+    mMin   = UINT64_MAX;
+    mMax   = 0;
+}
+
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the sample, 1-based, so that p100 is the last one.
+    double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank  = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(mCount))));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < mCounts.size(); i++)
+    {
+        seen += mCounts[i];
+        if (seen >= rank)
+        {
+            // The bucket bound may be above the largest recorded value.
+            return std::min(BucketUpperBound(i), mMax);
+        }
+    }
+    return mMax;
+}
+
+Json::Value LatencyHistogram::ToJson() const
+{
+    Json::Value value;
+    value["count"] = Json::UInt64(mCount);
+    value["min"]   = Json::UInt64(GetMin());
+    value["max"]   = Json::UInt64(GetMax());
+    value["mean"]  = Json::UInt64(GetMean());
+    for (size_t i = 0; i < std::size(kReportedPercentiles); i++)
+    {
+        value[kPercentileNames[i]] = Json::UInt64(GetPercentile(kReportedPercentiles[i]));
+    }
+
+    Json::Value buckets(Json::arrayValue);
+    for (size_t i = 0; i < mCounts.size(); i++)
+    {
+        if (mCounts[i] == 0)
+        {
+            continue;
+        }
+
+        Json::Value bucket;
+        bucket["le"]    = Json::UInt64(BucketUpperBound(i));
+        bucket["count"] = Json::UInt64(mCounts[i]);
+        buckets.append(bucket);
+    }
+    value["buckets"] = buckets;
+
+    return value;
+}
@@ -0,0 +1,65 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Histogram of latencies, in microseconds, with a bounded relative error.
+//
+// Values are grouped by power of two, and each power of two is split into kSubBucketCount linear
+// sub-buckets, so that the memory used does not depend on the number of samples while percentiles
+// stay within 1 / kSubBucketCount of the recorded values.
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits  = 5;
+    static constexpr uint64_t kSubBucketCount = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount      = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    LatencyHistogram() : mCounts(kBucketCount, 0) {}
+
+    void Record(uint64_t valueUs);
+    void Reset();
+
+    uint64_t GetCount() const { return mCount; }
+    uint64_t GetMin() const { return mCount ? mMin : 0; }
+    uint64_t GetMax() const { return mMax; }
+    uint64_t GetMean() const { return mCount ? mSum / mCount : 0; }
+
+    // Returns the upper bound of the bucket holding the given percentile (0 to 100) of the samples,
+    // or 0 if no sample was recorded.
+    uint64_t GetPercentile(double percentile) const;
+
+    // Summary statistics, along with the non-empty buckets as { "le": <upper bound>, "count": <samples> }.
+    Json::Value ToJson() const;
+
+private:
+    static size_t BucketIndex(uint64_t value);
+    static uint64_t BucketUpperBound(size_t index);
+
+    std::vector<uint64_t> mCounts;
+    uint64_t mCount = 0;
+    uint64_t mSum   = 0;
+    uint64_t mMin   = UINT64_MAX;
+    uint64_t mMax   = 0;
+};
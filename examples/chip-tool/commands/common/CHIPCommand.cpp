@@ -461,17 +461,41 @@ chip::Controller::DeviceCommissioner & CHIPCommand::GetCommissioner(std::string
     return *item->second;
 }
 
+CHIP_ERROR CHIPCommand::GetCurrentCommissioners(size_t count, std::vector<ChipDeviceCommissioner *> & commissioners)
+{
+    std::string identity = GetIdentity();
+    VerifyOrReturnError(identity != kIdentityNull, CHIP_ERROR_INVALID_ARGUMENT);
+
+    chip::NodeId nodeId;
+    ReturnErrorOnFailure(GetIdentityNodeId(identity, &nodeId));
+
+    commissioners.clear();
+    commissioners.push_back(&CurrentCommissioner());
+    for (size_t i = 1; i < count; i++)
+    {
+        CommissionerIdentity lookupKey{ identity, nodeId + i };
+        if (mCommissioners.find(lookupKey) == mCommissioners.end())
+        {
+            ReturnErrorOnFailure(InitializeCommissioner(lookupKey, CurrentCommissionerId(), /* listenForUdc = */ false));
+        }
+        commissioners.push_back(mCommissioners[lookupKey].get());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 void CHIPCommand::ShutdownCommissioner(const CommissionerIdentity & key)
 {
     mCommissioners[key].get()->Shutdown();
 }
 
-CHIP_ERROR CHIPCommand::InitializeCommissioner(CommissionerIdentity & identity, chip::FabricId fabricId)
+CHIP_ERROR CHIPCommand::InitializeCommissioner(CommissionerIdentity & identity, chip::FabricId fabricId, bool listenForUdc)
 {
     std::unique_ptr<ChipDeviceCommissioner> commissioner = std::make_unique<ChipDeviceCommissioner>();
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
     VerifyOrReturnError(chip::CanCastTo<uint16_t>(CHIP_UDC_PORT + fabricId), CHIP_ERROR_INVALID_ARGUMENT);
-    uint16_t udcListenPort = static_cast<uint16_t>(CHIP_UDC_PORT + fabricId);
+    // Commissioners that do not handle UDC requests listen on an ephemeral port, so they do not collide on the fabric port.
+    uint16_t udcListenPort = listenForUdc ? static_cast<uint16_t>(CHIP_UDC_PORT + fabricId) : 0;
     commissioner->SetUdcListenPort(udcListenPort);
 #endif // CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
     chip::Controller::SetupParams commissionerParams;
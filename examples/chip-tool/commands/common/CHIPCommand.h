@@ -38,6 +38,7 @@
 #include <crypto/RawKeySessionKeystore.h>
 
 #include <string>
+#include <vector>
 
 inline constexpr char kIdentityAlpha[] = "alpha";
 inline constexpr char kIdentityBeta[]  = "beta";
@@ -185,6 +186,11 @@ protected:
 
     ChipDeviceCommissioner & GetCommissioner(std::string identity);
 
+    // This method returns `count` commissioner instances on the fabric of the current identity, to
+    // commission several devices in parallel. The first one is CurrentCommissioner(), the other ones use the
+    // node ids following its node id.
+    CHIP_ERROR GetCurrentCommissioners(size_t count, std::vector<ChipDeviceCommissioner *> & commissioners);
+
 private:
     CHIP_ERROR MaybeSetUpStack();
     void MaybeTearDownStack();
@@ -212,7 +218,7 @@ private:
     // InitializeCommissioner uses various members, so can't be static.  This is
     // obviously a little odd, since the commissioners are then shared across
     // multiple commands in interactive mode...
-    CHIP_ERROR InitializeCommissioner(CommissionerIdentity & identity, chip::FabricId fabricId);
+    CHIP_ERROR InitializeCommissioner(CommissionerIdentity & identity, chip::FabricId fabricId, bool listenForUdc = true);
     void ShutdownCommissioner(const CommissionerIdentity & key);
     chip::FabricId CurrentCommissionerId();
 
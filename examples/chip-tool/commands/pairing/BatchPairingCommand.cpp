@@ -0,0 +1,108 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BatchPairingCommand.h"
+
+#include <algorithm>
+
+using namespace ::chip;
+using namespace ::chip::Controller;
+
+CHIP_ERROR BatchPairingCommand::RunCommand()
+{
+    VerifyOrReturnError(!mOnboardingPayloads.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t laneCount = std::min(static_cast<size_t>(mLanes.ValueOr(4)), mOnboardingPayloads.size());
+    std::vector<ChipDeviceCommissioner *> commissioners;
+    ReturnErrorOnFailure(GetCurrentCommissioners(laneCount, commissioners));
+
+    mPipeline = std::make_unique<CommissioningPipeline>();
+    for (auto * commissioner : commissioners)
+    {
+        ReturnErrorOnFailure(mPipeline->AddLane(commissioner));
+    }
+
+    std::vector<CommissioningPipeline::Job> jobs;
+    for (size_t i = 0; i < mOnboardingPayloads.size(); i++)
+    {
+        jobs.push_back({ mNodeId + i, mOnboardingPayloads[i] });
+    }
+
+    CommissioningParameters params;
+    if (mSSID.HasValue())
+    {
+        params.SetWiFiCredentials(WiFiCredentials(mSSID.Value(), mPassword.ValueOr(ByteSpan())));
+    }
+    if (mOperationalDataset.HasValue())
+    {
+        params.SetThreadOperationalDataset(mOperationalDataset.Value());
+    }
+    if (mBypassAttestationVerifier.ValueOr(false))
+    {
+        params.SetDeviceAttestationDelegate(this);
+    }
+
+    // Devices on the operational network can be discovered over DNS-SD only, the other ones need a commissioning channel.
+    bool onNetwork = !mSSID.HasValue() && !mOperationalDataset.HasValue();
+    return mPipeline->Start(std::move(jobs), params, onNetwork ? DiscoveryType::kDiscoveryNetworkOnly : DiscoveryType::kAll,
+                            this);
+}
+
+void BatchPairingCommand::Shutdown()
+{
+    if (mPipeline)
+    {
+        mPipeline->Stop();
+        mPipeline.reset();
+    }
+
+    CHIPCommand::Shutdown();
+}
+
+void BatchPairingCommand::OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error)
+{
+    if (error == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(chipTool, "Device 0x" ChipLogFormatX64 " commissioned", ChipLogValueX64(nodeId));
+    }
+    else
+    {
+        ChipLogError(chipTool, "Device 0x" ChipLogFormatX64 " commissioning failed: %" CHIP_ERROR_FORMAT, ChipLogValueX64(nodeId),
+                     error.Format());
+    }
+}
+
+void BatchPairingCommand::OnBatchComplete(size_t succeeded, size_t failed)
+{
+    mPipeline->LogMetrics();
+    SetCommandExitStatus(failed == 0 ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL);
+}
+
+void BatchPairingCommand::OnDeviceAttestationCompleted(
+    DeviceCommissioner * deviceCommissioner, DeviceProxy * device,
+    const Credentials::DeviceAttestationVerifier::AttestationDeviceInfo & info,
+    Credentials::AttestationVerificationResult attestationResult)
+{
+    // Bypass attestation verification, continue with success
+    CHIP_ERROR err =
+        deviceCommissioner->ContinueCommissioningAfterDeviceAttestation(device, Credentials::AttestationVerificationResult::kSuccess);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Failed to continue commissioning: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
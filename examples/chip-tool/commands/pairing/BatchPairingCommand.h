@@ -0,0 +1,78 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+#include <controller/CommissioningPipeline.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Commissions a batch of devices, given by their setup codes, using several commissioners in parallel.
+// The devices get consecutive node ids starting at node-id.
+class BatchPairingCommand : public CHIPCommand,
+                            public chip::Controller::CommissioningPipeline::Delegate,
+                            public chip::Credentials::DeviceAttestationDelegate
+{
+public:
+    BatchPairingCommand(CredentialIssuerCommands * credIssuerCommands) : CHIPCommand("code-batch", credIssuerCommands)
+    {
+        AddArgument("node-id", 0, UINT64_MAX, &mNodeId,
+                    "The node id of the first device, the next ones get the following node ids.");
+        AddArgument("payloads", &mOnboardingPayloads, "Comma-separated list of setup codes (QR codes or manual pairing codes).");
+        AddArgument("lanes", 1, UINT16_MAX, &mLanes,
+                    "Number of devices to commission in parallel, each one with its own commissioner. Defaults to 4.");
+        AddArgument("ssid", &mSSID, "Wi-Fi network to configure on the devices.");
+        AddArgument("password", &mPassword, "Password of the Wi-Fi network.");
+        AddArgument("operational-dataset", &mOperationalDataset, "Thread network to configure on the devices.");
+        AddArgument("bypass-attestation-verifier", 0, 1, &mBypassAttestationVerifier,
+                    "Bypass the attestation verifier. If not provided or false, the attestation verifier is not bypassed."
+                    " If true, the commissioning will continue in case of attestation verification failure.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeout, "Time allowed for the whole batch, in seconds. Defaults to 600.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(mTimeout.ValueOr(600)); }
+    void Shutdown() override;
+
+    /////////// CommissioningPipeline::Delegate Interface /////////
+    void OnDeviceCommissioned(chip::NodeId nodeId, CHIP_ERROR error) override;
+    void OnBatchComplete(size_t succeeded, size_t failed) override;
+
+    /////////// DeviceAttestationDelegate Interface /////////
+    chip::Optional<uint16_t> FailSafeExpiryTimeoutSecs() const override { return chip::NullOptional; }
+    void OnDeviceAttestationCompleted(chip::Controller::DeviceCommissioner * deviceCommissioner, chip::DeviceProxy * device,
+                                      const chip::Credentials::DeviceAttestationVerifier::AttestationDeviceInfo & info,
+                                      chip::Credentials::AttestationVerificationResult attestationResult) override;
+
+private:
+    chip::NodeId mNodeId;
+    std::vector<std::string> mOnboardingPayloads;
+    chip::Optional<uint16_t> mLanes;
+    chip::Optional<chip::ByteSpan> mSSID;
+    chip::Optional<chip::ByteSpan> mPassword;
+    chip::Optional<chip::ByteSpan> mOperationalDataset;
+    chip::Optional<bool> mBypassAttestationVerifier;
+    chip::Optional<uint16_t> mTimeout;
+
+    std::unique_ptr<chip::Controller::CommissioningPipeline> mPipeline;
+};
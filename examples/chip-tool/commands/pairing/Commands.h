@@ -19,6 +19,7 @@
 #pragma once
 
 #include "commands/common/Commands.h"
+#include "commands/pairing/BatchPairingCommand.h"
 #include "commands/pairing/GetCommissionerNodeIdCommand.h"
 #include "commands/pairing/GetCommissionerRootCertificateCommand.h"
 #include "commands/pairing/IssueNOCChainCommand.h"
@@ -255,6 +256,7 @@ void registerCommandsPairing(Commands & commands, CredentialIssuerCommands * cre
         make_unique<Unpair>(credsIssuerConfig),
         make_unique<PairCode>(credsIssuerConfig),
         make_unique<PairCodePase>(credsIssuerConfig),
+        make_unique<BatchPairingCommand>(credsIssuerConfig),
         make_unique<PairCodeWifi>(credsIssuerConfig),
         make_unique<PairCodeThread>(credsIssuerConfig),
         make_unique<PairCodeWiFiThread>(credsIssuerConfig),
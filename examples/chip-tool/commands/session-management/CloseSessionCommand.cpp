@@ -103,3 +103,23 @@ CHIP_ERROR EvictLocalCASESessionsCommand::RunCommand()
     SetCommandExitStatus(CHIP_NO_ERROR);
     return CHIP_NO_ERROR;
 }
+
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+CHIP_ERROR AddWarmPeerCommand::RunCommand()
+{
+    auto & controller = CurrentCommissioner();
+    ReturnErrorOnFailure(controller.CASESessionMgr()->AddWarmPeer(ScopedNodeId(mDestinationNodeId, controller.GetFabricIndex())));
+
+    SetCommandExitStatus(CHIP_NO_ERROR);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RemoveWarmPeerCommand::RunCommand()
+{
+    auto & controller = CurrentCommissioner();
+    controller.CASESessionMgr()->RemoveWarmPeer(ScopedNodeId(mDestinationNodeId, controller.GetFabricIndex()));
+
+    SetCommandExitStatus(CHIP_NO_ERROR);
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
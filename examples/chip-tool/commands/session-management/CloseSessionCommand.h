@@ -92,3 +92,36 @@ public:
         return chip::System::Clock::Seconds16(5);
     }
 };
+
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+class AddWarmPeerCommand : public detail::SessionManagementCommand
+{
+public:
+    AddWarmPeerCommand(CredentialIssuerCommands * credIssuerCommands) :
+        detail::SessionManagementCommand("add-warm-peer", credIssuerCommands,
+                                         "Keeps a CASE session with the given node id established ahead of use. "
+                                         "Only useful in interactive mode.")
+    {}
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override
+    {
+        // Sessions are established in the background, this command only registers the peer.
+        return chip::System::Clock::Seconds16(5);
+    }
+};
+
+class RemoveWarmPeerCommand : public detail::SessionManagementCommand
+{
+public:
+    RemoveWarmPeerCommand(CredentialIssuerCommands * credIssuerCommands) :
+        detail::SessionManagementCommand("remove-warm-peer", credIssuerCommands,
+                                         "Stops keeping a CASE session with the given node id established.")
+    {}
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(5); }
+};
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
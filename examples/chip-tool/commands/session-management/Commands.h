@@ -28,6 +28,10 @@ void registerCommandsSessionManagement(Commands & commands, CredentialIssuerComm
     commands_list clusterCommands = {
         make_unique<SendCloseSessionCommand>(credsIssuerConfig),
         make_unique<EvictLocalCASESessionsCommand>(credsIssuerConfig),
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+        make_unique<AddWarmPeerCommand>(credsIssuerConfig),
+        make_unique<RemoveWarmPeerCommand>(credsIssuerConfig),
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
     };
 
     commands.RegisterCommandSet(clusterName, clusterCommands, "Commands for managing CASE and PASE session state.");
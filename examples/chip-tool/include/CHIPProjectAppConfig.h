@@ -27,6 +27,9 @@
 
 #define CHIP_CONFIG_EVENT_LOGGING_NUM_EXTERNAL_CALLBACKS 2
 
+// Allow keeping CASE sessions with frequently used nodes established ahead of use.
+#define CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE 16
+
 // Uncomment this for a large Tunnel MTU.
 // #define CHIP_CONFIG_TUNNEL_INTERFACE_MTU                           (9000)
 
@@ -19,6 +19,7 @@
 #include "commands/common/Commands.h"
 #include "commands/example/ExampleCredentialIssuerCommands.h"
 
+#include "commands/benchmark/Commands.h"
 #include "commands/clusters/SubscriptionsCommands.h"
 #include "commands/dcl/Commands.h"
 #include "commands/delay/Commands.h"
@@ -40,6 +41,7 @@ int main(int argc, char * argv[])
 {
     ExampleCredentialIssuerCommands credIssuerCommands;
     Commands commands;
+    registerCommandsBenchmark(commands, &credIssuerCommands);
     registerCommandsDCL(commands);
     registerCommandsDelay(commands, &credIssuerCommands);
     registerCommandsDiscover(commands, &credIssuerCommands);
@@ -21,6 +21,8 @@
 namespace chip {
 namespace app {
 
+class ListEncodeCache;
+
 /// Maintains the internal state of list encoding
 ///
 /// List encoding is generally assumed incremental and chunkable (i.e.
@@ -31,6 +33,9 @@ namespace app {
 ///   - CurrentEncodingListIndex representing the list index that is next
 ///     to be encoded in the output. kInvalidListIndex means that a new list
 ///     encoding has been started.
+///
+/// It may also carry an OPTIONAL ListEncodeCache, owned by the caller, that
+/// list encoding uses to avoid re-encoding a list for each of its chunks.
 class AttributeEncodeState
 {
 public:
@@ -68,6 +73,15 @@ public:
         return *this;
     }
 
+    ListEncodeCache * GetListEncodeCache() const { return mListEncodeCache; }
+
+    AttributeEncodeState & SetListEncodeCache(ListEncodeCache * cache)
+    {
+        mListEncodeCache = cache;
+        return *this;
+    }
+
+    /// Resets the encoding progress. The list encode cache, if any, is kept.
     void Reset()
     {
         mCurrentEncodingListIndex = kInvalidListIndex;
@@ -97,6 +111,11 @@ private:
      * TODO: There might be a better name for this variable.
      */
     bool mAllowPartialData = false;
+
+    /**
+     * Cache of pre-encoded list items, owned by the ReadHandler. nullptr if list items are not cached.
+     */
+    ListEncodeCache * mListEncodeCache = nullptr;
 };
 
 } // namespace app
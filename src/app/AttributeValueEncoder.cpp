@@ -26,6 +26,11 @@ constexpr uint32_t kEndOfListByteCount = 1;
 constexpr uint32_t kEndOfAttributeReportIBByteCount = 2;
 constexpr TLV::TLVType kAttributeDataIBType         = TLV::kTLVType_Structure;
 
+bool IsOutOfSpaceError(CHIP_ERROR err)
+{
+    return (err == CHIP_ERROR_NO_MEMORY) || (err == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 } // anonymous namespace
 
 CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
@@ -69,6 +74,7 @@ CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
     }
 
     mCurrentEncodingListIndex = 0;
+    mListEncodeCache          = mEncodeState.GetListEncodeCache();
 
     // After encoding the initial list start, the remaining items are atomically encoded into the buffer. Tell report engine to not
     // revert partial data.
@@ -138,5 +144,107 @@ void AttributeValueEncoder::PostEncodeListItem(CHIP_ERROR aEncodeStatus, const T
     mEncodedAtLeastOneListItem = true;
 }
 
+bool AttributeValueEncoder::StartFillingListCache(CHIP_ERROR aEncodeStatus)
+{
+    VerifyOrReturnValue(mListEncodeCache != nullptr && IsOutOfSpaceError(aEncodeStatus), false);
+    // If not even the first item of the initial list fits, the whole attribute is moved to the next chunk, where the list starts
+    // over.
+    VerifyOrReturnValue(!mEncodingInitialList || mEncodedAtLeastOneListItem, false);
+
+    // Cache the items that do not fit in this chunk, so that the next chunks do not have to re-encode the list. Keep the generator
+    // going, and report the error once it is done.
+    mListEncodeCache->StartFilling(mPath, mDataVersion, mIsFabricFiltered, mCurrentEncodingListIndex);
+    mFillingListCache  = true;
+    mDeferredListError = aEncodeStatus;
+    return true;
+}
+
+CHIP_ERROR AttributeValueEncoder::PostCacheListItem(CHIP_ERROR aCacheStatus, TLV::TLVWriter & aCacheWriter)
+{
+    if (aCacheStatus == CHIP_NO_ERROR)
+    {
+        aCacheStatus = mListEncodeCache->CommitItem(aCacheWriter);
+    }
+    VerifyOrReturnError(aCacheStatus != CHIP_NO_ERROR, CHIP_NO_ERROR);
+
+    mFillingListCache = false;
+    if (!IsOutOfSpaceError(aCacheStatus) || mListEncodeCache->ItemCount() == 0)
+    {
+        // Not even a single item can be cached: the next chunks will re-encode the list as usual.
+        mListEncodeCache->Reset();
+    }
+
+    // Otherwise the cache is full: stop the generator, the next chunks send the cached items and then fill the cache again from
+    // the first item that did not make it in.
+    return mDeferredListError;
+}
+
+CHIP_ERROR AttributeValueEncoder::EncodeListFromCache(bool & aListDone)
+{
+    aListDone = false;
+    VerifyOrReturnError(!mEncodingInitialList && mListEncodeCache != nullptr &&
+                            mListEncodeCache->CanResume(mPath, mDataVersion, mIsFabricFiltered,
+                                                        mEncodeState.CurrentEncodingListIndex()),
+                        CHIP_NO_ERROR);
+
+    mCurrentEncodingListIndex = mEncodeState.CurrentEncodingListIndex();
+
+    while (mCurrentEncodingListIndex < mListEncodeCache->EndItem())
+    {
+        TLV::TLVReader reader;
+        ReturnErrorOnFailure(mListEncodeCache->GetItem(mCurrentEncodingListIndex, reader));
+
+        TLV::TLVWriter checkpoint;
+        mAttributeReportIBsBuilder.Checkpoint(checkpoint);
+
+        AttributeReportBuilder builder;
+        CHIP_ERROR err = builder.PrepareAttribute(mAttributeReportIBsBuilder, mPath, mDataVersion);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = mAttributeReportIBsBuilder.GetAttributeReport().GetAttributeData().GetWriter()->CopyElement(
+                TLV::ContextTag(AttributeDataIB::Tag::kData), reader);
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = builder.FinishAttribute(mAttributeReportIBsBuilder);
+        }
+
+        PostEncodeListItem(err, checkpoint);
+        ReturnErrorOnFailure(err);
+    }
+
+    aListDone = mListEncodeCache->IsComplete();
+    if (aListDone)
+    {
+        // The whole list has been sent.
+        mListEncodeCache->Reset();
+    }
+    else
+    {
+        // The generator skips the items sent so far, and fills the cache again.
+        mCurrentEncodingListIndex = 0;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AttributeValueEncoder::FinishFillingListCache(CHIP_ERROR aStatus)
+{
+    if (mFillingListCache)
+    {
+        mFillingListCache = false;
+        if (aStatus != CHIP_NO_ERROR)
+        {
+            // The generator failed: there is nothing to resume from.
+            mListEncodeCache->Reset();
+            return aStatus;
+        }
+
+        // The generator reached the end of the list without filling the cache.
+        mListEncodeCache->MarkComplete();
+    }
+
+    return (aStatus == CHIP_NO_ERROR) ? mDeferredListError : aStatus;
+}
+
 } // namespace app
 } // namespace chip
@@ -20,7 +20,9 @@
 #include <app/AttributeEncodeState.h>
 #include <app/AttributeReportBuilder.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/ListEncodeCache.h>
 #include <app/MessageDef/AttributeReportIBs.h>
+#include <app/data-model/Encode.h>
 #include <app/data-model/FabricScoped.h>
 #include <app/data-model/List.h>
 #include <lib/support/BitFlags.h>
@@ -38,6 +40,9 @@ namespace app {
  *
  * When Encode returns recoverable errors (e.g. CHIP_ERROR_NO_MEMORY) the state can be used to initialize the AttributeValueEncoder
  * for future use on the same attribute path.
+ *
+ * If the state carries a ListEncodeCache, the items of a list that do not fit are encoded into the cache, until it is full, and the
+ * following encode sessions of that list copy the items from the cache without calling the list generator until they run out.
  */
 class AttributeValueEncoder
 {
@@ -191,7 +196,12 @@ public:
         // An empty list is encoded iff both mCurrentEncodingListIndex and mEncodeState.mCurrentEncodingListIndex are invalid
         // values. After encoding the empty list, mEncodeState.mCurrentEncodingListIndex and mCurrentEncodingListIndex are set to 0.
         ReturnErrorOnFailure(EnsureListStarted());
-        CHIP_ERROR err = aCallback(ListEncodeHelper(*this));
+        bool listDone  = false;
+        CHIP_ERROR err = EncodeListFromCache(listDone);
+        if (err == CHIP_NO_ERROR && !listDone)
+        {
+            err = FinishFillingListCache(aCallback(ListEncodeHelper(*this)));
+        }
 
         // Even if encoding list items failed, make sure we EnsureListEnded().
         // Since we encode list items atomically, in the case when we just
@@ -240,28 +250,70 @@ private:
     template <typename ItemType, typename... ExtraArgTypes>
     CHIP_ERROR EncodeListItem(TLV::TLVWriter & aCheckpoint, const ItemType & aItem, ExtraArgTypes &&... aExtraArgs)
     {
-        if (!ShouldEncodeListItem(aCheckpoint))
+        // Once an item did not fit, the following items are only encoded into the list encode cache.
+        if (mDeferredListError == CHIP_NO_ERROR)
         {
-            return CHIP_NO_ERROR;
+            if (!ShouldEncodeListItem(aCheckpoint))
+            {
+                return CHIP_NO_ERROR;
+            }
+
+            CHIP_ERROR err;
+            if (mEncodingInitialList)
+            {
+                // Just encode a single item, with an anonymous tag.
+                AttributeReportBuilder builder;
+                err = builder.EncodeValue(mAttributeReportIBsBuilder, TLV::AnonymousTag(), aItem, aExtraArgs...);
+            }
+            else
+            {
+                err = EncodeAttributeReportIB(aItem, aExtraArgs...);
+            }
+
+            PostEncodeListItem(err, aCheckpoint);
+            if (!StartFillingListCache(err))
+            {
+                return err;
+            }
         }
 
-        CHIP_ERROR err;
-        if (mEncodingInitialList)
-        {
-            // Just encode a single item, with an anonymous tag.
-            AttributeReportBuilder builder;
-            err = builder.EncodeValue(mAttributeReportIBsBuilder, TLV::AnonymousTag(), aItem,
-                                      std::forward<ExtraArgTypes>(aExtraArgs)...);
-        }
-        else
-        {
-            err = EncodeAttributeReportIB(aItem, std::forward<ExtraArgTypes>(aExtraArgs)...);
-        }
+        VerifyOrReturnError(mFillingListCache, mDeferredListError);
 
-        PostEncodeListItem(err, aCheckpoint);
-        return err;
+        TLV::TLVWriter cacheWriter;
+        mListEncodeCache->PrepareItem(cacheWriter);
+        CHIP_ERROR cacheErr = EncodeCachedListItem(cacheWriter, aItem, std::forward<ExtraArgTypes>(aExtraArgs)...);
+        return PostCacheListItem(cacheErr, cacheWriter);
+    }
+
+    template <typename ItemType, std::enable_if_t<!DataModel::IsFabricScoped<ItemType>::value, bool> = true>
+    static CHIP_ERROR EncodeCachedListItem(TLV::TLVWriter & aWriter, const ItemType & aItem)
+    {
+        return DataModel::Encode(aWriter, TLV::AnonymousTag(), aItem);
+    }
+
+    template <typename ItemType, std::enable_if_t<DataModel::IsFabricScoped<ItemType>::value, bool> = true>
+    static CHIP_ERROR EncodeCachedListItem(TLV::TLVWriter & aWriter, const ItemType & aItem, FabricIndex aAccessingFabricIndex)
+    {
+        return DataModel::EncodeForRead(aWriter, TLV::AnonymousTag(), aAccessingFabricIndex, aItem);
     }
 
+    // Called with the status of the item that did not fit in this chunk: starts caching the following items, from that one on,
+    // into the list encode cache. Returns false if the items are not to be cached.
+    bool StartFillingListCache(CHIP_ERROR aEncodeStatus);
+
+    // Records the item just encoded into the list encode cache, and returns
+    // the status the list generator should see for this item.
+    CHIP_ERROR PostCacheListItem(CHIP_ERROR aCacheStatus, TLV::TLVWriter & aCacheWriter);
+
+    // Copies the items left to encode in this chunk from the list encode
+    // cache, if it holds them. aListDone is set to true if the last item of
+    // the list was sent, so the list generator does not need to be called.
+    CHIP_ERROR EncodeListFromCache(bool & aListDone);
+
+    // Completes or drops the list encode cache being filled once the list
+    // generator returned aStatus, and returns the status of the encode session.
+    CHIP_ERROR FinishFillingListCache(CHIP_ERROR aStatus);
+
     /**
      * Builds a single AttributeReportIB in AttributeReportIBs.  The caller is
      * responsible for setting up mPath correctly.
@@ -316,6 +368,11 @@ private:
     bool mEncodedAtLeastOneListItem     = false;
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
     AttributeEncodeState mEncodeState;
+    // mFillingListCache is true while the items that did not fit in this chunk are encoded into mListEncodeCache.
+    bool mFillingListCache             = false;
+    ListEncodeCache * mListEncodeCache = nullptr;
+    // Out of space error of the first item that did not fit in this chunk; returned once the generator is done.
+    CHIP_ERROR mDeferredListError = CHIP_NO_ERROR;
 };
 
 } // namespace app
@@ -36,11 +36,18 @@ void BufferedReadCallback::OnReportBegin()
 
 void BufferedReadCallback::OnReportEnd()
 {
-    CHIP_ERROR err = DispatchBufferedData(mBufferedPath, StatusIB(), true);
-    if (err != CHIP_NO_ERROR)
+    if (mpListItemCallback != nullptr)
     {
-        mCallback.OnError(err);
-        return;
+        EndStreamedList(StatusIB());
+    }
+    else
+    {
+        CHIP_ERROR err = DispatchBufferedData(mBufferedPath, StatusIB(), true);
+        if (err != CHIP_NO_ERROR)
+        {
+            mCallback.OnError(err);
+            return;
+        }
     }
 
     mCallback.OnReportEnd();
@@ -227,11 +234,92 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BufferedReadCallback::StreamData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                            const StatusIB & aStatus)
+{
+    const bool isListData = aPath.IsListOperation() && aStatus.IsSuccess();
+
+    //
+    // Only items appended to the list being streamed continue it. A status for that list means it could not
+    // be received completely, anything else means it is complete.
+    //
+    if (mStreamingList &&
+        !(isListData && aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem &&
+          aPath.MatchesConcreteAttributePath(mBufferedPath)))
+    {
+        EndStreamedList(aPath.MatchesConcreteAttributePath(mBufferedPath) ? aStatus : StatusIB());
+    }
+
+    if (!isListData)
+    {
+        mCallback.OnAttributeData(aPath, apData, aStatus);
+        return CHIP_NO_ERROR;
+    }
+
+    if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll)
+    {
+        TLV::TLVType outerContainer;
+
+        VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        mBufferedPath = aPath;
+        ReturnErrorOnFailure(mpListItemCallback->OnListBegin(mBufferedPath));
+        mStreamingList = true;
+
+        ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
+
+        CHIP_ERROR err;
+
+        while ((err = apData->Next()) == CHIP_NO_ERROR)
+        {
+            // The callback gets its own reader, so that it cannot move ours.
+            TLV::TLVReader itemReader;
+            itemReader.Init(*apData);
+            ReturnErrorOnFailure(mpListItemCallback->OnListItem(mBufferedPath, &itemReader));
+        }
+
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+
+        ReturnErrorOnFailure(err);
+        return apData->ExitContainer(outerContainer);
+    }
+
+    //
+    // Items appended to a list that is not being streamed belong to a list whose start was not delivered
+    // (e.g. it failed to be streamed): they cannot be delivered on their own.
+    //
+    VerifyOrReturnError(mStreamingList, CHIP_NO_ERROR);
+    return mpListItemCallback->OnListItem(mBufferedPath, apData);
+}
+
+void BufferedReadCallback::EndStreamedList(const StatusIB & aStatus)
+{
+    VerifyOrReturn(mStreamingList);
+
+    mStreamingList = false;
+    mpListItemCallback->OnListEnd(mBufferedPath, aStatus);
+    mBufferedPath = ConcreteDataAttributePath();
+}
+
 void BufferedReadCallback::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                            const StatusIB & aStatus)
 {
     CHIP_ERROR err;
 
+    if (mpListItemCallback != nullptr)
+    {
+        err = StreamData(aPath, apData, aStatus);
+        if (err != CHIP_NO_ERROR)
+        {
+            EndStreamedList(StatusIB(err));
+            mCallback.OnError(err);
+        }
+        return;
+    }
+
     //
     // First, let's dispatch to our registered callback any buffered up list data from previous calls.
     //
@@ -36,12 +36,56 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * In streaming mode, list attributes are instead delivered item by item to a ListItemCallback as the chunks
+ * arrive, straight from the received messages: nothing is buffered, whatever the size of the list.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
+    /*
+     * Receives the list attributes in streaming mode. Non-list attribute data and all attribute statuses,
+     * including the ones of list attributes, are still delivered to Callback::OnAttributeData.
+     *
+     * The items of a list are delivered between OnListBegin and OnListEnd, in order, and no other attribute
+     * data is delivered in between.
+     */
+    class ListItemCallback
+    {
+    public:
+        virtual ~ListItemCallback() = default;
+
+        /*
+         * A new value of the list attribute at aPath starts. aPath has a ReplaceAll list operation and the
+         * data version of the list.
+         *
+         * Returning an error stops the delivery of the list and is reported through Callback::OnError.
+         */
+        virtual CHIP_ERROR OnListBegin(const ConcreteDataAttributePath & aPath) = 0;
+
+        /*
+         * Next item of the list. apData is positioned on the item and is only valid for the duration of the call.
+         *
+         * Returning an error stops the delivery of the list and is reported through Callback::OnError.
+         */
+        virtual CHIP_ERROR OnListItem(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData) = 0;
+
+        /*
+         * The list started by OnListBegin is over. If aStatus is not a success, the list was not received
+         * completely and the items delivered since OnListBegin must be discarded.
+         */
+        virtual void OnListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus) = 0;
+    };
+
     BufferedReadCallback(Callback & callback) : mCallback(callback) {}
 
+    /*
+     * Creates a BufferedReadCallback in streaming mode, delivering list attributes to listItemCallback.
+     */
+    BufferedReadCallback(Callback & callback, ListItemCallback & listItemCallback) :
+        mCallback(callback), mpListItemCallback(&listItemCallback)
+    {}
+
 private:
     /*
      * Generates the reconsistuted TLV array from the stored individual list elements
@@ -65,6 +109,17 @@ private:
      */
     CHIP_ERROR BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apReader);
 
+    /*
+     * Streaming mode counterpart of DispatchBufferedData and BufferData: ends the list being streamed unless
+     * aPath appends to it, then delivers aPath to the ListItemCallback if it is list data, or to the Callback otherwise.
+     */
+    CHIP_ERROR StreamData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus);
+
+    /*
+     * Ends the list being streamed, if any, with the given status.
+     */
+    void EndStreamedList(const StatusIB & aStatus);
+
     //
     // ReadClient::Callback
     //
@@ -74,6 +129,7 @@ private:
     void OnError(CHIP_ERROR aError) override
     {
         mBufferedList.clear();
+        EndStreamedList(StatusIB(aError));
         return mCallback.OnError(aError);
     }
 
@@ -131,6 +187,10 @@ private:
     ConcreteDataAttributePath mBufferedPath;
     std::vector<System::PacketBufferHandle> mBufferedList;
     Callback & mCallback;
+    ListItemCallback * mpListItemCallback = nullptr;
+
+    // In streaming mode, whether the list at mBufferedPath has been started with OnListBegin and not ended yet.
+    bool mStreamingList = false;
 };
 
 } // namespace app
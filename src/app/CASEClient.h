@@ -31,6 +31,7 @@ struct CASEClientInitParams
     SessionManager * sessionManager                                    = nullptr;
     SessionResumptionStorage * sessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * certificateValidityPolicy = nullptr;
+    Credentials::VerifiedCertificateCache * verifiedCertificateCache   = nullptr;
     Messaging::ExchangeManager * exchangeMgr                           = nullptr;
     FabricTable * fabricTable                                          = nullptr;
     Credentials::GroupDataProvider * groupDataProvider                 = nullptr;
@@ -43,7 +44,7 @@ struct CASEClientInitParams
     CHIP_ERROR Validate() const
     {
         // sessionResumptionStorage can be nullptr when resumption is disabled.
-        // certificateValidityPolicy is optional, too.
+        // certificateValidityPolicy and verifiedCertificateCache are optional, too.
         VerifyOrReturnError(sessionManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
         VerifyOrReturnError(exchangeMgr != nullptr, CHIP_ERROR_INCORRECT_STATE);
         VerifyOrReturnError(fabricTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
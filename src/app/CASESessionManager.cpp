@@ -24,13 +24,22 @@ namespace chip {
 CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CASESessionManagerConfig & params)
 {
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
-    mConfig = params;
+    mConfig      = params;
+    mSystemLayer = systemLayer;
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
     return AddressResolve::Resolver::Instance().Init(systemLayer);
 }
 
 void CASESessionManager::Shutdown()
 {
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+    mWarmPeers.ReleaseAll();
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleWarmPoolRefresh, this);
+    }
+    mWarmPoolRefreshPending = false;
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
@@ -144,6 +153,15 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
 
 void CASESessionManager::ReleaseSessionsForFabric(FabricIndex fabricIndex)
 {
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+    mWarmPeers.ForEachActiveObject([&](WarmPeer * peer) {
+        if (peer->GetPeerId().GetFabricIndex() == fabricIndex)
+        {
+            mWarmPeers.ReleaseObject(peer);
+        }
+        return Loop::Continue;
+    });
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
     mConfig.sessionSetupPool->ReleaseAllSessionSetupsForFabric(fabricIndex);
 }
 
@@ -213,4 +231,183 @@ void CASESessionManager::ReleaseSession(OperationalSessionSetup * session)
     }
 }
 
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+CHIP_ERROR CASESessionManager::AddWarmPeer(const ScopedNodeId & peerId)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(peerId.GetFabricIndex() != kUndefinedFabricIndex, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(FindWarmPeer(peerId) == nullptr, CHIP_NO_ERROR);
+    VerifyOrReturnError(mWarmPeers.CreateObject(*this, peerId) != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ChipLogProgress(CASESessionManager, "Added peer [%d:" ChipLogFormatX64 "] to the warm pool", peerId.GetFabricIndex(),
+                    ChipLogValueX64(peerId.GetNodeId()));
+    ScheduleWarmPoolRefresh();
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionManager::RemoveWarmPeer(const ScopedNodeId & peerId)
+{
+    WarmPeer * peer = FindWarmPeer(peerId);
+    VerifyOrReturn(peer != nullptr);
+    mWarmPeers.ReleaseObject(peer);
+
+    // The peer may have been holding one of the handshake slots.
+    ScheduleWarmPoolRefresh();
+}
+
+bool CASESessionManager::IsWarmPeer(const ScopedNodeId & peerId)
+{
+    return FindWarmPeer(peerId) != nullptr;
+}
+
+CASESessionManager::WarmPeer * CASESessionManager::FindWarmPeer(const ScopedNodeId & peerId)
+{
+    WarmPeer * found = nullptr;
+    mWarmPeers.ForEachActiveObject([&](WarmPeer * peer) {
+        if (peer->GetPeerId() == peerId)
+        {
+            found = peer;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+void CASESessionManager::ScheduleWarmPoolRefresh()
+{
+    // Always refresh from a fresh stack: connection callbacks may be called from within FindOrEstablishSession. A timer is
+    // used rather than ScheduleWork() so that Shutdown() can cancel it on every platform.
+    if (mSystemLayer != nullptr)
+    {
+        mWarmPoolRefreshPending = true;
+        LogErrorOnFailure(mSystemLayer->StartTimer(System::Clock::kZero, HandleWarmPoolRefresh, this));
+    }
+}
+
+void CASESessionManager::HandleWarmPoolRefresh(System::Layer * systemLayer, void * appState)
+{
+    static_cast<CASESessionManager *>(appState)->RefreshWarmPool();
+}
+
+void CASESessionManager::RefreshWarmPool()
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    mWarmPoolRefreshPending            = false;
+
+    size_t handshakes = 0;
+    mWarmPeers.ForEachActiveObject([&](WarmPeer * peer) {
+        handshakes += peer->IsConnecting() ? 1 : 0;
+        return Loop::Continue;
+    });
+
+    Optional<System::Clock::Timestamp> nextAttemptTime;
+    mWarmPeers.ForEachActiveObject([&](WarmPeer * peer) {
+        if (peer->IsConnecting() || peer->HasSession())
+        {
+            return Loop::Continue;
+        }
+
+        if (peer->GetNextAttemptTime() > now)
+        {
+            if (!nextAttemptTime.HasValue() || peer->GetNextAttemptTime() < nextAttemptTime.Value())
+            {
+                nextAttemptTime.SetValue(peer->GetNextAttemptTime());
+            }
+            return Loop::Continue;
+        }
+
+        // Peers left out here are picked up by the refresh that follows the end of a handshake.
+        if (handshakes < CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES)
+        {
+            handshakes++;
+            peer->Connect();
+        }
+        return Loop::Continue;
+    });
+
+    // Starting the retry timer would replace a refresh requested by a peer that connected synchronously; that refresh
+    // schedules the retry timer again anyway.
+    if (nextAttemptTime.HasValue() && !mWarmPoolRefreshPending)
+    {
+        auto delay = std::chrono::duration_cast<System::Clock::Timeout>(nextAttemptTime.Value() - now);
+        LogErrorOnFailure(mSystemLayer->StartTimer(delay, HandleWarmPoolRefresh, this));
+    }
+}
+
+CASESessionManager::WarmPeer::WarmPeer(CASESessionManager & manager, const ScopedNodeId & peerId) :
+    mManager(manager), mPeerId(peerId), mSession(*this), mOnConnectedCallback(HandleConnected, this),
+    mOnConnectionFailureCallback(HandleConnectionFailure, this)
+{}
+
+CASESessionManager::WarmPeer::~WarmPeer()
+{
+    mOnConnectedCallback.Cancel();
+    mOnConnectionFailureCallback.Cancel();
+}
+
+void CASESessionManager::WarmPeer::Connect()
+{
+    // A session may have been established for another interaction in the meantime.
+    auto existingSession = mManager.FindExistingSession(mPeerId);
+    if (existingSession.HasValue())
+    {
+        GrabSession(existingSession.Value());
+        return;
+    }
+
+    ChipLogDetail(CASESessionManager, "Warm pool: establishing a session with peer [%d:" ChipLogFormatX64 "]",
+                  mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()));
+    mConnecting = true;
+    mManager.FindOrEstablishSession(mPeerId, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+}
+
+void CASESessionManager::WarmPeer::OnSessionReleased()
+{
+    ChipLogDetail(CASESessionManager, "Warm pool: session with peer [%d:" ChipLogFormatX64 "] released", mPeerId.GetFabricIndex(),
+                  ChipLogValueX64(mPeerId.GetNodeId()));
+
+    // A session released right after it was established, e.g. evicted from a full session table or dropped by the peer,
+    // is likely to be released again: wait as after a failed attempt rather than looping through handshakes.
+    if (System::SystemClock().GetMonotonicTimestamp() <
+        mSessionStartTime + System::Clock::Milliseconds32(CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS))
+    {
+        DelayNextAttempt();
+    }
+    mManager.ScheduleWarmPoolRefresh();
+}
+
+void CASESessionManager::WarmPeer::HandleConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                   const SessionHandle & sessionHandle)
+{
+    auto * peer       = static_cast<WarmPeer *>(context);
+    peer->mConnecting = false;
+    peer->GrabSession(sessionHandle);
+    peer->mManager.ScheduleWarmPoolRefresh();
+}
+
+void CASESessionManager::WarmPeer::HandleConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    auto * peer = static_cast<WarmPeer *>(context);
+    ChipLogError(CASESessionManager,
+                 "Warm pool: failed to establish a session with peer [%d:" ChipLogFormatX64 "]: %" CHIP_ERROR_FORMAT,
+                 peerId.GetFabricIndex(), ChipLogValueX64(peerId.GetNodeId()), error.Format());
+    peer->mConnecting = false;
+    peer->DelayNextAttempt();
+    peer->mManager.ScheduleWarmPoolRefresh();
+}
+
+void CASESessionManager::WarmPeer::GrabSession(const SessionHandle & sessionHandle)
+{
+    mSession.Grab(sessionHandle);
+    mSessionStartTime = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void CASESessionManager::WarmPeer::DelayNextAttempt()
+{
+    mNextAttemptTime = System::SystemClock().GetMonotonicTimestamp() +
+        System::Clock::Milliseconds32(CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS);
+}
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+
 } // namespace chip
@@ -52,6 +52,13 @@ public:
     CASESessionManager() = default;
     virtual ~CASESessionManager()
     {
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+        mWarmPeers.ReleaseAll();
+        if (mSystemLayer != nullptr)
+        {
+            mSystemLayer->CancelTimer(HandleWarmPoolRefresh, this);
+        }
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
         if (mConfig.sessionInitParams.Validate() == CHIP_NO_ERROR)
         {
             mConfig.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(nullptr);
@@ -183,6 +190,31 @@ public:
     CHIP_ERROR GetPeerAddress(const ScopedNodeId & peerId, Transport::PeerAddress & addr,
                               TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
 
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+    /**
+     * Add a peer to the warm pool.
+     *
+     * A CASE session with a warm peer is established right away, and established again, using session resumption
+     * when the peer still allows it, as soon as it goes away, so that interactions with the peer do not wait for
+     * address resolution and a handshake.
+     *
+     * The warm pool runs at most CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES handshakes at a time,
+     * and tries again CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS after a failed attempt.
+     *
+     * Warm peers are removed by ReleaseSessionsForFabric() for their fabric, and by Shutdown().
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE peers are already in the pool.
+     */
+    CHIP_ERROR AddWarmPeer(const ScopedNodeId & peerId);
+
+    /**
+     * Remove a peer from the warm pool. An established session with the peer is left alone.
+     */
+    void RemoveWarmPeer(const ScopedNodeId & peerId);
+
+    bool IsWarmPeer(const ScopedNodeId & peerId);
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+
     //////////// OperationalSessionReleaseDelegate Implementation ///////////////
     void ReleaseSession(OperationalSessionSetup * device) override;
 
@@ -204,7 +236,52 @@ private:
 #endif
                                       TransportPayloadCapability transportPayloadCapability);
 
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+    class WarmPeer : public SessionDelegate
+    {
+    public:
+        WarmPeer(CASESessionManager & manager, const ScopedNodeId & peerId);
+        ~WarmPeer() override;
+
+        const ScopedNodeId & GetPeerId() const { return mPeerId; }
+        bool IsConnecting() const { return mConnecting; }
+        bool HasSession() const { return static_cast<bool>(mSession); }
+        System::Clock::Timestamp GetNextAttemptTime() const { return mNextAttemptTime; }
+
+        void Connect();
+
+        //////////// SessionDelegate Implementation ///////////////
+        void OnSessionReleased() override;
+
+    private:
+        static void HandleConnected(void * context, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle);
+        static void HandleConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+
+        void GrabSession(const SessionHandle & sessionHandle);
+        void DelayNextAttempt();
+
+        CASESessionManager & mManager;
+        const ScopedNodeId mPeerId;
+        SessionHolderWithDelegate mSession;
+        Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
+        Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+        System::Clock::Timestamp mNextAttemptTime  = System::Clock::kZero;
+        System::Clock::Timestamp mSessionStartTime = System::Clock::kZero;
+        bool mConnecting                           = false;
+    };
+
+    WarmPeer * FindWarmPeer(const ScopedNodeId & peerId);
+    void ScheduleWarmPoolRefresh();
+    void RefreshWarmPool();
+
+    static void HandleWarmPoolRefresh(System::Layer * systemLayer, void * appState);
+
+    ObjectPool<WarmPeer, CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE> mWarmPeers;
+    bool mWarmPoolRefreshPending = false;
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+
     CASESessionManagerConfig mConfig;
+    System::Layer * mSystemLayer = nullptr;
 };
 
 } // namespace chip
@@ -24,7 +24,6 @@
 #include <app/StatusResponse.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/util/MatterCallbacks.h>
-#include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/TLVData.h>
 #include <lib/core/TLVUtilities.h>
@@ -477,10 +476,8 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
     CommandId commandId;
     GroupId groupId;
     FabricIndex fabric;
-
-    Credentials::GroupDataProvider::GroupEndpoint mapping;
-    Credentials::GroupDataProvider * groupDataProvider = Credentials::GetGroupDataProvider();
-    Credentials::GroupDataProvider::EndpointIterator * iterator;
+    EndpointId endpointId;
+    GroupEndpointCache::EndpointIterator iterator;
 
     err = aCommandElement.GetPath(&commandPath);
     VerifyOrReturnError(err == CHIP_NO_ERROR, Status::InvalidAction);
@@ -511,22 +508,17 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
     // No check for `CommandIsFabricScoped` unlike in `ProcessCommandDataIB()` since group commands
     // always have an accessing fabric, by definition.
 
-    // Find which endpoints can process the command, and dispatch to them.
-    iterator = groupDataProvider->IterateEndpoints(fabric);
-    VerifyOrReturnError(iterator != nullptr, Status::Failure);
+    // Find which endpoints of the group implement the cluster, and dispatch to them.
+    err = iterator.Init(mpCallback->GetGroupEndpointCache(), fabric, groupId, clusterId);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, Status::Failure);
 
-    while (iterator->Next(mapping))
+    while (iterator.Next(endpointId))
     {
-        if (groupId != mapping.group_id)
-        {
-            continue;
-        }
-
         ChipLogDetail(DataManagement,
-                      "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
-                      mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId));
+                      "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI, endpointId,
+                      ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId));
 
-        const ConcreteCommandPath concretePath(mapping.endpoint_id, clusterId, commandId);
+        const ConcreteCommandPath concretePath(endpointId, clusterId, commandId);
 
         {
             Access::SubjectDescriptor subjectDescriptor = GetSubjectDescriptor();
@@ -560,11 +552,10 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
             ChipLogError(DataManagement,
                          "Error when calling PreCommandReceived for Endpoint=%u Cluster=" ChipLogFormatMEI
                          " Command=" ChipLogFormatMEI " : %" CHIP_ERROR_FORMAT,
-                         mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId), err.Format());
+                         endpointId, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId), err.Format());
             continue;
         }
     }
-    iterator->Release();
     return Status::Success;
 }
 
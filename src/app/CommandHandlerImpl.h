@@ -21,6 +21,7 @@
 #include <app/CommandHandlerExchangeInterface.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/CommandPathRegistry.h>
+#include <app/GroupEndpointCache.h>
 #include <app/MessageDef/InvokeRequestMessage.h>
 #include <app/MessageDef/InvokeResponseMessage.h>
 #include <app/data-model-provider/OperationTypes.h>
@@ -76,6 +77,12 @@ public:
          */
         virtual void DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                      TLV::TLVReader & apPayload) = 0;
+
+        /*
+         * Cache used to find the endpoints a group command is dispatched to. When null, the
+         * endpoints are read from the group table for every group command.
+         */
+        virtual GroupEndpointCache * GetGroupEndpointCache() { return nullptr; }
     };
 
     struct InvokeResponseParameters
@@ -138,6 +138,12 @@ Protocols::InteractionModel::Status CommandResponseSender::ValidateCommandCanBeD
     return mpCommandHandlerCallback->ValidateCommandCanBeDispatched(request);
 }
 
+GroupEndpointCache * CommandResponseSender::GetGroupEndpointCache()
+{
+    VerifyOrReturnValue(mpCommandHandlerCallback, nullptr);
+    return mpCommandHandlerCallback->GetGroupEndpointCache();
+}
+
 CHIP_ERROR CommandResponseSender::SendCommandResponse()
 {
     VerifyOrReturnError(HasMoreToSend(), CHIP_ERROR_INCORRECT_STATE);
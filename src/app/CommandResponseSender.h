@@ -66,6 +66,8 @@ public:
 
     Protocols::InteractionModel::Status ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request) override;
 
+    GroupEndpointCache * GetGroupEndpointCache() override;
+
     /**
      * Gets the inner exchange context object, without ownership.
      *
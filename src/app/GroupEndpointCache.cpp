@@ -0,0 +1,209 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/GroupEndpointCache.h>
+
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataLookup.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+using Credentials::GroupDataProvider;
+
+void GroupEndpointCache::Invalidate()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mGroupDataProvider = nullptr;
+}
+
+CHIP_ERROR GroupEndpointCache::GetEntry(GroupDataProvider & groups, FabricIndex fabricIndex, GroupId groupId, Entry *& entry)
+{
+    entry = nullptr;
+
+    // Without a generation, changes to the group table cannot be noticed: always use the group table.
+    VerifyOrReturnError(groups.SupportsEndpointMappingGeneration(), CHIP_NO_ERROR);
+
+    if (mGroupDataProvider != &groups || mEndpointMappingGeneration != groups.GetEndpointMappingGeneration())
+    {
+        Invalidate();
+        mGroupDataProvider         = &groups;
+        mEndpointMappingGeneration = groups.GetEndpointMappingGeneration();
+    }
+
+    Entry * victim = &mEntries[0];
+    for (auto & candidate : mEntries)
+    {
+        if (candidate.fabricIndex == fabricIndex && candidate.groupId == groupId)
+        {
+            candidate.lastUsed = ++mUseCounter;
+            entry              = &candidate;
+            return CHIP_NO_ERROR;
+        }
+        if (candidate.lastUsed < victim->lastUsed)
+        {
+            victim = &candidate;
+        }
+    }
+
+    GroupDataProvider::EndpointIterator * iterator = groups.IterateEndpoints(fabricIndex, std::make_optional(groupId));
+    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    EndpointId endpoints[kMaxEndpointsPerGroup];
+    size_t endpointCount = 0;
+    bool overflow        = false;
+
+    GroupDataProvider::GroupEndpoint mapping;
+    while (iterator->Next(mapping))
+    {
+        if (endpointCount == kMaxEndpointsPerGroup)
+        {
+            overflow = true;
+            break;
+        }
+        endpoints[endpointCount++] = mapping.endpoint_id;
+    }
+    iterator->Release();
+
+    // Groups that do not fit are left to the group table, so that they do not evict the ones that do.
+    VerifyOrReturnError(!overflow, CHIP_NO_ERROR);
+
+    *victim               = Entry();
+    victim->fabricIndex   = fabricIndex;
+    victim->groupId       = groupId;
+    victim->endpointCount = static_cast<uint8_t>(endpointCount);
+    victim->lastUsed      = ++mUseCounter;
+    for (size_t i = 0; i < endpointCount; i++)
+    {
+        victim->endpoints[i] = endpoints[i];
+    }
+
+    entry = victim;
+    return CHIP_NO_ERROR;
+}
+
+uint32_t GroupEndpointCache::GetEndpointMask(Entry & entry, ClusterId clusterId)
+{
+    for (uint8_t i = 0; i < entry.clusterCount; i++)
+    {
+        if (entry.clusters[i].clusterId == clusterId)
+        {
+            return entry.clusters[i].endpointMask;
+        }
+    }
+
+    DataModel::ServerClusterFinder finder(mProvider);
+    uint32_t endpointMask = 0;
+    for (uint8_t i = 0; i < entry.endpointCount; i++)
+    {
+        if (finder.Find(ConcreteClusterPath(entry.endpoints[i], clusterId)).has_value())
+        {
+            endpointMask |= (1u << i);
+        }
+    }
+
+    uint8_t slot = entry.clusterCount;
+    if (slot < kMaxClustersPerGroup)
+    {
+        entry.clusterCount++;
+    }
+    else
+    {
+        slot              = entry.nextCluster;
+        entry.nextCluster = static_cast<uint8_t>((slot + 1) % kMaxClustersPerGroup);
+    }
+    entry.clusters[slot].clusterId    = clusterId;
+    entry.clusters[slot].endpointMask = endpointMask;
+
+    return endpointMask;
+}
+
+CHIP_ERROR GroupEndpointCache::EndpointIterator::Init(GroupEndpointCache * cache, FabricIndex fabricIndex, GroupId groupId,
+                                                      ClusterId clusterId)
+{
+    Release();
+    mEndpointCount = 0;
+    mEndpointIndex = 0;
+
+    GroupDataProvider * groups = Credentials::GetGroupDataProvider();
+    VerifyOrReturnError(groups != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (cache != nullptr && cache->mProvider != nullptr)
+    {
+        Entry * entry = nullptr;
+        ReturnErrorOnFailure(cache->GetEntry(*groups, fabricIndex, groupId, entry));
+
+        if (entry != nullptr)
+        {
+            uint32_t endpointMask = cache->GetEndpointMask(*entry, clusterId);
+            for (uint8_t i = 0; i < entry->endpointCount; i++)
+            {
+                if (endpointMask & (1u << i))
+                {
+                    mEndpoints[mEndpointCount++] = entry->endpoints[i];
+                }
+            }
+            return CHIP_NO_ERROR;
+        }
+
+        mProvider  = cache->mProvider;
+        mClusterId = clusterId;
+    }
+
+    mGroupIterator = groups->IterateEndpoints(fabricIndex, std::make_optional(groupId));
+    VerifyOrReturnError(mGroupIterator != nullptr, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+bool GroupEndpointCache::EndpointIterator::Next(EndpointId & endpointId)
+{
+    if (mGroupIterator == nullptr)
+    {
+        VerifyOrReturnValue(mEndpointIndex < mEndpointCount, false);
+        endpointId = mEndpoints[mEndpointIndex++];
+        return true;
+    }
+
+    GroupDataProvider::GroupEndpoint mapping;
+    while (mGroupIterator->Next(mapping))
+    {
+        if (mProvider != nullptr &&
+            !DataModel::ServerClusterFinder(mProvider).Find(ConcreteClusterPath(mapping.endpoint_id, mClusterId)).has_value())
+        {
+            continue;
+        }
+        endpointId = mapping.endpoint_id;
+        return true;
+    }
+    return false;
+}
+
+void GroupEndpointCache::EndpointIterator::Release()
+{
+    if (mGroupIterator != nullptr)
+    {
+        mGroupIterator->Release();
+        mGroupIterator = nullptr;
+    }
+    mProvider = nullptr;
+}
+
+} // namespace app
+} // namespace chip
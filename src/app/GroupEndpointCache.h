@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <credentials/GroupDataProvider.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Keeps, for the most recently addressed groups, the endpoints that are members of the group and which of them
+ * implement the server clusters targeted by group commands and writes.
+ *
+ * Fanning out a group message then neither walks the group table in storage nor looks the cluster up in the data
+ * model for every member endpoint: after the first message, it is a loop over a small array.
+ *
+ * The cache follows GroupDataProvider::GetEndpointMappingGeneration() to notice changes to the group table, e.g. through
+ * the Groups cluster. Groups of providers that do not support it are never cached. Changes to the data model, such as
+ * endpoints being enabled or disabled, must be signaled through Invalidate(); the reporting engine does so whenever
+ * Descriptor attributes are marked dirty.
+ */
+class GroupEndpointCache
+{
+public:
+    static constexpr size_t kMaxEndpointsPerGroup = CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS;
+    static constexpr size_t kMaxClustersPerGroup  = 4;
+
+    /**
+     * Iterates the endpoints of a group that implement a given server cluster, in group table order.
+     *
+     * The endpoints are copied when the iterator is initialized, so that the group table may be modified by the
+     * commands being dispatched while iterating.
+     */
+    class EndpointIterator
+    {
+    public:
+        EndpointIterator() = default;
+        ~EndpointIterator() { Release(); }
+
+        EndpointIterator(const EndpointIterator &)             = delete;
+        EndpointIterator & operator=(const EndpointIterator &) = delete;
+
+        /**
+         * Start iterating the endpoints of `groupId` on `fabricIndex` implementing `clusterId`.
+         *
+         * `cache` may be null, in which case the endpoints are read from the GroupDataProvider and are not filtered
+         * by cluster.
+         *
+         * @retval CHIP_ERROR_INCORRECT_STATE if there is no GroupDataProvider.
+         * @retval CHIP_ERROR_NO_MEMORY if a GroupDataProvider iterator could not be allocated.
+         */
+        CHIP_ERROR Init(GroupEndpointCache * cache, FabricIndex fabricIndex, GroupId groupId, ClusterId clusterId);
+
+        bool Next(EndpointId & endpointId);
+
+    private:
+        void Release();
+
+        // Used for groups that are not cached: endpoints come from the group table, and are checked against the
+        // data model one by one when mProvider is set.
+        Credentials::GroupDataProvider::EndpointIterator * mGroupIterator = nullptr;
+        DataModel::ProviderMetadataTree * mProvider                       = nullptr;
+        ClusterId mClusterId                                              = kInvalidClusterId;
+
+        EndpointId mEndpoints[kMaxEndpointsPerGroup];
+        uint8_t mEndpointCount = 0;
+        uint8_t mEndpointIndex = 0;
+    };
+
+    /**
+     * Set the data model used to check which endpoints implement a cluster. Without one, the cache is bypassed.
+     */
+    void SetDataModelProvider(DataModel::ProviderMetadataTree * provider)
+    {
+        mProvider = provider;
+        Invalidate();
+    }
+
+    /**
+     * Forget everything, e.g. because the structure of the data model changed.
+     */
+    void Invalidate();
+
+private:
+    struct ClusterSupport
+    {
+        ClusterId clusterId = kInvalidClusterId;
+        // Bit i is set if Entry::endpoints[i] implements the cluster.
+        uint32_t endpointMask = 0;
+    };
+
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        GroupId groupId         = kUndefinedGroupId;
+        uint8_t endpointCount   = 0;
+        uint8_t clusterCount    = 0;
+        // Next slot of `clusters` to replace once all of them are used.
+        uint8_t nextCluster = 0;
+        uint32_t lastUsed   = 0;
+        EndpointId endpoints[kMaxEndpointsPerGroup];
+        ClusterSupport clusters[kMaxClustersPerGroup];
+    };
+
+    static_assert(kMaxEndpointsPerGroup <= 32, "ClusterSupport::endpointMask is 32 bits");
+
+    /**
+     * Returns the entry for the group, loading it from `groups` if needed. Sets `entry` to nullptr if the group
+     * has too many endpoints to be cached, or if `groups` does not support an endpoint mapping generation.
+     */
+    CHIP_ERROR GetEntry(Credentials::GroupDataProvider & groups, FabricIndex fabricIndex, GroupId groupId, Entry *& entry);
+    uint32_t GetEndpointMask(Entry & entry, ClusterId clusterId);
+
+    DataModel::ProviderMetadataTree * mProvider         = nullptr;
+    Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    uint32_t mEndpointMappingGeneration                 = 0;
+    uint32_t mUseCounter                                = 0;
+    Entry mEntries[CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE];
+};
+
+} // namespace app
+} // namespace chip
@@ -1922,6 +1922,7 @@ DataModel::Provider * InteractionModelEngine::SetDataModelProvider(DataModel::Pr
     }
 
     mDataModelProvider = model;
+    mGroupEndpointCache.SetDataModelProvider(model);
     if (mDataModelProvider != nullptr)
     {
         DataModel::InteractionModelContext context;
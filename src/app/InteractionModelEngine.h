@@ -36,6 +36,7 @@
 #include <app/ConcreteEventPath.h>
 #include <app/DataVersionFilter.h>
 #include <app/EventPathParams.h>
+#include <app/GroupEndpointCache.h>
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadClient.h>
@@ -238,6 +239,9 @@ public:
     // WriteHandlerDelegate implementation
     bool HasConflictWriteRequests(const WriteHandler * apWriteHandler, const ConcreteAttributePath & apath) override;
 
+    // CommandHandlerImpl::Callback and WriteHandlerDelegate implementation
+    GroupEndpointCache * GetGroupEndpointCache() override { return &mGroupEndpointCache; }
+
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     /**
      *
@@ -656,6 +660,7 @@ private:
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
     reporting::ReportScheduler * mReportScheduler = nullptr;
+    GroupEndpointCache mGroupEndpointCache;
 
     static constexpr size_t kReservedHandlersForReads = kMinSupportedReadRequestsPerFabric * (CHIP_CONFIG_MAX_FABRICS);
     static constexpr size_t kReservedPathsForReads    = kMinSupportedPathsPerReadRequest * kReservedHandlersForReads;
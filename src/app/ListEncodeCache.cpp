@@ -0,0 +1,71 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/ListEncodeCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+static_assert(ListEncodeCache::kMaxItems < kInvalidListIndex, "List encode cache item count must fit in a ListIndex");
+static_assert(ListEncodeCache::kBufferSize <= UINT32_MAX, "List encode cache offsets must fit in 32 bits");
+
+void ListEncodeCache::StartFilling(const ConcreteAttributePath & aPath, DataVersion aDataVersion, bool aIsFabricFiltered,
+                                   ListIndex aFirstItem)
+{
+    Reset();
+    mPath             = aPath;
+    mDataVersion      = aDataVersion;
+    mIsFabricFiltered = aIsFabricFiltered;
+    mFirstItem        = aFirstItem;
+}
+
+void ListEncodeCache::PrepareItem(TLV::TLVWriter & aWriter)
+{
+    aWriter.Init(mBuffer + mUsed, kBufferSize - mUsed);
+}
+
+CHIP_ERROR ListEncodeCache::CommitItem(TLV::TLVWriter & aWriter)
+{
+    VerifyOrReturnError(!mComplete, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mItemCount < kMaxItems, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(aWriter.Finalize());
+
+    mOffsets[mItemCount++] = mUsed;
+    mUsed += aWriter.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+bool ListEncodeCache::CanResume(const ConcreteAttributePath & aPath, DataVersion aDataVersion, bool aIsFabricFiltered,
+                                ListIndex aNextItem) const
+{
+    VerifyOrReturnValue(mPath == aPath && mDataVersion == aDataVersion && mIsFabricFiltered == aIsFabricFiltered, false);
+    return (mFirstItem <= aNextItem && aNextItem < EndItem()) || (mComplete && aNextItem == EndItem());
+}
+
+CHIP_ERROR ListEncodeCache::GetItem(ListIndex aIndex, TLV::TLVReader & aReader) const
+{
+    VerifyOrReturnError(mFirstItem <= aIndex && aIndex < EndItem(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t item  = aIndex - mFirstItem;
+    const uint32_t end = (item + 1 < mItemCount) ? mOffsets[item + 1] : mUsed;
+    aReader.Init(mBuffer + mOffsets[item], end - mOffsets[item]);
+    return aReader.Next();
+}
+
+} // namespace app
+} // namespace chip
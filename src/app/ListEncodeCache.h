@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/// Holds pre-encoded items of a list attribute that is being chunked across
+/// several ReportData messages.
+///
+/// When an item of a list does not fit in a message, that item and the
+/// following ones are encoded into this cache (each as an anonymous TLV
+/// element) until the cache is full or the list ends, and their offsets are
+/// recorded. The following chunks then copy the items from the cache instead
+/// of running the list generator and re-encoding the list from its start.
+/// Once the cached items are sent, the list generator fills the cache again
+/// from the first item that does not fit, so a list bigger than the cache is
+/// re-encoded once per cache refill rather than once per chunk.
+///
+/// The cache is only valid for the attribute path, data version and fabric
+/// filtering it was filled for, and is meant to be owned by a single
+/// ReadHandler (i.e. a single subject).
+class ListEncodeCache
+{
+public:
+    static constexpr size_t kBufferSize = CHIP_CONFIG_LIST_ENCODE_CACHE_BUFFER_SIZE;
+    static constexpr size_t kMaxItems   = CHIP_CONFIG_LIST_ENCODE_CACHE_MAX_ITEMS;
+
+    /// Drops all the cached items.
+    void Reset()
+    {
+        mFirstItem = 0;
+        mItemCount = 0;
+        mUsed      = 0;
+        mComplete  = false;
+    }
+
+    /// Drops all the cached items and starts caching the items of the list
+    /// at aPath, starting with the item at index aFirstItem.
+    void StartFilling(const ConcreteAttributePath & aPath, DataVersion aDataVersion, bool aIsFabricFiltered, ListIndex aFirstItem);
+
+    /// Initializes aWriter over the free space of the cache, to encode the
+    /// next item with an anonymous tag.  CommitItem must be called once the
+    /// item is encoded.
+    void PrepareItem(TLV::TLVWriter & aWriter);
+
+    /// Records the item encoded by aWriter.
+    ///
+    /// Returns CHIP_ERROR_NO_MEMORY if the cache cannot hold more items.
+    CHIP_ERROR CommitItem(TLV::TLVWriter & aWriter);
+
+    /// Marks that the last item of the list has been cached.
+    void MarkComplete() { mComplete = true; }
+
+    /// Returns true if the last cached item is the last item of the list.
+    bool IsComplete() const { return mComplete; }
+
+    /// Returns true if the cache holds items of the list at aPath, starting
+    /// at aNextItem (the index of the next item to encode), or if aNextItem
+    /// is right after the last item of the list.
+    bool CanResume(const ConcreteAttributePath & aPath, DataVersion aDataVersion, bool aIsFabricFiltered,
+                   ListIndex aNextItem) const;
+
+    /// Index, in the list, of the first cached item.
+    ListIndex FirstItem() const { return mFirstItem; }
+
+    /// Index, in the list, of the item right after the last cached item.
+    ListIndex EndItem() const { return static_cast<ListIndex>(mFirstItem + mItemCount); }
+
+    ListIndex ItemCount() const { return mItemCount; }
+
+    /// Initializes aReader over the item at index aIndex of the list, and
+    /// positions it on the item.
+    CHIP_ERROR GetItem(ListIndex aIndex, TLV::TLVReader & aReader) const;
+
+private:
+    ConcreteAttributePath mPath;
+    DataVersion mDataVersion = 0;
+    bool mIsFabricFiltered   = false;
+    bool mComplete           = false;
+    ListIndex mFirstItem     = 0;
+    ListIndex mItemCount     = 0;
+    uint32_t mUsed           = 0;
+    uint32_t mOffsets[kMaxItems];
+    uint8_t mBuffer[kBufferSize];
+};
+
+} // namespace app
+} // namespace chip
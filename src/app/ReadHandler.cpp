@@ -335,6 +335,10 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, b
     SetStateFlag(ReadHandlerFlags::ChunkedReport, aMoreChunks);
     bool responseExpected = IsType(InteractionType::Subscribe) || aMoreChunks;
 
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    mReportBuffer = aMoreChunks ? aPayload.Retain() : nullptr;
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
     mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
     CHIP_ERROR err = mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
                                                responseExpected ? Messaging::SendMessageFlags::kExpectResponse
@@ -931,5 +935,27 @@ size_t ReadHandler::GetReportBufferMaxSize()
     return kMaxSecureSduLengthBytes;
 }
 
+System::PacketBufferHandle ReadHandler::AllocateReportBuffer(size_t aAvailableSize)
+{
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    System::PacketBufferHandle buffer = std::move(mReportBuffer);
+
+    // The messaging layer holds on to the previous chunk until it is acknowledged, which normally happens with the
+    // StatusResponse that triggered this chunk.
+    if (!buffer.IsNull() && buffer.HasSoleOwnership() && !buffer->HasChainedBuffer())
+    {
+        // Drop the headers and MIC added when the previous chunk was sent.
+        buffer->SetDataLength(0);
+        buffer->SetStart(buffer->Start() - buffer->ReservedSize() + System::PacketBuffer::kDefaultHeaderReserve);
+        if (buffer->AvailableDataLength() >= aAvailableSize)
+        {
+            return buffer;
+        }
+    }
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
+    return System::PacketBufferHandle::New(aAvailableSize);
+}
+
 } // namespace app
 } // namespace chip
@@ -361,6 +361,14 @@ private:
      */
     size_t GetReportBufferMaxSize();
 
+    /*
+     * Get a packet buffer to encode the next Report message into, with at least aAvailableSize bytes available.
+     *
+     * With CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING, the buffer of the previous chunk of a chunked report is reused
+     * when nothing else holds it anymore.
+     */
+    System::PacketBufferHandle AllocateReportBuffer(size_t aAvailableSize);
+
     /**
      *  Returns whether this ReadHandler represents a subscription that was created by the other side of the provided exchange.
      */
@@ -443,6 +451,11 @@ private:
 
     const AttributeEncodeState & GetAttributeEncodeState() const { return mAttributeEncoderState; }
     void SetAttributeEncodeState(const AttributeEncodeState & aState) { mAttributeEncoderState = aState; }
+#if CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
+    ListEncodeCache * GetListEncodeCache() { return &mListEncodeCache; }
+#else
+    ListEncodeCache * GetListEncodeCache() { return nullptr; }
+#endif // CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
     uint32_t GetLastWrittenEventsBytes() const { return mLastWrittenEventsBytes; }
 
     // Returns the number of interested paths, including wildcard and concrete paths.
@@ -589,8 +602,16 @@ private:
     uint32_t mLastWrittenEventsBytes = 0;
 
     // The detailed encoding state for a single attribute, used by list chunking feature.
-    // The size of AttributeEncoderState is 2 bytes for now.
+    // The size of AttributeEncoderState is 4 bytes plus a pointer to the list encode cache for now.
     AttributeEncodeState mAttributeEncoderState;
+#if CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
+    // Pre-encoded items of the list attribute being chunked, see ListEncodeCache.
+    ListEncodeCache mListEncodeCache;
+#endif // CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    // Buffer of the last chunk sent while more chunks are to follow, see AllocateReportBuffer().
+    System::PacketBufferHandle mReportBuffer;
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
 
     uint16_t mMinIntervalFloorSeconds        = 0;
     uint16_t mMaxInterval                    = 0;
@@ -47,6 +47,7 @@ constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kAttributeIdTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEventIdTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEventPathTypeTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kResumptionRetriesTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kSlotIndexTag;
 
 SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::SimpleSubscriptionInfoIterator(
     SimpleSubscriptionResumptionStorage & storage) :
@@ -112,9 +113,178 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount().KeyName(),
                                                    &countMaxToSave, sizeof(uint16_t)));
 
+    err = LoadIndex();
+    if (err != CHIP_NO_ERROR)
+    {
+        // Subscriptions stored before the index existed, or a damaged index: find the used slots by loading them.
+        if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(DataManagement, "Failed to load subscription index, rebuilding it: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        RebuildIndex();
+        ReturnErrorOnFailure(SaveIndex());
+    }
+
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR SimpleSubscriptionResumptionStorage::LoadIndex()
+{
+    for (auto & entry : mIndex)
+    {
+        entry = IndexEntry();
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxIndexSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len = static_cast<uint16_t>(MaxIndexSize());
+    ReturnErrorOnFailure(
+        mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName(), backingBuffer.Get(), len));
+
+    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType entryType;
+        ReturnErrorOnFailure(reader.EnterContainer(entryType));
+
+        uint16_t subscriptionIndex;
+        IndexEntry entry;
+        ReturnErrorOnFailure(reader.Next(kSlotIndexTag));
+        ReturnErrorOnFailure(reader.Get(subscriptionIndex));
+        ReturnErrorOnFailure(reader.Next(kPeerNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(entry.mNodeId));
+        ReturnErrorOnFailure(reader.Next(kFabricIndexTag));
+        ReturnErrorOnFailure(reader.Get(entry.mFabricIndex));
+        ReturnErrorOnFailure(reader.Next(kSubscriptionIdTag));
+        ReturnErrorOnFailure(reader.Get(entry.mSubscriptionId));
+
+        ReturnErrorOnFailure(reader.ExitContainer(entryType));
+
+        // Slots beyond CHIP_IM_MAX_NUM_SUBSCRIPTIONS were deleted by Init.
+        VerifyOrReturnError(entry.IsUsed(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+        if (subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+        {
+            mIndex[subscriptionIndex] = entry;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return reader.ExitContainer(arrayType);
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::SaveIndex()
+{
+    if (IndexCount() == 0)
+    {
+        CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName());
+        return (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxIndexSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxIndexSize());
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        const IndexEntry & entry = mIndex[subscriptionIndex];
+        if (!entry.IsUsed())
+        {
+            continue;
+        }
+
+        TLV::TLVType entryType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entryType));
+        ReturnErrorOnFailure(writer.Put(kSlotIndexTag, subscriptionIndex));
+        ReturnErrorOnFailure(writer.Put(kPeerNodeIdTag, entry.mNodeId));
+        ReturnErrorOnFailure(writer.Put(kFabricIndexTag, entry.mFabricIndex));
+        ReturnErrorOnFailure(writer.Put(kSubscriptionIdTag, entry.mSubscriptionId));
+        ReturnErrorOnFailure(writer.EndContainer(entryType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    writer.Finalize(backingBuffer);
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName(), backingBuffer.Get(),
+                                     static_cast<uint16_t>(len));
+}
+
+void SimpleSubscriptionResumptionStorage::RebuildIndex()
+{
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        mIndex[subscriptionIndex] = IndexEntry();
+
+        SubscriptionInfo subscriptionInfo;
+        if (Load(subscriptionIndex, subscriptionInfo) != CHIP_NO_ERROR)
+        {
+            // Slots that fail to load are cleaned up when iterating.
+            continue;
+        }
+
+        // Only keep the first copy of a subscription. Later copies are deleted, otherwise iterating would return them too.
+        if (FindIndexEntry(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex, subscriptionInfo.mSubscriptionId) !=
+            CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+        {
+            Delete(subscriptionIndex);
+            continue;
+        }
+
+        mIndex[subscriptionIndex].mNodeId         = subscriptionInfo.mNodeId;
+        mIndex[subscriptionIndex].mFabricIndex    = subscriptionInfo.mFabricIndex;
+        mIndex[subscriptionIndex].mSubscriptionId = subscriptionInfo.mSubscriptionId;
+    }
+}
+
+uint16_t SimpleSubscriptionResumptionStorage::IndexCount() const
+{
+    uint16_t count = 0;
+    for (const auto & entry : mIndex)
+    {
+        count = static_cast<uint16_t>(count + (entry.IsUsed() ? 1 : 0));
+    }
+    return count;
+}
+
+uint16_t SimpleSubscriptionResumptionStorage::FindIndexEntry(NodeId nodeId, FabricIndex fabricIndex,
+                                                             SubscriptionId subscriptionId) const
+{
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        if (mIndex[subscriptionIndex].Matches(nodeId, fabricIndex, subscriptionId))
+        {
+            return subscriptionIndex;
+        }
+    }
+    return CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+}
+
+uint16_t SimpleSubscriptionResumptionStorage::FindFreeIndexEntry() const
+{
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        if (!mIndex[subscriptionIndex].IsUsed())
+        {
+            return subscriptionIndex;
+        }
+    }
+    return CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+}
+
 SubscriptionResumptionStorage::SubscriptionInfoIterator * SimpleSubscriptionResumptionStorage::IterateSubscriptions()
 {
     return mSubscriptionInfoIterators.CreateObject(*this);
@@ -136,7 +306,20 @@ uint16_t SimpleSubscriptionResumptionStorage::Count()
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionIndex)
 {
-    return mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
+
+    // The index is updated after the slot, so that it never misses a stored subscription.
+    if ((subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS) && mIndex[subscriptionIndex].IsUsed())
+    {
+        mIndex[subscriptionIndex] = IndexEntry();
+        CHIP_ERROR indexErr       = SaveIndex();
+        if (err == CHIP_NO_ERROR)
+        {
+            err = indexErr;
+        }
+    }
+
+    return err;
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
@@ -331,41 +514,14 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
 {
-    // Find empty index or duplicate if exists
-    uint16_t subscriptionIndex;
-    uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
-    for (subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
-    {
-        SubscriptionInfo currentSubscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, currentSubscriptionInfo);
-
-        // if empty and firstEmptySubscriptionIndex isn't set yet, then mark empty spot
-        if ((firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS) && (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
-        {
-            firstEmptySubscriptionIndex = subscriptionIndex;
-        }
-
-        // delete duplicate
-        if (err == CHIP_NO_ERROR)
-        {
-            if ((subscriptionInfo.mNodeId == currentSubscriptionInfo.mNodeId) &&
-                (subscriptionInfo.mFabricIndex == currentSubscriptionInfo.mFabricIndex) &&
-                (subscriptionInfo.mSubscriptionId == currentSubscriptionInfo.mSubscriptionId))
-            {
-                Delete(subscriptionIndex);
-                // if duplicate is the first empty spot, then also set it
-                if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
-                {
-                    firstEmptySubscriptionIndex = subscriptionIndex;
-                }
-            }
-        }
-    }
-
-    // Fail if no empty space
-    if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+    // Overwrite the slot already holding this subscription, if any, or else use the first free one.
+    uint16_t subscriptionIndex =
+        FindIndexEntry(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex, subscriptionInfo.mSubscriptionId);
+    const bool isNewEntry = (subscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    if (isNewEntry)
     {
-        return CHIP_ERROR_NO_MEMORY;
+        subscriptionIndex = FindFreeIndexEntry();
+        VerifyOrReturnError(subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_NO_MEMORY);
     }
 
     // Now construct subscription state and save
@@ -382,56 +538,39 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
 
     writer.Finalize(backingBuffer);
 
-    ReturnErrorOnFailure(
-        mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
-                                  backingBuffer.Get(), static_cast<uint16_t>(len)));
+    // The index is updated before the slot, so that it never misses a stored subscription.
+    if (isNewEntry)
+    {
+        mIndex[subscriptionIndex].mNodeId         = subscriptionInfo.mNodeId;
+        mIndex[subscriptionIndex].mFabricIndex    = subscriptionInfo.mFabricIndex;
+        mIndex[subscriptionIndex].mSubscriptionId = subscriptionInfo.mSubscriptionId;
 
-    return CHIP_NO_ERROR;
+        CHIP_ERROR err = SaveIndex();
+        if (err != CHIP_NO_ERROR)
+        {
+            mIndex[subscriptionIndex] = IndexEntry();
+            return err;
+        }
+    }
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                     backingBuffer.Get(), static_cast<uint16_t>(len));
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId)
 {
-    bool subscriptionFound   = false;
-    CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
+    uint16_t subscriptionIndex = FindIndexEntry(nodeId, fabricIndex, subscriptionId);
+    VerifyOrReturnError(subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
 
-    uint16_t remainingSubscriptionsCount = 0;
-    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
-    {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
-
-        // delete match
-        if (err == CHIP_NO_ERROR)
-        {
-            if ((nodeId == subscriptionInfo.mNodeId) && (fabricIndex == subscriptionInfo.mFabricIndex) &&
-                (subscriptionId == subscriptionInfo.mSubscriptionId))
-            {
-                subscriptionFound    = true;
-                CHIP_ERROR deleteErr = Delete(subscriptionIndex);
-                if (deleteErr != CHIP_NO_ERROR)
-                {
-                    lastDeleteErr = deleteErr;
-                }
-            }
-            else
-            {
-                remainingSubscriptionsCount++;
-            }
-        }
-    }
+    CHIP_ERROR err = Delete(subscriptionIndex);
 
     // if there are no persisted subscriptions, the MaxCount can also be deleted
-    if (remainingSubscriptionsCount == 0)
+    if (IndexCount() == 0)
     {
         DeleteMaxCount();
     }
 
-    if (lastDeleteErr != CHIP_NO_ERROR)
-    {
-        return lastDeleteErr;
-    }
-
-    return subscriptionFound ? CHIP_NO_ERROR : CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    return err;
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteMaxCount()
@@ -443,31 +582,35 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
 {
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
 
-    uint16_t count = 0;
+    bool indexChanged = false;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        if (!mIndex[subscriptionIndex].IsUsed() || (mIndex[subscriptionIndex].mFabricIndex != fabricIndex))
+        {
+            continue;
+        }
 
-        if (err == CHIP_NO_ERROR)
+        CHIP_ERROR err =
+            mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
+        if ((err != CHIP_NO_ERROR) && (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
+        {
+            deleteErr = err;
+        }
+        mIndex[subscriptionIndex] = IndexEntry();
+        indexChanged              = true;
+    }
+
+    if (indexChanged)
+    {
+        CHIP_ERROR err = SaveIndex();
+        if (err != CHIP_NO_ERROR)
         {
-            if (fabricIndex == subscriptionInfo.mFabricIndex)
-            {
-                err = Delete(subscriptionIndex);
-                if ((err != CHIP_NO_ERROR) && (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
-                {
-                    deleteErr = err;
-                }
-            }
-            else
-            {
-                count++;
-            }
+            deleteErr = err;
         }
     }
 
     // if there are no persisted subscriptions, the MaxCount can also be deleted
-    if (count == 0)
+    if (IndexCount() == 0)
     {
         CHIP_ERROR err = DeleteMaxCount();
 
@@ -57,6 +57,29 @@ protected:
     uint16_t Count();
     CHIP_ERROR DeleteMaxCount();
 
+    // The index maps each used slot to the subscription stored in it, so that saving and deleting subscriptions only
+    // touches the slots involved. It is kept in memory and persisted as a whole after each change.
+    struct IndexEntry
+    {
+        NodeId mNodeId                 = kUndefinedNodeId;
+        SubscriptionId mSubscriptionId = 0;
+        FabricIndex mFabricIndex       = kUndefinedFabricIndex;
+
+        bool IsUsed() const { return mFabricIndex != kUndefinedFabricIndex; }
+        bool Matches(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId) const
+        {
+            return IsUsed() && (mNodeId == nodeId) && (mFabricIndex == fabricIndex) && (mSubscriptionId == subscriptionId);
+        }
+    };
+
+    CHIP_ERROR LoadIndex();
+    CHIP_ERROR SaveIndex();
+    void RebuildIndex();
+    uint16_t IndexCount() const;
+    // Returns CHIP_IM_MAX_NUM_SUBSCRIPTIONS if there is no such entry.
+    uint16_t FindIndexEntry(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId) const;
+    uint16_t FindFreeIndexEntry() const;
+
     class SimpleSubscriptionInfoIterator : public SubscriptionInfoIterator
     {
     public:
@@ -89,6 +112,13 @@ protected:
                                            sizeof(bool), MaxSubscriptionPathsSize());
     }
 
+    static constexpr size_t MaxIndexSize()
+    {
+        return TLV::EstimateStructOverhead(
+            TLV::EstimateStructOverhead(sizeof(uint16_t), sizeof(NodeId), sizeof(FabricIndex), sizeof(SubscriptionId)) *
+            CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    }
+
     enum class EventPathType : uint8_t
     {
         kUrgent    = 0x1,
@@ -116,6 +146,14 @@ protected:
     //         Endpoint ID
     //         Cluster ID
     //         Event ID
+    //
+    // The index is stored separately as:
+    //   Array of:
+    //     Structure of: (Used slot)
+    //       Slot index
+    //       Node ID
+    //       Fabric Index
+    //       Subscription ID
 
     static constexpr TLV::Tag kPeerNodeIdTag         = TLV::ContextTag(1);
     static constexpr TLV::Tag kFabricIndexTag        = TLV::ContextTag(2);
@@ -133,8 +171,10 @@ protected:
     static constexpr TLV::Tag kEventIdTag            = TLV::ContextTag(14);
     static constexpr TLV::Tag kEventPathTypeTag      = TLV::ContextTag(16);
     static constexpr TLV::Tag kResumptionRetriesTag  = TLV::ContextTag(17);
+    static constexpr TLV::Tag kSlotIndexTag          = TLV::ContextTag(18);
 
     PersistentStorageDelegate * mStorage;
+    IndexEntry mIndex[CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
     ObjectPool<SimpleSubscriptionInfoIterator, kIteratorsMax> mSubscriptionInfoIterators;
 };
 } // namespace app
@@ -32,7 +32,6 @@
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
-#include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
@@ -50,27 +49,6 @@ namespace {
 
 using Protocols::InteractionModel::Status;
 
-/// Wraps a EndpointIterator and ensures that `::Release()` is called
-/// for the iterator (assuming it is non-null)
-class AutoReleaseGroupEndpointIterator
-{
-public:
-    explicit AutoReleaseGroupEndpointIterator(Credentials::GroupDataProvider::EndpointIterator * iterator) : mIterator(iterator) {}
-    ~AutoReleaseGroupEndpointIterator()
-    {
-        if (mIterator != nullptr)
-        {
-            mIterator->Release();
-        }
-    }
-
-    bool IsNull() const { return mIterator == nullptr; }
-    bool Next(Credentials::GroupDataProvider::GroupEndpoint & item) { return mIterator->Next(item); }
-
-private:
-    Credentials::GroupDataProvider::EndpointIterator * mIterator;
-};
-
 } // namespace
 
 using namespace Protocols::InteractionModel;
@@ -288,9 +266,8 @@ CHIP_ERROR WriteHandler::DeliverFinalListWriteEndForGroupWrite(bool writeWasSucc
     VerifyOrReturnError(mProcessingAttributePath.HasValue() && mStateFlags.Has(StateBits::kProcessingAttributeIsList),
                         CHIP_NO_ERROR);
 
-    Credentials::GroupDataProvider::GroupEndpoint mapping;
-    Credentials::GroupDataProvider * groupDataProvider = Credentials::GetGroupDataProvider();
-    Credentials::GroupDataProvider::EndpointIterator * iterator;
+    EndpointId endpointId;
+    GroupEndpointCache::EndpointIterator iterator;
 
     GroupId groupId         = mExchangeCtx->GetSessionHandle()->AsIncomingGroupSession()->GetGroupId();
     FabricIndex fabricIndex = GetAccessingFabricIndex();
@@ -298,17 +275,11 @@ CHIP_ERROR WriteHandler::DeliverFinalListWriteEndForGroupWrite(bool writeWasSucc
     auto processingConcreteAttributePath = mProcessingAttributePath.Value();
     mProcessingAttributePath.ClearValue();
 
-    iterator = groupDataProvider->IterateEndpoints(fabricIndex);
-    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(iterator.Init(GetGroupEndpointCache(), fabricIndex, groupId, processingConcreteAttributePath.mClusterId));
 
-    while (iterator->Next(mapping))
+    while (iterator.Next(endpointId))
     {
-        if (groupId != mapping.group_id)
-        {
-            continue;
-        }
-
-        processingConcreteAttributePath.mEndpointId = mapping.endpoint_id;
+        processingConcreteAttributePath.mEndpointId = endpointId;
 
         VerifyOrReturnError(mDelegate, CHIP_ERROR_INCORRECT_STATE);
         if (!mDelegate->HasConflictWriteRequests(this, processingConcreteAttributePath))
@@ -316,7 +287,6 @@ CHIP_ERROR WriteHandler::DeliverFinalListWriteEndForGroupWrite(bool writeWasSucc
             DeliverListWriteEnd(processingConcreteAttributePath, writeWasSuccessful);
         }
     }
-    iterator->Release();
     return CHIP_NO_ERROR;
 }
 namespace {
@@ -483,8 +453,9 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
                       "Received group attribute write for Group=%u Cluster=" ChipLogFormatMEI " attribute=" ChipLogFormatMEI,
                       groupId, ChipLogValueMEI(dataAttributePath.mClusterId), ChipLogValueMEI(dataAttributePath.mAttributeId));
 
-        AutoReleaseGroupEndpointIterator iterator(Credentials::GetGroupDataProvider()->IterateEndpoints(fabric));
-        VerifyOrExit(!iterator.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+        GroupEndpointCache::EndpointIterator iterator;
+        err = iterator.Init(GetGroupEndpointCache(), fabric, groupId, dataAttributePath.mClusterId);
+        SuccessOrExit(err);
 
         bool shouldReportListWriteEnd = ShouldReportListWriteEnd(
             mProcessingAttributePath, mStateFlags.Has(StateBits::kProcessingAttributeIsList), dataAttributePath);
@@ -492,15 +463,10 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
 
         std::optional<bool> isListAttribute = std::nullopt;
 
-        Credentials::GroupDataProvider::GroupEndpoint mapping;
-        while (iterator.Next(mapping))
+        EndpointId endpointId;
+        while (iterator.Next(endpointId))
         {
-            if (groupId != mapping.group_id)
-            {
-                continue;
-            }
-
-            dataAttributePath.mEndpointId = mapping.endpoint_id;
+            dataAttributePath.mEndpointId = endpointId;
 
             // Try to get the metadata from for the attribute from one of the expanded endpoints (it doesn't really matter which
             // endpoint we pick, as long as it's valid) and update the path info according to it and recheck if we need to report
@@ -525,7 +491,7 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
             if (shouldReportListWriteEnd)
             {
                 auto processingConcreteAttributePath        = mProcessingAttributePath.Value();
-                processingConcreteAttributePath.mEndpointId = mapping.endpoint_id;
+                processingConcreteAttributePath.mEndpointId = endpointId;
                 VerifyOrExit(mDelegate, err = CHIP_ERROR_INCORRECT_STATE);
                 if (mDelegate->HasConflictWriteRequests(this, processingConcreteAttributePath))
                 {
@@ -539,7 +505,7 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
                 ChipLogDetail(DataManagement,
                               "Writing attribute endpoint=%u Cluster=" ChipLogFormatMEI " attribute=" ChipLogFormatMEI
                               " is conflict with other write transactions.",
-                              mapping.endpoint_id, ChipLogValueMEI(dataAttributePath.mClusterId),
+                              endpointId, ChipLogValueMEI(dataAttributePath.mClusterId),
                               ChipLogValueMEI(dataAttributePath.mAttributeId));
                 continue;
             }
@@ -552,7 +518,7 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
             ChipLogDetail(DataManagement,
                           "Processing group attribute write for endpoint=%u Cluster=" ChipLogFormatMEI
                           " attribute=" ChipLogFormatMEI,
-                          mapping.endpoint_id, ChipLogValueMEI(dataAttributePath.mClusterId),
+                          endpointId, ChipLogValueMEI(dataAttributePath.mClusterId),
                           ChipLogValueMEI(dataAttributePath.mAttributeId));
 
             chip::TLV::TLVReader tmpDataReader(dataReader);
@@ -565,7 +531,7 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
                 ChipLogError(DataManagement,
                              "WriteClusterData Endpoint=%u Cluster=" ChipLogFormatMEI " Attribute =" ChipLogFormatMEI
                              " failed: %" CHIP_ERROR_FORMAT,
-                             mapping.endpoint_id, ChipLogValueMEI(dataAttributePath.mClusterId),
+                             endpointId, ChipLogValueMEI(dataAttributePath.mClusterId),
                              ChipLogValueMEI(dataAttributePath.mAttributeId), err.Format());
             }
             DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Write,
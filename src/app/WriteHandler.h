@@ -22,6 +22,7 @@
 #include <app/AttributeAccessToken.h>
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/GroupEndpointCache.h>
 #include <app/InteractionModelDelegatePointers.h>
 #include <app/MessageDef/WriteResponseMessage.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
@@ -56,6 +57,12 @@ public:
      * (i.e. another write transaction is in the middle of processing a chunked write to the given path.)
      */
     virtual bool HasConflictWriteRequests(const WriteHandler * apWriteHandler, const ConcreteAttributePath & aPath) = 0;
+
+    /**
+     * Returns the cache used to find the endpoints a group write is applied to, or nullptr to read them from the group
+     * table for every group write.
+     */
+    virtual GroupEndpointCache * GetGroupEndpointCache() { return nullptr; }
 };
 
 /**
@@ -179,6 +186,8 @@ private:
     // ProcessGroupAttributeDataIBs.
     CHIP_ERROR DeliverFinalListWriteEndForGroupWrite(bool writeWasSuccessful);
 
+    GroupEndpointCache * GetGroupEndpointCache() { return mDelegate ? mDelegate->GetGroupEndpointCache() : nullptr; }
+
     CHIP_ERROR AddStatusInternal(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus);
 
     // ExchangeDelegate
@@ -100,12 +100,14 @@ template class chip::app::Storage::FabricTableImpl<SceneTableBase::SceneStorageI
 
 CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate & storage)
 {
+    InvalidateSceneIndex(kInvalidEndpointId, kUndefinedFabricIndex);
     return FabricTableImpl::Init(storage);
 }
 
 void DefaultSceneTableImpl::Finish()
 {
     UnregisterAllHandlers();
+    InvalidateSceneIndex(kInvalidEndpointId, kUndefinedFabricIndex);
     FabricTableImpl::Finish();
 }
 
@@ -138,21 +140,45 @@ CHIP_ERROR DefaultSceneTableImpl::SetSceneTableEntry(FabricIndex fabric_index, c
 
 CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id, SceneTableEntry & entry)
 {
-    // All data is copied to SceneTableEntry, buffer can be allocated on stack
-    PersistentStore<Serializer::kEntryMaxBytes()> store;
-    ReturnErrorOnFailure(this->GetTableEntry(fabric_index, scene_id, entry.mStorageData, store));
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+
+    SceneIndex scene_idx;
+    if (LookupSceneIndex(fabric_index, scene_id, scene_idx))
+    {
+        if (LoadSceneAtPosition(fabric_index, scene_idx, entry) == CHIP_NO_ERROR && entry.mStorageId == scene_id)
+        {
+            return CHIP_NO_ERROR;
+        }
+        // The scene moved or was removed behind the cache's back, look it up in the scene map instead
+        InvalidateSceneIndex(mEndpointId, fabric_index);
+    }
+
+    ReturnErrorOnFailure(this->FindTableEntry(fabric_index, scene_id, scene_idx));
+    CHIP_ERROR err = LoadSceneAtPosition(fabric_index, scene_idx, entry);
+
+    // If entry.Load returns "buffer too small", the scene in memory is too big to be retrieved (this could happen if the
+    // kEntryMaxBytes was reduced by OTA) and therefore must be deleted as it is no longer considered accessible.
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        ReturnErrorOnFailure(this->RemoveSceneTableEntry(fabric_index, scene_id));
+    }
+    ReturnErrorOnFailure(err);
+
     entry.mStorageId = scene_id;
+    CacheSceneIndex(fabric_index, scene_id, scene_idx);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id)
 {
+    InvalidateSceneIndex(mEndpointId, fabric_index);
     return this->RemoveTableEntry(fabric_index, scene_id);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId endpoint, FabricIndex fabric_index,
                                                                   SceneIndex scene_idx)
 {
+    InvalidateSceneIndex(endpoint, fabric_index);
     return this->RemoveTableEntryAtPosition(endpoint, fabric_index, scene_idx);
 }
 
@@ -192,6 +218,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetAllSceneIdsInGroup(FabricIndex fabric_index
 CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_index, GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSceneIndex(mEndpointId, fabric_index);
 
     FabricSceneData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
@@ -306,14 +333,81 @@ CHIP_ERROR DefaultSceneTableImpl::SceneApplyEFS(const SceneTableEntry & scene)
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveFabric(FabricIndex fabric_index)
 {
+    InvalidateSceneIndex(kInvalidEndpointId, fabric_index);
     return FabricTableImpl::RemoveFabric(fabric_index);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveEndpoint()
 {
+    InvalidateSceneIndex(mEndpointId, kUndefinedFabricIndex);
     return FabricTableImpl::RemoveEndpoint();
 }
 
+/// @brief Loads the scene stored at a position of the scene map of a fabric on the current endpoint, without loading the map
+/// @param fabric_index Fabric in which the scene belongs
+/// @param scene_idx Position in the Table
+/// @param entry[out] Scene loaded, including its ID
+CHIP_ERROR DefaultSceneTableImpl::LoadSceneAtPosition(FabricIndex fabric_index, SceneIndex scene_idx, SceneTableEntry & entry)
+{
+    VerifyOrReturnError(scene_idx < mMaxPerFabric, CHIP_ERROR_NOT_FOUND);
+
+    // All data is copied to SceneTableEntry, buffer can be allocated on stack
+    PersistentStore<Serializer::kEntryMaxBytes()> store;
+    TableEntryData<SceneStorageId, SceneData> table_entry(mEndpointId, fabric_index, entry.mStorageId, entry.mStorageData,
+                                                          scene_idx);
+    return store.Load(table_entry, mStorage);
+}
+
+bool DefaultSceneTableImpl::LookupSceneIndex(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneIndex & scene_idx)
+{
+    for (auto & cached : mSceneIndex)
+    {
+        if (cached.mFabricIndex == fabric_index && cached.mEndpointId == mEndpointId && cached.mStorageId == scene_id)
+        {
+            scene_idx        = cached.mIndex;
+            cached.mLastUsed = ++mSceneIndexUseCounter;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DefaultSceneTableImpl::CacheSceneIndex(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneIndex scene_idx)
+{
+    // Use a free slot if there is one, otherwise evict the position used the longest time ago
+    SceneIndexEntry * slot = &mSceneIndex[0];
+    for (auto & cached : mSceneIndex)
+    {
+        if (cached.mFabricIndex == kUndefinedFabricIndex)
+        {
+            slot = &cached;
+            break;
+        }
+        if (cached.mLastUsed < slot->mLastUsed)
+        {
+            slot = &cached;
+        }
+    }
+
+    slot->mFabricIndex = fabric_index;
+    slot->mEndpointId  = mEndpointId;
+    slot->mStorageId   = scene_id;
+    slot->mIndex       = scene_idx;
+    slot->mLastUsed    = ++mSceneIndexUseCounter;
+}
+
+void DefaultSceneTableImpl::InvalidateSceneIndex(EndpointId endpoint, FabricIndex fabric_index)
+{
+    for (auto & cached : mSceneIndex)
+    {
+        if ((endpoint == kInvalidEndpointId || cached.mEndpointId == endpoint) &&
+            (fabric_index == kUndefinedFabricIndex || cached.mFabricIndex == fabric_index))
+        {
+            cached = SceneIndexEntry();
+        }
+    }
+}
+
 /// @brief wrapper function around emberAfGetClustersFromEndpoint to allow testing, shimmed in test configuration because
 /// emberAfGetClusterFromEndpoint relies on <app/util/attribute-storage.h>, which relies on zap generated files
 uint8_t DefaultSceneTableImpl::GetClustersFromEndpoint(ClusterId * clusterList, uint8_t listLen)
@@ -25,6 +25,9 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#include <algorithm>
 
 namespace chip {
 namespace scenes {
@@ -41,6 +44,17 @@ static_assert(kMaxScenesPerEndpoint <= CHIP_CONFIG_MAX_SCENES_TABLE_SIZE,
 static_assert(kMaxScenesPerEndpoint >= 16, "Per spec, kMaxScenesPerEndpoint must be at least 16");
 static constexpr uint16_t kMaxScenesPerFabric = (kMaxScenesPerEndpoint - 1) / 2;
 
+// Remember at least one scene position per endpoint, so that recalling a scene on all endpoints, as ScenesServer::RecallScenes
+// does for a group, keeps hitting the cache.
+#ifdef MATTER_DM_SCENES_CLUSTER_SERVER_ENDPOINT_COUNT
+static constexpr uint16_t kSceneIndexEndpointCount =
+    static_cast<uint16_t>(MATTER_DM_SCENES_CLUSTER_SERVER_ENDPOINT_COUNT + CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT);
+static constexpr uint16_t kSceneIndexCacheSize = std::max<uint16_t>(CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE, kSceneIndexEndpointCount);
+#else
+static constexpr uint16_t kSceneIndexCacheSize = CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE;
+#endif
+static_assert(kSceneIndexCacheSize > 0, "CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE must be at least 1");
+
 /**
  * @brief Implementation of a storage in nonvolatile storage of the scene table.
  *
@@ -107,6 +121,30 @@ protected:
 
     // wrapper function around emberAfGetClusterCountForEndpoint to allow override when testing
     virtual uint8_t GetClusterCountFromEndpoint();
+
+private:
+    /// @brief Position of a scene in the scene map of its fabric on an endpoint
+    struct SceneIndexEntry
+    {
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        EndpointId mEndpointId   = kInvalidEndpointId;
+        SceneStorageId mStorageId;
+        SceneIndex mIndex  = 0;
+        uint32_t mLastUsed = 0;
+    };
+
+    CHIP_ERROR LoadSceneAtPosition(FabricIndex fabric_index, SceneIndex scene_idx, SceneTableEntry & entry);
+
+    // Cache of the positions of the scenes looked up last. A cached position is only used if the scene stored there is the one
+    // looked for, so that a stale position costs a failed read but never returns the wrong scene. Positions are still dropped
+    // when scenes are removed, so that they can be reused.
+    bool LookupSceneIndex(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneIndex & scene_idx);
+    void CacheSceneIndex(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneIndex scene_idx);
+    /// @brief Drops the cached positions on an endpoint and fabric, kInvalidEndpointId and kUndefinedFabricIndex matching all
+    void InvalidateSceneIndex(EndpointId endpoint, FabricIndex fabric_index);
+
+    SceneIndexEntry mSceneIndex[kSceneIndexCacheSize];
+    uint32_t mSceneIndexUseCounter = 0;
 }; // class DefaultSceneTableImpl
 
 /// @brief Gets a pointer to the instance of Scene Table Impl, providing EndpointId and Table Size for said endpoint
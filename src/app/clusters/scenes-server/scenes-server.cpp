@@ -592,9 +592,11 @@ CHIP_ERROR StoreSceneParse(const FabricIndex & fabricIdx, const EndpointId & end
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
-                            const SceneId & sceneID, const Optional<DataModel::Nullable<uint32_t>> & transitionTime,
-                            GroupDataProvider * groupProvider)
+/// @brief Loads the scene to recall on an endpoint, the first half of RecallSceneParse
+/// @param scene[out] Scene to apply, its transition time overridden by transitionTime if present
+CHIP_ERROR LoadSceneForRecall(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
+                              const SceneId & sceneID, const Optional<DataModel::Nullable<uint32_t>> & transitionTime,
+                              GroupDataProvider * groupProvider, SceneTableEntry & scene)
 {
     // Make SceneValid false for all fabrics before recalling a scene
     ScenesServer::Instance().MakeSceneInvalidForAllFabrics(endpointID);
@@ -613,7 +615,7 @@ CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & en
     }
 
     // Scene Table interface data
-    SceneTableEntry scene(SceneStorageId(sceneID, groupID));
+    scene.mStorageId = SceneStorageId(sceneID, groupID);
 
     VerifyOrReturnError(nullptr != sceneTable, CHIP_ERROR_INTERNAL);
     ReturnErrorOnFailure(sceneTable->GetSceneTableEntry(fabricIdx, scene.mStorageId, scene));
@@ -628,13 +630,30 @@ CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & en
         }
     }
 
+    return CHIP_NO_ERROR;
+}
+
+/// @brief Applies a scene loaded by LoadSceneForRecall, the second half of RecallSceneParse
+CHIP_ERROR ApplyRecalledScene(const FabricIndex & fabricIdx, const EndpointId & endpointID, const SceneTableEntry & scene)
+{
+    // Get Scene Table Instance
+    SceneTable * sceneTable = scenes::GetSceneTableImpl(endpointID);
+    VerifyOrReturnError(nullptr != sceneTable, CHIP_ERROR_INTERNAL);
+
     ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
 
     // Update FabricSceneInfo, at this point the scene is considered valid
-    ReturnErrorOnFailure(
-        UpdateFabricSceneInfo(endpointID, fabricIdx, Optional<GroupId>(groupID), Optional<SceneId>(sceneID), Optional<bool>(true)));
+    return UpdateFabricSceneInfo(endpointID, fabricIdx, Optional<GroupId>(scene.mStorageId.mGroupId),
+                                 Optional<SceneId>(scene.mStorageId.mSceneId), Optional<bool>(true));
+}
 
-    return CHIP_NO_ERROR;
+CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
+                            const SceneId & sceneID, const Optional<DataModel::Nullable<uint32_t>> & transitionTime,
+                            GroupDataProvider * groupProvider)
+{
+    SceneTableEntry scene;
+    ReturnErrorOnFailure(LoadSceneForRecall(fabricIdx, endpointID, groupID, sceneID, transitionTime, groupProvider, scene));
+    return ApplyRecalledScene(fabricIdx, endpointID, scene);
 }
 
 // CommandHanlerInterface
@@ -767,6 +786,68 @@ void ScenesServer::RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, Gr
     RecallSceneParse(aFabricIx, aEndpointId, aGroupId, aSceneId, transitionTime, mGroupProvider);
 }
 
+CHIP_ERROR ScenesServer::RecallScenes(FabricIndex aFabricIx, const Span<const EndpointId> & aEndpoints, GroupId aGroupId,
+                                      SceneId aSceneId)
+{
+    MATTER_TRACE_SCOPE("RecallScenes", "Scenes");
+    Optional<DataModel::Nullable<uint32_t>> transitionTime;
+
+    Platform::ScopedMemoryBuffer<SceneTableEntry *> scenes;
+    VerifyOrReturnError(scenes.Calloc(aEndpoints.size()), CHIP_ERROR_NO_MEMORY);
+
+    // Load all the scenes first, so that the endpoints change state together rather than one storage access after the other
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    for (size_t i = 0; i < aEndpoints.size(); i++)
+    {
+        SceneTableEntry * scene = Platform::New<SceneTableEntry>();
+        if (scene == nullptr)
+        {
+            ChipLogError(Zcl, "Failed to allocate scene to recall on endpoint %u", aEndpoints[i]);
+            continue;
+        }
+
+        CHIP_ERROR err = LoadSceneForRecall(aFabricIx, aEndpoints[i], aGroupId, aSceneId, transitionTime, mGroupProvider, *scene);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(Zcl, "Not recalling scene on endpoint %u: %" CHIP_ERROR_FORMAT, aEndpoints[i], err.Format());
+            Platform::Delete(scene);
+            continue;
+        }
+        scenes[i] = scene;
+    }
+
+    System::Clock::Timestamp loadedTime = System::SystemClock().GetMonotonicTimestamp();
+    size_t recalledCount                = 0;
+    for (size_t i = 0; i < aEndpoints.size(); i++)
+    {
+        if (scenes[i] == nullptr)
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = ApplyRecalledScene(aFabricIx, aEndpoints[i], *scenes[i]);
+        if (err == CHIP_NO_ERROR)
+        {
+            recalledCount++;
+        }
+        else
+        {
+            ChipLogError(Zcl, "Failed to recall scene on endpoint %u: %" CHIP_ERROR_FORMAT, aEndpoints[i], err.Format());
+        }
+        Platform::Delete(scenes[i]);
+    }
+    System::Clock::Timestamp appliedTime = System::SystemClock().GetMonotonicTimestamp();
+
+    ChipLogProgress(Zcl,
+                    "Recalled scene 0x%02x of group 0x%04x on %u of %u endpoints: loading took %" PRIu32 " ms, applying %" PRIu32
+                    " ms",
+                    aSceneId, aGroupId, static_cast<unsigned>(recalledCount), static_cast<unsigned>(aEndpoints.size()),
+                    std::chrono::duration_cast<System::Clock::Milliseconds32>(loadedTime - startTime).count(),
+                    std::chrono::duration_cast<System::Clock::Milliseconds32>(appliedTime - loadedTime).count());
+
+    return CHIP_NO_ERROR;
+}
+
 bool ScenesServer::IsHandlerRegistered(EndpointId aEndpointId, scenes::SceneHandler * handler)
 {
     SceneTable * sceneTable = scenes::GetSceneTableImpl(aEndpointId);
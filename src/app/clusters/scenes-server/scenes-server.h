@@ -96,6 +96,12 @@ public:
     void StoreCurrentScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId);
     void RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId);
 
+    /// @brief Recalls a scene on several endpoints at once, such as the members of a group. All the scenes are loaded from storage
+    /// before any of them is applied, so that the endpoints change state together. Endpoints on which the scene cannot be
+    /// recalled are skipped. The time taken by both steps is logged.
+    /// @return CHIP_NO_ERROR, or CHIP_ERROR_NO_MEMORY if the batch could not be allocated
+    CHIP_ERROR RecallScenes(FabricIndex aFabricIx, const Span<const EndpointId> & aEndpoints, GroupId aGroupId, SceneId aSceneId);
+
     // Handlers for extension field sets
     bool IsHandlerRegistered(EndpointId aEndpointId, scenes::SceneHandler * handler);
     void RegisterSceneHandler(EndpointId aEndpointId, scenes::SceneHandler * handler);
@@ -124,6 +124,17 @@ public:
     virtual std::optional<ActionReturnStatus> InvokeCommand(const InvokeRequest & request, chip::TLV::TLVReader & input_arguments,
                                                             CommandHandler * handler) = 0;
 
+    /// Declares that `ReadAttribute` and the `ProviderMetadataTree` queries may be called concurrently
+    /// from several threads.
+    ///
+    /// Concurrent calls only happen while the Matter thread is blocked waiting for them: no write,
+    /// invoke or data model change is processed in the meantime, so implementations only need to
+    /// make their reads (including any cache they maintain) safe against each other.
+    ///
+    /// When CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING is enabled, the reporting engine uses this to
+    /// encode the reports of several ReadHandlers on worker threads.
+    virtual bool SupportsConcurrentReads() const { return false; }
+
 protected:
     InteractionModelContext mContext = {};
 };
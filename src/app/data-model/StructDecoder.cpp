@@ -0,0 +1,59 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model/StructDecoder.h>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace detail {
+
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, const StructField * fields, size_t fieldCount)
+{
+    StructDecodeIterator iterator(reader);
+
+    // Encoders write the fields in the order they are declared, so the field following the
+    // last decoded one is checked first and a full lookup is only needed for fields that are
+    // out of order, repeated or unknown.
+    size_t expected = 0;
+
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        size_t index = expected;
+        if (index >= fieldCount || fields[index].Tag() != contextTag)
+        {
+            for (index = 0; index < fieldCount && fields[index].Tag() != contextTag; index++)
+            {
+            }
+        }
+
+        if (index < fieldCount)
+        {
+            ReturnErrorOnFailure(fields[index].Decode(reader));
+            expected = index + 1;
+        }
+    }
+}
+
+} // namespace detail
+} // namespace Clusters
+} // namespace app
+} // namespace chip
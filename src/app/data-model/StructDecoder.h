@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/data-model/Decode.h>
+#include <app/data-model/StructDecodeIterator.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/TypeTraits.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace detail {
+
+// INTERNAL class describing one field of a structure for `DecodeStruct`: the
+// context tag of the field, the member it is decoded into and the function
+// decoding it. That function only depends on the type of the member, so a
+// single copy of it is shared by every field of that type.
+class StructField
+{
+public:
+    template <typename FieldId, typename T>
+    StructField(FieldId id, T & value) : mDecode(&DecodeValue<T>), mValue(&value), mTag(static_cast<uint8_t>(to_underlying(id)))
+    {}
+
+    uint8_t Tag() const { return mTag; }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) const { return mDecode(reader, mValue); }
+
+private:
+    template <typename T>
+    static CHIP_ERROR DecodeValue(TLV::TLVReader & reader, void * value)
+    {
+        return DataModel::Decode(reader, *static_cast<T *>(value));
+    }
+
+    CHIP_ERROR (*mDecode)(TLV::TLVReader & reader, void * value);
+    void * mValue;
+    uint8_t mTag;
+};
+
+// INTERNAL function used by the generated `DecodableType::Decode` of structures
+// and events. Example:
+//
+//    CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+//    {
+//        return detail::DecodeStruct(reader, { detail::StructField(Fields::kA, a), detail::StructField(Fields::kB, b) });
+//    }
+//
+// The fields form a table built on the stack of the caller, so the loop over the
+// structure elements is shared by all the structures instead of being generated
+// for each of them.
+//
+// The reader MUST be positioned on a kTLVType_Structure element. Unknown context
+// tags and non-context tags are skipped. If a field appears several times, the
+// last occurrence wins.
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, const StructField * fields, size_t fieldCount);
+
+inline CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, std::initializer_list<StructField> fields)
+{
+    return DecodeStruct(reader, fields.begin(), fields.size());
+}
+
+} // namespace detail
+} // namespace Clusters
+} // namespace app
+} // namespace chip
@@ -0,0 +1,467 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/StructDecoder.h>
+#include <lib/core/TLV.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+using AttributeValuePair = ScenesManagement::Structs::AttributeValuePairStruct::DecodableType;
+using SceneInfo          = ScenesManagement::Structs::SceneInfoStruct::DecodableType;
+using AccessControlEntry = AccessControl::Structs::AccessControlEntryStruct::DecodableType;
+using EntryChanged       = AccessControl::Events::AccessControlEntryChanged::DecodableType;
+
+constexpr uint8_t kUnknownFieldTag = 200;
+constexpr uint32_t kIterations     = 50000;
+
+// Copies of the decoders generated before detail::DecodeStruct, used as the baseline of the
+// benchmark: every tag is looked up with a chain of comparisons and each field is decoded inline.
+CHIP_ERROR DecodeWithPreviousDecoder(TLV::TLVReader & reader, AttributeValuePair & value)
+{
+    using Fields = ScenesManagement::Structs::AttributeValuePairStruct::Fields;
+
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(Fields::kAttributeID))
+        {
+            err = DataModel::Decode(reader, value.attributeID);
+        }
+        else if (contextTag == to_underlying(Fields::kValueUnsigned8))
+        {
+            err = DataModel::Decode(reader, value.valueUnsigned8);
+        }
+        else if (contextTag == to_underlying(Fields::kValueSigned8))
+        {
+            err = DataModel::Decode(reader, value.valueSigned8);
+        }
+        else if (contextTag == to_underlying(Fields::kValueUnsigned16))
+        {
+            err = DataModel::Decode(reader, value.valueUnsigned16);
+        }
+        else if (contextTag == to_underlying(Fields::kValueSigned16))
+        {
+            err = DataModel::Decode(reader, value.valueSigned16);
+        }
+        else if (contextTag == to_underlying(Fields::kValueUnsigned32))
+        {
+            err = DataModel::Decode(reader, value.valueUnsigned32);
+        }
+        else if (contextTag == to_underlying(Fields::kValueSigned32))
+        {
+            err = DataModel::Decode(reader, value.valueSigned32);
+        }
+        else if (contextTag == to_underlying(Fields::kValueUnsigned64))
+        {
+            err = DataModel::Decode(reader, value.valueUnsigned64);
+        }
+        else if (contextTag == to_underlying(Fields::kValueSigned64))
+        {
+            err = DataModel::Decode(reader, value.valueSigned64);
+        }
+
+        ReturnErrorOnFailure(err);
+    }
+}
+
+CHIP_ERROR DecodeWithPreviousDecoder(TLV::TLVReader & reader, SceneInfo & value)
+{
+    using Fields = ScenesManagement::Structs::SceneInfoStruct::Fields;
+
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(Fields::kSceneCount))
+        {
+            err = DataModel::Decode(reader, value.sceneCount);
+        }
+        else if (contextTag == to_underlying(Fields::kCurrentScene))
+        {
+            err = DataModel::Decode(reader, value.currentScene);
+        }
+        else if (contextTag == to_underlying(Fields::kCurrentGroup))
+        {
+            err = DataModel::Decode(reader, value.currentGroup);
+        }
+        else if (contextTag == to_underlying(Fields::kSceneValid))
+        {
+            err = DataModel::Decode(reader, value.sceneValid);
+        }
+        else if (contextTag == to_underlying(Fields::kRemainingCapacity))
+        {
+            err = DataModel::Decode(reader, value.remainingCapacity);
+        }
+        else if (contextTag == to_underlying(Fields::kFabricIndex))
+        {
+            err = DataModel::Decode(reader, value.fabricIndex);
+        }
+
+        ReturnErrorOnFailure(err);
+    }
+}
+
+CHIP_ERROR DecodeWithPreviousDecoder(TLV::TLVReader & reader, AccessControlEntry & value)
+{
+    using Fields = AccessControl::Structs::AccessControlEntryStruct::Fields;
+
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(Fields::kPrivilege))
+        {
+            err = DataModel::Decode(reader, value.privilege);
+        }
+        else if (contextTag == to_underlying(Fields::kAuthMode))
+        {
+            err = DataModel::Decode(reader, value.authMode);
+        }
+        else if (contextTag == to_underlying(Fields::kSubjects))
+        {
+            err = DataModel::Decode(reader, value.subjects);
+        }
+        else if (contextTag == to_underlying(Fields::kTargets))
+        {
+            err = DataModel::Decode(reader, value.targets);
+        }
+        else if (contextTag == to_underlying(Fields::kFabricIndex))
+        {
+            err = DataModel::Decode(reader, value.fabricIndex);
+        }
+
+        ReturnErrorOnFailure(err);
+    }
+}
+
+class TestStructDecoder : public ::testing::Test
+{
+public:
+    void StartStruct()
+    {
+        mWriter.Init(mBuffer);
+        ASSERT_EQ(mWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, mOuter), CHIP_NO_ERROR);
+    }
+
+    template <typename T>
+    void Put(uint8_t tag, T value)
+    {
+        ASSERT_EQ(mWriter.Put(TLV::ContextTag(tag), value), CHIP_NO_ERROR);
+    }
+
+    void EndStruct()
+    {
+        ASSERT_EQ(mWriter.EndContainer(mOuter), CHIP_NO_ERROR);
+        ASSERT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        mLength = mWriter.GetLengthWritten();
+    }
+
+    template <typename Encodable>
+    void EncodeObject(const Encodable & value)
+    {
+        mWriter.Init(mBuffer);
+        ASSERT_EQ(value.Encode(mWriter, TLV::AnonymousTag()), CHIP_NO_ERROR);
+        ASSERT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        mLength = mWriter.GetLengthWritten();
+    }
+
+    template <typename Decodable>
+    CHIP_ERROR DecodeObject(Decodable & value)
+    {
+        TLV::TLVReader reader;
+        reader.Init(mBuffer, mLength);
+        ReturnErrorOnFailure(reader.Next());
+        return value.Decode(reader);
+    }
+
+    // Decodes the encoded object kIterations times with `decode` and returns the average time, in nanoseconds.
+    template <typename Decodable, typename DecodeFunction>
+    uint64_t MeasureDecode(DecodeFunction decode)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+
+        const uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (uint32_t i = 0; i < kIterations && err == CHIP_NO_ERROR; i++)
+        {
+            TLV::TLVReader reader;
+            reader.Init(mBuffer, mLength);
+            Decodable value;
+            err = reader.Next();
+            if (err == CHIP_NO_ERROR)
+            {
+                err = decode(reader, value);
+            }
+        }
+        const uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        return elapsed * 1000 / kIterations;
+    }
+
+    // Logs the decoding time of the encoded object with the generated decoder and with the previous one.
+    template <typename Decodable>
+    void LogDecodeTime(const char * name)
+    {
+        auto generated = [](TLV::TLVReader & reader, Decodable & value) { return value.Decode(reader); };
+        auto previous  = [](TLV::TLVReader & reader, Decodable & value) { return DecodeWithPreviousDecoder(reader, value); };
+
+        // The first run only warms up the caches.
+        MeasureDecode<Decodable>(generated);
+        const uint64_t previousNs  = MeasureDecode<Decodable>(previous);
+        const uint64_t generatedNs = MeasureDecode<Decodable>(generated);
+        ChipLogProgress(Test, "%s: %" PRIu64 " ns/op, %" PRIu64 " ns/op with the previous decoder", name, generatedNs, previousNs);
+    }
+
+    uint8_t mBuffer[512];
+    size_t mLength = 0;
+    TLV::TLVWriter mWriter;
+    TLV::TLVType mOuter;
+};
+
+AttributeValuePair MakeAttributeValuePair()
+{
+    AttributeValuePair value;
+    value.attributeID = 0x4001;
+    value.valueUnsigned8.SetValue(0x12);
+    value.valueSigned8.SetValue(-0x12);
+    value.valueUnsigned16.SetValue(0x1234);
+    value.valueSigned16.SetValue(-0x1234);
+    value.valueUnsigned32.SetValue(0x12345678);
+    value.valueSigned32.SetValue(-0x12345678);
+    value.valueUnsigned64.SetValue(0x123456789abcdef0);
+    value.valueSigned64.SetValue(-0x123456789abcdef0);
+    return value;
+}
+
+void ExpectAttributeValuePair(const AttributeValuePair & value)
+{
+    const AttributeValuePair expected = MakeAttributeValuePair();
+    EXPECT_EQ(value.attributeID, expected.attributeID);
+    EXPECT_EQ(value.valueUnsigned8, expected.valueUnsigned8);
+    EXPECT_EQ(value.valueSigned8, expected.valueSigned8);
+    EXPECT_EQ(value.valueUnsigned16, expected.valueUnsigned16);
+    EXPECT_EQ(value.valueSigned16, expected.valueSigned16);
+    EXPECT_EQ(value.valueUnsigned32, expected.valueUnsigned32);
+    EXPECT_EQ(value.valueSigned32, expected.valueSigned32);
+    EXPECT_EQ(value.valueUnsigned64, expected.valueUnsigned64);
+    EXPECT_EQ(value.valueSigned64, expected.valueSigned64);
+}
+
+TEST_F(TestStructDecoder, TestFieldsInOrder)
+{
+    EncodeObject(MakeAttributeValuePair());
+
+    AttributeValuePair value;
+    EXPECT_EQ(DecodeObject(value), CHIP_NO_ERROR);
+    ExpectAttributeValuePair(value);
+}
+
+TEST_F(TestStructDecoder, TestFieldsOutOfOrder)
+{
+    const AttributeValuePair expected = MakeAttributeValuePair();
+
+    // Unknown tags, before, between and after the known fields, must be skipped.
+    StartStruct();
+    Put(kUnknownFieldTag, true);
+    Put(8, expected.valueSigned64.Value());
+    Put(7, expected.valueUnsigned64.Value());
+    Put(6, expected.valueSigned32.Value());
+    Put(5, expected.valueUnsigned32.Value());
+    Put(kUnknownFieldTag, static_cast<uint8_t>(1));
+    Put(4, expected.valueSigned16.Value());
+    Put(3, expected.valueUnsigned16.Value());
+    Put(0, expected.attributeID);
+    Put(1, expected.valueUnsigned8.Value());
+    Put(2, expected.valueSigned8.Value());
+    Put(kUnknownFieldTag, false);
+    EndStruct();
+
+    AttributeValuePair value;
+    EXPECT_EQ(DecodeObject(value), CHIP_NO_ERROR);
+    ExpectAttributeValuePair(value);
+}
+
+TEST_F(TestStructDecoder, TestRepeatedField)
+{
+    StartStruct();
+    Put(0, static_cast<uint32_t>(1));
+    Put(1, static_cast<uint8_t>(2));
+    Put(0, static_cast<uint32_t>(3));
+    EndStruct();
+
+    // The last occurrence of a field wins, as it did with the previous decoders.
+    AttributeValuePair value;
+    EXPECT_EQ(DecodeObject(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value.attributeID, 3u);
+    EXPECT_EQ(value.valueUnsigned8, MakeOptional(static_cast<uint8_t>(2)));
+    EXPECT_FALSE(value.valueSigned8.HasValue());
+}
+
+TEST_F(TestStructDecoder, TestFieldErrors)
+{
+    // A field of the wrong type fails whether it is the expected next field or has to be looked up.
+    StartStruct();
+    Put(0, static_cast<uint32_t>(1));
+    Put(1, "not a number");
+    EndStruct();
+
+    AttributeValuePair value;
+    EXPECT_EQ(DecodeObject(value), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    StartStruct();
+    Put(2, static_cast<int8_t>(1));
+    Put(0, "not a number");
+    EndStruct();
+
+    EXPECT_EQ(DecodeObject(value), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // Anything but a structure is rejected.
+    mWriter.Init(mBuffer);
+    ASSERT_EQ(mWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, mOuter), CHIP_NO_ERROR);
+    ASSERT_EQ(mWriter.EndContainer(mOuter), CHIP_NO_ERROR);
+    ASSERT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+    mLength = mWriter.GetLengthWritten();
+
+    EXPECT_EQ(DecodeObject(value), CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+TEST_F(TestStructDecoder, TestObjectWithoutFields)
+{
+    StartStruct();
+    Put(kUnknownFieldTag, static_cast<uint8_t>(1));
+    EndStruct();
+
+    BasicInformation::Events::ShutDown::DecodableType shutDown;
+    EXPECT_EQ(DecodeObject(shutDown), CHIP_NO_ERROR);
+}
+
+TEST_F(TestStructDecoder, TestNestedObjects)
+{
+    const uint64_t subjects[] = { 0x1122334455667788, 0x8877665544332211 };
+
+    AccessControl::Structs::AccessControlEntryStruct::Type entry;
+    entry.privilege   = AccessControl::AccessControlEntryPrivilegeEnum::kOperate;
+    entry.authMode    = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+    entry.subjects    = DataModel::MakeNullable(DataModel::List<const uint64_t>(subjects));
+    entry.fabricIndex = 3;
+
+    AccessControl::Events::AccessControlEntryChanged::Type event;
+    event.adminNodeID = DataModel::MakeNullable(static_cast<NodeId>(0x1234));
+    event.changeType  = AccessControl::ChangeTypeEnum::kAdded;
+    event.latestValue = DataModel::MakeNullable(entry);
+    event.fabricIndex = 3;
+    EncodeObject(event);
+
+    EntryChanged value;
+    ASSERT_EQ(DecodeObject(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value.adminNodeID, DataModel::MakeNullable(static_cast<NodeId>(0x1234)));
+    EXPECT_TRUE(value.adminPasscodeID.IsNull());
+    EXPECT_EQ(value.changeType, AccessControl::ChangeTypeEnum::kAdded);
+    ASSERT_FALSE(value.latestValue.IsNull());
+    EXPECT_EQ(value.latestValue.Value().privilege, entry.privilege);
+    EXPECT_EQ(value.latestValue.Value().authMode, entry.authMode);
+    EXPECT_TRUE(value.latestValue.Value().targets.IsNull());
+    EXPECT_EQ(value.latestValue.Value().fabricIndex, 3);
+    ASSERT_FALSE(value.latestValue.Value().subjects.IsNull());
+
+    size_t count = 0;
+    auto iter    = value.latestValue.Value().subjects.Value().begin();
+    while (iter.Next())
+    {
+        ASSERT_LT(count, MATTER_ARRAY_SIZE(subjects));
+        EXPECT_EQ(iter.GetValue(), subjects[count]);
+        count++;
+    }
+    EXPECT_EQ(iter.GetStatus(), CHIP_NO_ERROR);
+    EXPECT_EQ(count, MATTER_ARRAY_SIZE(subjects));
+}
+
+// Not a pass/fail test: logs the decoding time of a few representative objects, with the generated
+// decoders and with the ones generated before them.
+TEST_F(TestStructDecoder, BenchmarkDecode)
+{
+    EncodeObject(MakeAttributeValuePair());
+    LogDecodeTime<AttributeValuePair>("AttributeValuePairStruct");
+
+    const AttributeValuePair pair = MakeAttributeValuePair();
+    StartStruct();
+    Put(8, pair.valueSigned64.Value());
+    Put(7, pair.valueUnsigned64.Value());
+    Put(6, pair.valueSigned32.Value());
+    Put(5, pair.valueUnsigned32.Value());
+    Put(4, pair.valueSigned16.Value());
+    Put(3, pair.valueUnsigned16.Value());
+    Put(2, pair.valueSigned8.Value());
+    Put(1, pair.valueUnsigned8.Value());
+    Put(0, pair.attributeID);
+    EndStruct();
+    LogDecodeTime<AttributeValuePair>("AttributeValuePairStruct, reversed");
+
+    ScenesManagement::Structs::SceneInfoStruct::Type sceneInfo;
+    sceneInfo.sceneCount        = 4;
+    sceneInfo.currentScene      = 2;
+    sceneInfo.currentGroup      = 0x0101;
+    sceneInfo.sceneValid        = true;
+    sceneInfo.remainingCapacity = 12;
+    sceneInfo.fabricIndex       = 1;
+    mWriter.Init(mBuffer);
+    ASSERT_EQ(sceneInfo.EncodeForRead(mWriter, TLV::AnonymousTag(), sceneInfo.fabricIndex), CHIP_NO_ERROR);
+    ASSERT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+    mLength = mWriter.GetLengthWritten();
+    LogDecodeTime<SceneInfo>("SceneInfoStruct");
+
+    const uint64_t subjects[] = { 0x1122334455667788, 0x8877665544332211, 0x0102030405060708 };
+    AccessControl::Structs::AccessControlEntryStruct::Type entry;
+    entry.privilege   = AccessControl::AccessControlEntryPrivilegeEnum::kAdminister;
+    entry.authMode    = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+    entry.subjects    = DataModel::MakeNullable(DataModel::List<const uint64_t>(subjects));
+    entry.fabricIndex = 1;
+    mWriter.Init(mBuffer);
+    ASSERT_EQ(entry.EncodeForRead(mWriter, TLV::AnonymousTag(), entry.fabricIndex), CHIP_NO_ERROR);
+    ASSERT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+    mLength = mWriter.GetLengthWritten();
+    LogDecodeTime<AccessControlEntry>("AccessControlEntryStruct");
+}
+
+} // namespace
@@ -24,6 +24,7 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <limits>
+#include <protocols/secure_channel/CheckinMessage.h>
 
 namespace {
 // FabricIndex is uint8_t, the tlv size with anonymous tag is 1(control bytes) + 1(value) = 2
@@ -395,6 +396,10 @@ CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
         static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(IncreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+    if (mClientInfoCacheLoaded)
+    {
+        CacheClientInfo(clientInfo);
+    }
     ChipLogProgress(ICD,
                     "Store ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId
                     " and checkin nodeId " ChipLogFormatScopedNodeId,
@@ -481,6 +486,7 @@ CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
                                            backingBuffer.Get(), static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(DecreaseEntryCountForFabric(peerNode.GetFabricIndex()));
+    UncacheClientInfo(peerNode);
     ChipLogProgress(ICD, "Remove ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(peerNode));
     return CHIP_NO_ERROR;
@@ -502,6 +508,7 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricIndex).KeyName()));
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricICDClientInfoCounter(fabricIndex).KeyName()));
+    UncacheFabric(fabricIndex);
 
     for (auto fabric = mFabricList.begin(); fabric != mFabricList.end(); fabric++)
     {
@@ -522,24 +529,190 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & payload, ICDClientInfo & clientInfo,
-                                                          Protocols::SecureChannel::CounterType & counter)
+void DefaultICDClientStorage::LoadClientInfoCache()
+{
+    VerifyOrReturn(!mClientInfoCacheLoaded);
+
+    for (auto & fabric_idx : mFabricList)
+    {
+        std::vector<ICDClientInfo> clientInfoVector;
+        size_t clientInfoSize = 0;
+        CHIP_ERROR err        = Load(fabric_idx, clientInfoVector, clientInfoSize);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(ICD, "Failed to load ICD entries for fabric index %u: %" CHIP_ERROR_FORMAT, fabric_idx, err.Format());
+            continue;
+        }
+        for (auto & clientInfo : clientInfoVector)
+        {
+            CacheClientInfo(clientInfo);
+        }
+    }
+
+    mClientInfoCacheLoaded = true;
+}
+
+void DefaultICDClientStorage::CacheClientInfo(const ICDClientInfo & clientInfo)
+{
+    size_t position = 0;
+    for (; position < mClientInfoCache.size(); position++)
+    {
+        if (mClientInfoCache[position].clientInfo.peer_node == clientInfo.peer_node)
+        {
+            break;
+        }
+    }
+
+    if (position == mClientInfoCache.size())
+    {
+        mClientInfoCache.emplace_back();
+    }
+    else
+    {
+        UnindexCachedClientInfo(position);
+    }
+
+    // The counter or the keys may have changed, the nonces of the ICD have to be computed again.
+    mClientInfoCache[position].clientInfo = clientInfo;
+    mClientInfoCache[position].indexed    = false;
+    IndexCachedClientInfo(position);
+}
+
+void DefaultICDClientStorage::UncacheClientInfo(const ScopedNodeId & peerNode)
+{
+    for (size_t position = 0; position < mClientInfoCache.size(); position++)
+    {
+        if (mClientInfoCache[position].clientInfo.peer_node == peerNode)
+        {
+            EraseCachedClientInfo(position);
+            return;
+        }
+    }
+}
+
+void DefaultICDClientStorage::UncacheFabric(FabricIndex fabricIndex)
+{
+    for (size_t position = 0; position < mClientInfoCache.size();)
+    {
+        if (mClientInfoCache[position].clientInfo.peer_node.GetFabricIndex() == fabricIndex)
+        {
+            // The last entry is moved to this position, look at it next.
+            EraseCachedClientInfo(position);
+            continue;
+        }
+        position++;
+    }
+}
+
+void DefaultICDClientStorage::EraseCachedClientInfo(size_t position)
+{
+    size_t last = mClientInfoCache.size() - 1;
+
+    UnindexCachedClientInfo(position);
+    if (position != last)
+    {
+        UnindexCachedClientInfo(last);
+        mClientInfoCache[position] = mClientInfoCache[last];
+        IndexCachedClientInfo(position);
+    }
+    mClientInfoCache.pop_back();
+}
+
+void DefaultICDClientStorage::IndexCachedClientInfo(size_t position)
+{
+    CachedClientInfo & entry = mClientInfoCache[position];
+
+    if (!entry.indexed)
+    {
+        // The next Check-In messages carry the counters following the last one processed for this ICD.
+        Protocols::SecureChannel::CounterType lastCounter = entry.clientInfo.start_icd_counter + entry.clientInfo.offset;
+        for (size_t i = 0; i < kCheckInNonceWindow; i++)
+        {
+            uint8_t nonce[Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+            Encoding::LittleEndian::BufferWriter writer(nonce, sizeof(nonce));
+            auto counter   = static_cast<Protocols::SecureChannel::CounterType>(lastCounter + i + 1);
+            CHIP_ERROR err = Protocols::SecureChannel::CheckinMessage::GenerateCheckInMessageNonce(
+                entry.clientInfo.hmac_key_handle, counter, writer);
+            if (err != CHIP_NO_ERROR)
+            {
+                // The ICD will only be found by trying the keys of every registered ICD.
+                ChipLogError(ICD, "Failed to compute the Check-In nonces of " ChipLogFormatScopedNodeId ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueScopedNodeId(entry.clientInfo.peer_node), err.Format());
+                return;
+            }
+            entry.nonceTags[i] = GetNonceTag(nonce);
+        }
+        entry.indexed = true;
+    }
+
+    for (auto tag : entry.nonceTags)
+    {
+        mCheckInNonceIndex.emplace(tag, position);
+    }
+}
+
+void DefaultICDClientStorage::UnindexCachedClientInfo(size_t position)
+{
+    CachedClientInfo & entry = mClientInfoCache[position];
+    VerifyOrReturn(entry.indexed);
+
+    for (auto tag : entry.nonceTags)
+    {
+        auto candidates = mCheckInNonceIndex.equal_range(tag);
+        for (auto it = candidates.first; it != candidates.second; ++it)
+        {
+            if (it->second == position)
+            {
+                mCheckInNonceIndex.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+bool DefaultICDClientStorage::DecodeCheckInPayload(const ICDClientInfo & clientInfo, const ByteSpan & payload,
+                                                   Protocols::SecureChannel::CounterType & counter)
 {
     uint8_t appDataBuffer[kAppDataLength];
     MutableByteSpan appData(appDataBuffer);
-    auto * iterator = IterateICDClientInfo();
-    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
-    while (iterator->Next(clientInfo))
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    mCheckInDecryptionCount++;
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    return Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
+               clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter, appData) == CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & payload, ICDClientInfo & clientInfo,
+                                                          Protocols::SecureChannel::CounterType & counter)
+{
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    mCheckInDecryptionCount = 0;
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    LoadClientInfoCache();
+
+    if (payload.size() >= Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES)
     {
-        CHIP_ERROR err = chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
-            clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter, appData);
-        if (CHIP_NO_ERROR == err)
+        auto candidates = mCheckInNonceIndex.equal_range(GetNonceTag(payload.data()));
+        for (auto it = candidates.first; it != candidates.second; ++it)
         {
-            iterator->Release();
+            if (DecodeCheckInPayload(mClientInfoCache[it->second].clientInfo, payload, counter))
+            {
+                clientInfo = mClientInfoCache[it->second].clientInfo;
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+
+    // The sender may have sent more Check-In messages than we have nonces for since the last one we processed.
+    for (auto & entry : mClientInfoCache)
+    {
+        if (DecodeCheckInPayload(entry.clientInfo, payload, counter))
+        {
+            clientInfo = entry.clientInfo;
             return CHIP_NO_ERROR;
         }
     }
-    iterator->Release();
+
     return CHIP_ERROR_NOT_FOUND;
 }
 
@@ -549,6 +722,9 @@ void DefaultICDClientStorage::Shutdown()
     mpClientInfoStore = nullptr;
     mpKeyStore        = nullptr;
     mFabricList.clear();
+    mClientInfoCache.clear();
+    mCheckInNonceIndex.clear();
+    mClientInfoCacheLoaded = false;
 }
 
 } // namespace app
@@ -27,12 +27,14 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/ScopedNodeId.h>
 #include <lib/core/TLV.h>
 #include <lib/support/CommonIterator.h>
 #include <lib/support/Pool.h>
+#include <unordered_map>
 #include <vector>
 
 // TODO: SymmetricKeystore is an alias for SessionKeystore, replace the below when sdk supports SymmetricKeystore
@@ -75,7 +77,8 @@ public:
         ICDClientInfoIterator * mpICDClientInfoIterator = nullptr;
     };
 
-    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax       = CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS;
+    static constexpr size_t kCheckInNonceWindow = CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW;
 
     CHIP_ERROR Init(PersistentStorageDelegate * clientInfoStore, Crypto::SymmetricKeystore * keyStore);
 
@@ -117,6 +120,13 @@ public:
      */
     CHIP_ERROR DeleteAllEntries(FabricIndex fabricIndex);
 
+    /**
+     * Find the registered ICD that sent a Check-In message, and decrypt it.
+     *
+     * The registered ICDs are kept in memory once the first Check-In message is received, along with an index of the
+     * nonces of the next kCheckInNonceWindow Check-In messages expected from each of them. A message whose nonce is in the
+     * index is decrypted with the keys of the matching ICD only; otherwise the keys of every registered ICD are tried.
+     */
     CHIP_ERROR ProcessCheckInPayload(const ByteSpan & payload, ICDClientInfo & clientInfo,
                                      Protocols::SecureChannel::CounterType & counter) override;
 
@@ -130,6 +140,9 @@ public:
     size_t GetFabricListSize() { return mFabricList.size(); }
 
     PersistentStorageDelegate * GetClientInfoStore() { return mpClientInfoStore; }
+
+    // Number of ICDs whose keys were tried by the last call to ProcessCheckInPayload
+    size_t GetCheckInDecryptionCount() { return mCheckInDecryptionCount; }
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
 protected:
@@ -198,11 +211,42 @@ private:
     CHIP_ERROR SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ICDClientInfo> & clientInfoVector);
     CHIP_ERROR Load(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector, size_t & clientInfoSize);
 
+    struct CachedClientInfo
+    {
+        ICDClientInfo clientInfo;
+        // Tags of the nonces of the next kCheckInNonceWindow Check-In messages expected from the ICD.
+        uint32_t nonceTags[kCheckInNonceWindow];
+        bool indexed = false;
+    };
+
+    void LoadClientInfoCache();
+    void CacheClientInfo(const ICDClientInfo & clientInfo);
+    void UncacheClientInfo(const ScopedNodeId & peerNode);
+    void UncacheFabric(FabricIndex fabricIndex);
+    void EraseCachedClientInfo(size_t position);
+    void IndexCachedClientInfo(size_t position);
+    void UnindexCachedClientInfo(size_t position);
+    bool DecodeCheckInPayload(const ICDClientInfo & clientInfo, const ByteSpan & payload,
+                              Protocols::SecureChannel::CounterType & counter);
+
+    // The nonce of a Check-In message is sent in clear, its first bytes are used as the index key.
+    static uint32_t GetNonceTag(const uint8_t * nonce) { return Encoding::LittleEndian::Get32(nonce); }
+
     ObjectPool<ICDClientInfoIteratorImpl, kIteratorsMax> mICDClientInfoIterators;
 
     PersistentStorageDelegate * mpClientInfoStore = nullptr;
     Crypto::SymmetricKeystore * mpKeyStore        = nullptr;
     std::vector<FabricIndex> mFabricList;
+
+    // In-memory copy of the ICDClientInfos of every fabric in mFabricList, loaded on the first Check-In message and kept in
+    // sync with the persistent storage after that.
+    bool mClientInfoCacheLoaded = false;
+    std::vector<CachedClientInfo> mClientInfoCache;
+    // Maps the nonce tags of the expected Check-In messages to positions in mClientInfoCache.
+    std::unordered_multimap<uint32_t, size_t> mCheckInNonceIndex;
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    size_t mCheckInDecryptionCount = 0;
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 };
 } // namespace app
 } // namespace chip
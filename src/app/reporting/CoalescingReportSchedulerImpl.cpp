@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/CoalescingReportSchedulerImpl.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
+
+static_assert(CoalescingReportSchedulerImpl::kWheelSlots > 0, "CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS must be greater than zero");
+
+CoalescingReportSchedulerImpl::CoalescingReportSchedulerImpl(TimerDelegate * aTimerDelegate, Milliseconds32 aCoalescingWindow) :
+    ReportSchedulerImpl(aTimerDelegate), mCoalescingWindow(aCoalescingWindow)
+{
+    VerifyOrDie(mCoalescingWindow > Milliseconds32(0));
+}
+
+void CoalescingReportSchedulerImpl::OnReadHandlerDestroyed(ReadHandler * aReadHandler)
+{
+    ReadHandlerNode * removeNode = FindReadHandlerNode(aReadHandler);
+    // Nothing to remove if the handler is not found in the list
+    VerifyOrReturn(nullptr != removeNode);
+
+    removeNode->Unlink();
+    mNodesPool.ReleaseObject(removeNode);
+
+    if (!mNodesPool.Allocated())
+    {
+        // Only cancel the timer if there are no more handlers registered
+        CancelReport();
+    }
+}
+
+bool CoalescingReportSchedulerImpl::IsReportScheduled(ReadHandler * aReadHandler)
+{
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    VerifyOrReturnValue(nullptr != node, false);
+    return node->IsInList() && mTimerDelegate->IsTimerActive(this);
+}
+
+CHIP_ERROR CoalescingReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now)
+{
+    node->Unlink();
+
+    if (timeout == Milliseconds32(0))
+    {
+        // An engine run is needed anyway, so let every other node due within the coalescing window report in the same run.
+        node->SetEngineRunScheduled(true);
+        CollectDueNodes(now);
+        ReportTimerCallback();
+        return UpdateTimer(now);
+    }
+
+    Timestamp deadline = now + timeout;
+    InsertNode(node, deadline);
+
+    // The timer only needs to move when this node is now the earliest deadline.
+    VerifyOrReturnError(!mTimerDelegate->IsTimerActive(this) || deadline < mNextReportTimestamp, CHIP_NO_ERROR);
+
+    mTimerDelegate->CancelTimer(this);
+    mNextReportTimestamp = deadline;
+    return mTimerDelegate->StartTimer(this, timeout);
+}
+
+void CoalescingReportSchedulerImpl::CancelReport()
+{
+    mTimerDelegate->CancelTimer(this);
+}
+
+void CoalescingReportSchedulerImpl::TimerFired()
+{
+    Timestamp now        = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    bool engineRunNeeded = CollectDueNodes(now);
+
+    LogErrorOnFailure(UpdateTimer(now));
+
+    if (engineRunNeeded)
+    {
+        ReportTimerCallback();
+    }
+}
+
+void CoalescingReportSchedulerImpl::InsertNode(ReadHandlerNode * node, const Timestamp & deadline)
+{
+    node->SetDeadline(deadline);
+    SlotForTick(ToTick(deadline)).PushBack(node);
+}
+
+bool CoalescingReportSchedulerImpl::CollectDueNodes(const Timestamp & now)
+{
+    Timestamp horizon    = now + mCoalescingWindow;
+    bool engineRunNeeded = false;
+
+    // No node in the wheel has a deadline earlier than mNextReportTimestamp, which can be in the past if the timer fired late.
+    uint64_t firstTick = ToTick(std::min(mNextReportTimestamp, now));
+    uint64_t slotCount = std::min<uint64_t>(ToTick(horizon) - firstTick + 1, kWheelSlots);
+
+    for (uint64_t tick = firstTick; tick < firstTick + slotCount; tick++)
+    {
+        WheelSlot & slot = SlotForTick(tick);
+        for (auto it = slot.begin(); it != slot.end();)
+        {
+            ReadHandlerNode * node = &(*it);
+            ++it;
+
+            if (node->GetDeadline() > horizon)
+            {
+                // Due in a later revolution of the wheel
+                continue;
+            }
+
+            if (node->GetMinTimestamp() > now)
+            {
+                // Never report before the min interval, the node stays in the wheel until its deadline
+                continue;
+            }
+
+            node->Unlink();
+            node->SetEngineRunScheduled(true);
+            engineRunNeeded = true;
+        }
+    }
+
+    return engineRunNeeded;
+}
+
+bool CoalescingReportSchedulerImpl::FindNextDeadline(const Timestamp & now, Timestamp & deadline)
+{
+    uint64_t nowTick = ToTick(now);
+    bool wheelEmpty  = true;
+
+    for (uint64_t tick = nowTick; tick < nowTick + kWheelSlots; tick++)
+    {
+        bool found = false;
+        for (auto & node : SlotForTick(tick))
+        {
+            wheelEmpty = false;
+            if (ToTick(node.GetDeadline()) <= tick && (!found || node.GetDeadline() < deadline))
+            {
+                deadline = node.GetDeadline();
+                found    = true;
+            }
+        }
+
+        if (found)
+        {
+            return true;
+        }
+    }
+
+    VerifyOrReturnValue(!wheelEmpty, false);
+
+    // All deadlines are more than one revolution away
+    deadline = Timestamp((nowTick + kWheelSlots) * mCoalescingWindow.count());
+    return true;
+}
+
+CHIP_ERROR CoalescingReportSchedulerImpl::UpdateTimer(const Timestamp & now)
+{
+    Timestamp deadline;
+    if (!FindNextDeadline(now, deadline))
+    {
+        CancelReport();
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(!mTimerDelegate->IsTimerActive(this) || deadline != mNextReportTimestamp, CHIP_NO_ERROR);
+
+    mTimerDelegate->CancelTimer(this);
+    mNextReportTimestamp = deadline;
+    return mTimerDelegate->StartTimer(this, (deadline > now) ? Timeout(deadline - now) : Timeout(0));
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,141 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/support/IntrusiveList.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class CoalescingReportSchedulerImpl
+ *
+ * @brief This class extends ReportSchedulerImpl and replaces the per-node timers with a single timer driven by a timing wheel.
+ *
+ * It is intended for devices that serve many subscriptions at once, such as bridges, where the one-timer-per-handler approach of
+ * ReportSchedulerImpl results in a system timer being cancelled and restarted for every dirty attribute and every report sent,
+ * and in one wakeup per handler deadline.
+ *
+ * ## Scheduling Logic
+ *
+ * - The deadline of each node is calculated the same way as in ReportSchedulerImpl: now if the node is reportable now, its min
+ *   timestamp if its ReadHandler is dirty, and its max timestamp otherwise.
+ *
+ * - Nodes waiting for their deadline are kept in a timing wheel of CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS slots, each slot
+ *   covering one coalescing window. Moving a node to a new deadline is O(1) and does not touch the system timer unless the new
+ *   deadline is earlier than the one the timer is armed for.
+ *
+ * - A single scheduler timer is armed for the earliest deadline in the wheel. When it fires, or when a node becomes reportable
+ *   immediately, every node whose deadline falls within the coalescing window and whose min interval has elapsed is flagged as
+ *   EngineRunScheduled, so that all of their reports are emitted by the same Engine::Run pass.
+ *
+ * - A report may therefore be emitted up to one coalescing window before the node's max interval, but never before its min
+ *   interval.
+ *
+ * @note Like ReportSchedulerImpl, this implementation does not take any action on ICD state changes besides the forced reports
+ * on entering active mode.
+ */
+class CoalescingReportSchedulerImpl : public ReportSchedulerImpl, public TimerContext
+{
+public:
+    static constexpr size_t kWheelSlots = CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS;
+
+    /**
+     * @param[in] aTimerDelegate Timer delegate used to arm the scheduler timer.
+     * @param[in] aCoalescingWindow Width of a timing wheel slot: reports due within this window of an engine run are emitted in
+     *                              that run. Must be greater than zero.
+     */
+    CoalescingReportSchedulerImpl(TimerDelegate * aTimerDelegate,
+                                  System::Clock::Milliseconds32 aCoalescingWindow =
+                                      System::Clock::Milliseconds32(CHIP_CONFIG_REPORT_SCHEDULER_COALESCING_WINDOW_MS));
+    ~CoalescingReportSchedulerImpl() override { UnregisterAllHandlers(); }
+
+    void OnReadHandlerDestroyed(ReadHandler * aReadHandler) override;
+
+    /**
+     * @brief Checks if a report is scheduled for the ReadHandler, meaning that its node is waiting in the timing wheel and the
+     * scheduler timer is active.
+     */
+    bool IsReportScheduled(ReadHandler * aReadHandler) override;
+
+    /**
+     * @brief Callback called when the scheduler timer expires.
+     *
+     * Flags every node due within the coalescing window, schedules a single engine run for all of them if any, and re-arms the
+     * timer for the next deadline in the wheel.
+     */
+    void TimerFired() override;
+
+protected:
+    /**
+     * @brief Place the node in the timing wheel at now + timeout, or emit its report right away if the timeout is 0.
+     *
+     * When the report is emitted right away, the other nodes due within the coalescing window are emitted in the same engine run.
+     *
+     * @return CHIP_ERROR CHIP_NO_ERROR on success, timer-related error code otherwise (This can only fail on starting the timer)
+     */
+    CHIP_ERROR ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now) override;
+    void CancelReport();
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    using WheelSlot = IntrusiveList<ReadHandlerNode, IntrusiveMode::AutoUnlink>;
+
+    uint64_t ToTick(const Timestamp & timestamp) const { return timestamp.count() / mCoalescingWindow.count(); }
+    WheelSlot & SlotForTick(uint64_t tick) { return mWheel[tick % kWheelSlots]; }
+
+    void InsertNode(ReadHandlerNode * node, const Timestamp & deadline);
+
+    /**
+     * @brief Remove from the wheel and flag as EngineRunScheduled every node that is due within the coalescing window and
+     * past its min interval.
+     *
+     * @return true if at least one node was flagged and an engine run is needed.
+     */
+    bool CollectDueNodes(const Timestamp & now);
+
+    /**
+     * @brief Find the earliest deadline in the wheel.
+     *
+     * Only one revolution of the wheel is looked at; if all nodes are further away, the end of that revolution is returned so
+     * that the wheel gets looked at again then.
+     *
+     * @return false if the wheel is empty.
+     */
+    bool FindNextDeadline(const Timestamp & now, Timestamp & deadline);
+
+    /**
+     * @brief Make sure the scheduler timer is armed for the earliest deadline in the wheel, restarting the system timer only if
+     * that deadline changed.
+     */
+    CHIP_ERROR UpdateTimer(const Timestamp & now);
+
+    WheelSlot mWheel[kWheelSlots];
+    System::Clock::Milliseconds32 mCoalescingWindow;
+
+    // Timestamp the scheduler timer is armed for. It is never later than the deadline of any node in the wheel.
+    Timestamp mNextReportTimestamp = System::Clock::Milliseconds64(0);
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
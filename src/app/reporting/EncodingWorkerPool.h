@@ -0,0 +1,52 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class EncodingWorkerPool
+ *
+ * @brief Interface between the reporting engine and the threads it may encode reports on.
+ *
+ * The reporting engine does not create threads: platforms that want reports of several ReadHandlers to be encoded in parallel
+ * (see CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING) provide an implementation backed by their own worker threads.
+ */
+class EncodingWorkerPool
+{
+public:
+    using Work = void (*)(void * apContext, size_t aIndex);
+
+    virtual ~EncodingWorkerPool() {}
+
+    /// @brief Run aWork(apContext, i) for every i in [0, aCount) and return once all of them have returned.
+    ///
+    /// Calls may run concurrently with each other, in any order and on any thread, including the calling one. The calling
+    /// (Matter) thread is blocked until this returns, so aWork may use the Matter stack state it is given but must not wait on
+    /// the Matter thread.
+    virtual void RunAndWait(Work aWork, void * apContext, size_t aCount) = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
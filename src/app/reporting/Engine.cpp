@@ -18,8 +18,10 @@
 
 #include <access/AccessRestrictionProvider.h>
 #include <access/Privilege.h>
+#include <app-common/zap-generated/ids/Clusters.h>
 #include <app/AppConfig.h>
 #include <app/AttributePathExpandIterator.h>
+#include <app/AttributeReportBuilder.h>
 #include <app/ConcreteEventPath.h>
 #include <app/GlobalAttributes.h>
 #include <app/InteractionModelEngine.h>
@@ -39,6 +41,12 @@
 
 #include <optional>
 
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+#include <mutex>
+
+#include <system/SystemMutex.h>
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
 #include <app/icd/server/ICDNotifier.h> // nogncheck
 #endif
@@ -53,6 +61,36 @@ namespace {
 using DataModel::ReadFlags;
 using Protocols::InteractionModel::Status;
 
+// Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
+constexpr uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
+
+// Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
+// context tag, 1 byte for value
+constexpr uint32_t kReservedSizeForIMRevision = 1 + 1 + 1;
+
+// Reserved size for the end of report message, which is an end-of-container (i.e 1 byte for the control tag).
+constexpr uint32_t kReservedSizeForEndOfReportMessage = 1;
+
+// Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
+constexpr uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
+
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+// Access control (including its delegate and the access restriction provider) and the data model callbacks are single
+// threaded, while RetrieveClusterData may run on several encoding workers at once: its calls into them hold this lock.
+System::Mutex sSingleThreadedCallsLock;
+bool sSingleThreadedCallsLockInitialized = false;
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
+/// Runs `call` with sSingleThreadedCallsLock held when reports may be encoded in parallel.
+template <typename Call>
+auto CallSingleThreaded(Call && call)
+{
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    std::lock_guard<System::Mutex> lock(sSingleThreadedCallsLock);
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    return call();
+}
+
 /// Returns the status of ACL validation.
 ///   If the return value has a status set, that means the ACL check failed,
 ///   the read must not be performed, and the returned status (which may
@@ -70,7 +108,8 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & sub
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err =
+        CallSingleThreaded([&] { return GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege); });
     if (err == CHIP_NO_ERROR)
     {
         return std::nullopt;
@@ -107,12 +146,16 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
 
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  DataModel::ServerClusterFinder & serverClusterFinder,
+                                                  DataModel::AttributeFinder & attributeFinder)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
-    DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
-                                                          DataModelCallbacks::OperationOrder::Pre, path);
+    CallSingleThreaded([&] {
+        DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                              DataModelCallbacks::OperationOrder::Pre, path);
+    });
 
     DataModel::ReadAttributeRequest readRequest;
 
@@ -120,8 +163,6 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     readRequest.subjectDescriptor = &subjectDescriptor;
     readRequest.path              = path;
 
-    DataModel::ServerClusterFinder serverClusterFinder(dataModel);
-
     DataVersion version = 0;
     if (auto clusterInfo = serverClusterFinder.Find(path); clusterInfo.has_value())
     {
@@ -149,8 +190,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     // View, to determine if the subject would have had at least some access against the concrete path. This is done so we don't
     // leak information if we do fail existence checks.
 
-    DataModel::AttributeFinder finder(dataModel);
-    std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
+    std::optional<DataModel::AttributeEntry> entry = attributeFinder.Find(path);
 
     if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
     {
@@ -187,8 +227,10 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
         //
         //       For now this preserves existing/previous code logic, however we should consider to ALWAYS
         //       call this.
-        DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
-                                                              DataModelCallbacks::OperationOrder::Post, path);
+        CallSingleThreaded([&] {
+            DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                                  DataModelCallbacks::OperationOrder::Post, path);
+        });
         return status;
     }
 
@@ -222,6 +264,50 @@ bool IsClusterDataVersionEqualTo(DataModel::Provider * dataModel, const Concrete
     return info.has_value() && (info->dataVersion == dataVersion);
 }
 
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+/// Checks whether the smallest AttributeReportIB that can be encoded for `path` fits in `reportBuilder`: attribute data
+/// with the smallest data version and a null value. Every data or status report for `path` is at least that large.
+bool SmallestAttributeReportFits(AttributeReportIBs::Builder & reportBuilder, const ConcreteReadAttributePath & path)
+{
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+
+    AttributeReportBuilder attributeReportBuilder;
+    CHIP_ERROR err = attributeReportBuilder.PrepareAttribute(reportBuilder, ConcreteDataAttributePath(path), 0 /* aDataVersion */);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = attributeReportBuilder.EncodeValue(reportBuilder, TLV::ContextTag(AttributeDataIB::Tag::kData),
+                                                 DataModel::Nullable<uint8_t>());
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = attributeReportBuilder.FinishAttribute(reportBuilder);
+    }
+
+    reportBuilder.Rollback(checkpoint);
+    return err == CHIP_NO_ERROR;
+}
+
+/// Checks whether reading `path` would leave it out of the report without encoding anything, which wildcard expansion does
+/// for attributes the subject has no access to (see ValidateReadAttributeACL).
+bool IsOmittedByAccessControl(const SubjectDescriptor & subjectDescriptor, const ConcreteReadAttributePath & path,
+                              const std::optional<DataModel::AttributeEntry> & entry)
+{
+    VerifyOrReturnValue(path.mExpanded, false);
+
+    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    {
+        return *access_status == CHIP_NO_ERROR;
+    }
+
+    // Unsupported or unreadable attributes get a status report.
+    VerifyOrReturnValue(entry.has_value() && entry->GetReadPrivilege().has_value(), false);
+
+    auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
+    return required_privilege_status.has_value() && *required_privilege_status == CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
 /// Check if the given `err` is a known ACL error that can be translated into
 /// a StatusIB (UnsupportedAccess/AccessRestricted)
 ///
@@ -309,6 +395,14 @@ CHIP_ERROR Engine::Init(EventManagement * apEventManagement)
     mCurReadHandlerIdx  = 0;
     mpEventManagement   = apEventManagement;
 
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    if (!sSingleThreadedCallsLockInitialized)
+    {
+        ReturnErrorOnFailure(System::Mutex::Init(sSingleThreadedCallsLock));
+        sSingleThreadedCallsLockInitialized = true;
+    }
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
     return CHIP_NO_ERROR;
 }
 
@@ -394,6 +488,14 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
         uint32_t attributesRead = 0;
 #endif
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+        // Smallest AttributeReportIB encoded in this chunk for a non-list attribute, 0 until there is one.
+        uint32_t smallestAttributeReportSize = 0;
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
+        // Paths are expanded cluster by cluster, so the metadata looked up for one attribute is reused for the next ones.
+        DataModel::ServerClusterFinder serverClusterFinder(mpImEngine->GetDataModelProvider());
+        DataModel::AttributeFinder attributeFinder(mpImEngine->GetDataModelProvider());
 
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
@@ -402,23 +504,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                if (!IsConcretePathDirty(apReadHandler, readPath))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -440,6 +526,28 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             }
 #endif
 
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+            // Lists are left alone: a list that does not fit at all still saves its encode state for the next chunk.
+            std::optional<DataModel::AttributeEntry> attributeEntry = attributeFinder.Find(readPath);
+            bool isSingleValueAttribute =
+                attributeEntry.has_value() && !attributeEntry->HasFlags(DataModel::AttributeQualityFlags::kListAttribute);
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+            isSingleValueAttribute = isSingleValueAttribute && mChunkPlanningEnabled;
+#endif
+
+            // If not even the smallest report of this path fits, reading the attribute could only produce data to roll back:
+            // end the chunk here, the attribute will be the first one of the next chunk. Chunks end exactly where they would
+            // have otherwise. The check is only made once the space left is below the smallest report of this chunk.
+            if (isSingleValueAttribute && attributeReportIBs.GetWriter()->GetRemainingFreeLength() < smallestAttributeReportSize &&
+                !SmallestAttributeReportFits(attributeReportIBs, readPath) &&
+                !IsOmittedByAccessControl(apReadHandler->GetSubjectDescriptor(), readPath, attributeEntry))
+            {
+                ChipLogDetail(DataManagement, "Chunk is full, next attribute goes in the next chunk");
+                ExitNow(err = CHIP_ERROR_BUFFER_TOO_SMALL);
+            }
+            const uint32_t attributeReportStart = attributeReportIBs.GetWriter()->GetLengthWritten();
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
             // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty
             // paths.
             TLV::TLVWriter attributeBackup;
@@ -447,12 +555,13 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
+            encodeState.SetListEncodeCache(apReadHandler->GetListEncodeCache());
             BitFlags<ReadFlags> flags;
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
             DataModel::ActionReturnStatus status =
                 RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                                    attributeReportIBs, pathForRetrieval, &encodeState, serverClusterFinder, attributeFinder);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -512,6 +621,17 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             SuccessOrExit(err);
             // Successfully encoded the attribute, clear the internal state.
             apReadHandler->SetAttributeEncodeState(AttributeEncodeState());
+
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+            if (isSingleValueAttribute)
+            {
+                const uint32_t attributeReportSize = attributeReportIBs.GetWriter()->GetLengthWritten() - attributeReportStart;
+                if (smallestAttributeReportSize == 0 || attributeReportSize < smallestAttributeReportSize)
+                {
+                    smallestAttributeReportSize = attributeReportSize;
+                }
+            }
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
         }
 
         // We just visited all paths interested by this read handler and did not abort in the middle of iteration, there are no more
@@ -728,57 +848,53 @@ exit:
 
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    System::PacketBufferTLVWriter reportDataWriter;
-    ReportDataMessage::Builder reportDataBuilder;
-    System::PacketBufferHandle bufHandle = nullptr;
-    uint16_t reservedSize                = 0;
-    bool hasMoreChunks                   = false;
-    bool needCloseReadHandler            = false;
-    size_t reportBufferMaxSize           = 0;
+    VerifyOrReturnError(apReadHandler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
-    const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
+    ReportDataContext context;
+    context.mpReadHandler = apReadHandler;
 
-    // Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
-    // context tag, 1 byte for value
-    const uint32_t kReservedSizeForIMRevision = 1 + 1 + 1;
-
-    // Reserved size for the end of report message, which is an end-of-container (i.e 1 byte for the control tag).
-    const uint32_t kReservedSizeForEndOfReportMessage = 1;
+    CHIP_ERROR err = PrepareReportData(context);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = EncodeReportDataAttributes(context);
+    }
+    return FinishAndSendReportData(context, err);
+}
 
-    // Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
-    const uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
+CHIP_ERROR Engine::PrepareReportData(ReportDataContext & aContext)
+{
+    ReadHandler * readHandler            = aContext.mpReadHandler;
+    System::PacketBufferHandle bufHandle = nullptr;
+    uint16_t reservedSize                = 0;
+    size_t reportBufferMaxSize           = 0;
 
-    VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(readHandler->GetSession() != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    reportBufferMaxSize = apReadHandler->GetReportBufferMaxSize();
+    reportBufferMaxSize = readHandler->GetReportBufferMaxSize();
 
-    bufHandle = System::PacketBufferHandle::New(reportBufferMaxSize);
-    VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    bufHandle = readHandler->AllocateReportBuffer(reportBufferMaxSize);
+    VerifyOrReturnError(!bufHandle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     if (bufHandle->AvailableDataLength() > reportBufferMaxSize)
     {
         reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - reportBufferMaxSize);
     }
 
-    reportDataWriter.Init(std::move(bufHandle));
+    aContext.mWriter.Init(std::move(bufHandle));
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    reportDataWriter.ReserveBuffer(mReservedSize);
+    aContext.mWriter.ReserveBuffer(mReservedSize);
 #endif
 
     // Always limit the size of the generated packet to fit within the max size returned by the ReadHandler regardless
     // of the available buffer capacity.
     // Also, we need to reserve some extra space for the MIC field.
-    reportDataWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
+    aContext.mWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
 
     // Create a report data.
-    err = reportDataBuilder.Init(&reportDataWriter);
-    SuccessOrExit(err);
+    ReturnErrorOnFailure(aContext.mBuilder.Init(&aContext.mWriter));
 
-    if (apReadHandler->IsType(ReadHandler::InteractionType::Subscribe))
+    if (readHandler->IsType(ReadHandler::InteractionType::Subscribe))
     {
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
         // Notify the ICDManager that we are about to send a subscription report before we prepare the Report payload.
@@ -787,34 +903,46 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
 
         SubscriptionId subscriptionId = 0;
-        apReadHandler->GetSubscriptionId(subscriptionId);
-        reportDataBuilder.SubscriptionId(subscriptionId);
+        readHandler->GetSubscriptionId(subscriptionId);
+        aContext.mBuilder.SubscriptionId(subscriptionId);
     }
 
-    SuccessOrExit(err = reportDataWriter.ReserveBuffer(kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision +
-                                                       kReservedSizeForEndOfReportMessage + kReservedSizeForEventReportIBs));
+    return aContext.mWriter.ReserveBuffer(kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision +
+                                          kReservedSizeForEndOfReportMessage + kReservedSizeForEventReportIBs);
+}
+
+CHIP_ERROR Engine::EncodeReportDataAttributes(ReportDataContext & aContext)
+{
+    return BuildSingleReportDataAttributeReportIBs(aContext.mBuilder, aContext.mpReadHandler, &aContext.mHasMoreChunksForAttributes,
+                                                   &aContext.mHasEncodedAttributes);
+}
+
+CHIP_ERROR Engine::FinishAndSendReportData(ReportDataContext & aContext, CHIP_ERROR aError)
+{
+    CHIP_ERROR err                       = aError;
+    ReadHandler * readHandler            = aContext.mpReadHandler;
+    System::PacketBufferHandle bufHandle = nullptr;
+    bool hasMoreChunks                   = false;
+    bool needCloseReadHandler            = false;
+
+    SuccessOrExit(err);
 
     {
-        bool hasMoreChunksForAttributes = false;
-        bool hasMoreChunksForEvents     = false;
-        bool hasEncodedAttributes       = false;
-        bool hasEncodedEvents           = false;
+        bool hasMoreChunksForEvents = false;
+        bool hasEncodedEvents       = false;
 
-        err = BuildSingleReportDataAttributeReportIBs(reportDataBuilder, apReadHandler, &hasMoreChunksForAttributes,
-                                                      &hasEncodedAttributes);
-        SuccessOrExit(err);
-        SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForEventReportIBs));
-        err = BuildSingleReportDataEventReports(reportDataBuilder, apReadHandler, hasEncodedAttributes, &hasMoreChunksForEvents,
-                                                &hasEncodedEvents);
+        SuccessOrExit(err = aContext.mWriter.UnreserveBuffer(kReservedSizeForEventReportIBs));
+        err = BuildSingleReportDataEventReports(aContext.mBuilder, readHandler, aContext.mHasEncodedAttributes,
+                                                &hasMoreChunksForEvents, &hasEncodedEvents);
         SuccessOrExit(err);
 
-        hasMoreChunks = hasMoreChunksForAttributes || hasMoreChunksForEvents;
+        hasMoreChunks = aContext.mHasMoreChunksForAttributes || hasMoreChunksForEvents;
 
-        if (!hasEncodedAttributes && !hasEncodedEvents && hasMoreChunks)
+        if (!aContext.mHasEncodedAttributes && !hasEncodedEvents && hasMoreChunks)
         {
             ChipLogError(DataManagement,
                          "No data actually encoded but hasMoreChunks flag is set, close read handler! (attribute too big?)");
-            err = apReadHandler->SendStatusReport(Protocols::InteractionModel::Status::ResourceExhausted);
+            err = readHandler->SendStatusReport(Protocols::InteractionModel::Status::ResourceExhausted);
             if (err == CHIP_NO_ERROR)
             {
                 needCloseReadHandler = true;
@@ -823,31 +951,31 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
         }
     }
 
-    SuccessOrExit(err = reportDataBuilder.GetError());
-    SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision +
+    SuccessOrExit(err = aContext.mBuilder.GetError());
+    SuccessOrExit(err = aContext.mWriter.UnreserveBuffer(kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision +
                                                          kReservedSizeForEndOfReportMessage));
     if (hasMoreChunks)
     {
-        reportDataBuilder.MoreChunkedMessages(true);
+        aContext.mBuilder.MoreChunkedMessages(true);
     }
-    else if (apReadHandler->IsType(ReadHandler::InteractionType::Read))
+    else if (readHandler->IsType(ReadHandler::InteractionType::Read))
     {
-        reportDataBuilder.SuppressResponse(true);
+        aContext.mBuilder.SuppressResponse(true);
     }
 
-    reportDataBuilder.EndOfReportDataMessage();
+    aContext.mBuilder.EndOfReportDataMessage();
 
     //
     // Since we've already reserved space for both the MoreChunked/SuppressResponse flags, as well as
     // the end-of-container flag for the end of the report, we should never hit an error closing out the message.
     //
-    VerifyOrDie(reportDataBuilder.GetError() == CHIP_NO_ERROR);
+    VerifyOrDie(aContext.mBuilder.GetError() == CHIP_NO_ERROR);
 
-    err = reportDataWriter.Finalize(&bufHandle);
+    err = aContext.mWriter.Finalize(&bufHandle);
     SuccessOrExit(err);
 
-    ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
-    err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
+    ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", aContext.mWriter.GetLengthWritten());
+    err = SendReport(readHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
@@ -855,7 +983,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
                   mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
-    if (err != CHIP_NO_ERROR || (apReadHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
+    if (err != CHIP_NO_ERROR || (readHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
         needCloseReadHandler)
     {
         //
@@ -863,12 +991,44 @@ exit:
         // any further activity on this exchange. The EC layer will automatically close our EC, so shutdown the ReadHandler
         // gracefully.
         //
-        apReadHandler->Close();
+        readHandler->Close();
     }
 
     return err;
 }
 
+bool Engine::IsConcretePathDirty(const ReadHandler * apReadHandler, const ConcreteAttributePath & aPath)
+{
+    // We don't need to worry about paths that were already marked dirty before the last time this read handler
+    // started a report that it completed: those paths already got reported.
+    auto isDirty = [&](const AttributePathParamsWithGeneration & dirtyPath) {
+        return dirtyPath.IsAttributePathSupersetOf(aPath) && dirtyPath.mGeneration > apReadHandler->mPreviousReportsBeginGeneration;
+    };
+
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    if (mpDirtySetSnapshot != nullptr)
+    {
+        for (size_t i = 0; i < mDirtySetSnapshotSize; i++)
+        {
+            VerifyOrReturnValue(!isDirty(mpDirtySetSnapshot[i]), true);
+        }
+        return false;
+    }
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
+    bool concretePathDirty = false;
+    // TODO: Optimize this implementation by making the iterator only emit intersected paths.
+    mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+        if (isDirty(*dirtyPath))
+        {
+            concretePathDirty = true;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return concretePathDirty;
+}
+
 void Engine::Run(System::Layer * aSystemLayer, void * apAppState)
 {
     Engine * const pEngine = reinterpret_cast<Engine *>(apAppState);
@@ -905,6 +1065,15 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    if (CanEncodeInParallel())
+    {
+        VerifyOrReturn(BuildAndSendReportDataInParallel() == CHIP_NO_ERROR);
+        CompleteRun();
+        return;
+    }
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
     uint32_t numReadHandled = 0;
 
     // We may be deallocating read handlers as we go.  Track how many we had
@@ -935,6 +1104,11 @@ void Engine::Run()
         mCurReadHandlerIdx++;
     }
 
+    CompleteRun();
+}
+
+void Engine::CompleteRun()
+{
     //
     // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
     // This isn't strictly necessary, but does make it easier to debug issues in this code if they
@@ -965,6 +1139,102 @@ void Engine::Run()
     }
 }
 
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+bool Engine::CanEncodeInParallel()
+{
+    DataModel::Provider * provider = mpImEngine->GetDataModelProvider();
+    return (mpEncodingWorkerPool != nullptr) && (provider != nullptr) && provider->SupportsConcurrentReads();
+}
+
+CHIP_ERROR Engine::BuildAndSendReportDataInParallel()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ReportDataContext contexts[CHIP_IM_MAX_REPORTS_IN_FLIGHT];
+    size_t contextCount     = 0;
+    uint32_t numReadHandled = 0;
+
+    // Pick the ReadHandlers the serial loop would have serviced, in the same order. None of them is closed before all of them
+    // are picked, so the tracker moves exactly as it would there.
+    size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+    while ((mNumReportsInFlight + contextCount < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
+    {
+        ReadHandler * readHandler =
+            mpImEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) mpImEngine->mReadHandlers.Allocated());
+        VerifyOrDie(readHandler != nullptr);
+
+        numReadHandled++;
+        mCurReadHandlerIdx++;
+
+        if (!readHandler->ShouldReportUnscheduled() && !mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
+        {
+            continue;
+        }
+
+        ReportDataContext & context = contexts[contextCount];
+        context.mpReadHandler       = readHandler;
+        err                         = PrepareReportData(context);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Same as the serial loop: this ReadHandler is closed and the run stops after the reports already prepared.
+            mRunningReadHandler = readHandler;
+            FinishAndSendReportData(context, err);
+            mRunningReadHandler = nullptr;
+            break;
+        }
+        contextCount++;
+    }
+
+    // Attribute data is encoded on the workers against a copy of the dirty set, which only a heap based pool may outgrow.
+    if ((contextCount > 1) && (mGlobalDirtySet.Allocated() <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET))
+    {
+        AttributePathParamsWithGeneration dirtySet[CHIP_IM_SERVER_MAX_NUM_DIRTY_SET];
+        mDirtySetSnapshotSize = 0;
+        mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+            dirtySet[mDirtySetSnapshotSize++] = *dirtyPath;
+            return Loop::Continue;
+        });
+        mpDirtySetSnapshot = dirtySet;
+
+        struct EncodeBatch
+        {
+            Engine * mpEngine;
+            ReportDataContext * mpContexts;
+        } batch{ this, contexts };
+
+        mpEncodingWorkerPool->RunAndWait(
+            [](void * apContext, size_t aIndex) {
+                auto * encodeBatch          = static_cast<EncodeBatch *>(apContext);
+                ReportDataContext & context = encodeBatch->mpContexts[aIndex];
+                context.mError              = encodeBatch->mpEngine->EncodeReportDataAttributes(context);
+            },
+            &batch, contextCount);
+
+        mpDirtySetSnapshot    = nullptr;
+        mDirtySetSnapshotSize = 0;
+    }
+    else
+    {
+        for (size_t i = 0; i < contextCount; i++)
+        {
+            contexts[i].mError = EncodeReportDataAttributes(contexts[i]);
+        }
+    }
+
+    for (size_t i = 0; i < contextCount; i++)
+    {
+        mRunningReadHandler = contexts[i].mpReadHandler;
+        CHIP_ERROR sendErr  = FinishAndSendReportData(contexts[i], contexts[i].mError);
+        mRunningReadHandler = nullptr;
+        if (err == CHIP_NO_ERROR)
+        {
+            err = sendErr;
+        }
+    }
+
+    return err;
+}
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
     return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
@@ -1104,6 +1374,13 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
+    // Whole endpoints being marked dirty, or Descriptor attributes changing, mean that endpoints or clusters may have been
+    // added or removed: the endpoints group messages are dispatched to have to be looked up again.
+    if (aAttributePath.HasWildcardClusterId() || aAttributePath.mClusterId == Clusters::Descriptor::Id)
+    {
+        mpImEngine->GetGroupEndpointCache()->Invalidate();
+    }
+
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
     mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
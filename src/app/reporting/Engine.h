@@ -29,6 +29,7 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/EncodingWorkerPool.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -80,8 +81,20 @@ public:
     void SetWriterReserved(uint32_t aReservedSize) { mReservedSize = aReservedSize; }
 
     void SetMaxAttributesPerChunk(uint32_t aMaxAttributesPerChunk) { mMaxAttributesPerChunk = aMaxAttributesPerChunk; }
+
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    void SetChunkPlanningEnabled(bool aEnabled) { mChunkPlanningEnabled = aEnabled; }
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
 #endif
 
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    /**
+     * Sets the worker pool used to encode the reports of several ReadHandlers in parallel, or nullptr to encode all of them on
+     * the Matter thread. The pool is only used if the data model provider declares SupportsConcurrentReads().
+     */
+    void SetEncodingWorkerPool(EncodingWorkerPool * apWorkerPool) { mpEncodingWorkerPool = apWorkerPool; }
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
     /**
      * Should be invoked when the device receives a Status report, or when the Report data request times out.
      * This allows the engine to do some clean-up.
@@ -158,12 +171,61 @@ private:
         uint64_t mGeneration = 0;
     };
 
+    /**
+     * A ReportData message being built for a ReadHandler.
+     */
+    struct ReportDataContext
+    {
+        ReadHandler * mpReadHandler = nullptr;
+        System::PacketBufferTLVWriter mWriter;
+        ReportDataMessage::Builder mBuilder;
+        bool mHasMoreChunksForAttributes = false;
+        bool mHasEncodedAttributes       = false;
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+        CHIP_ERROR mError = CHIP_NO_ERROR; // Result of EncodeReportDataAttributes when it is run for several contexts at once.
+#endif
+    };
+
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
+    /**
+     * Steps of BuildAndSendSingleReportData:
+     *   - PrepareReportData allocates the message buffer and starts the ReportData message,
+     *   - EncodeReportDataAttributes encodes the attribute data,
+     *   - FinishAndSendReportData encodes the event data, sends the message and closes the ReadHandler if needed. aError is
+     *     the result of the previous steps: if it is an error, nothing is sent and the ReadHandler is closed.
+     *
+     * Only EncodeReportDataAttributes may run outside of the Matter thread.
+     */
+    CHIP_ERROR PrepareReportData(ReportDataContext & aContext);
+    CHIP_ERROR EncodeReportDataAttributes(ReportDataContext & aContext);
+    CHIP_ERROR FinishAndSendReportData(ReportDataContext & aContext, CHIP_ERROR aError);
+
+    /**
+     * Bookkeeping at the end of a Run that serviced the ReadHandlers without errors.
+     */
+    void CompleteRun();
+
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    bool CanEncodeInParallel();
+
+    /**
+     * Parallel variant of the Run loop: prepares the reports of the ReadHandlers that are reportable now, encodes their
+     * attribute data on the worker pool and then sends them in order.
+     */
+    CHIP_ERROR BuildAndSendReportDataInParallel();
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
+    /**
+     * Returns whether the global dirty set has a path, marked dirty since the ReadHandler started its last complete report,
+     * that includes aPath.
+     */
+    bool IsConcretePathDirty(const ReadHandler * apReadHandler, const ConcreteAttributePath & aPath);
+
     CHIP_ERROR BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                        bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
@@ -292,9 +354,23 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    EncodingWorkerPool * mpEncodingWorkerPool = nullptr;
+
+    /**
+     * Copy of mGlobalDirtySet used while attribute data is encoded on the worker pool, since the pool may not be iterated
+     * from several threads at once. nullptr otherwise.
+     */
+    const AttributePathParamsWithGeneration * mpDirtySetSnapshot = nullptr;
+    size_t mDirtySetSnapshotSize                                 = 0;
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    bool mChunkPlanningEnabled = true;
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
 #endif
 
     InteractionModelEngine * mpImEngine = nullptr;
@@ -21,6 +21,7 @@
 #include <app/ReadHandler.h>
 #include <app/icd/server/ICDStateObserver.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveList.h>
 #include <system/SystemClock.h>
 
 namespace chip {
@@ -110,8 +111,11 @@ public:
      *  This flag is used to confirm that the next report timer has fired for a ReadHandler, thus allowing reporting when timers
      *  fire earlier than the minimal timestamp due to mechanisms such as NTP clock adjustments.
      *
+     *  The intrusive list hook and the deadline are only used by schedulers that bucket nodes by deadline, such as the
+     *  CoalescingReportSchedulerImpl.
+     *
      */
-    class ReadHandlerNode : public TimerContext
+    class ReadHandlerNode : public TimerContext, public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
     {
     public:
         enum class ReadHandlerNodeFlags : uint8_t
@@ -178,11 +182,16 @@ public:
         System::Clock::Timestamp GetMinTimestamp() const { return mMinTimestamp; }
         System::Clock::Timestamp GetMaxTimestamp() const { return mMaxTimestamp; }
 
+        /// @brief Timestamp at which the scheduler next needs to look at this node, when the scheduler tracks it.
+        System::Clock::Timestamp GetDeadline() const { return mDeadline; }
+        void SetDeadline(const Timestamp & aDeadline) { mDeadline = aDeadline; }
+
     private:
         ReadHandler * mReadHandler;
         ReportScheduler * mScheduler;
         Timestamp mMinTimestamp;
         Timestamp mMaxTimestamp;
+        Timestamp mDeadline = System::Clock::Milliseconds64(0);
 
         BitFlags<ReadHandlerNodeFlags> mFlags;
     };
@@ -69,7 +69,11 @@
 #include <transport/raw/WiFiPAF.h>
 #endif
 #include <app/TimerDelegates.h>
+#if CHIP_CONFIG_COALESCED_REPORTS_ENABLED
+#include <app/reporting/CoalescingReportSchedulerImpl.h>
+#else
 #include <app/reporting/ReportSchedulerImpl.h>
+#endif
 #include <transport/raw/UDP.h>
 #if CHIP_DEVICE_CONFIG_ENABLE_NFC_BASED_COMMISSIONING
 #include <transport/raw/NFC.h>
@@ -337,7 +341,11 @@ private:
     static Credentials::PersistentStorageOpCertStore sPersistentStorageOpCertStore;
     static Credentials::GroupDataProviderImpl sGroupDataProvider;
     static chip::app::DefaultTimerDelegate sTimerDelegate;
+#if CHIP_CONFIG_COALESCED_REPORTS_ENABLED
+    static app::reporting::CoalescingReportSchedulerImpl sReportScheduler;
+#else
     static app::reporting::ReportSchedulerImpl sReportScheduler;
+#endif
 
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
     static SimpleSessionResumptionStorage sSessionResumptionStorage;
@@ -577,6 +577,162 @@ TEST(TestAttributeValueEncoder, TestEncodeListChunking2)
     }
 }
 
+// Encodes the same chunk of a list with and without a list encode cache, and checks that the output is the same.
+template <size_t N, typename CachedGenerator, typename UncachedGenerator>
+CHIP_ERROR EncodeListChunkWithAndWithoutCache(AttributeEncodeState & cachedState, AttributeEncodeState & uncachedState,
+                                              CachedGenerator cachedGenerator, UncachedGenerator uncachedGenerator)
+{
+    LimitedTestSetup<N> cached(kTestFabricIndex, cachedState);
+    LimitedTestSetup<N> uncached(kTestFabricIndex, uncachedState);
+
+    CHIP_ERROR err = cached.encoder.EncodeList(cachedGenerator);
+    EXPECT_EQ(err, uncached.encoder.EncodeList(uncachedGenerator));
+    EXPECT_EQ(cached.writer.GetLengthWritten(), uncached.writer.GetLengthWritten());
+    EXPECT_EQ(memcmp(cached.buf, uncached.buf, uncached.writer.GetLengthWritten()), 0);
+
+    cachedState   = cached.encoder.GetState();
+    uncachedState = uncached.encoder.GetState();
+    return err;
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeListChunkingWithListEncodeCache)
+{
+    bool list[]            = { true, false, false, true, true, false };
+    size_t cachedCalls     = 0;
+    size_t uncachedCalls   = 0;
+    auto makeListGenerator = [&list](size_t & calls) {
+        return [&list, &calls](const auto & encoder) -> CHIP_ERROR {
+            calls++;
+            for (auto & item : list)
+            {
+                ReturnErrorOnFailure(encoder.Encode(item));
+            }
+            return CHIP_NO_ERROR;
+        };
+    };
+
+    ListEncodeCache cache;
+    AttributeEncodeState cachedState;
+    AttributeEncodeState uncachedState;
+    cachedState.SetListEncodeCache(&cache);
+
+    // Same chunking as TestEncodeListChunking: the first chunk ends after the first "false".
+    CHIP_ERROR err = EncodeListChunkWithAndWithoutCache<30>(cachedState, uncachedState, makeListGenerator(cachedCalls),
+                                                            makeListGenerator(uncachedCalls));
+    EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    // Only the items that did not fit are cached.
+    EXPECT_EQ(cache.FirstItem(), 2u);
+    EXPECT_EQ(cache.ItemCount(), 4u);
+
+    // The next chunks are copied from the cache, without running the generator again.
+    err = EncodeListChunkWithAndWithoutCache<30>(cachedState, uncachedState, makeListGenerator(cachedCalls),
+                                                 makeListGenerator(uncachedCalls));
+    EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    err = EncodeListChunkWithAndWithoutCache<1024>(cachedState, uncachedState, makeListGenerator(cachedCalls),
+                                                   makeListGenerator(uncachedCalls));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    EXPECT_EQ(cachedCalls, 1u);
+    EXPECT_EQ(uncachedCalls, 3u);
+    // The cache is dropped once the whole list has been sent.
+    EXPECT_EQ(cache.ItemCount(), 0u);
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeListChunkingWithListEncodeCacheRefill)
+{
+    // A list with more items than the cache can hold is cached one window at a time.
+    constexpr size_t kListSize = 2 * ListEncodeCache::kMaxItems + 1;
+    size_t cachedCalls         = 0;
+    size_t uncachedCalls       = 0;
+    auto makeListGenerator     = [](size_t & calls) {
+        return [&calls](const auto & encoder) -> CHIP_ERROR {
+            calls++;
+            for (uint32_t i = 0; i < kListSize; i++)
+            {
+                ReturnErrorOnFailure(encoder.Encode(i));
+            }
+            return CHIP_NO_ERROR;
+        };
+    };
+
+    ListEncodeCache cache;
+    AttributeEncodeState cachedState;
+    AttributeEncodeState uncachedState;
+    cachedState.SetListEncodeCache(&cache);
+
+    CHIP_ERROR err;
+    size_t chunks = 0;
+    do
+    {
+        err = EncodeListChunkWithAndWithoutCache<128>(cachedState, uncachedState, makeListGenerator(cachedCalls),
+                                                      makeListGenerator(uncachedCalls));
+        chunks++;
+        EXPECT_LE(cache.ItemCount(), ListEncodeCache::kMaxItems);
+    } while ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && chunks <= kListSize);
+
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_GT(chunks, 3u);
+    EXPECT_EQ(uncachedCalls, chunks);
+    // The generator runs for the first chunk, which fills the cache, and once the cached items are sent, to cache the rest.
+    EXPECT_EQ(cachedCalls, 2u);
+    EXPECT_EQ(cache.ItemCount(), 0u);
+}
+
+// A list item that counts how many times it is encoded.
+struct CountingListItem
+{
+    static constexpr bool kIsFabricScoped = false;
+
+    uint8_t value;
+    size_t * encodeCount;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        (*encodeCount)++;
+        return writer.Put(tag, value);
+    }
+};
+
+TEST(TestAttributeValueEncoder, TestEncodeListWithListEncodeCacheNotChunked)
+{
+    size_t encodeCount = 0;
+    ListEncodeCache cache;
+    AttributeEncodeState state;
+    state.SetListEncodeCache(&cache);
+
+    // The whole list fits: each item is encoded once, and nothing is cached.
+    TestSetup test(kTestFabricIndex, state);
+    CHIP_ERROR err = test.encoder.EncodeList([&encodeCount](const auto & encoder) -> CHIP_ERROR {
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            ReturnErrorOnFailure(encoder.Encode(CountingListItem{ i, &encodeCount }));
+        }
+        return CHIP_NO_ERROR;
+    });
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(encodeCount, 4u);
+    EXPECT_EQ(cache.ItemCount(), 0u);
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeListWithListEncodeCacheFirstItemTooLarge)
+{
+    uint8_t bytes[64] = {};
+    ListEncodeCache cache;
+    AttributeEncodeState state;
+    state.SetListEncodeCache(&cache);
+
+    // Not even the first item fits: the whole attribute moves to the next chunk, so there is nothing to cache.
+    LimitedTestSetup<30> test(kTestFabricIndex, state);
+    CHIP_ERROR err = test.encoder.EncodeList([&bytes](const auto & encoder) -> CHIP_ERROR {
+        ReturnErrorOnFailure(encoder.Encode(ByteSpan(bytes)));
+        return encoder.Encode(ByteSpan(bytes));
+    });
+    EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_FALSE(test.encoder.GetState().AllowPartialData());
+    EXPECT_EQ(cache.ItemCount(), 0u);
+}
+
 TEST(TestAttributeValueEncoder, TestEncodePreEncoded)
 {
     TestSetup test{};
@@ -15,6 +15,7 @@
  *    See the License for the specific language governing permissions and
  *    limitations under the License.
  */
+#include <string>
 #include <vector>
 
 #include "app-common/zap-generated/ids/Attributes.h"
@@ -597,4 +598,153 @@ TEST_F(TestBufferedReadCallback, TestBufferedSequences)
     });
 }
 
+// Records what a BufferedReadCallback in streaming mode delivers: "A" and "B" for the simple attributes, "C[n]" and "D[n]"
+// for complete lists of n items, "C!" and "D!" for lists that were not received completely, "C|e" and "D|e" for list
+// statuses and "error" for OnError.
+class StreamValidator : public BufferedReadCallback::Callback, public BufferedReadCallback::ListItemCallback
+{
+public:
+    //
+    // BufferedReadCallback::Callback
+    //
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        if (!aStatus.IsSuccess())
+        {
+            mDelivered.push_back(Name(aPath) + "|e");
+            return;
+        }
+
+        EXPECT_EQ(aPath.mListOp, ConcreteDataAttributePath::ListOperation::NotList);
+        mDelivered.push_back(Name(aPath));
+    }
+
+    void OnError(CHIP_ERROR aError) override { mDelivered.push_back("error"); }
+    void OnDone(ReadClient *) override {}
+
+    //
+    // BufferedReadCallback::ListItemCallback
+    //
+
+    CHIP_ERROR OnListBegin(const ConcreteDataAttributePath & aPath) override
+    {
+        EXPECT_EQ(aPath.mListOp, ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        EXPECT_FALSE(mInList);
+        mInList    = true;
+        mItemCount = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnListItem(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData) override
+    {
+        EXPECT_TRUE(mInList);
+        VerifyOrReturnError(mItemCount != mFailAtItem, CHIP_ERROR_NO_MEMORY);
+
+        if (aPath.mAttributeId == Clusters::UnitTesting::Attributes::ListStructOctetString::Id)
+        {
+            Clusters::UnitTesting::Structs::TestListStructOctet::DecodableType value;
+            EXPECT_EQ(DataModel::Decode(*apData, value), CHIP_NO_ERROR);
+            EXPECT_EQ(value.member1, mItemCount);
+        }
+        else
+        {
+            uint8_t value;
+            EXPECT_EQ(DataModel::Decode(*apData, value), CHIP_NO_ERROR);
+            EXPECT_EQ(value, mItemCount % 256);
+        }
+
+        mItemCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnListEnd(const ConcreteDataAttributePath & aPath, const StatusIB & aStatus) override
+    {
+        EXPECT_TRUE(mInList);
+        mInList = false;
+        mDelivered.push_back(Name(aPath) + (aStatus.IsSuccess() ? "[" + std::to_string(mItemCount) + "]" : "!"));
+    }
+
+    static std::string Name(const ConcreteAttributePath & aPath)
+    {
+        switch (aPath.mAttributeId)
+        {
+        case Clusters::UnitTesting::Attributes::Int8u::Id:
+            return "A";
+        case Clusters::UnitTesting::Attributes::Int32u::Id:
+            return "B";
+        case Clusters::UnitTesting::Attributes::ListStructOctetString::Id:
+            return "C";
+        default:
+            return "D";
+        }
+    }
+
+    std::vector<std::string> mDelivered;
+    uint32_t mFailAtItem = UINT32_MAX;
+    uint32_t mItemCount  = 0;
+    bool mInList         = false;
+};
+
+std::vector<std::string> RunStreamedSequence(std::vector<ValidationInstruction> instructionList,
+                                             uint32_t failAtItem = UINT32_MAX)
+{
+    StreamValidator validator;
+    validator.mFailAtItem = failAtItem;
+
+    BufferedReadCallback streamingCallback(validator, validator);
+    DataSeriesGenerator generator(streamingCallback, instructionList);
+    generator.Generate();
+
+    EXPECT_FALSE(validator.mInList);
+    return validator.mDelivered;
+}
+
+TEST_F(TestBufferedReadCallback, TestStreamedSequences)
+{
+    using Delivered = std::vector<std::string>;
+
+    ChipLogProgress(DataManagement, "Validating various sequences of attribute data IBs in streaming mode...");
+
+    EXPECT_EQ(RunStreamedSequence({ { ValidationInstruction::kSimpleAttributeA } }), Delivered({ "A" }));
+
+    EXPECT_EQ(RunStreamedSequence(
+                  { { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Empty } }),
+              Delivered({ "A", "C[0]" }));
+
+    EXPECT_EQ(RunStreamedSequence(
+                  { { ValidationInstruction::kListAttributeC_NotEmpty }, { ValidationInstruction::kListAttributeD_Empty } }),
+              Delivered({ "C[2]", "D[0]" }));
+
+    EXPECT_EQ(RunStreamedSequence({ { ValidationInstruction::kListAttributeC_Empty },
+                                    { ValidationInstruction::kSimpleAttributeA },
+                                    { ValidationInstruction::kListAttributeC_NotEmpty } }),
+              Delivered({ "C[0]", "A", "C[2]" }));
+
+    // A new value of the same list supersedes the previous one.
+    EXPECT_EQ(RunStreamedSequence(
+                  { { ValidationInstruction::kListAttributeC_Empty }, { ValidationInstruction::kListAttributeC_NotEmpty } }),
+              Delivered({ "C[0]", "C[2]" }));
+
+    // A status for the list being streamed aborts it.
+    EXPECT_EQ(RunStreamedSequence(
+                  { { ValidationInstruction::kListAttributeC_NotEmpty }, { ValidationInstruction::kListAttributeC_Error } }),
+              Delivered({ "C!", "C|e" }));
+
+    EXPECT_EQ(RunStreamedSequence(
+                  { { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Error } }),
+              Delivered({ "A", "C|e" }));
+
+    // Chunked lists are delivered item by item.
+    EXPECT_EQ(RunStreamedSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
+                                    { ValidationInstruction::kListAttributeD_NotEmpty_Chunked } }),
+              Delivered({ "C[512]", "D[512]" }));
+
+    // A list that fails to be delivered is aborted and the rest of its items are dropped, the next lists are delivered.
+    EXPECT_EQ(RunStreamedSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
+                                    { ValidationInstruction::kSimpleAttributeA } },
+                                  10),
+              Delivered({ "C!", "error", "A" }));
+}
+
 } // namespace
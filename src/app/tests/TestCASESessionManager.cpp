@@ -0,0 +1,334 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/CASESessionManager.h>
+#include <app/tests/AppTestContext.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <system/SystemClock.h>
+#include <system/SystemTimer.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#if CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// Timers of the warm pool are driven by the mock clock, independently of the system layer of the messaging context.
+class TimerAndMockClock : public System::Clock::Internal::MockClock, public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+    bool HasPendingTimers() const { return !mTimerList.Empty(); }
+
+    CHIP_ERROR StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        // Like the real system layers, starting a timer replaces the pending one with the same callback and state.
+        CancelTimer(aComplete, aAppState);
+        System::Clock::Timestamp awakenTime =
+            GetMonotonicMilliseconds64() + std::chrono::duration_cast<System::Clock::Milliseconds64>(aDelay);
+        mTimerList.Add(mTimerNodes.Create(*this, awakenTime, aComplete, aAppState));
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != System::Clock::Timeout(0);
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    // Work scheduled this way cannot be cancelled on every platform, so the warm pool must not rely on it.
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Like one iteration of the event loop: runs the timers that expired by the new time, but not the ones they start.
+    void AdvanceMonotonic(System::Clock::Milliseconds64 increment)
+    {
+        const System::Clock::Milliseconds64 timestamp = GetMonotonicMilliseconds64() + increment;
+        SetMonotonic(timestamp);
+
+        System::TimerList expired = mTimerList.ExtractEarlier(timestamp + 1_ms64);
+        System::TimerList::Node * node;
+        while ((node = expired.PopEarliest()) != nullptr)
+        {
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+// Fails every session setup right away, as if the pool was exhausted, and records the peers it was asked for.
+class RecordingSessionSetupPool : public OperationalSessionSetupPoolDelegate
+{
+public:
+    OperationalSessionSetup * Allocate(const CASEClientInitParams & params, CASEClientPoolDelegate * clientPool,
+                                       ScopedNodeId peerId, OperationalSessionReleaseDelegate * releaseDelegate) override
+    {
+        mAttempts.push_back(peerId);
+        return nullptr;
+    }
+    void Release(OperationalSessionSetup * device) override {}
+    OperationalSessionSetup * FindSessionSetup(ScopedNodeId peerId, bool forAddressUpdate) override { return nullptr; }
+    void ReleaseAllSessionSetupsForFabric(FabricIndex fabricIndex) override {}
+    void ReleaseAllSessionSetup() override {}
+
+    size_t AttemptsFor(const ScopedNodeId & peerId) const
+    {
+        return static_cast<size_t>(std::count(mAttempts.begin(), mAttempts.end(), peerId));
+    }
+
+    std::vector<ScopedNodeId> mAttempts;
+};
+
+constexpr System::Clock::Milliseconds64 kRetryInterval(CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS);
+constexpr size_t kMaxHandshakes = CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES;
+
+class TestCASESessionManager : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        if (HasFailure())
+        {
+            return;
+        }
+
+        mSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mTimerAndClock);
+
+        CASESessionManagerConfig config;
+        config.sessionInitParams.sessionManager    = &GetSecureSessionManager();
+        config.sessionInitParams.exchangeMgr       = &GetExchangeManager();
+        config.sessionInitParams.fabricTable       = &GetFabricTable();
+        config.sessionInitParams.groupDataProvider = &mGroupDataProvider;
+        config.sessionSetupPool                    = &mSessionSetupPool;
+        ASSERT_EQ(mManager.Init(&mTimerAndClock, config), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mManager.Shutdown();
+        GetExchangeManager().GetReliableMessageMgr()->RegisterSessionUpdateDelegate(nullptr);
+        mTimerAndClock.Clear();
+        System::Clock::Internal::SetSystemClockForTesting(mSavedClock);
+        AppContext::TearDown();
+    }
+
+protected:
+    // The peer for which the messaging context holds a CASE session.
+    ScopedNodeId AliceFromBob() { return ScopedNodeId(GetAliceFabric()->GetNodeId(), GetBobFabricIndex()); }
+    ScopedNodeId UnreachablePeer(NodeId nodeId) { return ScopedNodeId(nodeId, GetBobFabricIndex()); }
+
+    TimerAndMockClock mTimerAndClock;
+    System::Clock::ClockBase * mSavedClock = nullptr;
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+    RecordingSessionSetupPool mSessionSetupPool;
+    CASESessionManager mManager;
+};
+
+TEST_F(TestCASESessionManager, TestExistingSessionIsKeptWarm)
+{
+    ASSERT_EQ(CreateCASESessionBobToAlice(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(mManager.AddWarmPeer(AliceFromBob()), CHIP_NO_ERROR);
+    EXPECT_TRUE(mManager.IsWarmPeer(AliceFromBob()));
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+
+    // The session that already exists is used: no handshake is started.
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(AliceFromBob()), 0u);
+
+    // Once the session goes away, the warm pool establishes a new one.
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    ExpireSessionBobToAlice();
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(AliceFromBob()), 1u);
+}
+
+TEST_F(TestCASESessionManager, TestQuicklyReleasedSessionIsNotReestablishedAtOnce)
+{
+    ASSERT_EQ(CreateCASESessionBobToAlice(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(mManager.AddWarmPeer(AliceFromBob()), CHIP_NO_ERROR);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+
+    // A session released right after it was established is established again after the retry interval only, as
+    // after a failed attempt.
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval - 1_ms64);
+    ExpireSessionBobToAlice();
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(AliceFromBob()), 0u);
+
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval - 1_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(AliceFromBob()), 0u);
+    mTimerAndClock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(AliceFromBob()), 1u);
+}
+
+TEST_F(TestCASESessionManager, TestFailedAttemptIsRetried)
+{
+    const ScopedNodeId peer = UnreachablePeer(0x1234);
+
+    EXPECT_EQ(mManager.AddWarmPeer(peer), CHIP_NO_ERROR);
+    // Adding a peer twice is not an error and does not start another attempt.
+    EXPECT_EQ(mManager.AddWarmPeer(peer), CHIP_NO_ERROR);
+
+    // Attempts are only made from the timer, never from within AddWarmPeer.
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 0u);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 1u);
+
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval - 1_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 1u);
+    mTimerAndClock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 2u);
+}
+
+TEST_F(TestCASESessionManager, TestHandshakesAreLimited)
+{
+    for (NodeId nodeId = 1; nodeId <= CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE; nodeId++)
+    {
+        EXPECT_EQ(mManager.AddWarmPeer(UnreachablePeer(nodeId)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mManager.AddWarmPeer(UnreachablePeer(CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE + 1)), CHIP_ERROR_NO_MEMORY);
+    EXPECT_FALSE(mManager.IsWarmPeer(UnreachablePeer(CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE + 1)));
+
+    // A refresh starts at most CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES attempts; the other peers are
+    // picked up by the refresh that the end of those attempts schedules.
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.mAttempts.size(), kMaxHandshakes);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    for (NodeId nodeId = 1; nodeId <= CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE; nodeId++)
+    {
+        EXPECT_EQ(mSessionSetupPool.AttemptsFor(UnreachablePeer(nodeId)), 1u);
+    }
+
+    // All the peers failed at the same time, so they are all due for a retry after the same interval.
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.mAttempts.size(), static_cast<size_t>(2 * CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE));
+}
+
+TEST_F(TestCASESessionManager, TestRemovedPeersAreNotRetried)
+{
+    const ScopedNodeId removed = UnreachablePeer(1);
+    const ScopedNodeId kept    = UnreachablePeer(2);
+    const ScopedNodeId evicted = ScopedNodeId(3, GetAliceFabricIndex());
+
+    EXPECT_EQ(mManager.AddWarmPeer(removed), CHIP_NO_ERROR);
+    EXPECT_EQ(mManager.AddWarmPeer(kept), CHIP_NO_ERROR);
+    EXPECT_EQ(mManager.AddWarmPeer(evicted), CHIP_NO_ERROR);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.mAttempts.size(), 3u);
+
+    mManager.RemoveWarmPeer(removed);
+    mManager.ReleaseSessionsForFabric(GetAliceFabricIndex());
+    EXPECT_FALSE(mManager.IsWarmPeer(removed));
+    EXPECT_TRUE(mManager.IsWarmPeer(kept));
+    EXPECT_FALSE(mManager.IsWarmPeer(evicted));
+
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(removed), 1u);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(kept), 2u);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(evicted), 1u);
+
+    // The slots of the removed peers can be reused.
+    EXPECT_EQ(mManager.AddWarmPeer(removed), CHIP_NO_ERROR);
+}
+
+TEST_F(TestCASESessionManager, TestNoRefreshAfterShutdown)
+{
+    const ScopedNodeId peer = UnreachablePeer(0x1234);
+
+    // A refresh is pending...
+    EXPECT_EQ(mManager.AddWarmPeer(peer), CHIP_NO_ERROR);
+    mManager.Shutdown();
+    EXPECT_FALSE(mManager.IsWarmPeer(peer));
+
+    // ... and must not run once the manager is shut down.
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    EXPECT_TRUE(mSessionSetupPool.mAttempts.empty());
+
+    // Same for the retry timer of a failed attempt.
+    ASSERT_EQ(mManager.AddWarmPeer(peer), CHIP_NO_ERROR);
+    mTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 1u);
+    mManager.Shutdown();
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    EXPECT_EQ(mSessionSetupPool.AttemptsFor(peer), 1u);
+}
+
+TEST_F(TestCASESessionManager, TestNoRefreshAfterDestruction)
+{
+    const ScopedNodeId peer = UnreachablePeer(0x1234);
+
+    CASESessionManagerConfig config;
+    config.sessionInitParams.sessionManager    = &GetSecureSessionManager();
+    config.sessionInitParams.exchangeMgr       = &GetExchangeManager();
+    config.sessionInitParams.fabricTable       = &GetFabricTable();
+    config.sessionInitParams.groupDataProvider = &mGroupDataProvider;
+    config.sessionSetupPool                    = &mSessionSetupPool;
+
+    // A manager destroyed without Shutdown() while a refresh is pending must not leave its timer behind.
+    auto manager = std::make_unique<CASESessionManager>();
+    ASSERT_EQ(manager->Init(&mTimerAndClock, config), CHIP_NO_ERROR);
+    EXPECT_EQ(manager->AddWarmPeer(peer), CHIP_NO_ERROR);
+    EXPECT_TRUE(mTimerAndClock.HasPendingTimers());
+    manager.reset();
+
+    EXPECT_FALSE(mTimerAndClock.HasPendingTimers());
+    mTimerAndClock.AdvanceMonotonic(kRetryInterval);
+    EXPECT_TRUE(mSessionSetupPool.mAttempts.empty());
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE > 0
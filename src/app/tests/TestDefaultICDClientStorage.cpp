@@ -395,3 +395,134 @@ TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithEmptyIcdStorage
     ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
     EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
 }
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadUsesNonceIndex)
+{
+    FabricIndex fabricId = 1;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+
+    const uint8_t * keys[] = { kKeyBuffer1, kKeyBuffer2, kKeyBuffer3 };
+    ICDClientInfo clientInfos[3];
+    for (size_t i = 0; i < 3; i++)
+    {
+        clientInfos[i].peer_node = ScopedNodeId(static_cast<NodeId>(6666 + i), fabricId);
+        EXPECT_EQ(manager.SetKey(clientInfos[i], ByteSpan(keys[i], sizeof(kKeyBuffer1))), CHIP_NO_ERROR);
+        EXPECT_EQ(manager.StoreEntry(clientInfos[i]), CHIP_NO_ERROR);
+    }
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+    auto checkIn            = [&](const ICDClientInfo & sender, uint32_t counter) {
+        MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+        EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                      sender.aes_key_handle, sender.hmac_key_handle, counter, ByteSpan(), output),
+                  CHIP_NO_ERROR);
+        buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+        return manager.ProcessCheckInPayload(ByteSpan(buffer->Start(), buffer->DataLength()), decodeClientInfo, checkInCounter);
+    };
+
+    // The next expected Check-In message of each ICD only needs its own keys
+    for (auto & clientInfo : clientInfos)
+    {
+        EXPECT_EQ(checkIn(clientInfo, 1), CHIP_NO_ERROR);
+        EXPECT_TRUE(decodeClientInfo.peer_node == clientInfo.peer_node);
+        EXPECT_EQ(checkInCounter, 1u);
+        EXPECT_EQ(manager.GetCheckInDecryptionCount(), 1u);
+    }
+
+    // A counter past the window is still found by trying the keys of every ICD
+    uint32_t counter = static_cast<uint32_t>(DefaultICDClientStorage::kCheckInNonceWindow) + 5;
+    EXPECT_EQ(checkIn(clientInfos[2], counter), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodeClientInfo.peer_node == clientInfos[2].peer_node);
+    EXPECT_EQ(checkInCounter, counter);
+    EXPECT_GT(manager.GetCheckInDecryptionCount(), 1u);
+
+    // Storing the new offset moves the window of that ICD
+    clientInfos[2].offset = counter;
+    EXPECT_EQ(manager.StoreEntry(clientInfos[2]), CHIP_NO_ERROR);
+    EXPECT_EQ(checkIn(clientInfos[2], counter + 1), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodeClientInfo.peer_node == clientInfos[2].peer_node);
+    EXPECT_EQ(manager.GetCheckInDecryptionCount(), 1u);
+
+    // Removing an ICD keeps the index of the others valid
+    EXPECT_EQ(manager.DeleteEntry(clientInfos[0].peer_node), CHIP_NO_ERROR);
+    EXPECT_EQ(checkIn(clientInfos[0], 2), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(checkIn(clientInfos[1], 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodeClientInfo.peer_node == clientInfos[1].peer_node);
+    EXPECT_EQ(manager.GetCheckInDecryptionCount(), 1u);
+    EXPECT_EQ(checkIn(clientInfos[2], counter + 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodeClientInfo.peer_node == clientInfos[2].peer_node);
+    EXPECT_EQ(manager.GetCheckInDecryptionCount(), 1u);
+
+    manager.Shutdown();
+}
+
+TEST_F(TestDefaultICDClientStorage, BenchmarkProcessCheckInPayloadWithManyClients)
+{
+    constexpr size_t kFabricCount      = 4;
+    constexpr size_t kClientsPerFabric = 250;
+    constexpr uint32_t kCheckInCount   = 100;
+
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+
+    std::vector<ICDClientInfo> clientInfos;
+    for (size_t fabric = 1; fabric <= kFabricCount; fabric++)
+    {
+        EXPECT_EQ(manager.UpdateFabricList(static_cast<FabricIndex>(fabric)), CHIP_NO_ERROR);
+        for (size_t node = 0; node < kClientsPerFabric; node++)
+        {
+            uint8_t key[sizeof(kKeyBuffer1)];
+            memcpy(key, kKeyBuffer1, sizeof(key));
+            Encoding::LittleEndian::Put32(key, static_cast<uint32_t>(clientInfos.size()));
+
+            ICDClientInfo clientInfo;
+            clientInfo.peer_node = ScopedNodeId(static_cast<NodeId>(node + 1), static_cast<FabricIndex>(fabric));
+            EXPECT_EQ(manager.SetKey(clientInfo, ByteSpan(key)), CHIP_NO_ERROR);
+            EXPECT_EQ(manager.StoreEntry(clientInfo), CHIP_NO_ERROR);
+            clientInfos.push_back(clientInfo);
+        }
+    }
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+    auto checkIn            = [&](const ICDClientInfo & sender, uint32_t counter) {
+        MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+        EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                      sender.aes_key_handle, sender.hmac_key_handle, counter, ByteSpan(), output),
+                  CHIP_NO_ERROR);
+        buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        EXPECT_EQ(manager.ProcessCheckInPayload(ByteSpan(buffer->Start(), buffer->DataLength()), decodeClientInfo, checkInCounter),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(decodeClientInfo.peer_node == sender.peer_node);
+        return System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+    };
+
+    // The first Check-In message also loads the ICDs from storage and computes their nonces
+    uint64_t firstUs = checkIn(clientInfos.back(), 1);
+
+    uint64_t indexedUs = 0;
+    for (uint32_t i = 0; i < kCheckInCount; i++)
+    {
+        indexedUs += checkIn(clientInfos[(i * 7919) % clientInfos.size()], 1);
+    }
+
+    uint64_t scanUs = checkIn(clientInfos.back(), static_cast<uint32_t>(DefaultICDClientStorage::kCheckInNonceWindow) + 1);
+
+    ChipLogProgress(Test, "Check-In with %u registered ICDs: first %" PRIu64 " us, indexed %" PRIu64 " us, scan %" PRIu64 " us",
+                    static_cast<unsigned>(clientInfos.size()), firstUs, indexedUs / kCheckInCount, scanUs);
+
+    manager.Shutdown();
+}
@@ -0,0 +1,223 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app/GroupEndpointCache.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Test;
+
+namespace {
+
+constexpr FabricIndex kFabricIndex = 1;
+constexpr GroupId kGroup1          = 0x0101;
+constexpr GroupId kGroup2          = 0x0102;
+
+std::vector<EndpointId> Collect(GroupEndpointCache * cache, GroupId groupId, ClusterId clusterId)
+{
+    std::vector<EndpointId> endpoints;
+    GroupEndpointCache::EndpointIterator iterator;
+    EXPECT_EQ(iterator.Init(cache, kFabricIndex, groupId, clusterId), CHIP_NO_ERROR);
+
+    EndpointId endpointId;
+    while (iterator.Next(endpointId))
+    {
+        endpoints.push_back(endpointId);
+    }
+    std::sort(endpoints.begin(), endpoints.end());
+    return endpoints;
+}
+
+std::vector<EndpointId> Sorted(std::vector<EndpointId> endpoints)
+{
+    std::sort(endpoints.begin(), endpoints.end());
+    return endpoints;
+}
+
+// Counts the group table iterations, optionally hiding the endpoint mapping generation.
+class CountingGroupDataProvider : public Credentials::GroupDataProviderImpl
+{
+public:
+    EndpointIterator * IterateEndpoints(FabricIndex fabric_index, std::optional<GroupId> group_id = std::nullopt) override
+    {
+        mIterations++;
+        return GroupDataProviderImpl::IterateEndpoints(fabric_index, group_id);
+    }
+    bool SupportsEndpointMappingGeneration() const override { return mSupportsGeneration; }
+
+    size_t mIterations        = 0;
+    bool mSupportsGeneration = true;
+};
+
+class TestGroupEndpointCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mGroups.SetStorageDelegate(&mStorage);
+        mGroups.SetSessionKeystore(&mSessionKeystore);
+        ASSERT_EQ(mGroups.Init(), CHIP_NO_ERROR);
+        Credentials::SetGroupDataProvider(&mGroups);
+
+        mCache.SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    }
+
+    void TearDown() override
+    {
+        ResetMockNodeConfig();
+        Credentials::SetGroupDataProvider(nullptr);
+        mGroups.Finish();
+    }
+
+protected:
+    TestPersistentStorageDelegate mStorage;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    CountingGroupDataProvider mGroups;
+    GroupEndpointCache mCache;
+};
+
+TEST_F(TestGroupEndpointCache, TestFiltersByCluster)
+{
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint1), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint2), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup2, kMockEndpoint1), CHIP_NO_ERROR);
+
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(1)), Sorted({ kMockEndpoint1, kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(3)), Sorted({ kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup2, MockClusterId(4)), Sorted({}));
+    EXPECT_EQ(Collect(&mCache, kGroup2, MockClusterId(1)), Sorted({ kMockEndpoint1 }));
+
+    // Addressing more clusters than an entry keeps replaces the cached ones.
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(2)), Sorted({ kMockEndpoint1, kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(5)), Sorted({}));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(6)), Sorted({}));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(1)), Sorted({ kMockEndpoint1, kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(3)), Sorted({ kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+
+    // Unknown groups have no endpoints.
+    EXPECT_EQ(Collect(&mCache, 0x0200, MockClusterId(1)), Sorted({}));
+}
+
+TEST_F(TestGroupEndpointCache, TestWithoutCache)
+{
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint1), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+
+    // Without a cache, every endpoint of the group is returned: the caller checks the cluster.
+    EXPECT_EQ(Collect(nullptr, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint1, kMockEndpoint3 }));
+
+    // Same for a cache without a data model.
+    GroupEndpointCache cache;
+    EXPECT_EQ(Collect(&cache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint1, kMockEndpoint3 }));
+}
+
+TEST_F(TestGroupEndpointCache, TestFollowsGroupTable)
+{
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint1), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint2), CHIP_NO_ERROR);
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(2)), Sorted({ kMockEndpoint1, kMockEndpoint2 }));
+
+    uint32_t generation = mGroups.GetEndpointMappingGeneration();
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+    EXPECT_NE(mGroups.GetEndpointMappingGeneration(), generation);
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(2)), Sorted({ kMockEndpoint1, kMockEndpoint2, kMockEndpoint3 }));
+
+    ASSERT_EQ(mGroups.RemoveEndpoint(kFabricIndex, kGroup1, kMockEndpoint2), CHIP_NO_ERROR);
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(2)), Sorted({ kMockEndpoint1, kMockEndpoint3 }));
+
+    ASSERT_EQ(mGroups.RemoveGroupInfo(kFabricIndex, kGroup1), CHIP_NO_ERROR);
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(2)), Sorted({}));
+}
+
+TEST_F(TestGroupEndpointCache, TestProviderWithoutGeneration)
+{
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint1), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+
+    // Providers with a generation are iterated once per group.
+    mGroups.mIterations = 0;
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+    EXPECT_EQ(mGroups.mIterations, 1u);
+
+    // Other providers are iterated on every message, still filtered by cluster.
+    mGroups.mSupportsGeneration = false;
+    mGroups.mIterations         = 0;
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+    EXPECT_EQ(mGroups.mIterations, 2u);
+}
+
+TEST_F(TestGroupEndpointCache, TestInvalidate)
+{
+    using namespace Clusters::Globals::Attributes;
+
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint1), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(4), { ClusterRevision::Id, FeatureMap::Id }),
+        }),
+    });
+    // clang-format on
+    SetMockNodeConfig(config);
+
+    // The data model is not watched: the cached endpoints are kept until invalidated.
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint3 }));
+
+    mCache.Invalidate();
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(4)), Sorted({ kMockEndpoint1 }));
+}
+
+TEST_F(TestGroupEndpointCache, TestLargeGroup)
+{
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint2), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, kMockEndpoint3), CHIP_NO_ERROR);
+    for (EndpointId endpointId = 1; endpointId < GroupEndpointCache::kMaxEndpointsPerGroup; endpointId++)
+    {
+        ASSERT_EQ(mGroups.AddEndpoint(kFabricIndex, kGroup1, endpointId), CHIP_NO_ERROR);
+    }
+
+    // Too many endpoints to be cached, the group table and data model are used instead.
+    EXPECT_EQ(Collect(&mCache, kGroup1, MockClusterId(3)), Sorted({ kMockEndpoint2, kMockEndpoint3 }));
+    EXPECT_EQ(Collect(nullptr, kGroup1, MockClusterId(3)).size(), GroupEndpointCache::kMaxEndpointsPerGroup + 1);
+}
+
+} // namespace
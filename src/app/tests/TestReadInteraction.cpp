@@ -30,6 +30,7 @@
 #include <app/tests/test-interaction-model-api.h>
 #include <app/util/basic-types.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/MatterCallbacks.h>
 #include <app/util/mock/Functions.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
@@ -49,7 +50,11 @@
 #include <messaging/Flags.h>
 #include <protocols/interaction_model/Constants.h>
 
+#include <algorithm>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <vector>
 
 namespace {
 using namespace chip::app::Clusters::Globals::Attributes;
@@ -458,6 +463,127 @@ public:
     }
 };
 
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+// Counts the attributes the reporting engine reads.
+class AttributeReadCounter : public chip::DataModelCallbacks
+{
+public:
+    void AttributeOperation(OperationType operation, OperationOrder order, const chip::app::ConcreteAttributePath & path) override
+    {
+        if (operation == OperationType::Read && order == OperationOrder::Pre)
+        {
+            mAttributeReads++;
+        }
+    }
+
+    uint32_t mAttributeReads = 0;
+};
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+// The test data model, made safe to read from worker threads: the mock attribute storage and the metadata caches of the
+// codegen provider are single threaded, so every read and metadata query holds a lock.
+class ConcurrentReadsDataModel : public chip::app::TestImCustomDataModel
+{
+public:
+    using ActionReturnStatus = chip::app::DataModel::ActionReturnStatus;
+    template <typename T>
+    using Builder = chip::ReadOnlyBufferBuilder<T>;
+
+    bool SupportsConcurrentReads() const override { return true; }
+
+    ActionReturnStatus ReadAttribute(const chip::app::DataModel::ReadAttributeRequest & request,
+                                     chip::app::AttributeValueEncoder & encoder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::ReadAttribute(request, encoder);
+    }
+
+    CHIP_ERROR Endpoints(Builder<chip::app::DataModel::EndpointEntry> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::Endpoints(builder);
+    }
+
+    CHIP_ERROR SemanticTags(chip::EndpointId endpointId, Builder<SemanticTag> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::SemanticTags(endpointId, builder);
+    }
+
+    CHIP_ERROR DeviceTypes(chip::EndpointId endpointId, Builder<chip::app::DataModel::DeviceTypeEntry> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::DeviceTypes(endpointId, builder);
+    }
+
+    CHIP_ERROR ClientClusters(chip::EndpointId endpointId, Builder<chip::ClusterId> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::ClientClusters(endpointId, builder);
+    }
+
+    CHIP_ERROR ServerClusters(chip::EndpointId endpointId, Builder<chip::app::DataModel::ServerClusterEntry> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::ServerClusters(endpointId, builder);
+    }
+
+    CHIP_ERROR EventInfo(const chip::app::ConcreteEventPath & path, chip::app::DataModel::EventEntry & eventInfo) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::EventInfo(path, eventInfo);
+    }
+
+    CHIP_ERROR Attributes(const chip::app::ConcreteClusterPath & path,
+                          Builder<chip::app::DataModel::AttributeEntry> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::Attributes(path, builder);
+    }
+
+    CHIP_ERROR GeneratedCommands(const chip::app::ConcreteClusterPath & path, Builder<chip::CommandId> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::GeneratedCommands(path, builder);
+    }
+
+    CHIP_ERROR AcceptedCommands(const chip::app::ConcreteClusterPath & path,
+                                Builder<chip::app::DataModel::AcceptedCommandEntry> & builder) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return TestImCustomDataModel::AcceptedCommands(path, builder);
+    }
+
+private:
+    std::mutex mMutex;
+};
+
+// Runs every work item on a thread of its own, so the reports of a batch are encoded concurrently.
+class ThreadEncodingWorkerPool : public chip::app::reporting::EncodingWorkerPool
+{
+public:
+    void RunAndWait(Work aWork, void * apContext, size_t aCount) override
+    {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < aCount; i++)
+        {
+            workers.emplace_back([=] { aWork(apContext, i); });
+        }
+        for (auto & worker : workers)
+        {
+            worker.join();
+        }
+
+        mBatchCount++;
+        mMaxBatchSize = std::max(mMaxBatchSize, aCount);
+    }
+
+    size_t mBatchCount   = 0;
+    size_t mMaxBatchSize = 0;
+};
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
 } // namespace
 
 using ReportScheduler     = chip::app::reporting::ReportScheduler;
@@ -531,6 +657,14 @@ public:
     void TestPostSubscribeRoundtripStatusReportTimeout();
     void TestProcessSubscribeRequest();
     void TestReadChunking();
+    void TestReadChunkingBenchmark();
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+    void TestReadChunkingPlanningMatchesUnplanned();
+    void TestReadChunkingReportBufferReuse();
+#endif
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+    void TestReadChunkingParallelEncoding();
+#endif
     void TestReadChunkingInvalidSubscriptionId();
     void TestReadChunkingStatusReportTimeout();
     void TestReadClient();
@@ -1520,6 +1654,292 @@ void TestReadInteraction::TestReadWildcard()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// TestReadChunkingBenchmark reads the whole mock data model with a reduced packet size, so that the report is split into
+// many chunks, and logs how long building and sending each chunk takes.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunkingBenchmark)
+void TestReadInteraction::TestReadChunkingBenchmark()
+{
+    constexpr uint32_t kIterations         = 20;
+    constexpr uint32_t kMinChunksPerReport = 20;
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    // Leave room for a few attributes per chunk only.
+    engine->GetReportingEngine().SetWriterReserved(850);
+
+    // Wildcard on everything. The mock data model is small, so it is read twice to get a report of a more realistic size.
+    chip::app::AttributePathParams attributePathParams[2];
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = MATTER_ARRAY_SIZE(attributePathParams);
+
+    uint32_t chunkCount       = 0;
+    uint64_t elapsedUs        = 0;
+    int attributeReportsCount = -1;
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        MockInteractionModelApp delegate;
+        app::ReadClient readClient(engine, &GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Read);
+
+        GetLoopback().mSentMessageCount = 0;
+        const uint64_t start            = gRealClock->GetMonotonicMicroseconds64().count();
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+
+        elapsedUs += gRealClock->GetMonotonicMicroseconds64().count() - start;
+
+        EXPECT_TRUE(delegate.mGotReport);
+        EXPECT_FALSE(delegate.mReadError);
+
+        // Every chunk but the last one is acknowledged by a StatusResponse, the last one by a standalone ack.
+        const uint32_t chunks = (GetLoopback().mSentMessageCount - 1) / 2;
+        EXPECT_GE(chunks, kMinChunksPerReport);
+        chunkCount += chunks;
+
+        // All the reads must deliver the same data.
+        if (attributeReportsCount < 0)
+        {
+            attributeReportsCount = delegate.mNumAttributeResponse;
+        }
+        EXPECT_EQ(delegate.mNumAttributeResponse, attributeReportsCount);
+    }
+
+    ChipLogProgress(Test, "Wildcard read: %u chunks per report, %" PRIu64 " us per chunk", chunkCount / kIterations,
+                    chunkCount > 0 ? elapsedUs / chunkCount : 0);
+
+    engine->GetReportingEngine().SetWriterReserved(0);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+#if CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+// TestReadChunkingPlanningMatchesUnplanned does the wildcard read of TestReadChunkingBenchmark for a range of chunk sizes, with
+// and without chunk planning, and checks that planning delivers the same attribute reports in the same number of chunks while
+// reading fewer attributes.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunkingPlanningMatchesUnplanned)
+void TestReadInteraction::TestReadChunkingPlanningMatchesUnplanned()
+{
+    struct ReadResult
+    {
+        uint32_t chunks         = 0;
+        uint32_t attributeReads = 0;
+        std::vector<chip::app::ConcreteAttributePath> attributePaths;
+        std::vector<std::optional<unsigned>> listSizes;
+    };
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    AttributeReadCounter readCounter;
+    chip::DataModelCallbacks * previousCallbacks = chip::DataModelCallbacks::SetInstance(&readCounter);
+
+    chip::app::AttributePathParams attributePathParams[2];
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = MATTER_ARRAY_SIZE(attributePathParams);
+
+    auto read = [&](bool chunkPlanning, ReadResult & result) {
+        engine->GetReportingEngine().SetChunkPlanningEnabled(chunkPlanning);
+
+        MockInteractionModelApp delegate;
+        app::ReadClient readClient(engine, &GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Read);
+
+        GetLoopback().mSentMessageCount = 0;
+        readCounter.mAttributeReads     = 0;
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+
+        EXPECT_TRUE(delegate.mGotReport);
+        EXPECT_FALSE(delegate.mReadError);
+
+        // Every chunk but the last one is acknowledged by a StatusResponse, the last one by a standalone ack.
+        result.chunks         = (GetLoopback().mSentMessageCount - 1) / 2;
+        result.attributeReads = readCounter.mAttributeReads;
+        result.attributePaths = delegate.mReceivedAttributePaths;
+        result.listSizes      = delegate.mReceivedListSizes;
+    };
+
+    // Beyond 870 reserved bytes, some attributes of the mock data model do not fit in a chunk at all.
+    uint32_t savedReads = 0;
+    for (uint32_t reservedSize = 750; reservedSize <= 870; reservedSize += 5)
+    {
+        engine->GetReportingEngine().SetWriterReserved(reservedSize);
+
+        ReadResult unplanned;
+        ReadResult planned;
+        read(false, unplanned);
+        read(true, planned);
+
+        EXPECT_GT(unplanned.chunks, 1u);
+        EXPECT_EQ(planned.chunks, unplanned.chunks);
+        EXPECT_TRUE(planned.attributePaths == unplanned.attributePaths);
+        EXPECT_TRUE(planned.listSizes == unplanned.listSizes);
+        EXPECT_LE(planned.attributeReads, unplanned.attributeReads);
+        savedReads += unplanned.attributeReads - planned.attributeReads;
+    }
+
+    // Some of the chunks must have been ended without reading the attribute that did not fit.
+    EXPECT_GT(savedReads, 0u);
+
+    chip::DataModelCallbacks::SetInstance(previousCallbacks);
+    engine->GetReportingEngine().SetChunkPlanningEnabled(true);
+    engine->GetReportingEngine().SetWriterReserved(0);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+// TestReadChunkingReportBufferReuse checks that the buffer of a chunk is not used for the next chunk while the messaging layer
+// still holds it for retransmission, and that it is once the messaging layer has released it.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunkingReportBufferReuse)
+void TestReadInteraction::TestReadChunkingReportBufferReuse()
+{
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+    engine->GetReportingEngine().SetWriterReserved(850);
+
+    chip::app::AttributePathParams attributePathParams[2];
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = MATTER_ARRAY_SIZE(attributePathParams);
+
+    {
+        MockInteractionModelApp delegate;
+        app::ReadClient readClient(engine, &GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Read);
+
+        // Let the ReadRequest through and drop the first chunk, which stays in the retransmission table.
+        GetLoopback().mSentMessageCount                 = 0;
+        GetLoopback().mNumMessagesToAllowBeforeDropping = 1;
+        GetLoopback().mNumMessagesToDrop                = 1;
+        GetLoopback().mDroppedMessageCount              = 0;
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+
+        EXPECT_EQ(GetLoopback().mSentMessageCount, 2u);
+        EXPECT_EQ(GetLoopback().mDroppedMessageCount, 1u);
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(), 1u);
+
+        ReadHandler * readHandler = engine->ActiveHandlerAt(0);
+        ASSERT_NE(readHandler, nullptr);
+        ASSERT_FALSE(readHandler->mReportBuffer.IsNull());
+        EXPECT_FALSE(readHandler->mReportBuffer.HasSoleOwnership());
+
+        const System::PacketBuffer * firstChunk = readHandler->mReportBuffer.operator->();
+        System::PacketBufferHandle firstChunkHandle = readHandler->mReportBuffer.Retain();
+
+        // The first chunk is not acknowledged yet: the next chunk gets another buffer.
+        System::PacketBufferHandle buffer = readHandler->AllocateReportBuffer(readHandler->GetReportBufferMaxSize());
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_NE(buffer.operator->(), firstChunk);
+
+        // Once the messaging layer has released the first chunk, its buffer is used for the next one.
+        readHandler->mReportBuffer = std::move(firstChunkHandle);
+        rm->ClearRetransTable(readHandler->mExchangeCtx->GetReliableMessageContext());
+        EXPECT_TRUE(readHandler->mReportBuffer.HasSoleOwnership());
+
+        buffer = readHandler->AllocateReportBuffer(readHandler->GetReportBufferMaxSize());
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(buffer.operator->(), firstChunk);
+        EXPECT_GE(buffer->AvailableDataLength(), readHandler->GetReportBufferMaxSize());
+        EXPECT_EQ(buffer->DataLength(), 0u);
+
+        ExpireSessionAliceToBob();
+        ExpireSessionBobToAlice();
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 0u);
+    }
+
+    GetLoopback().mSentMessageCount                 = 0;
+    GetLoopback().mNumMessagesToDrop                = 0;
+    GetLoopback().mNumMessagesToAllowBeforeDropping = 0;
+    GetLoopback().mDroppedMessageCount              = 0;
+
+    engine->GetReportingEngine().SetWriterReserved(0);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    CreateSessionAliceToBob();
+    CreateSessionBobToAlice();
+}
+#endif // CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+
+#if CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+// TestReadChunkingParallelEncoding serves several chunked wildcard reads at once with the attribute data encoded on a worker
+// pool, and checks that every reader gets the same data as a read served on the Matter thread only.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunkingParallelEncoding)
+void TestReadInteraction::TestReadChunkingParallelEncoding()
+{
+    constexpr size_t kReadClientCount = 3;
+
+    ConcurrentReadsDataModel dataModel;
+    ThreadEncodingWorkerPool workerPool;
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+    engine->GetReportingEngine().SetWriterReserved(850);
+
+    chip::app::AttributePathParams attributePathParams[2];
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = MATTER_ARRAY_SIZE(attributePathParams);
+
+    // Reference read: the test data model does not declare concurrent reads, so it is served on the Matter thread.
+    engine->GetReportingEngine().SetEncodingWorkerPool(&workerPool);
+    MockInteractionModelApp referenceDelegate;
+    {
+        app::ReadClient readClient(engine, &GetExchangeManager(), referenceDelegate, chip::app::ReadClient::InteractionType::Read);
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+    EXPECT_TRUE(referenceDelegate.mGotReport);
+    EXPECT_FALSE(referenceDelegate.mReadError);
+    EXPECT_EQ(workerPool.mBatchCount, 0u);
+
+    engine->SetDataModelProvider(&dataModel);
+    {
+        MockInteractionModelApp delegates[kReadClientCount];
+        std::optional<app::ReadClient> readClients[kReadClientCount];
+        for (size_t i = 0; i < kReadClientCount; i++)
+        {
+            readClients[i].emplace(engine, &GetExchangeManager(), delegates[i], chip::app::ReadClient::InteractionType::Read);
+            EXPECT_EQ(readClients[i]->SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        }
+        DrainAndServiceIO();
+
+        for (auto & delegate : delegates)
+        {
+            EXPECT_TRUE(delegate.mGotReport);
+            EXPECT_FALSE(delegate.mReadError);
+            EXPECT_EQ(delegate.mNumAttributeResponse, referenceDelegate.mNumAttributeResponse);
+            EXPECT_EQ(delegate.mReceivedAttributePaths, referenceDelegate.mReceivedAttributePaths);
+        }
+    }
+
+    // The reports of the readers were encoded together on the worker pool.
+    EXPECT_GT(workerPool.mBatchCount, 0u);
+    EXPECT_GE(workerPool.mMaxBatchSize, 2u);
+
+    engine->SetDataModelProvider(&TestImCustomDataModel::Instance());
+    engine->GetReportingEngine().SetEncodingWorkerPool(nullptr);
+    engine->GetReportingEngine().SetWriterReserved(0);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+#endif // CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+
 // TestReadChunking will try to read a few large attributes, the report won't fit into the MTU and result in chunking.
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunking)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadChunking)
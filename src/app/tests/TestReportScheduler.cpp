@@ -17,6 +17,7 @@
  */
 
 #include <app/InteractionModelEngine.h>
+#include <app/reporting/CoalescingReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <app/tests/AppTestContext.h>
@@ -58,6 +59,7 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestCoalescingScheduler();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -210,6 +212,7 @@ public:
 
         mTimerContext = context;
         mTimerTimeout = mMockSystemTimestamp + aTimeout;
+        mStartTimerCount++;
         return CHIP_NO_ERROR;
     }
     virtual void CancelTimer(TimerContext * context) override
@@ -252,6 +255,7 @@ public:
     TimerContext * mTimerContext                  = nullptr;
     System::Clock::Timeout mTimerTimeout          = System::Clock::Milliseconds64(0x7FFFFFFFFFFFFFFF);
     System::Clock::Timestamp mMockSystemTimestamp = System::Clock::Milliseconds64(0);
+    uint32_t mStartTimerCount                     = 0;
 };
 
 TestTimerDelegate sTestTimerDelegate;
@@ -260,6 +264,9 @@ ReportSchedulerImpl sScheduler(&sTestTimerDelegate);
 TestTimerSynchronizedDelegate sTestTimerSynchronizedDelegate;
 SynchronizedReportSchedulerImpl syncScheduler(&sTestTimerSynchronizedDelegate);
 
+TestTimerSynchronizedDelegate sTestTimerCoalescingDelegate;
+CoalescingReportSchedulerImpl coalescingScheduler(&sTestTimerCoalescingDelegate, System::Clock::Milliseconds32(1000));
+
 TEST_F_FROM_FIXTURE(TestReportScheduler, TestReadHandlerList)
 {
 
@@ -807,6 +814,107 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestCoalescingScheduler)
+{
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize the mock system time
+    sTestTimerCoalescingDelegate.SetMockSystemTimestamp(System::Clock::Milliseconds64(0));
+    sTestTimerCoalescingDelegate.mStartTimerCount = 0;
+
+    ReadHandler * readHandler1 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &coalescingScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &coalescingScheduler, 0, 2));
+    ReadHandler * readHandler2 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &coalescingScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &coalescingScheduler, 0, 3));
+    ReadHandler * readHandler3 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &coalescingScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler3, &coalescingScheduler, 0, 5));
+    ReadHandler * readHandler4 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &coalescingScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler4, &coalescingScheduler, 3, 4));
+
+    // readHandler4 is dirty but has to wait for its min interval (3s)
+    readHandler4->ForceDirtyState();
+
+    ReadHandlerNode * node1 = coalescingScheduler.FindReadHandlerNode(readHandler1);
+    ReadHandlerNode * node4 = coalescingScheduler.FindReadHandlerNode(readHandler4);
+
+    EXPECT_EQ(coalescingScheduler.GetNumReadHandlers(), 4u);
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler1));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler2));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler3));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler4));
+
+    // A single timer is armed for the earliest deadline, later deadlines do not restart it
+    EXPECT_EQ(sTestTimerCoalescingDelegate.mStartTimerCount, 1u);
+    EXPECT_EQ(coalescingScheduler.mNextReportTimestamp, node1->GetMaxTimestamp());
+
+    // Simulate waiting for the max interval of readHandler1 to expire (2s)
+    sTestTimerCoalescingDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+
+    // readHandler2 is due within the coalescing window and reports in the same engine run as readHandler1
+    EXPECT_TRUE(coalescingScheduler.IsReportableNow(readHandler1));
+    EXPECT_TRUE(coalescingScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(coalescingScheduler.IsReportScheduled(readHandler1));
+    EXPECT_FALSE(coalescingScheduler.IsReportScheduled(readHandler2));
+    // readHandler3 is not due within the window
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler3));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler3));
+    // readHandler4 is due within the window but its min interval has not elapsed
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler4));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler4));
+    EXPECT_EQ(coalescingScheduler.mNextReportTimestamp, node4->GetMinTimestamp());
+    EXPECT_EQ(sTestTimerCoalescingDelegate.mStartTimerCount, 2u);
+
+    // Simulate a report emission for readHandler1 and readHandler2, their next deadlines are later than the armed timer
+    coalescingScheduler.OnSubscriptionReportSent(readHandler1);
+    coalescingScheduler.OnSubscriptionReportSent(readHandler2);
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler1));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler2));
+    EXPECT_EQ(sTestTimerCoalescingDelegate.mStartTimerCount, 2u);
+
+    // Simulate waiting for the min interval of readHandler4 to elapse (1s)
+    sTestTimerCoalescingDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1000));
+
+    // readHandler1 is due within the coalescing window and reports with readHandler4, one window before its max interval
+    EXPECT_TRUE(coalescingScheduler.IsReportableNow(readHandler4));
+    EXPECT_TRUE(coalescingScheduler.IsReportableNow(readHandler1));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler3));
+    EXPECT_EQ(sTestTimerCoalescingDelegate.mStartTimerCount, 3u);
+
+    readHandler4->ClearForceDirtyFlag(); // report got emited so clear dirty flag
+    coalescingScheduler.OnSubscriptionReportSent(readHandler1);
+    coalescingScheduler.OnSubscriptionReportSent(readHandler4);
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler1));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler4));
+
+    // A handler that becomes dirty past its min interval reports immediately, without pulling in handlers outside the window
+    readHandler2->ForceDirtyState();
+    EXPECT_TRUE(coalescingScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler1));
+    EXPECT_FALSE(coalescingScheduler.IsReportableNow(readHandler3));
+    EXPECT_TRUE(coalescingScheduler.IsReportScheduled(readHandler3));
+
+    // Destroying a handler removes it from the wheel
+    coalescingScheduler.OnReadHandlerDestroyed(readHandler3);
+    EXPECT_EQ(coalescingScheduler.GetNumReadHandlers(), 3u);
+    EXPECT_FALSE(coalescingScheduler.IsReportScheduled(readHandler3));
+
+    coalescingScheduler.UnregisterAllHandlers();
+    EXPECT_FALSE(sTestTimerCoalescingDelegate.IsTimerActive(&coalescingScheduler));
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -24,6 +24,7 @@
 #include <app/util/odd-sized-integers.h>
 #include <crypto/DefaultSessionKeystore.h>
 #include <lib/core/TLV.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/Span.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 
@@ -2298,4 +2299,112 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestSceneIndexCache)
+{
+    SceneTableImpl * sceneTable = scenes::GetSceneTableImpl(kTestEndpoint1, defaultTestTableSize);
+    ASSERT_NE(nullptr, sceneTable);
+    ResetSceneTable(sceneTable);
+
+    SceneTableEntry scene;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene2));
+
+    // The first lookup of a scene goes through the scene map of its fabric and caches the position of the scene
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+
+    // Later lookups no longer read the scene map
+    std::string sceneMapKey = DefaultStorageKeyAllocator::FabricSceneDataKey(kFabric1, kTestEndpoint1).KeyName();
+    mpTestStorage->AddPoisonKey(sceneMapKey);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+    EXPECT_NE(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    mpTestStorage->ClearPoisonKeys();
+
+    // Positions are cached per fabric
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric2, sceneId1, scene));
+
+    // Replace scene 1 by scene 3 through another table sharing the storage, leaving a stale position in the cache: the lookup
+    // must not return scene 3, nor a scene that no longer exists
+    TestSceneTableImpl otherSceneTable;
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.Init(*mpTestStorage));
+    otherSceneTable.SetEndpoint(kTestEndpoint1);
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.RemoveSceneTableEntry(kFabric1, sceneId1));
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.SetSceneTableEntry(kFabric1, scene3));
+    otherSceneTable.Finish();
+
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(scene, scene3);
+
+    // Removed scenes are no longer found
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->RemoveSceneTableEntry(kFabric1, sceneId3));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->RemoveFabric(kFabric1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+
+    ResetSceneTable(sceneTable);
+}
+
+TEST_F(TestSceneTable, TestSceneIndexCacheBatchedRecall)
+{
+    // Endpoints recalling the same scene, as ScenesServer::RecallScenes does for the members of a group
+    constexpr EndpointId kFirstBatchEndpoint = 100;
+    constexpr uint16_t kBatchSize            = scenes::kSceneIndexCacheSize;
+
+    SceneTableEntry scene;
+    for (uint16_t i = 0; i <= kBatchSize; i++)
+    {
+        SceneTableImpl * sceneTable = scenes::GetSceneTableImpl(static_cast<EndpointId>(kFirstBatchEndpoint + i));
+        ASSERT_NE(nullptr, sceneTable);
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene1));
+    }
+
+    auto recall = [&](uint16_t i) {
+        SceneTableImpl * sceneTable = scenes::GetSceneTableImpl(static_cast<EndpointId>(kFirstBatchEndpoint + i));
+        return sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene);
+    };
+    auto poisonSceneMaps = [&]() {
+        for (uint16_t i = 0; i <= kBatchSize; i++)
+        {
+            mpTestStorage->AddPoisonKey(
+                DefaultStorageKeyAllocator::FabricSceneDataKey(kFabric1, static_cast<EndpointId>(kFirstBatchEndpoint + i))
+                    .KeyName());
+        }
+    };
+
+    // A first recall on every endpoint caches all the positions, so that repeated batched recalls no longer read the scene maps
+    for (uint16_t i = 0; i < kBatchSize; i++)
+    {
+        EXPECT_EQ(CHIP_NO_ERROR, recall(i));
+    }
+    poisonSceneMaps();
+    for (uint16_t round = 0; round < 2; round++)
+    {
+        for (uint16_t i = 0; i < kBatchSize; i++)
+        {
+            EXPECT_EQ(CHIP_NO_ERROR, recall(i));
+            EXPECT_EQ(scene, scene1);
+        }
+    }
+    mpTestStorage->ClearPoisonKeys();
+
+    // Once full, the position used the longest time ago is evicted: recall the first endpoint again, so that caching one more
+    // endpoint evicts the second one
+    EXPECT_EQ(CHIP_NO_ERROR, recall(0));
+    EXPECT_EQ(CHIP_NO_ERROR, recall(kBatchSize));
+    poisonSceneMaps();
+    EXPECT_EQ(CHIP_NO_ERROR, recall(0));
+    EXPECT_EQ(CHIP_NO_ERROR, recall(kBatchSize));
+    EXPECT_NE(CHIP_NO_ERROR, recall(1));
+    mpTestStorage->ClearPoisonKeys();
+
+    for (uint16_t i = 0; i <= kBatchSize; i++)
+    {
+        SceneTableImpl * sceneTable = scenes::GetSceneTableImpl(static_cast<EndpointId>(kFirstBatchEndpoint + i));
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable->RemoveEndpoint());
+    }
+}
+
 } // namespace TestScenes
@@ -403,3 +403,126 @@ TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionStateJunkData)
     EXPECT_EQ(iterator->Count(), 0u);
     iterator->Release();
 }
+
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionIndexTouchesOnlyAffectedSlots)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    subscriptionStorage.Init(&storage);
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo = { .mNodeId = 7777, .mFabricIndex = 47 };
+    for (chip::SubscriptionId subscriptionId = 0; subscriptionId < 3; subscriptionId++)
+    {
+        subscriptionInfo.mSubscriptionId = subscriptionId;
+        EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo), CHIP_NO_ERROR);
+    }
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName()));
+
+    // Restart, then make every slot but the second one fail on access: the index alone locates the subscriptions.
+    SimpleSubscriptionResumptionStorageTest restartedStorage;
+    EXPECT_EQ(restartedStorage.Init(&storage), CHIP_NO_ERROR);
+    for (size_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        if (subscriptionIndex != 1)
+        {
+            storage.AddPoisonKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
+        }
+    }
+
+    // Deleting the second subscription and saving a new one only use the second slot.
+    EXPECT_EQ(restartedStorage.Delete(7777, 47, 1), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(1).KeyName()));
+    EXPECT_EQ(restartedStorage.Delete(7777, 47, 1), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    subscriptionInfo.mSubscriptionId = 3;
+    EXPECT_EQ(restartedStorage.Save(subscriptionInfo), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(1).KeyName()));
+
+    // Saving the same subscription again overwrites its slot.
+    subscriptionInfo.mMaxInterval = 60;
+    EXPECT_EQ(restartedStorage.Save(subscriptionInfo), CHIP_NO_ERROR);
+
+    storage.ClearPoisonKeys();
+    auto * iterator = restartedStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 3u);
+    size_t updatedCount = 0;
+    while (iterator->Next(subscriptionInfo))
+    {
+        updatedCount += (subscriptionInfo.mSubscriptionId == 3 && subscriptionInfo.mMaxInterval == 60) ? 1 : 0;
+    }
+    iterator->Release();
+    EXPECT_EQ(updatedCount, 1u);
+
+    // Deleting the whole fabric removes the index along with the slots.
+    EXPECT_EQ(restartedStorage.DeleteAll(47), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionIndexRebuilt)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    subscriptionStorage.Init(&storage);
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo1 = { .mNodeId         = 8888,
+                                                                                     .mFabricIndex    = 48,
+                                                                                     .mSubscriptionId = 8 };
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo2 = { .mNodeId         = 9999,
+                                                                                     .mFabricIndex    = 49,
+                                                                                     .mSubscriptionId = 9 };
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo2), CHIP_NO_ERROR);
+
+    // Subscriptions saved before the index existed are found again by Init.
+    EXPECT_EQ(storage.SyncDeleteKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName()),
+              CHIP_NO_ERROR);
+
+    SimpleSubscriptionResumptionStorageTest restartedStorage;
+    EXPECT_EQ(restartedStorage.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName()));
+
+    EXPECT_EQ(restartedStorage.DeleteAll(48), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(0).KeyName()));
+    EXPECT_EQ(restartedStorage.Delete(9999, 49, 9), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(1).KeyName()));
+    EXPECT_FALSE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName()));
+}
+
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionIndexRebuiltDropsDuplicates)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    subscriptionStorage.Init(&storage);
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo = { .mNodeId         = 8888,
+                                                                                    .mFabricIndex    = 48,
+                                                                                    .mSubscriptionId = 8 };
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo), CHIP_NO_ERROR);
+
+    // Copy the subscription to a second slot and drop the index, as an interrupted update could leave it.
+    uint8_t buffer[SimpleSubscriptionResumptionStorageTest::TestMaxSubscriptionSize()];
+    uint16_t len = sizeof(buffer);
+    EXPECT_EQ(storage.SyncGetKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumption(0).KeyName(), buffer, len),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SyncSetKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumption(1).KeyName(), buffer, len),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SyncDeleteKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName()),
+              CHIP_NO_ERROR);
+
+    SimpleSubscriptionResumptionStorageTest restartedStorage;
+    EXPECT_EQ(restartedStorage.Init(&storage), CHIP_NO_ERROR);
+
+    // The duplicate slot is deleted, so iterating returns the subscription only once.
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(0).KeyName()));
+    EXPECT_FALSE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(1).KeyName()));
+
+    auto * iterator = restartedStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 1u);
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo iteratedInfo;
+    EXPECT_TRUE(iterator->Next(iteratedInfo));
+    EXPECT_EQ(iteratedInfo.mNodeId, subscriptionInfo.mNodeId);
+    EXPECT_FALSE(iterator->Next(iteratedInfo));
+    iterator->Release();
+
+    EXPECT_EQ(restartedStorage.DeleteAll(48), CHIP_NO_ERROR);
+}
@@ -114,7 +114,7 @@ CHIP_ERROR BLEEndPoint::StartConnect()
 
     req.mMtu = mBle->mPlatformDelegate->GetMTU(mConnObj);
 
-    req.mWindowSize = BLE_MAX_RECEIVE_WINDOW_SIZE;
+    req.mWindowSize = GetOfferedReceiveWindowSize();
 
     // Populate request with highest supported protocol versions
     for (uint8_t i = 0; i < numVersions; i++)
@@ -534,6 +534,12 @@ CHIP_ERROR BLEEndPoint::Init(BleLayer * bleLayer, BLE_CONNECTION_OBJECT connObj,
     mSendQueue               = nullptr;
     mAckToSend               = nullptr;
 
+    mImmediateAckWindowThreshold = BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD;
+
+    // Keep the mode for the whole connection, so that the window offered during the handshake and the ack policy applied
+    // once it completes agree even if BleLayer::SetBtpSlidingWindowEnabled() is called in between.
+    mSlidingWindowEnabled = bleLayer->IsBtpSlidingWindowEnabled();
+
     ChipLogDebugBleEndPoint(Ble, "initialized local rx window, size = %u", mLocalReceiveWindowSize);
 
     // End point is ready to connect or receive a connection.
@@ -754,7 +760,7 @@ CHIP_ERROR BLEEndPoint::HandleHandshakeConfirmationReceived()
         {
             // If local receive window size has shrunk to or below immediate ack threshold, AND a message fragment is not
             // pending on which to piggyback an ack, send immediate stand-alone ack.
-            if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD && mSendQueue.IsNull())
+            if (mLocalReceiveWindowSize <= mImmediateAckWindowThreshold && mSendQueue.IsNull())
             {
                 err = DriveStandAloneAck(); // Encode stand-alone ack and drive sending.
                 SuccessOrExit(err);
@@ -816,7 +822,7 @@ CHIP_ERROR BLEEndPoint::HandleFragmentConfirmationReceived()
     // This check covers the case where the local receive window has shrunk between transmission and confirmation of
     // the stand-alone ack, and also the case where a window size < the immediate ack threshold was detected in
     // Receive(), but the stand-alone ack was deferred due to a pending outbound message fragment.
-    if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD && mSendQueue.IsNull() &&
+    if (mLocalReceiveWindowSize <= mImmediateAckWindowThreshold && mSendQueue.IsNull() &&
         mBtpEngine.TxState() != BtpEngine::kState_InProgress)
     {
         err = DriveStandAloneAck(); // Encode stand-alone ack and drive sending.
@@ -1011,8 +1017,7 @@ CHIP_ERROR BLEEndPoint::HandleCapabilitiesRequestReceived(PacketBufferHandle &&
 
     // Select local and remote max receive window size based on local resources available for both incoming writes AND
     // GATT confirmations.
-    mRemoteReceiveWindowSize = mLocalReceiveWindowSize = mReceiveWindowMaxSize =
-        std::min(req.mWindowSize, static_cast<uint8_t>(BLE_MAX_RECEIVE_WINDOW_SIZE));
+    SetReceiveWindowMaxSize(std::min(req.mWindowSize, GetOfferedReceiveWindowSize()));
     resp.mWindowSize = mReceiveWindowMaxSize;
 
     ChipLogProgress(Ble, "local and remote recv window sizes = %u", resp.mWindowSize);
@@ -1077,7 +1082,7 @@ CHIP_ERROR BLEEndPoint::HandleCapabilitiesResponseReceived(PacketBufferHandle &&
 
     // Select local and remote max receive window size based on local resources available for both incoming indications
     // AND GATT confirmations.
-    mRemoteReceiveWindowSize = mLocalReceiveWindowSize = mReceiveWindowMaxSize = resp.mWindowSize;
+    SetReceiveWindowMaxSize(resp.mWindowSize);
 
     ChipLogProgress(Ble, "local and remote recv window size = %u", resp.mWindowSize);
 
@@ -1095,6 +1100,26 @@ CHIP_ERROR BLEEndPoint::HandleCapabilitiesResponseReceived(PacketBufferHandle &&
     return HandleConnectComplete();
 }
 
+uint8_t BLEEndPoint::GetOfferedReceiveWindowSize() const
+{
+    return mSlidingWindowEnabled ? static_cast<uint8_t>(BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE)
+                                 : static_cast<uint8_t>(BLE_MAX_RECEIVE_WINDOW_SIZE);
+}
+
+void BLEEndPoint::SetReceiveWindowMaxSize(SequenceNumber_t size)
+{
+    mRemoteReceiveWindowSize = mLocalReceiveWindowSize = mReceiveWindowMaxSize = size;
+
+    // In sliding-window mode, acknowledge once half of the window is used, so that the sender gets the ack before it runs
+    // out of window. As with the default threshold, receiving a single stand-alone ack right after sending one does not
+    // bring the window down to the threshold, so end points do not keep acknowledging each other's acks.
+    if (mSlidingWindowEnabled)
+    {
+        mImmediateAckWindowThreshold = std::max(static_cast<SequenceNumber_t>(BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD),
+                                                static_cast<SequenceNumber_t>(size / 2));
+    }
+}
+
 // Returns number of open slots in remote receive window given the input values.
 SequenceNumber_t BLEEndPoint::AdjustRemoteReceiveWindow(SequenceNumber_t lastReceivedAck, SequenceNumber_t maxRemoteWindowSize,
                                                         SequenceNumber_t newestUnackedSentSeqNum)
@@ -1254,7 +1279,7 @@ CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
     // this threshold again when the GATT operation is confirmed.
     if (mBtpEngine.HasUnackedData())
     {
-        if (mLocalReceiveWindowSize <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD &&
+        if (mLocalReceiveWindowSize <= mImmediateAckWindowThreshold &&
             !mConnStateFlags.Has(ConnectionStateFlag::kGattOperationInFlight))
         {
             ChipLogDebugBleEndPoint(Ble, "sending immediate ack");
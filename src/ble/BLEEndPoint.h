@@ -152,6 +152,9 @@ private:
     SequenceNumber_t mLocalReceiveWindowSize;
     SequenceNumber_t mRemoteReceiveWindowSize;
     SequenceNumber_t mReceiveWindowMaxSize;
+    SequenceNumber_t mImmediateAckWindowThreshold;
+    // Whether the end point uses the BTP sliding-window mode, latched from the BleLayer when the end point is initialized.
+    bool mSlidingWindowEnabled;
 
     // Private functions:
     BLEEndPoint()  = delete;
@@ -183,6 +186,8 @@ private:
     CHIP_ERROR HandleFragmentConfirmationReceived();
     CHIP_ERROR HandleCapabilitiesRequestReceived(PacketBufferHandle && data);
     CHIP_ERROR HandleCapabilitiesResponseReceived(PacketBufferHandle && data);
+    uint8_t GetOfferedReceiveWindowSize() const;
+    void SetReceiveWindowMaxSize(SequenceNumber_t size);
     SequenceNumber_t AdjustRemoteReceiveWindow(SequenceNumber_t lastReceivedAck, SequenceNumber_t maxRemoteWindowSize,
                                                SequenceNumber_t newestUnackedSentSeqNum);
 
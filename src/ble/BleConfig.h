@@ -170,6 +170,43 @@
 #error "BLE_MAX_RECEIVE_WINDOW_SIZE must be greater than 2 for BLE transport protocol stability."
 #endif
 
+/**
+ *  @def BLE_CONFIG_BTP_SLIDING_WINDOW
+ *
+ *  @brief
+ *    Whether (1) or not (0) BLE end points use the BTP sliding-window mode by default. The mode can also be selected at
+ *    run time with BleLayer::SetBtpSlidingWindowEnabled().
+ *
+ *    In this mode, an end point offers a receive window of BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE fragments, and sends a
+ *    stand-alone acknowledgement once half of its receive window is used rather than when a single slot is left. The
+ *    acknowledgement then reaches the sender while it still has room in the window, so that fragments keep flowing at the
+ *    rate of GATT confirmations instead of pausing for a round trip at the end of every window, while each
+ *    acknowledgement still covers several fragments.
+ *
+ *    The mode only changes choices left to each end point by the protocol, so it works with peers that do not use it.
+ */
+#ifndef BLE_CONFIG_BTP_SLIDING_WINDOW
+#define BLE_CONFIG_BTP_SLIDING_WINDOW 0
+#endif
+
+/**
+ *  @def BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE
+ *
+ *  @brief
+ *    The receive window offered by end points in the BTP sliding-window mode. The window used on a connection is the
+ *    smallest of the ones offered by both ends.
+ *
+ *    The same constraints as for BLE_MAX_RECEIVE_WINDOW_SIZE apply. Platforms which reserve enough GATT buffers should
+ *    raise this value, as a larger window lets the sender get further ahead of the acknowledgements.
+ */
+#ifndef BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE
+#define BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE BLE_MAX_RECEIVE_WINDOW_SIZE
+#endif
+
+#if (BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE < 3 || BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE > 255)
+#error "BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE must be between 3 and 255."
+#endif
+
 /**
  *  @def BLE_CONFIG_ERROR_MIN
  *
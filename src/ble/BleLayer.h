@@ -286,6 +286,14 @@ public:
     void CloseAllBleConnections();
     void CloseBleConnection(BLE_CONNECTION_OBJECT connObj);
 
+    /**
+     * Selects whether the end points created from now on use the BTP sliding-window mode, which is described along with
+     * BLE_CONFIG_BTP_SLIDING_WINDOW, the default. Each end point latches the mode when it is created, so end points already
+     * created, including those with a handshake in progress, keep their mode.
+     */
+    void SetBtpSlidingWindowEnabled(bool enabled) { mBtpSlidingWindowEnabled = enabled; }
+    bool IsBtpSlidingWindowEnabled() const { return mBtpSlidingWindowEnabled; }
+
     /**< Platform interface functions:
 
      *   Calling conventions:
@@ -351,6 +359,7 @@ private:
     BlePlatformDelegate * mPlatformDelegate;
     BleApplicationDelegate * mApplicationDelegate;
     chip::System::Layer * mSystemLayer;
+    bool mBtpSlidingWindowEnabled = BLE_CONFIG_BTP_SLIDING_WINDOW;
 
     // Private functions:
     void HandleAckReceived(BLE_CONNECTION_OBJECT connObj);
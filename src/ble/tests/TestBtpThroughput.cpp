@@ -0,0 +1,434 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+
+#define _CHIP_BLE_BLE_H
+#include <ble/BleApplicationDelegate.h>
+#include <ble/BleLayer.h>
+#include <ble/BleLayerDelegate.h>
+#include <ble/BlePlatformDelegate.h>
+#include <ble/BtpEngine.h>
+
+namespace chip {
+namespace Ble {
+
+namespace {
+
+// Characteristics of the simulated link. Times are in microseconds of simulated time.
+struct LinkParameters
+{
+    uint16_t mtu;
+    uint8_t windowSize;
+    // One-way latency of a GATT PDU.
+    uint64_t latencyUs;
+    // Time taken by the peripheral to get an indication on the air, on top of the link latency.
+    uint64_t indicationDelayUs;
+};
+
+struct TransferResult
+{
+    uint64_t elapsedUs;
+    unsigned writes;
+    unsigned indications;
+};
+
+constexpr size_t kMessageSize  = 1000;
+constexpr size_t kMessageCount = 4;
+
+// Upper bound on the number of simulated events, so that a stalled transfer fails instead of hanging.
+constexpr unsigned kMaxEvents = 100000;
+
+uint8_t MessageByte(size_t message, size_t index)
+{
+    return static_cast<uint8_t>(message * 31 + index);
+}
+
+}; // namespace
+
+// Drives a BleLayer in the peripheral role from a simulated central over a link with latency, and measures in
+// simulated time how long it takes for the peripheral to receive a few messages.
+//
+// As on real stacks, the central has at most one write request in flight and the peripheral at most one indication
+// in flight. The peripheral's stack responds to writes right away, while its indications, including stand-alone
+// acks, take an additional delay to get on the air.
+class TestBtpThroughput : public BleLayer,
+                          private BleApplicationDelegate,
+                          private BleLayerDelegate,
+                          private BlePlatformDelegate,
+                          public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::SystemLayer().Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::SystemLayer().Shutdown();
+        chip::Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(Init(this, this, &DeviceLayer::SystemLayer()), CHIP_NO_ERROR);
+        mBleTransport = this;
+    }
+
+    void TearDown() override
+    {
+        mEvents.clear();
+        mBleTransport = nullptr;
+        Shutdown();
+    }
+
+    TransferResult RunTransfer(const LinkParameters & link);
+
+    // Closes the connection of the previous transfer, so that another one can be run.
+    void Restart()
+    {
+        TearDown();
+        SetUp();
+    }
+
+private:
+    enum class EventType
+    {
+        kWriteReceived,
+        kWriteResponse,
+        kSubscribeReceived,
+        kIndicationReceived,
+        kIndicationConfirmed,
+    };
+
+    struct Event
+    {
+        EventType type;
+        System::PacketBufferHandle data;
+    };
+
+    template <typename T = BLE_CONNECTION_OBJECT>
+    BLE_CONNECTION_OBJECT GetConnectionObject()
+    {
+        if constexpr (std::is_pointer_v<T>)
+        {
+            return reinterpret_cast<T>(&mConnection);
+        }
+        else
+        {
+            return static_cast<T>(1);
+        }
+    }
+
+    void Schedule(uint64_t delayUs, EventType type, System::PacketBufferHandle && data = System::PacketBufferHandle())
+    {
+        mEvents.emplace(mNowUs + delayUs, Event{ type, std::move(data) });
+    }
+
+    void Dispatch(Event & event);
+    void CentralWrite(System::PacketBufferHandle && data);
+    void CentralReceive(System::PacketBufferHandle && data);
+    void CentralDriveSending();
+
+    ///
+    // Implementation of BleApplicationDelegate
+
+    void NotifyChipConnectionClosed(BLE_CONNECTION_OBJECT connObj) override {}
+
+    ///
+    // Implementation of BleLayerDelegate
+
+    void OnBleConnectionComplete(BLEEndPoint * endpoint) override {}
+    void OnBleConnectionError(CHIP_ERROR err) override {}
+    void OnEndPointConnectComplete(BLEEndPoint * endPoint, CHIP_ERROR err) override {}
+    void OnEndPointConnectionClosed(BLEEndPoint * endPoint, CHIP_ERROR err) override {}
+    CHIP_ERROR SetEndPoint(BLEEndPoint * endPoint) override { return CHIP_NO_ERROR; }
+
+    void OnEndPointMessageReceived(BLEEndPoint * endPoint, System::PacketBufferHandle && msg) override
+    {
+        ASSERT_FALSE(msg.IsNull());
+        ASSERT_EQ(msg->TotalLength(), kMessageSize);
+        ASSERT_FALSE(msg->HasChainedBuffer());
+        for (size_t i = 0; i < kMessageSize; i++)
+        {
+            ASSERT_EQ(msg->Start()[i], MessageByte(mMessagesReceived, i));
+        }
+        mMessagesReceived++;
+        mLastMessageUs = mNowUs;
+    }
+
+    ///
+    // Implementation of BlePlatformDelegate
+
+    CHIP_ERROR SubscribeCharacteristic(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR UnsubscribeCharacteristic(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR CloseConnection(BLE_CONNECTION_OBJECT) override { return CHIP_NO_ERROR; }
+    uint16_t GetMTU(BLE_CONNECTION_OBJECT) const override { return 0; }
+    CHIP_ERROR SendIndication(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *, PacketBufferHandle data) override
+    {
+        // Never call back into the BLE layer from here: deliver and confirm the indication later.
+        mIndications++;
+        Schedule(mLink.indicationDelayUs + mLink.latencyUs, EventType::kIndicationReceived, std::move(data));
+        Schedule(mLink.indicationDelayUs + 2 * mLink.latencyUs, EventType::kIndicationConfirmed);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR SendWriteRequest(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *, PacketBufferHandle) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    uint8_t mConnection = 0;
+    LinkParameters mLink{};
+    uint64_t mNowUs = 0;
+    std::multimap<uint64_t, Event> mEvents;
+
+    // State of the simulated central.
+    BtpEngine mCentral;
+    bool mCentralSubscribed   = false;
+    bool mCentralConnected    = false;
+    bool mWriteInFlight       = false;
+    uint8_t mWindowSize       = 0;
+    uint8_t mRemoteWindowSize = 0;
+    size_t mMessagesSent      = 0;
+
+    // Figures of the transfer.
+    size_t mMessagesReceived = 0;
+    uint64_t mLastMessageUs  = 0;
+    unsigned mWrites         = 0;
+    unsigned mIndications    = 0;
+};
+
+TransferResult TestBtpThroughput::RunTransfer(const LinkParameters & link)
+{
+    mLink              = link;
+    mNowUs             = 0;
+    mCentralSubscribed = false;
+    mCentralConnected  = false;
+    mWriteInFlight     = false;
+    mMessagesSent      = 0;
+    mMessagesReceived  = 0;
+    mLastMessageUs     = 0;
+    mWrites            = 0;
+    mIndications       = 0;
+    EXPECT_EQ(mCentral.Init(this, false), CHIP_NO_ERROR);
+
+    BleTransportCapabilitiesRequestMessage req{};
+    req.SetSupportedProtocolVersion(0, CHIP_BLE_TRANSPORT_PROTOCOL_MAX_SUPPORTED_VERSION);
+    req.mMtu        = link.mtu;
+    req.mWindowSize = link.windowSize;
+
+    auto buf = System::PacketBufferHandle::New(kCapabilitiesRequestLength);
+    EXPECT_FALSE(buf.IsNull());
+    EXPECT_EQ(req.Encode(buf), CHIP_NO_ERROR);
+    CentralWrite(std::move(buf));
+
+    unsigned events = 0;
+    while (!mEvents.empty() && mMessagesReceived < kMessageCount && events++ < kMaxEvents && !HasFatalFailure())
+    {
+        auto it = mEvents.begin();
+        mNowUs  = it->first;
+        Event event{ it->second.type, std::move(it->second.data) };
+        mEvents.erase(it);
+        Dispatch(event);
+    }
+
+    EXPECT_EQ(mMessagesReceived, kMessageCount);
+    return TransferResult{ mLastMessageUs, mWrites, mIndications };
+}
+
+void TestBtpThroughput::Dispatch(Event & event)
+{
+    const auto connObj = GetConnectionObject();
+
+    switch (event.type)
+    {
+    case EventType::kWriteReceived:
+        EXPECT_TRUE(HandleWriteReceived(connObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID, std::move(event.data)));
+        break;
+    case EventType::kWriteResponse:
+        mWriteInFlight = false;
+        if (!mCentralSubscribed)
+        {
+            // The capabilities request went through: subscribe to get the response.
+            mCentralSubscribed = true;
+            Schedule(mLink.latencyUs, EventType::kSubscribeReceived);
+            break;
+        }
+        CentralDriveSending();
+        break;
+    case EventType::kSubscribeReceived:
+        EXPECT_TRUE(HandleSubscribeReceived(connObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_2_UUID));
+        break;
+    case EventType::kIndicationReceived:
+        CentralReceive(std::move(event.data));
+        break;
+    case EventType::kIndicationConfirmed:
+        EXPECT_TRUE(HandleIndicationConfirmation(connObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_2_UUID));
+        break;
+    }
+}
+
+void TestBtpThroughput::CentralWrite(System::PacketBufferHandle && data)
+{
+    mWriteInFlight = true;
+    mWrites++;
+    Schedule(mLink.latencyUs, EventType::kWriteReceived, std::move(data));
+    Schedule(2 * mLink.latencyUs, EventType::kWriteResponse);
+}
+
+void TestBtpThroughput::CentralReceive(System::PacketBufferHandle && data)
+{
+    if (!mCentralConnected)
+    {
+        BleTransportCapabilitiesResponseMessage resp;
+        ASSERT_EQ(BleTransportCapabilitiesResponseMessage::Decode(data, resp), CHIP_NO_ERROR);
+        ASSERT_GT(resp.mFragmentSize, 0);
+        ASSERT_GT(resp.mWindowSize, 1);
+        mCentral.SetRxFragmentSize(resp.mFragmentSize);
+        mCentral.SetTxFragmentSize(resp.mFragmentSize);
+        mWindowSize       = resp.mWindowSize;
+        mRemoteWindowSize = resp.mWindowSize;
+        mCentralConnected = true;
+        CentralDriveSending();
+        return;
+    }
+
+    SequenceNumber_t receivedAck;
+    bool didReceiveAck;
+    ASSERT_EQ(mCentral.HandleCharacteristicReceived(std::move(data), receivedAck, didReceiveAck), CHIP_NO_ERROR);
+    if (didReceiveAck)
+    {
+        // Same computation as BLEEndPoint::AdjustRemoteReceiveWindow.
+        auto inFlight     = static_cast<uint8_t>(mCentral.GetNewestUnackedSentSequenceNumber() - receivedAck);
+        mRemoteWindowSize = static_cast<uint8_t>(mWindowSize - inFlight);
+    }
+    CentralDriveSending();
+}
+
+void TestBtpThroughput::CentralDriveSending()
+{
+    VerifyOrReturn(mCentralConnected && !mWriteInFlight);
+
+    // Same rule as BLEEndPoint::DriveSending: the last slot of the peer's window is kept for a fragment carrying an ack.
+    const bool sendAck = mCentral.HasUnackedData();
+    VerifyOrReturn(mRemoteWindowSize > 1 || (mRemoteWindowSize == 1 && sendAck));
+
+    if (mCentral.TxState() == BtpEngine::kState_Complete)
+    {
+        mCentral.ClearTxPacket();
+    }
+
+    if (mCentral.TxState() == BtpEngine::kState_Idle)
+    {
+        VerifyOrReturn(mMessagesSent < kMessageCount);
+
+        auto msg = System::PacketBufferHandle::New(kMessageSize);
+        ASSERT_FALSE(msg.IsNull());
+        for (size_t i = 0; i < kMessageSize; i++)
+        {
+            msg->Start()[i] = MessageByte(mMessagesSent, i);
+        }
+        msg->SetDataLength(kMessageSize);
+        mMessagesSent++;
+
+        ASSERT_TRUE(mCentral.HandleCharacteristicSend(std::move(msg), sendAck));
+    }
+    else
+    {
+        ASSERT_TRUE(mCentral.HandleCharacteristicSend(nullptr, sendAck));
+    }
+
+    // The engine keeps the whole message: send a copy of the current fragment.
+    auto fragment = mCentral.BorrowTxPacket();
+    auto copy     = System::PacketBufferHandle::NewWithData(fragment->Start(), fragment->DataLength());
+    ASSERT_FALSE(copy.IsNull());
+
+    mRemoteWindowSize--;
+    CentralWrite(std::move(copy));
+}
+
+TEST_F(TestBtpThroughput, TransfersMessagesWithDefaultAckPolicy)
+{
+    SetBtpSlidingWindowEnabled(false);
+    auto result = RunTransfer({ 247, BLE_MAX_RECEIVE_WINDOW_SIZE, 7500, 7500 });
+    EXPECT_GT(result.writes, kMessageCount * kMessageSize / 244);
+}
+
+TEST_F(TestBtpThroughput, TransfersMessagesWithSlidingWindow)
+{
+    SetBtpSlidingWindowEnabled(true);
+    auto result = RunTransfer({ 247, BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE, 7500, 7500 });
+    EXPECT_GT(result.writes, kMessageCount * kMessageSize / 244);
+}
+
+TEST_F(TestBtpThroughput, TransfersMessagesWithSmallMtu)
+{
+    SetBtpSlidingWindowEnabled(true);
+    auto result = RunTransfer({ 23, BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE, 7500, 7500 });
+    EXPECT_GT(result.writes, kMessageCount * kMessageSize / 20);
+}
+
+// Compares the time taken by the transfer with both ack policies, on a link where the peripheral takes twice the link
+// latency to get an indication on the air.
+TEST_F(TestBtpThroughput, SlidingWindowKeepsTheLinkBusy)
+{
+    constexpr uint64_t kLatencyUs = 7500;
+    constexpr LinkParameters kLink{ 247, BLE_CONFIG_BTP_SLIDING_WINDOW_SIZE, kLatencyUs, 2 * kLatencyUs };
+
+    SetBtpSlidingWindowEnabled(false);
+    auto legacy = RunTransfer(kLink);
+    Restart();
+
+    SetBtpSlidingWindowEnabled(true);
+    auto sliding = RunTransfer(kLink);
+
+    ChipLogProgress(Test, "Default ack policy: %u writes, %u indications, %u ms", legacy.writes, legacy.indications,
+                    static_cast<unsigned>(legacy.elapsedUs / 1000));
+    ChipLogProgress(Test, "Sliding window: %u writes, %u indications, %u ms", sliding.writes, sliding.indications,
+                    static_cast<unsigned>(sliding.elapsedUs / 1000));
+
+    EXPECT_LT(sliding.elapsedUs, legacy.elapsedUs);
+
+    // With the sliding window, the central never waits for an ack: after the handshake, which takes a write, a
+    // subscription and an indication, each write takes one round trip.
+    uint64_t handshakeUs = 2 * kLatencyUs + kLatencyUs + kLink.indicationDelayUs + kLatencyUs;
+    EXPECT_LE(sliding.elapsedUs, handshakeUs + (sliding.writes - 1) * 2 * kLatencyUs + kLatencyUs);
+}
+
+} // namespace Ble
+} // namespace chip
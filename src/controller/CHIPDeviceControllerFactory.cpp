@@ -29,6 +29,7 @@
 #include <app/TimerDelegates.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/util/DataModelHandler.h>
+#include <lib/address_resolve/AddressResolve.h>
 #include <lib/core/ErrorStr.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 
@@ -66,6 +67,7 @@ CHIP_ERROR DeviceControllerFactory::Init(FactoryInitParams params)
     mOperationalKeystore       = params.operationalKeystore;
     mOpCertStore               = params.opCertStore;
     mCertificateValidityPolicy = params.certificateValidityPolicy;
+    mVerifiedCertificateCache  = params.verifiedCertificateCache;
     mSessionResumptionStorage  = params.sessionResumptionStorage;
     mEnableServerInteractions  = params.enableServerInteractions;
 
@@ -99,6 +101,7 @@ CHIP_ERROR DeviceControllerFactory::ReinitSystemStateIfNecessary()
     params.operationalKeystore       = mOperationalKeystore;
     params.opCertStore               = mOpCertStore;
     params.certificateValidityPolicy = mCertificateValidityPolicy;
+    params.verifiedCertificateCache  = mVerifiedCertificateCache;
     params.sessionResumptionStorage  = mSessionResumptionStorage;
 
     // re-initialization keeps any previously initialized values. The only place where
@@ -250,8 +253,20 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
         sessionResumptionStorage                     = stateParams.externalSessionResumptionStorage;
     }
 
+    if (params.verifiedCertificateCache == nullptr)
+    {
+        stateParams.ownedVerifiedCertificateCache = chip::Platform::MakeUnique<Credentials::VerifiedCertificateCache>();
+        VerifyOrReturnError(stateParams.ownedVerifiedCertificateCache != nullptr, CHIP_ERROR_NO_MEMORY);
+        stateParams.verifiedCertificateCache = stateParams.ownedVerifiedCertificateCache.get();
+    }
+    else
+    {
+        stateParams.verifiedCertificateCache = params.verifiedCertificateCache;
+    }
+
     auto delegate = chip::Platform::MakeUnique<ControllerFabricDelegate>();
-    ReturnErrorOnFailure(delegate->Init(sessionResumptionStorage, stateParams.groupDataProvider));
+    ReturnErrorOnFailure(
+        delegate->Init(sessionResumptionStorage, stateParams.groupDataProvider, stateParams.verifiedCertificateCache));
     stateParams.fabricTableDelegate = delegate.get();
     ReturnErrorOnFailure(stateParams.fabricTable->AddFabricDelegate(stateParams.fabricTableDelegate));
     delegate.release();
@@ -314,6 +329,7 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
         .sessionManager            = stateParams.sessionMgr,
         .sessionResumptionStorage  = sessionResumptionStorage,
         .certificateValidityPolicy = stateParams.certificateValidityPolicy,
+        .verifiedCertificateCache  = stateParams.verifiedCertificateCache,
         .exchangeMgr               = stateParams.exchangeMgr,
         .fabricTable               = stateParams.fabricTable,
         .groupDataProvider         = stateParams.groupDataProvider,
@@ -332,6 +348,9 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     stateParams.caseSessionManager = Platform::New<CASESessionManager>();
     ReturnErrorOnFailure(stateParams.caseSessionManager->Init(stateParams.systemLayer, sessionManagerConfig));
 
+    // Reconnecting to known nodes after a restart can then skip their DNSSD lookup.
+    LogErrorOnFailure(AddressResolve::Resolver::Instance().SetPersistentStorage(params.fabricIndependentStorage));
+
     ReturnErrorOnFailure(interactionModelEngine->Init(stateParams.exchangeMgr, stateParams.fabricTable, stateParams.reportScheduler,
                                                       stateParams.caseSessionManager));
 
@@ -465,6 +484,7 @@ void DeviceControllerFactory::Shutdown()
     mOperationalKeystore       = nullptr;
     mOpCertStore               = nullptr;
     mCertificateValidityPolicy = nullptr;
+    mVerifiedCertificateCache  = nullptr;
     mSessionResumptionStorage  = nullptr;
 }
 
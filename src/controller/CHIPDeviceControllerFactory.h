@@ -161,6 +161,10 @@ struct FactoryInitParams
      * The default value of `0` will pick any available port. */
     uint16_t listenPort = 0;
 
+    // Cache of the certificate signatures verified when validating the certificate chains of CASE peers.
+    // If null, the system state creates and owns one.
+    Credentials::VerifiedCertificateCache * verifiedCertificateCache = nullptr;
+
     // MUST NOT be null during initialization: every application must define the
     // data model it wants to use. Backwards-compatibility can use `CodegenDataModelProviderInstance`
     // for ember/zap-generated models.
@@ -240,13 +244,15 @@ public:
     class ControllerFabricDelegate final : public chip::FabricTable::Delegate
     {
     public:
-        CHIP_ERROR Init(SessionResumptionStorage * sessionResumptionStorage, Credentials::GroupDataProvider * groupDataProvider)
+        CHIP_ERROR Init(SessionResumptionStorage * sessionResumptionStorage, Credentials::GroupDataProvider * groupDataProvider,
+                        Credentials::VerifiedCertificateCache * verifiedCertificateCache)
         {
             VerifyOrReturnError(sessionResumptionStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
             VerifyOrReturnError(groupDataProvider != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
             mSessionResumptionStorage = sessionResumptionStorage;
             mGroupDataProvider        = groupDataProvider;
+            mVerifiedCertificateCache = verifiedCertificateCache;
             return CHIP_NO_ERROR;
         };
 
@@ -258,15 +264,33 @@ public:
                 mGroupDataProvider->RemoveFabric(fabricIndex);
             }
             ClearCASEResumptionStateOnFabricChange(fabricIndex);
+            ClearVerifiedCertificates();
         };
 
         void OnFabricUpdated(const chip::FabricTable & fabricTable, chip::FabricIndex fabricIndex) override
         {
             (void) fabricTable;
             ClearCASEResumptionStateOnFabricChange(fabricIndex);
+            ClearVerifiedCertificates();
+        }
+
+        void OnFabricCommitted(const chip::FabricTable & fabricTable, chip::FabricIndex fabricIndex) override
+        {
+            (void) fabricTable;
+            (void) fabricIndex;
+            ClearVerifiedCertificates();
         }
 
     private:
+        // Signatures verified against the trusted roots of a fabric are dropped whenever these roots may have changed.
+        void ClearVerifiedCertificates()
+        {
+            if (mVerifiedCertificateCache != nullptr)
+            {
+                mVerifiedCertificateCache->Clear();
+            }
+        }
+
         void ClearCASEResumptionStateOnFabricChange(chip::FabricIndex fabricIndex)
         {
             VerifyOrReturn(mSessionResumptionStorage != nullptr);
@@ -279,8 +303,9 @@ public:
             }
         }
 
-        Credentials::GroupDataProvider * mGroupDataProvider  = nullptr;
-        SessionResumptionStorage * mSessionResumptionStorage = nullptr;
+        Credentials::GroupDataProvider * mGroupDataProvider               = nullptr;
+        SessionResumptionStorage * mSessionResumptionStorage              = nullptr;
+        Credentials::VerifiedCertificateCache * mVerifiedCertificateCache = nullptr;
     };
 
 private:
@@ -296,6 +321,7 @@ private:
     Crypto::OperationalKeystore * mOperationalKeystore                  = nullptr;
     Credentials::OperationalCertificateStore * mOpCertStore             = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
+    Credentials::VerifiedCertificateCache * mVerifiedCertificateCache   = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     bool mEnableServerInteractions                                      = false;
 };
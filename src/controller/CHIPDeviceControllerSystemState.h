@@ -34,6 +34,7 @@
 #include <app/reporting/ReportScheduler.h>
 #include <credentials/FabricTable.h>
 #include <credentials/GroupDataProvider.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPConfig.h>
 #include <protocols/bdx/BdxTransferServer.h>
@@ -129,7 +130,11 @@ struct DeviceControllerSystemStateParams
     // externally owned) or ownedSessionResumptionStorage (managed by the system
     // state) must be non-null.
     Platform::UniquePtr<SimpleSessionResumptionStorage> ownedSessionResumptionStorage;
+    // NOTE: verifiedCertificateCache is either externally owned or the same as
+    // ownedVerifiedCertificateCache (managed by the system state).
+    Platform::UniquePtr<Credentials::VerifiedCertificateCache> ownedVerifiedCertificateCache;
     Credentials::CertificateValidityPolicy * certificateValidityPolicy            = nullptr;
+    Credentials::VerifiedCertificateCache * verifiedCertificateCache              = nullptr;
     SessionManager * sessionMgr                                                   = nullptr;
     Protocols::SecureChannel::UnsolicitedStatusHandler * unsolicitedStatusHandler = nullptr;
     Messaging::ExchangeManager * exchangeMgr                                      = nullptr;
@@ -174,8 +179,9 @@ public:
         mCASESessionManager(params.caseSessionManager), mSessionSetupPool(params.sessionSetupPool),
         mCASEClientPool(params.caseClientPool), mGroupDataProvider(params.groupDataProvider), mTimerDelegate(params.timerDelegate),
         mReportScheduler(params.reportScheduler), mSessionKeystore(params.sessionKeystore),
-        mFabricTableDelegate(params.fabricTableDelegate),
-        mOwnedSessionResumptionStorage(std::move(params.ownedSessionResumptionStorage))
+        mFabricTableDelegate(params.fabricTableDelegate), mVerifiedCertificateCache(params.verifiedCertificateCache),
+        mOwnedSessionResumptionStorage(std::move(params.ownedSessionResumptionStorage)),
+        mOwnedVerifiedCertificateCache(std::move(params.ownedVerifiedCertificateCache))
     {
         if (mOwnedSessionResumptionStorage)
         {
@@ -245,6 +251,7 @@ public:
     Credentials::GroupDataProvider * GetGroupDataProvider() const { return mGroupDataProvider; }
     chip::app::reporting::ReportScheduler * GetReportScheduler() const { return mReportScheduler; }
     SessionResumptionStorage * GetSessionResumptionStorage() const { return mSessionResumptionStorage; }
+    Credentials::VerifiedCertificateCache * GetVerifiedCertificateCache() const { return mVerifiedCertificateCache; }
 
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
     void SetTempFabricTable(FabricTable * tempFabricTable, bool enableServerInteractions)
@@ -280,7 +287,9 @@ private:
     Crypto::SessionKeystore * mSessionKeystore                                     = nullptr;
     FabricTable::Delegate * mFabricTableDelegate                                   = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                           = nullptr;
+    Credentials::VerifiedCertificateCache * mVerifiedCertificateCache              = nullptr;
     Platform::UniquePtr<SimpleSessionResumptionStorage> mOwnedSessionResumptionStorage;
+    Platform::UniquePtr<Credentials::VerifiedCertificateCache> mOwnedVerifiedCertificateCache;
 
     // If mTempFabricTable is not null, it was created during
     // DeviceControllerFactory::InitSystemState and needs to be
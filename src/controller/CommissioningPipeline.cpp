@@ -0,0 +1,293 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPipeline.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+CommissioningPipeline::~CommissioningPipeline()
+{
+    Stop();
+}
+
+CHIP_ERROR CommissioningPipeline::AddLane(DeviceCommissioner * commissioner)
+{
+    VerifyOrReturnError(commissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+
+    for (auto & lane : mLanes)
+    {
+        VerifyOrReturnError(lane->GetCommissioner() != commissioner, CHIP_ERROR_DUPLICATE_KEY_ID);
+    }
+
+    mLanes.push_back(std::make_unique<Lane>(*this, commissioner));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommissioningPipeline::Start(std::vector<Job> jobs, const CommissioningParameters & params, DiscoveryType discoveryType,
+                                        Delegate * delegate)
+{
+    VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!jobs.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!mLanes.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+
+    mPendingJobs.assign(jobs.begin(), jobs.end());
+    mParams        = params;
+    mDiscoveryType = discoveryType;
+    mDelegate      = delegate;
+
+    for (auto & metrics : mStageMetrics)
+    {
+        metrics = StageMetrics();
+    }
+    mSucceeded = 0;
+    mFailed    = 0;
+    mStartTime = System::SystemClock().GetMonotonicTimestamp();
+    mEndTime   = System::Clock::kZero;
+
+    ChipLogProgress(Controller, "Commissioning %u devices over %u lanes", static_cast<unsigned>(mPendingJobs.size()),
+                    static_cast<unsigned>(mLanes.size()));
+
+    for (auto & lane : mLanes)
+    {
+        lane->Attach();
+        lane->ScheduleNextJob();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::Stop()
+{
+    VerifyOrReturn(IsRunning());
+
+    mPendingJobs.clear();
+    for (auto & lane : mLanes)
+    {
+        lane->CancelJob();
+        lane->Detach();
+    }
+
+    mDelegate = nullptr;
+    mEndTime  = System::SystemClock().GetMonotonicTimestamp();
+}
+
+System::Clock::Milliseconds64 CommissioningPipeline::GetElapsedTime() const
+{
+    System::Clock::Timestamp end = (mEndTime != System::Clock::kZero) ? mEndTime : System::SystemClock().GetMonotonicTimestamp();
+    return std::chrono::duration_cast<System::Clock::Milliseconds64>(end - mStartTime);
+}
+
+void CommissioningPipeline::LogMetrics() const
+{
+    uint64_t elapsedMs = GetElapsedTime().count();
+    size_t devices     = mSucceeded + mFailed;
+
+    ChipLogProgress(Controller, "Commissioned %u devices (%u failed) in %" PRIu64 " ms, %" PRIu64 " devices/min",
+                    static_cast<unsigned>(devices), static_cast<unsigned>(mFailed), elapsedMs,
+                    elapsedMs > 0 ? static_cast<uint64_t>(mSucceeded) * 60000 / elapsedMs : 0);
+
+    for (size_t stage = 0; stage < kStageCount; stage++)
+    {
+        const StageMetrics & metrics = mStageMetrics[stage];
+        if (metrics.completed == 0 && metrics.failed == 0)
+        {
+            continue;
+        }
+
+        uint64_t averageMs = metrics.totalTime.count() / (metrics.completed + metrics.failed);
+        ChipLogProgress(Controller, "  %-40s completed %u failed %u avg %" PRIu64 " ms max %" PRIu64 " ms",
+                        StageToString(static_cast<CommissioningStage>(stage)), static_cast<unsigned>(metrics.completed),
+                        static_cast<unsigned>(metrics.failed), averageMs, metrics.maxTime.count());
+    }
+}
+
+CHIP_ERROR CommissioningPipeline::PairDevice(DeviceCommissioner & commissioner, const Job & job)
+{
+    return commissioner.PairDevice(job.nodeId, job.setUpCode.c_str(), mParams, mDiscoveryType);
+}
+
+CHIP_ERROR CommissioningPipeline::StopPairing(DeviceCommissioner & commissioner, NodeId nodeId)
+{
+    return commissioner.StopPairing(nodeId);
+}
+
+void CommissioningPipeline::OnJobComplete(const Job & job, CHIP_ERROR error)
+{
+    if (error == CHIP_NO_ERROR)
+    {
+        mSucceeded++;
+    }
+    else
+    {
+        ChipLogError(Controller, "Commissioning of node 0x" ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(job.nodeId), error.Format());
+        mFailed++;
+    }
+
+    mDelegate->OnDeviceCommissioned(job.nodeId, error);
+}
+
+void CommissioningPipeline::MaybeFinishBatch()
+{
+    VerifyOrReturn(IsRunning() && mPendingJobs.empty());
+    for (auto & lane : mLanes)
+    {
+        VerifyOrReturn(!lane->IsBusy());
+    }
+
+    for (auto & lane : mLanes)
+    {
+        lane->Detach();
+    }
+
+    Delegate * delegate = mDelegate;
+    mDelegate           = nullptr;
+    mEndTime            = System::SystemClock().GetMonotonicTimestamp();
+    delegate->OnBatchComplete(mSucceeded, mFailed);
+}
+
+void CommissioningPipeline::Lane::Attach()
+{
+    mPreviousDelegate = mCommissioner->GetPairingDelegate();
+    mCommissioner->RegisterPairingDelegate(this);
+}
+
+void CommissioningPipeline::Lane::Detach()
+{
+    DeviceLayer::SystemLayer().CancelTimer(StartNextJob, this);
+    if (mCommissioner->GetPairingDelegate() == this)
+    {
+        mCommissioner->RegisterPairingDelegate(mPreviousDelegate);
+    }
+    mPreviousDelegate = nullptr;
+}
+
+void CommissioningPipeline::Lane::ScheduleNextJob()
+{
+    // The commissioner is still unwinding when it reports the completion of the previous device, start the next one
+    // from a fresh stack.
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(System::Clock::kZero, StartNextJob, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule the next commissioning: %" CHIP_ERROR_FORMAT, err.Format());
+        StartNextJob(&DeviceLayer::SystemLayer(), this);
+    }
+}
+
+void CommissioningPipeline::Lane::StartNextJob(System::Layer * systemLayer, void * appState)
+{
+    auto * lane                      = static_cast<Lane *>(appState);
+    CommissioningPipeline & pipeline = lane->mPipeline;
+
+    while (pipeline.IsRunning() && !pipeline.mPendingJobs.empty())
+    {
+        lane->mJob.emplace(std::move(pipeline.mPendingJobs.front()));
+        pipeline.mPendingJobs.pop_front();
+        lane->mStageStart = System::SystemClock().GetMonotonicTimestamp();
+
+        CHIP_ERROR err = pipeline.PairDevice(*lane->mCommissioner, *lane->mJob);
+        if (err == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        Job job = std::move(*lane->mJob);
+        lane->mJob.reset();
+        pipeline.OnJobComplete(job, err);
+    }
+
+    pipeline.MaybeFinishBatch();
+}
+
+void CommissioningPipeline::Lane::CancelJob()
+{
+    VerifyOrReturn(mJob.has_value());
+
+    NodeId nodeId = mJob->nodeId;
+    mJob.reset();
+    LogErrorOnFailure(mPipeline.StopPairing(*mCommissioner, nodeId));
+}
+
+void CommissioningPipeline::Lane::RecordStage(CommissioningStage stage, CHIP_ERROR error)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    auto duration                = std::chrono::duration_cast<System::Clock::Milliseconds64>(now - mStageStart);
+    mStageStart                  = now;
+
+    VerifyOrReturn(static_cast<size_t>(stage) < kStageCount);
+    StageMetrics & metrics = mPipeline.mStageMetrics[stage];
+    if (error == CHIP_NO_ERROR)
+    {
+        metrics.completed++;
+    }
+    else
+    {
+        metrics.failed++;
+    }
+    metrics.totalTime += duration;
+    metrics.maxTime = std::max(metrics.maxTime, duration);
+}
+
+void CommissioningPipeline::Lane::FinishJob(CHIP_ERROR error)
+{
+    VerifyOrReturn(mJob.has_value());
+
+    Job job = std::move(*mJob);
+    mJob.reset();
+    mPipeline.OnJobComplete(job, error);
+    if (mPipeline.IsRunning())
+    {
+        ScheduleNextJob();
+    }
+}
+
+void CommissioningPipeline::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(mJob.has_value());
+
+    RecordStage(CommissioningStage::kSecurePairing, error);
+    if (error != CHIP_NO_ERROR)
+    {
+        // No commissioning is started when PASE could not be established.
+        FinishJob(error);
+    }
+}
+
+void CommissioningPipeline::Lane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    VerifyOrReturn(mJob.has_value() && mJob->nodeId == peerId.GetNodeId());
+    RecordStage(stageCompleted, error);
+}
+
+void CommissioningPipeline::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mJob.has_value() && mJob->nodeId == deviceId);
+    FinishJob(error);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <system/SystemClock.h>
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Commissions a batch of devices by running several commissioning state machines in parallel.
+ *
+ * A DeviceCommissioner drives a single commissionee at a time, so the pipeline spreads the batch over a
+ * set of commissioners (lanes), each taking the next device from the queue once it is done with the
+ * previous one. The PASE, attestation, NOC issuance and network setup stages of different devices thus
+ * overlap, while the stages of each device still run in order.
+ *
+ * The lanes must be commissioners on the same fabric with distinct node IDs (see
+ * SetupParams::permitMultiControllerFabrics). The pipeline registers itself as their pairing delegate
+ * while it runs, and restores the previous delegates once the batch is complete.
+ *
+ * All methods must be called with the Matter stack lock held.
+ */
+class CommissioningPipeline
+{
+public:
+    struct Job
+    {
+        NodeId nodeId;
+        std::string setUpCode;
+    };
+
+    struct StageMetrics
+    {
+        uint32_t completed = 0;
+        uint32_t failed    = 0;
+        System::Clock::Milliseconds64 totalTime{ 0 };
+        System::Clock::Milliseconds64 maxTime{ 0 };
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        virtual void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) {}
+
+        /**
+         * Called once every device of the batch was either commissioned or failed.
+         */
+        virtual void OnBatchComplete(size_t succeeded, size_t failed) = 0;
+    };
+
+    CommissioningPipeline() = default;
+    virtual ~CommissioningPipeline();
+
+    CommissioningPipeline(const CommissioningPipeline &)             = delete;
+    CommissioningPipeline & operator=(const CommissioningPipeline &) = delete;
+
+    /**
+     * Add a commissioner to run commissioning state machines on. Must not be called while a batch is running.
+     */
+    CHIP_ERROR AddLane(DeviceCommissioner * commissioner);
+
+    /**
+     * Start commissioning the devices of the batch, using the given parameters for all of them.
+     *
+     * The parameters must stay valid until Delegate::OnBatchComplete is called.
+     */
+    CHIP_ERROR Start(std::vector<Job> jobs, const CommissioningParameters & params, DiscoveryType discoveryType,
+                     Delegate * delegate);
+
+    /**
+     * Stop the devices that are being commissioned, and drop the ones still queued. No delegate callback is
+     * called after this returns.
+     */
+    void Stop();
+
+    bool IsRunning() const { return mDelegate != nullptr; }
+    size_t GetLaneCount() const { return mLanes.size(); }
+
+    /**
+     * Metrics of a commissioning stage across all devices of the batch. The time spent in kSecurePairing
+     * includes the discovery of the device.
+     */
+    const StageMetrics & GetStageMetrics(CommissioningStage stage) const { return mStageMetrics[stage]; }
+
+    /**
+     * Time since the batch was started, or the time the batch took once it is complete.
+     */
+    System::Clock::Milliseconds64 GetElapsedTime() const;
+
+    void LogMetrics() const;
+
+protected:
+    /**
+     * Start commissioning a device on the given lane, or stop it. These call DeviceCommissioner::PairDevice and
+     * DeviceCommissioner::StopPairing, and are only overridden by the tests.
+     */
+    virtual CHIP_ERROR PairDevice(DeviceCommissioner & commissioner, const Job & job);
+    virtual CHIP_ERROR StopPairing(DeviceCommissioner & commissioner, NodeId nodeId);
+
+private:
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        Lane(CommissioningPipeline & pipeline, DeviceCommissioner * commissioner) :
+            mPipeline(pipeline), mCommissioner(commissioner)
+        {}
+
+        DeviceCommissioner * GetCommissioner() const { return mCommissioner; }
+        bool IsBusy() const { return mJob.has_value(); }
+
+        void Attach();
+        void Detach();
+        void ScheduleNextJob();
+        void CancelJob();
+
+        // DevicePairingDelegate
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+    private:
+        static void StartNextJob(System::Layer * systemLayer, void * appState);
+        void RecordStage(CommissioningStage stage, CHIP_ERROR error);
+        void FinishJob(CHIP_ERROR error);
+
+        CommissioningPipeline & mPipeline;
+        DeviceCommissioner * mCommissioner;
+        DevicePairingDelegate * mPreviousDelegate = nullptr;
+        std::optional<Job> mJob;
+        System::Clock::Timestamp mStageStart;
+    };
+
+    static constexpr size_t kStageCount = CommissioningStage::kCleanup + 1;
+
+    void OnJobComplete(const Job & job, CHIP_ERROR error);
+    void MaybeFinishBatch();
+
+    std::vector<std::unique_ptr<Lane>> mLanes;
+    std::deque<Job> mPendingJobs;
+    CommissioningParameters mParams;
+    DiscoveryType mDiscoveryType = DiscoveryType::kAll;
+    Delegate * mDelegate         = nullptr;
+
+    StageMetrics mStageMetrics[kStageCount];
+    size_t mSucceeded = 0;
+    size_t mFailed    = 0;
+    System::Clock::Timestamp mStartTime;
+    System::Clock::Timestamp mEndTime;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -266,7 +266,7 @@ CHIP_ERROR ConvertReportTlvToJson(const uint32_t id, TLV::TLVReader & data, std:
     readerForJson.Init(buffer.get(), size);
     ReturnErrorOnFailure(readerForJson.Next());
     // Convert TLV to JSON
-    return TlvToJson(readerForJson, json);
+    return StreamingTlvToJson(readerForJson, json);
 }
 
 void ReportCallback::OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
@@ -850,7 +850,7 @@ void InvokeCallback::OnResponse(app::CommandSender * apCommandSender, const app:
         err = readerForJson.Next();
         VerifyOrReturn(err == CHIP_NO_ERROR,
                        ChipLogError(Controller, "Failed readerForJson next: %" CHIP_ERROR_FORMAT, err.Format()));
-        err = TlvToJson(readerForJson, json);
+        err = StreamingTlvToJson(readerForJson, json);
         VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Failed TlvToJson: %" CHIP_ERROR_FORMAT, err.Format()));
         UtfString jsonString(env, json.c_str());
 
@@ -1101,7 +1101,7 @@ void ExtendableInvokeCallback::OnResponse(app::CommandSender * apCommandSender,
         err = readerForJson.Next();
         VerifyOrReturn(err == CHIP_NO_ERROR,
                        ChipLogError(Controller, "Failed readerForJson next: %" CHIP_ERROR_FORMAT, err.Format()));
-        err = TlvToJson(readerForJson, json);
+        err = StreamingTlvToJson(readerForJson, json);
         VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Failed TlvToJson: %" CHIP_ERROR_FORMAT, err.Format()));
         UtfString jsonString(env, json.c_str());
 
@@ -269,7 +269,7 @@ CHIP_ERROR ConvertJsonToTlvWithoutStruct(const std::string & json, MutableByteSp
     Platform::ScopedMemoryBufferWithSize<uint8_t> buf;
     VerifyOrReturnError(buf.Calloc(data.size()), CHIP_ERROR_NO_MEMORY);
     MutableByteSpan dataWithStruct(buf.Get(), buf.AllocatedSize());
-    ReturnErrorOnFailure(JsonToTlv(json, dataWithStruct));
+    ReturnErrorOnFailure(StreamingJsonToTlv(CharSpan(json.data(), json.size()), dataWithStruct));
     TLV::TLVReader tlvReader;
     TLV::TLVType outerContainer = TLV::kTLVType_Structure;
     tlvReader.Init(dataWithStruct);
@@ -586,8 +586,7 @@ CHIP_ERROR extendableInvoke(JNIEnv * env, jlong handle, jlong callbackHandle, jl
                 // The invoke does not support chunk, kMaxSecureSduLengthBytes should be enough for command json blob
                 uint8_t tlvBytes[chip::app::kMaxSecureSduLengthBytes] = { 0 };
                 MutableByteSpan tlvEncodingLocal{ tlvBytes };
-                SuccessOrExit(err = JsonToTlv(std::string(jsonUtfJniString.c_str(), static_cast<size_t>(jsonUtfJniString.size())),
-                                              tlvEncodingLocal));
+                SuccessOrExit(err = StreamingJsonToTlv(jsonUtfJniString.charSpan(), tlvEncodingLocal));
                 SuccessOrExit(err = PutPreencodedInvokeRequest(*commandSender, path, tlvEncodingLocal, prepareCommandParams));
             }
         }
@@ -768,8 +767,7 @@ CHIP_ERROR invoke(JNIEnv * env, jlong handle, jlong callbackHandle, jlong device
             // The invoke does not support chunk, kMaxSecureSduLengthBytes should be enough for command json blob
             uint8_t tlvBytes[chip::app::kMaxSecureSduLengthBytes] = { 0 };
             MutableByteSpan tlvEncodingLocal{ tlvBytes };
-            SuccessOrExit(err = JsonToTlv(std::string(jsonUtfJniString.c_str(), static_cast<size_t>(jsonUtfJniString.size())),
-                                          tlvEncodingLocal));
+            SuccessOrExit(err = StreamingJsonToTlv(jsonUtfJniString.charSpan(), tlvEncodingLocal));
             SuccessOrExit(err = PutPreencodedInvokeRequest(*commandSender, path, tlvEncodingLocal));
         }
     }
@@ -22,6 +22,7 @@ import builtins
 import ctypes
 import inspect
 import logging
+import pickle
 import sys
 from asyncio.futures import Future
 from ctypes import CFUNCTYPE, POINTER, c_bool, c_size_t, c_uint8, c_uint16, c_uint32, c_uint64, c_void_p, cast, py_object
@@ -35,13 +36,16 @@ from rich.pretty import pprint  # type: ignore
 from ..interaction_model import (AttributePathIBstruct, DataVersionFilterIBstruct, EventPathIBstruct, InteractionModelError,
                                  PyWriteAttributeData)
 from ..interaction_model import Status as InteractionModelStatus
-from ..native import ErrorSDKPart, GetLibraryHandle, NativeLibraryHandleMethodArguments, PyChipError
+from ..native import DecodeTLV, ErrorSDKPart, GetLibraryHandle, NativeLibraryHandleMethodArguments, PyChipError
 from ..tlv import TLVReader
 from . import Objects as GeneratedObjects  # noqa: F401
 from .ClusterObjects import Cluster, ClusterAttributeDescriptor, ClusterEvent
 
 LOGGER = logging.getLogger(__name__)
 
+# Whether reports are decoded by the native library rather than by chip.tlv.TLVReader, see SetNativeDecodeEnabled().
+_nativeDecodeEnabled = True
+
 
 @unique
 class EventTimestampType(Enum):
@@ -681,22 +685,35 @@ class AsyncReadTransaction:
         """Returns subscription transaction."""
         return self._subscription_handler
 
-    def handleAttributeData(self, path: AttributePath, dataVersion: int, status: int, data: bytes):
+    def handleAttributeData(self, report: bytes):
+        ''' Handles the attributes of a report, pickled by the native ReadClientCallback into a list of
+            (endpoint, cluster, attribute, dataVersion, status, value, decoded) tuples. The values that
+            the native code did not decode are raw TLV.
+        '''
         try:
-            imStatus = InteractionModelStatus(status)
+            entries = pickle.loads(report)
+        except Exception as ex:
+            LOGGER.exception(ex)
+            return
 
-            if (imStatus != InteractionModelStatus.Success):
-                attributeValue = ValueDecodeFailure(
-                    None, InteractionModelError(imStatus))
-            else:
-                tlvData = TLVReader(data).get().get("Any", {})
-                attributeValue = tlvData
+        for endpoint, cluster, attribute, dataVersion, status, value, decoded in entries:
+            try:
+                path = AttributePath(EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute)
+                imStatus = InteractionModelStatus(status)
+
+                if (imStatus != InteractionModelStatus.Success):
+                    attributeValue = ValueDecodeFailure(
+                        None, InteractionModelError(imStatus))
+                elif decoded:
+                    attributeValue = value
+                else:
+                    attributeValue = TLVReader(value).get().get("Any", {})
 
-            self._cache.UpdateTLV(path, dataVersion, attributeValue)
-            self._changedPathSet.add(path)
+                self._cache.UpdateTLV(path, dataVersion, attributeValue)
+                self._changedPathSet.add(path)
 
-        except Exception as ex:
-            LOGGER.exception(ex)
+            except Exception as ex:
+                LOGGER.exception(ex)
 
     def handleEventData(self, header: EventHeader, path: EventPath, data: bytes, status: int):
         try:
@@ -705,14 +722,17 @@ class AsyncReadTransaction:
 
             if data:
                 # data will be an empty buffer when we received an EventStatusIB instead of an EventDataIB.
-                tlvData = TLVReader(data).get().get("Any", {})
+                if _nativeDecodeEnabled:
+                    tlvData = DecodeTLV(data)
+                else:
+                    tlvData = TLVReader(data).get().get("Any", {})
 
                 if eventType is None:
                     eventValue = ValueDecodeFailure(
                         tlvData, LookupError("event schema not found"))
                 else:
                     try:
-                        eventValue = eventType.FromTLV(data)
+                        eventValue = eventType.FromTagDict(tlvData)
                     except Exception as ex:
                         LOGGER.error(
                             f"Error convering TLV to Cluster Object for path: Endpoint = {path.EndpointId}/"
@@ -877,7 +897,7 @@ class AsyncWriteTransaction:
 
 
 _OnReadAttributeDataCallbackFunct = CFUNCTYPE(
-    None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+    None, py_object, c_void_p, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(
     None, py_object, PyChipError, c_uint32)
@@ -894,10 +914,8 @@ _OnReportEndCallbackFunct = CFUNCTYPE(
 
 
 @_OnReadAttributeDataCallbackFunct
-def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, cluster: int, attribute: int, status, data, len):
-    dataBytes = ctypes.string_at(data, len)
-    closure.handleAttributeData(AttributePath(
-        EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
+def _OnReadAttributeDataCallback(closure, data, len):
+    closure.handleAttributeData(ctypes.string_at(data, len))
 
 
 @_OnReadEventDataCallbackFunct
@@ -1175,6 +1193,18 @@ def Read(transaction: AsyncReadTransaction, device,
     return res
 
 
+def SetNativeDecodeEnabled(enabled: bool):
+    ''' Selects whether attribute and event data are decoded by the native library, which is the default, or by
+        chip.tlv.TLVReader. Both produce the same values; the latter is kept for comparison and troubleshooting.
+    '''
+    global _nativeDecodeEnabled
+    _nativeDecodeEnabled = enabled
+
+    handle = GetLibraryHandle()
+    builtins.chipStack.Call(
+        lambda: handle.pychip_ReadClient_SetNativeDecodeEnabled(enabled))
+
+
 def Init():
     handle = GetLibraryHandle()
 
@@ -1207,6 +1237,7 @@ def Init():
                    _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct,
                    _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
                    _OnReportBeginCallbackFunct, _OnReportEndCallbackFunct])
+        setter.Set('pychip_ReadClient_SetNativeDecodeEnabled', None, [c_bool])
 
     handle.pychip_WriteClient_InitCallbacks(
         _OnWriteResponseCallback, _OnWriteErrorCallback, _OnWriteDoneCallback)
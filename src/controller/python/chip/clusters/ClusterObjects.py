@@ -203,6 +203,10 @@ class ClusterObject:
     def FromTLV(cls, data: bytes):
         return cls.FromDict(data=cls.descriptor.TLVToDict(data))
 
+    @classmethod
+    def FromTagDict(cls, data: dict):
+        return cls.FromDict(data=cls.descriptor.TagDictToLabelDict('', data))
+
     @ChipUtility.classproperty
     def descriptor(cls):
         raise NotImplementedError()
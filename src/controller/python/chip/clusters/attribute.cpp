@@ -29,6 +29,7 @@
 #include <controller/CHIPDeviceController.h>
 #include <controller/python/chip/interaction_model/Delegate.h>
 #include <controller/python/chip/native/PyChipError.h>
+#include <controller/python/chip/tlv/TLVPickleWriter.h>
 #include <lib/core/Optional.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -66,10 +67,7 @@ struct __attribute__((packed)) DataVersionFilter
     chip::DataVersion dataVersion;
 };
 
-using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::DataVersion version, chip::EndpointId endpointId,
-                                             chip::ClusterId clusterId, chip::AttributeId attributeId,
-                                             std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
-                                             size_t dataLen);
+using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, const uint8_t * data, size_t dataLen);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, size_t dataLen,
@@ -91,6 +89,9 @@ OnReadDoneCallback gOnReadDoneCallback                               = nullptr;
 OnReportBeginCallback gOnReportBeginCallback                         = nullptr;
 OnReportBeginCallback gOnReportEndCallback                           = nullptr;
 
+// Whether attribute values are decoded natively, rather than handed to chip.tlv.TLVReader as raw TLV.
+bool gNativeDecodeEnabled = true;
+
 void PythonResubscribePolicy(uint32_t aNumCumulativeRetries, uint32_t & aNextSubscriptionIntervalMsec, bool & aShouldResubscribe)
 {
     aShouldResubscribe = true;
@@ -103,6 +104,9 @@ public:
 
     app::BufferedReadCallback * GetBufferedReadCallback() { return &mBufferedReadCallback; }
 
+    // The attributes of a report are gathered into a single pickled list, handed to Python when the report ends, so that
+    // Python builds all the values in one pickle.loads() call. Each entry is a tuple (endpoint, cluster, attribute,
+    // data version, status, value, decoded), where value is the raw TLV when decoded is False.
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
     {
         //
@@ -140,8 +144,37 @@ public:
             version = aPath.mDataVersion.Value();
         }
 
-        gOnReadAttributeDataCallback(mAppContext, version, aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId,
-                                     to_underlying(aStatus.mStatus), buffer.get(), size);
+        if (mPendingAttributeCount == 0)
+        {
+            mAttributeReport.Reset();
+            mAttributeReport.StartList();
+        }
+        mPendingAttributeCount++;
+
+        mAttributeReport.StartTuple();
+        mAttributeReport.PutUnsignedInt(aPath.mEndpointId);
+        mAttributeReport.PutUnsignedInt(aPath.mClusterId);
+        mAttributeReport.PutUnsignedInt(aPath.mAttributeId);
+        mAttributeReport.PutUnsignedInt(version);
+        mAttributeReport.PutUnsignedInt(to_underlying(aStatus.mStatus));
+        if (buffer)
+        {
+            TLV::TLVReader reader;
+            reader.Init(buffer.get(), size);
+            bool decoded =
+                gNativeDecodeEnabled && reader.Next() == CHIP_NO_ERROR && mAttributeReport.PutElement(reader) == CHIP_NO_ERROR;
+            if (!decoded)
+            {
+                mAttributeReport.PutBytes(ByteSpan(buffer.get(), size));
+            }
+            mAttributeReport.PutBool(decoded);
+        }
+        else
+        {
+            mAttributeReport.PutNone();
+            mAttributeReport.PutBool(true);
+        }
+        mAttributeReport.EndTuple();
     }
 
     void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
@@ -153,6 +186,7 @@ public:
 
     CHIP_ERROR OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override
     {
+        FlushAttributeReport();
         if (mAutoResubscribeNeeded)
         {
             ReturnErrorOnFailure(ReadClient::Callback::OnResubscriptionNeeded(apReadClient, aTerminationCause));
@@ -205,7 +239,11 @@ public:
             to_underlying(apStatus == nullptr ? Protocols::InteractionModel::Status::Success : apStatus->mStatus));
     }
 
-    void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, ToPyChipError(aError)); }
+    void OnError(CHIP_ERROR aError) override
+    {
+        FlushAttributeReport();
+        gOnReadErrorCallback(mAppContext, ToPyChipError(aError));
+    }
 
     void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
@@ -226,10 +264,15 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        FlushAttributeReport();
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
+        FlushAttributeReport();
         gOnReadDoneCallback(mAppContext);
 
         delete this;
@@ -240,10 +283,24 @@ public:
     void SetAutoResubscribe(bool autoResubscribe) { mAutoResubscribe = autoResubscribe; }
 
 private:
+    // Hands the attributes gathered since the last flush to Python.
+    void FlushAttributeReport()
+    {
+        VerifyOrReturn(mPendingAttributeCount != 0);
+
+        mAttributeReport.EndList();
+        mAttributeReport.Finish();
+        mPendingAttributeCount = 0;
+        gOnReadAttributeDataCallback(mAppContext, mAttributeReport.Data(), mAttributeReport.Size());
+    }
+
     BufferedReadCallback mBufferedReadCallback;
 
     PyObject * mAppContext;
 
+    TLVPickleWriter mAttributeReport;
+    size_t mPendingAttributeCount = 0;
+
     std::unique_ptr<ReadClient> mReadClient;
     bool mAutoResubscribe       = true;
     bool mAutoResubscribeNeeded = false;
@@ -342,6 +399,11 @@ void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttribute
     gOnReportEndCallback               = onReportEndCallback;
 }
 
+void pychip_ReadClient_SetNativeDecodeEnabled(bool enabled)
+{
+    gNativeDecodeEnabled = enabled;
+}
+
 PyChipError pychip_WriteClient_WriteAttributes(void * appContext, DeviceProxy * device, size_t timedWriteTimeoutMsSizeT,
                                                size_t interactionTimeoutMsSizeT, size_t busyWaitMsSizeT,
                                                python::PyWriteAttributeData * writeAttributesData, size_t attributeDataLength,
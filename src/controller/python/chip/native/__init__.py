@@ -19,6 +19,7 @@ import enum
 import functools
 import glob
 import os
+import pickle
 import platform
 import typing
 from dataclasses import dataclass
@@ -26,6 +27,7 @@ from dataclasses import dataclass
 import construct  # type: ignore
 
 from ..exceptions import ChipStackError
+from ..tlv import TLVReader
 
 
 class Library(enum.Enum):
@@ -244,6 +246,8 @@ def _GetLibraryHandle(lib: Library, expectAlreadyInitialized: bool) -> _Handle:
             setter.Set("pychip_CommonStackInit", PyChipError, [ctypes.c_char_p])
             setter.Set("pychip_FormatError", None,
                        [ctypes.POINTER(PyChipError), ctypes.c_char_p, ctypes.c_uint32])
+            setter.Set("pychip_TLV_ToPickle", PyChipError,
+                       [ctypes.c_char_p, ctypes.c_size_t, ctypes.c_char_p, ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)])
         elif lib == Library.SERVER:
             setter.Set("pychip_server_native_init", PyChipError, [])
             setter.Set("pychip_server_set_callbacks", None, [c_PostAttributeChangeCallback])
@@ -275,3 +279,24 @@ class HandleFlags(enum.Flag):
 def GetLibraryHandle(flags=HandleFlags.REQUIRE_INITIALIZATION) -> ctypes.CDLL:
     handle = _GetLibraryHandle(Library.CONTROLLER, HandleFlags.REQUIRE_INITIALIZATION in flags)
     return handle.dll
+
+
+def DecodeTLV(data: bytes) -> typing.Any:
+    """Decodes the TLV element in data, which has an anonymous tag, into the same value as
+    TLVReader(data).get().get("Any", {}).
+
+    The native library walks the TLV and hands back a pickle stream, which is much faster than decoding it in
+    Python. The elements it does not handle are decoded by TLVReader.
+    """
+    if data:
+        dll = _GetLibraryHandle(Library.CONTROLLER, False).dll
+        outputLength = ctypes.c_size_t(0)
+        output = ctypes.create_string_buffer(4 * len(data) + 64)
+        res = dll.pychip_TLV_ToPickle(data, len(data), output, len(output), ctypes.byref(outputLength))
+        if not res.is_success and outputLength.value > len(output):
+            output = ctypes.create_string_buffer(outputLength.value)
+            res = dll.pychip_TLV_ToPickle(data, len(data), output, len(output), ctypes.byref(outputLength))
+        if res.is_success:
+            return pickle.loads(memoryview(output)[:outputLength.value])
+
+    return TLVReader(data).get().get("Any", {})
@@ -0,0 +1,382 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "TLVPickleWriter.h"
+
+#include <controller/python/chip/native/PyChipError.h>
+#include <lib/core/CHIPSafeCasts.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/utf8.h>
+
+#include <cstring>
+
+namespace chip {
+namespace python {
+namespace {
+
+// Pickle opcodes, see Lib/pickletools.py in the CPython sources. All of them are available from protocol 4.
+constexpr uint8_t kOpProto           = 0x80;
+constexpr uint8_t kOpStop            = '.';
+constexpr uint8_t kOpMark            = '(';
+constexpr uint8_t kOpNone            = 'N';
+constexpr uint8_t kOpNewTrue         = 0x88;
+constexpr uint8_t kOpNewFalse        = 0x89;
+constexpr uint8_t kOpBinInt          = 'J';
+constexpr uint8_t kOpBinInt1         = 'K';
+constexpr uint8_t kOpBinInt2         = 'M';
+constexpr uint8_t kOpLong1           = 0x8a;
+constexpr uint8_t kOpBinFloat        = 'G';
+constexpr uint8_t kOpShortBinUnicode = 0x8c;
+constexpr uint8_t kOpBinUnicode      = 'X';
+constexpr uint8_t kOpShortBinBytes   = 'C';
+constexpr uint8_t kOpBinBytes        = 'B';
+constexpr uint8_t kOpEmptyDict       = '}';
+constexpr uint8_t kOpSetItems        = 'u';
+constexpr uint8_t kOpEmptyList       = ']';
+constexpr uint8_t kOpAppends         = 'e';
+constexpr uint8_t kOpTuple           = 't';
+constexpr uint8_t kOpTuple1          = 0x85;
+constexpr uint8_t kOpGlobal          = 'c';
+constexpr uint8_t kOpBinPut          = 'q';
+constexpr uint8_t kOpBinGet          = 'h';
+constexpr uint8_t kOpReduce          = 'R';
+
+constexpr uint8_t kProtocolVersion = 4;
+
+constexpr char kUintGlobal[]    = "chip.tlv\nuint\n";
+constexpr char kFloat32Global[] = "chip.tlv\nfloat32\n";
+
+} // namespace
+
+void TLVPickleWriter::Reset()
+{
+    mBuffer.clear();
+    mMemoized = 0;
+    PutOpcode(kOpProto);
+    PutOpcode(kProtocolVersion);
+}
+
+CHIP_ERROR TLVPickleWriter::PutElement(TLV::TLVReader & reader)
+{
+    const size_t size      = mBuffer.size();
+    const uint8_t memoized = mMemoized;
+
+    CHIP_ERROR err = PutElementAtDepth(reader, 0);
+    if (err != CHIP_NO_ERROR)
+    {
+        mBuffer.resize(size);
+        mMemoized = memoized;
+    }
+    return err;
+}
+
+CHIP_ERROR TLVPickleWriter::PutElementAtDepth(TLV::TLVReader & reader, uint8_t depth)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_SignedInteger: {
+        int64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutInt(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutTlvUint(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Boolean: {
+        bool value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutBool(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_FloatingPointNumber: {
+        // Only single precision elements can be read as a float.
+        float singleValue;
+        if (reader.Get(singleValue) == CHIP_NO_ERROR)
+        {
+            PutTlvFloat32(singleValue);
+            return CHIP_NO_ERROR;
+        }
+        double value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutDouble(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_UTF8String:
+        return PutString(reader, /* utf8 = */ true);
+    case TLV::kTLVType_ByteString:
+        return PutString(reader, /* utf8 = */ false);
+    case TLV::kTLVType_Null:
+        PutNone();
+        return CHIP_NO_ERROR;
+    case TLV::kTLVType_Structure:
+    case TLV::kTLVType_Array: {
+        VerifyOrReturnError(depth < kMaxDepth, CHIP_ERROR_RECURSION_DEPTH_LIMIT);
+        TLV::TLVType outerType;
+        const TLV::TLVType type = reader.GetType();
+        ReturnErrorOnFailure(reader.EnterContainer(outerType));
+        ReturnErrorOnFailure(PutContainerContent(reader, type, depth));
+        return reader.ExitContainer(outerType);
+    }
+    default:
+        // Lists (the "Path" type of chip.tlv) are decoded into TLVList objects, which are left to the Python decoder.
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+}
+
+CHIP_ERROR TLVPickleWriter::PutContainerContent(TLV::TLVReader & reader, TLV::TLVType type, uint8_t depth)
+{
+    const bool isStructure = (type == TLV::kTLVType_Structure);
+
+    PutOpcode(isStructure ? kOpEmptyDict : kOpEmptyList);
+    PutOpcode(kOpMark);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        const TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(!TLV::IsProfileTag(tag), CHIP_ERROR_NOT_IMPLEMENTED);
+
+        // TLV::TLVReader only accepts context tags in structures and anonymous tags in arrays.
+        if (isStructure)
+        {
+            PutUnsignedInt(TLV::TagNumFromTag(tag));
+        }
+        ReturnErrorOnFailure(PutElementAtDepth(reader, static_cast<uint8_t>(depth + 1)));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    PutOpcode(isStructure ? kOpSetItems : kOpAppends);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVPickleWriter::PutString(TLV::TLVReader & reader, bool utf8)
+{
+    const uint8_t * data;
+    ReturnErrorOnFailure(reader.GetDataPtr(data));
+    ByteSpan value(data, reader.GetLength());
+
+    // chip.tlv.TLVReader hands back the raw bytes of strings that do not decode.
+    CharSpan text(Uint8::to_const_char(value.data()), value.size());
+    if (utf8 && Utf8::IsValid(text))
+    {
+        PutUnicode(text);
+    }
+    else
+    {
+        PutBytes(value);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void TLVPickleWriter::PutNone()
+{
+    PutOpcode(kOpNone);
+}
+
+void TLVPickleWriter::PutBool(bool value)
+{
+    PutOpcode(value ? kOpNewTrue : kOpNewFalse);
+}
+
+void TLVPickleWriter::PutInt(int64_t value)
+{
+    if (value >= 0 && value <= UINT8_MAX)
+    {
+        PutOpcode(kOpBinInt1);
+        PutLittleEndian(static_cast<uint64_t>(value), 1);
+    }
+    else if (value >= 0 && value <= UINT16_MAX)
+    {
+        PutOpcode(kOpBinInt2);
+        PutLittleEndian(static_cast<uint64_t>(value), 2);
+    }
+    else if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        PutOpcode(kOpBinInt);
+        PutLittleEndian(static_cast<uint64_t>(value), 4);
+    }
+    else
+    {
+        // LONG1 holds a two's complement little endian integer.
+        PutOpcode(kOpLong1);
+        PutOpcode(sizeof(int64_t));
+        PutLittleEndian(static_cast<uint64_t>(value), sizeof(int64_t));
+    }
+}
+
+void TLVPickleWriter::PutUnsignedInt(uint64_t value)
+{
+    if (value <= INT64_MAX)
+    {
+        PutInt(static_cast<int64_t>(value));
+        return;
+    }
+
+    // An extra zero byte keeps the value positive.
+    PutOpcode(kOpLong1);
+    PutOpcode(sizeof(uint64_t) + 1);
+    PutLittleEndian(value, sizeof(uint64_t));
+    PutOpcode(0);
+}
+
+void TLVPickleWriter::PutTlvUint(uint64_t value)
+{
+    PutType(Memo::kUint);
+    PutUnsignedInt(value);
+    PutOpcode(kOpTuple1);
+    PutOpcode(kOpReduce);
+}
+
+void TLVPickleWriter::PutTlvFloat32(float value)
+{
+    PutType(Memo::kFloat32);
+    PutDouble(static_cast<double>(value));
+    PutOpcode(kOpTuple1);
+    PutOpcode(kOpReduce);
+}
+
+void TLVPickleWriter::PutDouble(double value)
+{
+    // BINFLOAT holds a big endian double.
+    uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(value), "Unexpected double size");
+    memcpy(&bits, &value, sizeof(bits));
+
+    PutOpcode(kOpBinFloat);
+    for (int shift = 56; shift >= 0; shift -= 8)
+    {
+        PutOpcode(static_cast<uint8_t>(bits >> shift));
+    }
+}
+
+void TLVPickleWriter::PutUnicode(CharSpan value)
+{
+    if (value.size() <= UINT8_MAX)
+    {
+        PutOpcode(kOpShortBinUnicode);
+        PutLittleEndian(value.size(), 1);
+    }
+    else
+    {
+        PutOpcode(kOpBinUnicode);
+        PutLittleEndian(value.size(), 4);
+    }
+    PutRaw(Uint8::from_const_char(value.data()), value.size());
+}
+
+void TLVPickleWriter::PutBytes(ByteSpan value)
+{
+    if (value.size() <= UINT8_MAX)
+    {
+        PutOpcode(kOpShortBinBytes);
+        PutLittleEndian(value.size(), 1);
+    }
+    else
+    {
+        PutOpcode(kOpBinBytes);
+        PutLittleEndian(value.size(), 4);
+    }
+    PutRaw(value.data(), value.size());
+}
+
+void TLVPickleWriter::PutType(Memo memo)
+{
+    const uint8_t slot = to_underlying(memo);
+    if (mMemoized & (1u << slot))
+    {
+        PutOpcode(kOpBinGet);
+        PutOpcode(slot);
+        return;
+    }
+
+    const char * global = (memo == Memo::kUint) ? kUintGlobal : kFloat32Global;
+    PutOpcode(kOpGlobal);
+    PutRaw(Uint8::from_const_char(global), strlen(global));
+    PutOpcode(kOpBinPut);
+    PutOpcode(slot);
+    mMemoized = static_cast<uint8_t>(mMemoized | (1u << slot));
+}
+
+void TLVPickleWriter::StartTuple()
+{
+    PutOpcode(kOpMark);
+}
+
+void TLVPickleWriter::EndTuple()
+{
+    PutOpcode(kOpTuple);
+}
+
+void TLVPickleWriter::StartList()
+{
+    PutOpcode(kOpEmptyList);
+    PutOpcode(kOpMark);
+}
+
+void TLVPickleWriter::EndList()
+{
+    PutOpcode(kOpAppends);
+}
+
+void TLVPickleWriter::Finish()
+{
+    PutOpcode(kOpStop);
+}
+
+void TLVPickleWriter::PutLittleEndian(uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        PutOpcode(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+} // namespace python
+} // namespace chip
+
+using namespace chip;
+
+extern "C" {
+
+/**
+ * Converts the TLV element in tlv, which must have an anonymous tag, into a pickle stream written to output.
+ *
+ * Returns CHIP_ERROR_BUFFER_TOO_SMALL with outputLength set to the size needed when the stream does not fit, and
+ * CHIP_ERROR_NOT_IMPLEMENTED when the element must be decoded by chip.tlv.TLVReader instead.
+ */
+PyChipError pychip_TLV_ToPickle(const uint8_t * tlv, size_t tlvLength, uint8_t * output, size_t outputSize,
+                                size_t * outputLength)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv, tlvLength);
+    PyReturnErrorOnFailure(ToPyChipError(reader.Next()));
+
+    python::TLVPickleWriter writer;
+    PyReturnErrorOnFailure(ToPyChipError(writer.PutElement(reader)));
+    writer.Finish();
+
+    *outputLength = writer.Size();
+    VerifyOrReturnError(writer.Size() <= outputSize, ToPyChipError(CHIP_ERROR_BUFFER_TOO_SMALL));
+    memcpy(output, writer.Data(), writer.Size());
+    return ToPyChipError(CHIP_NO_ERROR);
+}
+}
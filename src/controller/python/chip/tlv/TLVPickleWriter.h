@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chip {
+namespace python {
+
+/**
+ * Serializes values into a Python pickle stream, so that the Python side can build all the objects they describe
+ * with a single pickle.loads() call, which runs in native code, instead of walking the TLV in Python.
+ *
+ * TLV elements are turned into the same objects as the ones built by chip.tlv.TLVReader: structures become dicts
+ * keyed by context tag number, arrays become lists, unsigned integers become chip.tlv.uint, single precision floats
+ * become chip.tlv.float32, and UTF-8 strings that are not valid UTF-8 are kept as bytes.
+ *
+ * Profile tags and lists, which the interaction model does not use in data payloads, are not supported: PutElement
+ * fails with CHIP_ERROR_NOT_IMPLEMENTED on them, so that the caller can hand the raw TLV to the Python decoder. It
+ * also fails on the elements TLV::TLVReader rejects, such as anonymous elements of a structure, which
+ * chip.tlv.TLVReader decodes anyway.
+ *
+ * The stream only ever refers to the two chip.tlv types above, so loading it cannot run arbitrary code.
+ */
+class TLVPickleWriter
+{
+public:
+    TLVPickleWriter() { Reset(); }
+
+    /**
+     * Discards the stream and starts a new one.
+     */
+    void Reset();
+
+    /**
+     * Appends the element the reader is positioned on, including the content of containers. The reader may be moved
+     * within the element.
+     *
+     * On failure, the stream is left as it was before the call.
+     */
+    CHIP_ERROR PutElement(TLV::TLVReader & reader);
+
+    void PutNone();
+    void PutBool(bool value);
+    void PutInt(int64_t value);
+    void PutUnsignedInt(uint64_t value);
+    void PutBytes(ByteSpan value);
+
+    /**
+     * Tuples and lists hold the values put between their start and their end. They may be nested.
+     */
+    void StartTuple();
+    void EndTuple();
+    void StartList();
+    void EndList();
+
+    /**
+     * Terminates the stream. The value put last, at the outermost level, is the one returned by pickle.loads().
+     */
+    void Finish();
+
+    const uint8_t * Data() const { return mBuffer.data(); }
+    size_t Size() const { return mBuffer.size(); }
+
+private:
+    // Containers nested deeper than this are left to the Python decoder, so that a peer cannot exhaust the stack.
+    static constexpr uint8_t kMaxDepth = 32;
+
+    // Memo slots holding the chip.tlv types once they have been looked up.
+    enum class Memo : uint8_t
+    {
+        kUint    = 0,
+        kFloat32 = 1,
+    };
+
+    CHIP_ERROR PutElementAtDepth(TLV::TLVReader & reader, uint8_t depth);
+    CHIP_ERROR PutContainerContent(TLV::TLVReader & reader, TLV::TLVType type, uint8_t depth);
+    CHIP_ERROR PutString(TLV::TLVReader & reader, bool utf8);
+    void PutTlvUint(uint64_t value);
+    void PutTlvFloat32(float value);
+    void PutDouble(double value);
+    void PutUnicode(CharSpan value);
+    void PutType(Memo memo);
+
+    void PutOpcode(uint8_t opcode) { mBuffer.push_back(opcode); }
+    void PutLittleEndian(uint64_t value, size_t size);
+    void PutRaw(const uint8_t * data, size_t size) { mBuffer.insert(mBuffer.end(), data, data + size); }
+
+    std::vector<uint8_t> mBuffer;
+    uint8_t mMemoized = 0; // Bit mask of the Memo slots that are set.
+};
+
+} // namespace python
+} // namespace chip
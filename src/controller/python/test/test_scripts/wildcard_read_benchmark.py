@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2025 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+# Wildcard read benchmark: compares the time taken by full wildcard reads of a device, typically the
+# all-clusters-app, when reports are decoded by the native library and by chip.tlv.TLVReader, and checks
+# that both decoders return the same attributes.
+
+import asyncio
+import math
+import os
+import statistics
+import sys
+import time
+from optparse import OptionParser
+
+import chip.clusters.Attribute as Attribute
+from base import BaseTestHelper, FailIfNot, TestFail, TestTimeout, logger
+
+TEST_DISCRIMINATOR = 3840
+TEST_SETUPPIN = 20202021
+
+
+async def RunWildcardReads(test: BaseTestHelper, nodeid: int, iterations: int, nativeDecode: bool):
+    Attribute.SetNativeDecodeEnabled(nativeDecode)
+
+    durations = []
+    for _ in range(iterations):
+        start = time.perf_counter()
+        res = await test.devCtrl.Read(nodeid, [()])
+        durations.append(time.perf_counter() - start)
+
+    attributes = FlattenAttributes(res.tlvAttributes)
+    logger.info(f"{'native' if nativeDecode else 'python'} decode: {len(attributes)} attributes, "
+                f"mean {statistics.mean(durations) * 1000:.1f} ms, median {statistics.median(durations) * 1000:.1f} ms, "
+                f"min {min(durations) * 1000:.1f} ms over {iterations} reads")
+    return statistics.median(durations), attributes
+
+
+def FlattenAttributes(tlvAttributes):
+    return {(endpoint, cluster, attribute): value
+            for endpoint, endpointData in tlvAttributes.items()
+            for cluster, clusterData in endpointData.items()
+            for attribute, value in clusterData.items()}
+
+
+def SameValue(a, b) -> bool:
+    """Compares decoded values, including their types: chip.tlv.uint and int, or chip.tlv.float32 and float, are equal
+    as numbers but are not decoded the same."""
+    if type(a) is not type(b):
+        return False
+    if isinstance(a, dict):
+        return list(a.keys()) == list(b.keys()) and all(SameValue(a[key], b[key]) for key in a)
+    if isinstance(a, list):
+        return len(a) == len(b) and all(SameValue(x, y) for x, y in zip(a, b))
+    if isinstance(a, float) and math.isnan(a):
+        return math.isnan(b)
+    return a == b
+
+
+def CheckDecodersAgree(before, native, after):
+    """Checks that the native decoder returns the same attributes as the reads decoded by TLVReader around it. The
+    attributes that changed between those two reads, such as counters, are only checked for presence."""
+    FailIfNot(native.keys() == before.keys() == after.keys(), "Native and Python decoders returned different attribute paths")
+    stable = [path for path in before if SameValue(before[path], after[path])]
+    mismatches = [path for path in stable if not SameValue(native[path], before[path])]
+    FailIfNot(not mismatches, f"Native and Python decoders returned different values for {mismatches}")
+    logger.info(f"Native and Python decoders agree on {len(stable)} attributes ({len(before) - len(stable)} changed between reads)")
+
+
+async def main():
+    optParser = OptionParser()
+    optParser.add_option(
+        "-t",
+        "--timeout",
+        action="store",
+        dest="testTimeout",
+        default=600,
+        type='int',
+        help="The program will return with timeout after specified seconds.",
+        metavar="<timeout-second>",
+    )
+    optParser.add_option(
+        "-a",
+        "--address",
+        action="store",
+        dest="deviceAddress",
+        default='',
+        type='str',
+        help="Address of the device",
+        metavar="<device-addr>",
+    )
+    optParser.add_option(
+        "--nodeid",
+        action="store",
+        dest="nodeid",
+        default=1,
+        type=int,
+        help="The Node ID issued to the device",
+        metavar="<nodeid>"
+    )
+    optParser.add_option(
+        "--discriminator",
+        action="store",
+        dest="discriminator",
+        default=TEST_DISCRIMINATOR,
+        type=int,
+        help="Discriminator of the device",
+        metavar="<nodeid>"
+    )
+    optParser.add_option(
+        "--setuppin",
+        action="store",
+        dest="setuppin",
+        default=TEST_SETUPPIN,
+        type=int,
+        help="Setup PIN of the device",
+        metavar="<nodeid>"
+    )
+    optParser.add_option(
+        "-p",
+        "--paa-trust-store-path",
+        action="store",
+        dest="paaTrustStorePath",
+        default='',
+        type='str',
+        help="Path that contains valid and trusted PAA Root Certificates.",
+        metavar="<paa-trust-store-path>"
+    )
+    optParser.add_option(
+        "--iterations",
+        action="store",
+        dest="iterations",
+        default=10,
+        type=int,
+        help="Number of wildcard reads for each decoder",
+        metavar="<iterations>"
+    )
+
+    (options, remainingArgs) = optParser.parse_args(sys.argv[1:])
+
+    timeoutTicker = TestTimeout(options.testTimeout)
+    timeoutTicker.start()
+
+    test = BaseTestHelper(
+        nodeid=112233, paaTrustStorePath=options.paaTrustStorePath, testCommissioner=False)
+
+    FailIfNot(
+        await test.TestOnNetworkCommissioning(options.discriminator, options.setuppin, options.nodeid, options.deviceAddress),
+        "Failed on on-network commissioning")
+
+    # A first read warms up the session and the Python caches, so that it does not skew the first figures.
+    await test.devCtrl.Read(options.nodeid, [()])
+
+    python, pythonAttributes = await RunWildcardReads(test, options.nodeid, options.iterations, nativeDecode=False)
+    native, nativeAttributes = await RunWildcardReads(test, options.nodeid, options.iterations, nativeDecode=True)
+    _, laterPythonAttributes = await RunWildcardReads(test, options.nodeid, 1, nativeDecode=False)
+    CheckDecodersAgree(pythonAttributes, nativeAttributes, laterPythonAttributes)
+    logger.info(f"Native decode speedup: {python / native:.2f}x on the median wildcard read")
+
+    timeoutTicker.stop()
+
+    logger.info("Test finished")
+
+    # TODO: Python device controller cannot be shutdown clean sometimes and will block on AsyncDNSResolverSockets shutdown.
+    # Call os._exit(0) to force close it.
+    os._exit(0)
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except Exception as ex:
+        logger.exception(ex)
+        TestFail("Exception occurred when running tests.")
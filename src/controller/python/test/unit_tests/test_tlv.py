@@ -15,9 +15,15 @@
 #    limitations under the License.
 #
 
+import ctypes
+import pickle
+import struct
 import unittest
+from collections import OrderedDict
 
-from chip.tlv import TLVList, TLVReader, TLVWriter
+from chip import native
+from chip.tlv import INT32_MAX, INT32_MIN, INT64_MAX, INT64_MIN, UINT64_MAX, TLVList, TLVReader, TLVWriter
+from chip.tlv import float32 as tlvFloat32
 from chip.tlv import uint as tlvUint
 
 
@@ -216,5 +222,130 @@ class TestTLVTypes(unittest.TestCase):
         self.assertEqual(expectIterateContent, iteratedContent)
 
 
+def _nativeLibraryAvailable():
+    try:
+        native.FindNativeLibraryPath(native.Library.CONTROLLER)
+        return True
+    except Exception:
+        return False
+
+
+@unittest.skipUnless(_nativeLibraryAvailable(), "the native controller library is not built")
+class TestNativeTLVDecoder(unittest.TestCase):
+    '''
+    Checks that chip.native.DecodeTLV(), which decodes through a pickle stream built by the native library, returns the
+    same values as TLVReader. The elements the native library does not handle must be left to TLVReader.
+    '''
+
+    def _encode(self, val):
+        writer = TLVWriter()
+        writer.put(None, val)
+        return bytes(writer.encoding)
+
+    def _toPickle(self, tlv):
+        dll = native.GetLibraryHandle(native.HandleFlags(0))
+        output = ctypes.create_string_buffer(4 * len(tlv) + 64)
+        outputLength = ctypes.c_size_t(0)
+        res = dll.pychip_TLV_ToPickle(tlv, len(tlv), output, len(output), ctypes.byref(outputLength))
+        return res, output.raw[:outputLength.value]
+
+    def _assertSameValue(self, actual, expected):
+        self.assertIs(type(actual), type(expected))
+        if isinstance(expected, dict):
+            self.assertEqual(list(actual.keys()), list(expected.keys()))
+            for key in expected:
+                self._assertSameValue(actual[key], expected[key])
+        elif isinstance(expected, list):
+            self.assertEqual(len(actual), len(expected))
+            for actualItem, expectedItem in zip(actual, expected):
+                self._assertSameValue(actualItem, expectedItem)
+        elif isinstance(expected, float):
+            # Compares the bits, so that NaN and the sign of zero are checked too.
+            self.assertEqual(struct.pack("<d", actual), struct.pack("<d", expected))
+        else:
+            self.assertEqual(actual, expected)
+
+    def _assertDecodedNatively(self, tlv):
+        expected = TLVReader(tlv).get()["Any"]
+        res, stream = self._toPickle(tlv)
+        self.assertTrue(res.is_success)
+        self._assertSameValue(pickle.loads(stream), expected)
+        self._assertSameValue(native.DecodeTLV(tlv), expected)
+
+    def _assertLeftToTLVReader(self, tlv):
+        expected = TLVReader(tlv).get()["Any"]
+        res, _ = self._toPickle(tlv)
+        self.assertFalse(res.is_success)
+        self._assertSameValue(native.DecodeTLV(tlv), expected)
+
+    def test_int(self):
+        for val in [0, 1, -1, 0xff, 0x100, 0xffff, 0x10000, -0x80, -0x81, -0x8000, -0x8001,
+                    INT32_MIN - 1, INT32_MIN, INT32_MAX, INT32_MAX + 1, INT64_MIN, INT64_MAX]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(val))
+
+    def test_uint(self):
+        for val in [0, 0xff, 0x100, 0xffff, 0x10000, 0xffffffff, 0x100000000, INT64_MAX, INT64_MAX + 1, UINT64_MAX]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(tlvUint(val)))
+
+    def test_float(self):
+        for val in [0.0, -0.0, 1.5, 0.1, 1e38, float("inf"), float("-inf"), float("nan")]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(tlvFloat32(val)))
+        for val in [0.0, -0.0, 1.5, 0.1, 1e300, 5e-324, float("inf"), float("nan")]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(val))
+
+    def test_string(self):
+        for val in ["", "Matter", "\u00e9t\u00e9", "\u6f22\u5b57", "\U0001f600", "x" * 255, "x" * 256, "\u00e9" * 300]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(val))
+        for val in [b"", b"\x00\xff", bytes(range(256)) * 2]:
+            with self.subTest(val=val):
+                self._assertDecodedNatively(self._encode(val))
+
+    def test_invalid_utf8_string(self):
+        for val in [b"\xff", b"\x80", b"\xc0\x80", b"\xe0\x80\x80", b"\xed\xa0\x80", b"\xed\xbf\xbf", b"\xe2\x82",
+                    b"\xf4\x90\x80\x80", b"abc\xed\xa0\x80def"]:
+            with self.subTest(val=val):
+                # UTF-8 string, anonymous tag, 1 octet length.
+                self._assertDecodedNatively(bytes([0x0c, len(val)]) + val)
+
+    def test_containers(self):
+        self._assertDecodedNatively(self._encode({}))
+        self._assertDecodedNatively(self._encode([]))
+        self._assertDecodedNatively(self._encode({0: None, 1: True, 2: False, 254: tlvUint(3), 255: [-1, "a", {3: b"b"}]}))
+        self._assertDecodedNatively(self._encode([[], {}, [[tlvUint(1)]], None]))
+
+        # The last of several elements with the same tag wins.
+        self._assertDecodedNatively(bytes([0x15, 0x24, 0x01, 0x01, 0x24, 0x01, 0x02, 0x18]))
+
+    def test_fallback(self):
+        # Anonymous tags inside a structure, which TLVReader keys "Any", and context tags inside an array.
+        self._assertLeftToTLVReader(bytes([0x15, 0x04, 0x05, 0x24, 0x01, 0x06, 0x18]))
+        self._assertLeftToTLVReader(bytes([0x16, 0x24, 0x01, 0x06, 0x04, 0x07, 0x18]))
+
+        # TLV lists are decoded into TLVList objects.
+        self._assertLeftToTLVReader(self._encode(TLVList([(None, 1), (2, "a")])))
+        self._assertLeftToTLVReader(self._encode({1: [TLVList([(3, 4)])]}))
+
+        # Profile tags, in their implicit, common and fully qualified forms.
+        for tag in [(None, 1), (0, 0x12345), (0xfff1_0001, 2)]:
+            with self.subTest(tag=tag):
+                self._assertLeftToTLVReader(self._encode(OrderedDict([(1, 2), (tag, "a")])))
+
+        # Containers nested deeper than the native decoder goes.
+        self._assertDecodedNatively(self._encode(self._nested(32)))
+        self._assertLeftToTLVReader(self._encode(self._nested(33)))
+        self._assertLeftToTLVReader(self._encode({1: self._nested(100)}))
+
+    def _nested(self, depth):
+        val = tlvUint(1)
+        for _ in range(depth):
+            val = [val]
+        return val
+
+
 if __name__ == '__main__':
     unittest.main()
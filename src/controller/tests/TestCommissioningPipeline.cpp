@@ -0,0 +1,381 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningPipeline.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// Runs the timers of the pipeline from the mock clock instead of an event loop.
+class TimerAndMockClock : public System::Clock::Internal::MockClock, public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+    bool HasPendingTimers() const { return !mTimerList.Empty(); }
+
+    CHIP_ERROR StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        CancelTimer(aComplete, aAppState);
+        System::Clock::Timestamp awakenTime =
+            GetMonotonicMilliseconds64() + std::chrono::duration_cast<System::Clock::Milliseconds64>(aDelay);
+        mTimerList.Add(mTimerNodes.Create(*this, awakenTime, aComplete, aAppState));
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != System::Clock::Timeout(0);
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Like one iteration of the event loop: runs the timers that expired by the new time, but not the ones they start.
+    void AdvanceMonotonic(System::Clock::Milliseconds64 increment)
+    {
+        const System::Clock::Milliseconds64 timestamp = GetMonotonicMilliseconds64() + increment;
+        SetMonotonic(timestamp);
+
+        System::TimerList expired = mTimerList.ExtractEarlier(timestamp + 1_ms64);
+        System::TimerList::Node * node;
+        while ((node = expired.PopEarliest()) != nullptr)
+        {
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+// Stands in for the commissioners: records the devices each lane was asked to commission, which the tests then
+// complete through the pairing delegate the pipeline registered on the lane.
+class FakeCommissioningPipeline : public CommissioningPipeline
+{
+public:
+    ~FakeCommissioningPipeline() override { Stop(); }
+
+    // Devices being commissioned, by lane.
+    std::map<DeviceCommissioner *, NodeId> mActive;
+    // Devices in the order the lanes started them.
+    std::vector<NodeId> mStarted;
+    std::vector<NodeId> mStopped;
+    size_t mMaxActive = 0;
+    // Devices for which PairDevice fails right away.
+    std::map<NodeId, CHIP_ERROR> mPairDeviceErrors;
+
+protected:
+    CHIP_ERROR PairDevice(DeviceCommissioner & commissioner, const Job & job) override
+    {
+        EXPECT_EQ(mActive.count(&commissioner), 0u);
+        mStarted.push_back(job.nodeId);
+
+        auto error = mPairDeviceErrors.find(job.nodeId);
+        if (error != mPairDeviceErrors.end())
+        {
+            return error->second;
+        }
+
+        mActive[&commissioner] = job.nodeId;
+        mMaxActive             = std::max(mMaxActive, mActive.size());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR StopPairing(DeviceCommissioner & commissioner, NodeId nodeId) override
+    {
+        EXPECT_EQ(mActive[&commissioner], nodeId);
+        mActive.erase(&commissioner);
+        mStopped.push_back(nodeId);
+        return CHIP_NO_ERROR;
+    }
+};
+
+class RecordingDelegate : public CommissioningPipeline::Delegate
+{
+public:
+    void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) override
+    {
+        EXPECT_FALSE(mBatchComplete);
+        mCommissioned.push_back(nodeId);
+        mErrors.push_back(error);
+    }
+
+    void OnBatchComplete(size_t succeeded, size_t failed) override
+    {
+        EXPECT_FALSE(mBatchComplete);
+        mBatchComplete = true;
+        mSucceeded     = succeeded;
+        mFailed        = failed;
+    }
+
+    std::vector<NodeId> mCommissioned;
+    std::vector<CHIP_ERROR> mErrors;
+    bool mBatchComplete = false;
+    size_t mSucceeded   = 0;
+    size_t mFailed      = 0;
+};
+
+class NullPairingDelegate : public DevicePairingDelegate
+{
+};
+
+class TestCommissioningPipeline : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        sSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&sTimerAndClock);
+        DeviceLayer::SetSystemLayerForTesting(&sTimerAndClock);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sTimerAndClock.Shutdown();
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        System::Clock::Internal::SetSystemClockForTesting(sSavedClock);
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override { sTimerAndClock.Clear(); }
+
+protected:
+    static std::vector<CommissioningPipeline::Job> MakeJobs(NodeId first, size_t count)
+    {
+        std::vector<CommissioningPipeline::Job> jobs;
+        for (size_t i = 0; i < count; i++)
+        {
+            jobs.push_back({ first + i, "MT:-24J0AFN00KA0648G00" });
+        }
+        return jobs;
+    }
+
+    void AddLanes(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            mCommissioners[i].RegisterPairingDelegate(&mPreviousDelegate);
+            ASSERT_EQ(mPipeline.AddLane(&mCommissioners[i]), CHIP_NO_ERROR);
+        }
+    }
+
+    DeviceCommissioner * LaneOf(NodeId nodeId)
+    {
+        for (auto & active : mPipeline.mActive)
+        {
+            if (active.second == nodeId)
+            {
+                return active.first;
+            }
+        }
+        return nullptr;
+    }
+
+    // Reports the end of the commissioning of a device, as the commissioner of its lane would, then lets the pipeline
+    // start the next device.
+    void Complete(NodeId nodeId, CHIP_ERROR error = CHIP_NO_ERROR)
+    {
+        DeviceCommissioner * commissioner = LaneOf(nodeId);
+        ASSERT_NE(commissioner, nullptr);
+        mPipeline.mActive.erase(commissioner);
+        commissioner->GetPairingDelegate()->OnCommissioningComplete(nodeId, error);
+        sTimerAndClock.AdvanceMonotonic(0_ms64);
+    }
+
+    // Reports that PASE could not be established with a device, after which no commissioning is started for it.
+    void FailPairing(NodeId nodeId, CHIP_ERROR error)
+    {
+        DeviceCommissioner * commissioner = LaneOf(nodeId);
+        ASSERT_NE(commissioner, nullptr);
+        mPipeline.mActive.erase(commissioner);
+        commissioner->GetPairingDelegate()->OnPairingComplete(error);
+        sTimerAndClock.AdvanceMonotonic(0_ms64);
+    }
+
+    static TimerAndMockClock sTimerAndClock;
+    static System::Clock::ClockBase * sSavedClock;
+
+    DeviceCommissioner mCommissioners[4];
+    NullPairingDelegate mPreviousDelegate;
+    FakeCommissioningPipeline mPipeline;
+    RecordingDelegate mDelegate;
+    CommissioningParameters mParams;
+};
+
+TimerAndMockClock TestCommissioningPipeline::sTimerAndClock;
+System::Clock::ClockBase * TestCommissioningPipeline::sSavedClock = nullptr;
+
+TEST_F(TestCommissioningPipeline, DoesNotExceedTheLaneCount)
+{
+    AddLanes(2);
+    ASSERT_EQ(mPipeline.Start(MakeJobs(1, 5), mParams, DiscoveryType::kAll, &mDelegate), CHIP_NO_ERROR);
+
+    // Devices are only started from the event loop, never from Start().
+    EXPECT_TRUE(mPipeline.mStarted.empty());
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mPipeline.mStarted, (std::vector<NodeId>{ 1, 2 }));
+    EXPECT_EQ(mPipeline.mActive.size(), 2u);
+
+    // The pipeline is the pairing delegate of its lanes while it runs.
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_NE(mCommissioners[i].GetPairingDelegate(), &mPreviousDelegate);
+    }
+
+    for (NodeId nodeId = 1; nodeId <= 5; nodeId++)
+    {
+        Complete(nodeId);
+        EXPECT_LE(mPipeline.mActive.size(), 2u);
+    }
+
+    EXPECT_EQ(mPipeline.mStarted, (std::vector<NodeId>{ 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(mPipeline.mMaxActive, 2u);
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mDelegate.mSucceeded, 5u);
+    EXPECT_EQ(mDelegate.mFailed, 0u);
+    EXPECT_FALSE(mPipeline.IsRunning());
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(mCommissioners[i].GetPairingDelegate(), &mPreviousDelegate);
+    }
+}
+
+TEST_F(TestCommissioningPipeline, FailedDeviceDoesNotStallOtherLanes)
+{
+    AddLanes(2);
+    mPipeline.mPairDeviceErrors[3] = CHIP_ERROR_INVALID_ARGUMENT;
+    ASSERT_EQ(mPipeline.Start(MakeJobs(1, 5), mParams, DiscoveryType::kAll, &mDelegate), CHIP_NO_ERROR);
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+
+    DeviceCommissioner * busyLane = LaneOf(2);
+    ASSERT_NE(busyLane, nullptr);
+
+    // The lane of device 1 fails PASE, then moves on while device 2 is still being commissioned. Device 3 cannot be
+    // started at all, so the same lane goes on with device 4 right away.
+    FailPairing(1, CHIP_ERROR_TIMEOUT);
+    EXPECT_EQ(mPipeline.mStarted, (std::vector<NodeId>{ 1, 2, 3, 4 }));
+    EXPECT_EQ(LaneOf(2), busyLane);
+    ASSERT_NE(LaneOf(4), nullptr);
+    EXPECT_NE(LaneOf(4), busyLane);
+
+    Complete(4, CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(mPipeline.mStarted.back(), 5u);
+    EXPECT_NE(LaneOf(5), busyLane);
+    Complete(5);
+    EXPECT_FALSE(mDelegate.mBatchComplete);
+
+    Complete(2);
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mDelegate.mSucceeded, 2u);
+    EXPECT_EQ(mDelegate.mFailed, 3u);
+    EXPECT_EQ(mDelegate.mCommissioned, (std::vector<NodeId>{ 1, 3, 4, 5, 2 }));
+    EXPECT_EQ(mDelegate.mErrors,
+              (std::vector<CHIP_ERROR>{ CHIP_ERROR_TIMEOUT, CHIP_ERROR_INVALID_ARGUMENT, CHIP_ERROR_INTERNAL, CHIP_NO_ERROR,
+                                        CHIP_NO_ERROR }));
+    EXPECT_EQ(mPipeline.GetStageMetrics(CommissioningStage::kSecurePairing).failed, 1u);
+}
+
+TEST_F(TestCommissioningPipeline, ReportsDevicesInCompletionOrder)
+{
+    AddLanes(3);
+    ASSERT_EQ(mPipeline.Start(MakeJobs(10, 4), mParams, DiscoveryType::kAll, &mDelegate), CHIP_NO_ERROR);
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mPipeline.mStarted, (std::vector<NodeId>{ 10, 11, 12 }));
+
+    // Devices are reported as they complete, not in the order of the batch, and the batch is reported once, after
+    // the last device.
+    Complete(12);
+    EXPECT_EQ(mPipeline.mStarted.back(), 13u);
+    Complete(13);
+    Complete(10);
+    EXPECT_FALSE(mDelegate.mBatchComplete);
+    Complete(11);
+
+    EXPECT_EQ(mDelegate.mCommissioned, (std::vector<NodeId>{ 12, 13, 10, 11 }));
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mDelegate.mSucceeded, 4u);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+}
+
+TEST_F(TestCommissioningPipeline, StopCancelsActiveDevicesAndDropsQueuedOnes)
+{
+    AddLanes(2);
+    ASSERT_EQ(mPipeline.Start(MakeJobs(1, 4), mParams, DiscoveryType::kAll, &mDelegate), CHIP_NO_ERROR);
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+
+    mPipeline.Stop();
+    std::sort(mPipeline.mStopped.begin(), mPipeline.mStopped.end());
+    EXPECT_EQ(mPipeline.mStopped, (std::vector<NodeId>{ 1, 2 }));
+    EXPECT_FALSE(mPipeline.IsRunning());
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(mPipeline.mStarted.size(), 2u);
+    EXPECT_TRUE(mDelegate.mCommissioned.empty());
+    EXPECT_FALSE(mDelegate.mBatchComplete);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(mCommissioners[i].GetPairingDelegate(), &mPreviousDelegate);
+    }
+}
+
+} // namespace
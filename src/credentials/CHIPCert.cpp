@@ -254,6 +254,7 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     CHIP_ERROR err                     = CHIP_NO_ERROR;
     const ChipCertificateData * caCert = nullptr;
     CertType certType;
+    bool useCache = false;
 
     err = cert->mSubjectDN.GetCertType(certType);
     SuccessOrExit(err);
@@ -411,10 +412,24 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
-    // succeeds, the current certificate is valid.
+    // succeeds, the current certificate is valid. A signature of a CA certificate that was already verified against the same
+    // CA key can be taken from the cache; all the checks above have still been applied to the certificate. Leaf certificates
+    // differ for every peer, so caching them would only evict the ICACs shared by a fabric.
+    useCache = (context.mVerifiedCertCache != nullptr && cert->mCertFlags.Has(CertFlags::kIsCA));
+    if (useCache && context.mVerifiedCertCache->Contains(*cert, *caCert))
+    {
+        ExitNow(err = CHIP_NO_ERROR);
+    }
+
     err = VerifyCertSignature(*cert, *caCert);
     SuccessOrExit(err);
 
+    if (useCache)
+    {
+        // Failing to cache the result only costs a repeated verification later.
+        LogErrorOnFailure(context.mVerifiedCertCache->Add(*cert, *caCert));
+    }
+
 exit:
     return err;
 }
@@ -500,9 +515,10 @@ bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 
 void ValidationContext::Reset()
 {
-    mEffectiveTime  = EffectiveTime{};
-    mTrustAnchor    = nullptr;
-    mValidityPolicy = nullptr;
+    mEffectiveTime     = EffectiveTime{};
+    mTrustAnchor       = nullptr;
+    mValidityPolicy    = nullptr;
+    mVerifiedCertCache = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
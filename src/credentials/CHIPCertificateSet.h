@@ -32,6 +32,7 @@
 
 #include "CHIPCert.h"
 #include "CertificateValidityPolicy.h"
+#include "VerifiedCertificateCache.h"
 #include <lib/support/Variant.h>
 
 namespace chip {
@@ -74,6 +75,9 @@ struct ValidationContext
 
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
+    VerifiedCertificateCache * mVerifiedCertCache =
+        nullptr; /**< Optional cache of already verified certificate signatures. Validity period checks
+                    are still applied to cached certificates. */
 
     void Reset();
 
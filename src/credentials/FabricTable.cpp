@@ -48,6 +48,12 @@ static_assert(CHIP_CONFIG_MAX_FABRICS <= kMaxValidFabricIndex, "Max fabric count
 constexpr TLV::Tag kVendorIdTag    = TLV::ContextTag(0);
 constexpr TLV::Tag kFabricLabelTag = TLV::ContextTag(1);
 
+// Tags for our summary storage.
+constexpr TLV::Tag kSummaryNodeIdTag             = TLV::ContextTag(0);
+constexpr TLV::Tag kSummaryFabricIdTag           = TLV::ContextTag(1);
+constexpr TLV::Tag kSummaryCompressedFabricIdTag = TLV::ContextTag(2);
+constexpr TLV::Tag kSummaryRootPublicKeyTag      = TLV::ContextTag(3);
+
 // Tags for our index list storage.
 constexpr TLV::Tag kNextAvailableFabricIndexTag = TLV::ContextTag(0);
 constexpr TLV::Tag kFabricIndicesTag            = TLV::ContextTag(1);
@@ -192,6 +198,28 @@ CHIP_ERROR FabricInfo::CommitToStorage(PersistentStorageDelegate * storage) cons
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR FabricInfo::CommitSummaryToStorage(PersistentStorageDelegate * storage) const
+{
+    uint8_t buf[SummaryTLVMaxSize()];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+
+    ReturnErrorOnFailure(writer.Put(kSummaryNodeIdTag, mNodeId));
+    ReturnErrorOnFailure(writer.Put(kSummaryFabricIdTag, mFabricId));
+    ReturnErrorOnFailure(writer.Put(kSummaryCompressedFabricIdTag, mCompressedFabricId));
+    ReturnErrorOnFailure(writer.Put(kSummaryRootPublicKeyTag, ByteSpan(mRootPublicKey.ConstBytes(), mRootPublicKey.Length())));
+
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+
+    const auto summaryLength = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(summaryLength), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return storage->SyncSetKeyValue(DefaultStorageKeyAllocator::FabricSummary(mFabricIndex).KeyName(), buf,
+                                    static_cast<uint16_t>(summaryLength));
+}
+
 CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex, const ByteSpan & rcac,
                                        const ByteSpan & noc)
 {
@@ -215,6 +243,52 @@ CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, Fabr
     }
 
     // Load other storable metadata (label, vendorId, etc)
+    return LoadMetadataFromStorage(storage);
+}
+
+CHIP_ERROR FabricInfo::LoadSummaryFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex)
+{
+    mFabricIndex = newFabricIndex;
+
+    // Restore operational metadata that LoadFromStorage() would otherwise derive from NOC/RCAC
+    {
+        uint8_t buf[SummaryTLVMaxSize()];
+        uint16_t size = sizeof(buf);
+        ReturnErrorOnFailure(
+            storage->SyncGetKeyValue(DefaultStorageKeyAllocator::FabricSummary(mFabricIndex).KeyName(), buf, size));
+        TLV::ContiguousBufferTLVReader reader;
+        reader.Init(buf, size);
+
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(reader.Next(kSummaryNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(mNodeId));
+
+        ReturnErrorOnFailure(reader.Next(kSummaryFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(mFabricId));
+
+        ReturnErrorOnFailure(reader.Next(kSummaryCompressedFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(mCompressedFabricId));
+
+        ReturnErrorOnFailure(reader.Next(kSummaryRootPublicKeyTag));
+        ByteSpan rootPublicKey;
+        ReturnErrorOnFailure(reader.Get(rootPublicKey));
+        VerifyOrReturnError(rootPublicKey.size() == Crypto::kP256_PublicKey_Length, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        mRootPublicKey = P256PublicKeySpan(rootPublicKey.data());
+
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        ReturnErrorOnFailure(reader.VerifyEndOfContainer());
+
+        VerifyOrReturnError(IsOperationalNodeId(mNodeId) && IsValidFabricId(mFabricId), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    }
+
+    return LoadMetadataFromStorage(storage);
+}
+
+CHIP_ERROR FabricInfo::LoadMetadataFromStorage(PersistentStorageDelegate * storage)
+{
     {
         uint8_t buf[MetadataTLVMaxSize()];
         uint16_t size = sizeof(buf);
@@ -258,6 +332,14 @@ CHIP_ERROR FabricTable::DeleteMetadataFromStorage(FabricIndex fabricIndex)
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+    // Fabrics committed before summaries existed may not have one, so a missing summary is expected here.
+    CHIP_ERROR summaryErr = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricSummary(fabricIndex).KeyName());
+    if ((summaryErr != CHIP_NO_ERROR) && (summaryErr != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
+    {
+        ChipLogError(FabricProvisioning, "Error deleting summary for fabric 0x%x: %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(fabricIndex), summaryErr.Format());
+    }
+
     CHIP_ERROR deleteErr = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricMetadata(fabricIndex).KeyName());
 
     if (deleteErr != CHIP_NO_ERROR)
@@ -685,6 +767,26 @@ CHIP_ERROR FabricTable::StoreFabricMetadata(const FabricInfo * fabricInfo) const
     // TODO: Refactor not to internally rely directly on storage
     ReturnErrorOnFailure(fabricInfo->CommitToStorage(mStorage));
 
+    // The summary mirrors the certificates, which are committed along with the metadata, so it is refreshed
+    // every time the metadata is. Without lazy loading, it is removed instead so that a summary written by a
+    // previous lazy boot can never outlive an update of the certificates.
+    const auto summaryKey = DefaultStorageKeyAllocator::FabricSummary(fabricIndex);
+    if (mLazyCertificateLoading)
+    {
+        CHIP_ERROR summaryErr = fabricInfo->CommitSummaryToStorage(mStorage);
+        if (summaryErr != CHIP_NO_ERROR)
+        {
+            // Never leave the summary of previous certificates behind: the fabric would be restored from it.
+            mStorage->SyncDeleteKeyValue(summaryKey.KeyName());
+            return summaryErr;
+        }
+    }
+    else
+    {
+        CHIP_ERROR deleteErr = mStorage->SyncDeleteKeyValue(summaryKey.KeyName());
+        VerifyOrReturnError((deleteErr == CHIP_NO_ERROR) || (deleteErr == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND), deleteErr);
+    }
+
     ChipLogProgress(FabricProvisioning, "Metadata for Fabric 0x%x persisted to storage.", static_cast<unsigned>(fabricIndex));
 
     return CHIP_NO_ERROR;
@@ -695,6 +797,20 @@ CHIP_ERROR FabricTable::LoadFromStorage(FabricInfo * fabric, FabricIndex newFabr
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(!fabric->IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
 
+    if (mLazyCertificateLoading)
+    {
+        CHIP_ERROR summaryErr = LoadSummaryFromStorage(fabric, newFabricIndex);
+        if (summaryErr == CHIP_NO_ERROR)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        // Fall back to the certificates, e.g. for a fabric committed before summaries existed.
+        ChipLogProgress(FabricProvisioning, "No usable summary for Fabric (0x%x): %" CHIP_ERROR_FORMAT,
+                        static_cast<unsigned>(newFabricIndex), summaryErr.Format());
+        fabric->Reset();
+    }
+
     uint8_t nocBuf[kMaxCHIPCertLength];
     MutableByteSpan nocSpan{ nocBuf };
     uint8_t rcacBuf[kMaxCHIPCertLength];
@@ -728,6 +844,32 @@ CHIP_ERROR FabricTable::LoadFromStorage(FabricInfo * fabric, FabricIndex newFabr
                     ChipLogValueX64(fabric->GetFabricId()), ChipLogValueX64(fabric->GetNodeId()),
                     to_underlying(fabric->GetVendorId()));
 
+    if (mLazyCertificateLoading)
+    {
+        // Failing to write the summary only means the certificates are parsed again on next boot.
+        LogErrorOnFailure(fabric->CommitSummaryToStorage(mStorage));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FabricTable::LoadSummaryFromStorage(FabricInfo * fabric, FabricIndex newFabricIndex)
+{
+    // The certificates are not read, but they must still be there for the fabric to be usable, as on the
+    // non-lazy path which skips fabrics without RCAC/NOC.
+    VerifyOrReturnError(mOpCertStore->HasCertificateForFabric(newFabricIndex, CertChainElement::kNoc) &&
+                            mOpCertStore->HasCertificateForFabric(newFabricIndex, CertChainElement::kRcac),
+                        CHIP_ERROR_NOT_FOUND);
+
+    ReturnErrorOnFailure(fabric->LoadSummaryFromStorage(mStorage, newFabricIndex));
+
+    ChipLogProgress(FabricProvisioning,
+                    "Fabric index 0x%x was restored from its summary. Compressed FabricId 0x" ChipLogFormatX64
+                    ", FabricId 0x" ChipLogFormatX64 ", NodeId 0x" ChipLogFormatX64 ", VendorId 0x%04X",
+                    static_cast<unsigned>(fabric->GetFabricIndex()), ChipLogValueX64(fabric->GetCompressedFabricId()),
+                    ChipLogValueX64(fabric->GetFabricId()), ChipLogValueX64(fabric->GetNodeId()),
+                    to_underlying(fabric->GetVendorId()));
+
     return CHIP_NO_ERROR;
 }
 
@@ -1076,9 +1218,10 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     VerifyOrReturnError(initParams.storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(initParams.opCertStore != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    mStorage             = initParams.storage;
-    mOperationalKeystore = initParams.operationalKeystore;
-    mOpCertStore         = initParams.opCertStore;
+    mStorage                = initParams.storage;
+    mOperationalKeystore    = initParams.operationalKeystore;
+    mOpCertStore            = initParams.opCertStore;
+    mLazyCertificateLoading = initParams.lazyCertificateLoading;
 
     ChipLogDetail(FabricProvisioning, "Initializing FabricTable from persistent storage");
 
@@ -221,6 +221,12 @@ private:
         return TLV::EstimateStructOverhead(sizeof(uint16_t), kFabricLabelMaxLengthInBytes);
     }
 
+    static constexpr size_t SummaryTLVMaxSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(NodeId), sizeof(FabricId), sizeof(CompressedFabricId),
+                                           Crypto::kP256_PublicKey_Length);
+    }
+
     static constexpr size_t OpKeyTLVMaxSize()
     {
         return TLV::EstimateStructOverhead(sizeof(uint16_t), Crypto::P256SerializedKeypair::Capacity());
@@ -251,8 +257,12 @@ private:
     mutable Crypto::P256Keypair * mOperationalKey = nullptr;
 
     CHIP_ERROR CommitToStorage(PersistentStorageDelegate * storage) const;
+    CHIP_ERROR CommitSummaryToStorage(PersistentStorageDelegate * storage) const;
     CHIP_ERROR LoadFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex, const ByteSpan & rcac,
                                const ByteSpan & noc);
+    // Same as LoadFromStorage, but takes the identity of the fabric from its summary record instead of its certificates.
+    CHIP_ERROR LoadSummaryFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex);
+    CHIP_ERROR LoadMetadataFromStorage(PersistentStorageDelegate * storage);
 };
 
 /**
@@ -364,6 +374,9 @@ public:
         Crypto::OperationalKeystore * operationalKeystore = nullptr;
         // Operational Certificate store to hold the NOC/ICAC/RCAC chains (MANDATORY).
         Credentials::OperationalCertificateStore * opCertStore = nullptr;
+        // If true, Init() restores fabrics from their summary record and only reads their certificates when they
+        // are used. See CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING.
+        bool lazyCertificateLoading = CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING;
     };
 
     class DLL_EXPORT Delegate
@@ -1174,6 +1187,10 @@ private:
     // Load a FabricInfo metatada item from storage for a given new fabric index. Returns internal error on failure.
     CHIP_ERROR LoadFromStorage(FabricInfo * fabric, FabricIndex newFabricIndex);
 
+    // Same as LoadFromStorage, without reading or parsing the certificates of the fabric. Used when
+    // `mLazyCertificateLoading` is set.
+    CHIP_ERROR LoadSummaryFromStorage(FabricInfo * fabric, FabricIndex newFabricIndex);
+
     // Store a given fabric metadata directly/immediately. Used by internal operations.
     CHIP_ERROR StoreFabricMetadata(const FabricInfo * fabricInfo) const;
 
@@ -1303,6 +1320,9 @@ private:
     Optional<FabricIndex> mNextAvailableFabricIndex;
     uint8_t mFabricCount = 0;
 
+    // Set from InitParams::lazyCertificateLoading.
+    bool mLazyCertificateLoading = false;
+
     BitFlags<StateFlags> mStateFlags;
 };
 
@@ -316,7 +316,21 @@ public:
     void SetListener(GroupListener * listener) { mListener = listener; };
     void RemoveListener() { mListener = nullptr; };
 
+    /**
+     *  Returns true if the provider calls EndpointMappingChanged() on every change to the (group, endpoint) pairs
+     *  returned by IterateEndpoints(). Callers must not cache these pairs for providers that return false.
+     */
+    virtual bool SupportsEndpointMappingGeneration() const { return false; }
+
+    /**
+     *  Returns a counter that changes every time the (group, endpoint) pairs returned by IterateEndpoints() may
+     *  have changed, so that callers can cache them instead of iterating the group table on every group message.
+     *  Only meaningful if SupportsEndpointMappingGeneration() returns true.
+     */
+    uint32_t GetEndpointMappingGeneration() const { return mEndpointMappingGeneration; }
+
 protected:
+    void EndpointMappingChanged() { mEndpointMappingGeneration++; }
     void GroupAdded(FabricIndex fabric_index, const GroupInfo & new_group)
     {
         if (mListener)
@@ -333,7 +347,8 @@ protected:
     }
     const uint16_t mMaxGroupsPerFabric;
     const uint16_t mMaxGroupKeysPerFabric;
-    GroupListener * mListener = nullptr;
+    GroupListener * mListener           = nullptr;
+    uint32_t mEndpointMappingGeneration = 0;
 };
 
 /**
@@ -838,6 +838,7 @@ void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * stora
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    EndpointMappingChanged();
 }
 
 //
@@ -895,6 +896,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    EndpointMappingChanged();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -977,6 +979,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    EndpointMappingChanged();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1037,6 +1040,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    EndpointMappingChanged();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1095,6 +1099,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    EndpointMappingChanged();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1319,6 +1324,7 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    EndpointMappingChanged();
 
     FabricData fabric(fabric_index);
     GroupData group;
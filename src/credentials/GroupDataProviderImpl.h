@@ -69,6 +69,7 @@ public:
     // Iterators
     GroupInfoIterator * IterateGroupInfo(FabricIndex fabric_index) override;
     EndpointIterator * IterateEndpoints(FabricIndex fabric_index, std::optional<GroupId> group_id = std::nullopt) override;
+    bool SupportsEndpointMappingGeneration() const override { return true; }
 
     //
     // Group-Key map
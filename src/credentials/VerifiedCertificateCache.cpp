@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertificateCache.h>
+
+#include <credentials/CHIPCert.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+static_assert(VerifiedCertificateCache::kCapacity > 0, "CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE must be greater than zero");
+
+CHIP_ERROR VerifiedCertificateCache::ComputeKey(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                                uint8_t (&key)[Crypto::kSHA256_Hash_Length])
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Crypto::Hash_SHA256_stream hash;
+    MutableByteSpan keySpan(key);
+
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+    return hash.Finish(keySpan);
+}
+
+VerifiedCertificateCache::Entry * VerifiedCertificateCache::Find(const uint8_t (&key)[Crypto::kSHA256_Hash_Length])
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && memcmp(entry.mKey, key, sizeof(key)) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool VerifiedCertificateCache::Contains(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    uint8_t key[Crypto::kSHA256_Hash_Length];
+    VerifyOrReturnValue(ComputeKey(cert, signer, key) == CHIP_NO_ERROR, false);
+
+    Entry * entry = Find(key);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    entry->mLastUsed = ++mUseCounter;
+    return true;
+}
+
+CHIP_ERROR VerifiedCertificateCache::Add(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    uint8_t key[Crypto::kSHA256_Hash_Length];
+    ReturnErrorOnFailure(ComputeKey(cert, signer, key));
+
+    Entry * slot = Find(key);
+    if (slot == nullptr)
+    {
+        // Pick a free slot, or evict the least recently used entry.
+        slot = &mEntries[0];
+        for (auto & entry : mEntries)
+        {
+            if (!entry.mInUse)
+            {
+                slot = &entry;
+                break;
+            }
+            if (entry.mLastUsed < slot->mLastUsed)
+            {
+                slot = &entry;
+            }
+        }
+        memcpy(slot->mKey, key, sizeof(key));
+        slot->mInUse = true;
+    }
+
+    slot->mLastUsed = ++mUseCounter;
+    return CHIP_NO_ERROR;
+}
+
+void VerifiedCertificateCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        memset(entry.mKey, 0, sizeof(entry.mKey));
+        entry.mLastUsed = 0;
+        entry.mInUse    = false;
+    }
+    mUseCounter = 0;
+}
+
+size_t VerifiedCertificateCache::Count() const
+{
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        if (entry.mInUse)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace Credentials
+} // namespace chip
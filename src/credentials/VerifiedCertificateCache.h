@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a small cache of certificate signatures that have already been
+ *      successfully verified, so that intermediate and root certificates shared
+ *      by many peers of a fabric are not ECDSA-verified on every CASE handshake.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+struct ChipCertificateData;
+
+/**
+ *  @class VerifiedCertificateCache
+ *
+ *  @brief
+ *    Remembers (certificate, signer) pairs whose signature was successfully
+ *    verified.
+ *
+ *    An entry is keyed by a SHA-256 digest over the certificate's TBS hash, its
+ *    signature and the signer's public key, so a hit is only possible for the
+ *    exact same certificate signed by the exact same key.  Only the signature
+ *    verification step is memoized: certificate validity windows, Last Known
+ *    Good Time, key usage and path length checks are still evaluated by
+ *    ChipCertificateSet::ValidateCert() on every validation.
+ *
+ *    When the cache is full, the least recently used entry is evicted.
+ *
+ *    This class is not thread-safe.  Callers that validate certificates outside
+ *    of the Matter event loop must not share a cache with the event loop.
+ */
+class VerifiedCertificateCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE;
+
+    VerifiedCertificateCache() { Clear(); }
+
+    /**
+     * @brief Check whether the signature of `cert` was previously verified against `signer`.
+     *
+     * A successful lookup refreshes the entry's position in the LRU order.
+     */
+    bool Contains(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    /**
+     * @brief Record that the signature of `cert` was successfully verified against `signer`.
+     *
+     * @return CHIP_NO_ERROR on success, or an error if the cache key could not be computed.
+     */
+    CHIP_ERROR Add(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    /**
+     * @brief Drop all cached entries.
+     *
+     * Should be called when trust anchors are removed or replaced, e.g. when a fabric is removed.
+     */
+    void Clear();
+
+    /**
+     * @return Number of currently cached entries.
+     */
+    size_t Count() const;
+
+private:
+    struct Entry
+    {
+        uint8_t mKey[Crypto::kSHA256_Hash_Length];
+        uint32_t mLastUsed;
+        bool mInUse;
+    };
+
+    static CHIP_ERROR ComputeKey(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                 uint8_t (&key)[Crypto::kSHA256_Hash_Length]);
+
+    Entry * Find(const uint8_t (&key)[Crypto::kSHA256_Hash_Length]);
+
+    Entry mEntries[kCapacity];
+    uint32_t mUseCounter;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -27,6 +27,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -833,6 +834,123 @@ TEST_F(TestChipCert, TestChipCert_CertValidTime)
     certSet.Release();
 }
 
+TEST_F(TestChipCert, TestChipCert_VerifiedCertificateCache)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+    VerifiedCertificateCache cache;
+
+    err = certSet.Init(kStandardCertsCount);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    err = LoadTestCertSet01(certSet);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    const ChipCertificateData * rootCert = &certSet.GetCertSet()[0];
+    const ChipCertificateData * icaCert  = &certSet.GetCertSet()[1];
+    const ChipCertificateData * nodeCert = &certSet.GetCertSet()[2];
+
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    validContext.mVerifiedCertCache = &cache;
+
+    // First validation populates the cache with the ICAC->RCAC signature. The NOC is a leaf, specific to one peer, and is
+    // verified every time.
+    err = SetCurrentTime(validContext, 2022, 02, 23, 12, 30, 01);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+    EXPECT_FALSE(cache.Contains(*nodeCert, *icaCert));
+    EXPECT_TRUE(cache.Contains(*icaCert, *rootCert));
+
+    // Pairs that were never verified must not match.
+    EXPECT_FALSE(cache.Contains(*nodeCert, *rootCert));
+    EXPECT_FALSE(cache.Contains(*icaCert, *icaCert));
+
+    // Subsequent validation is served from the cache and does not add entries.
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(validContext.mTrustAnchor, rootCert);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    // Validity periods are still enforced for cached certificates.
+    err = SetCurrentTime(validContext, 2040, 10, 15, 14, 23, 43);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_ERROR_CERT_EXPIRED);
+
+    err = SetCurrentTime(validContext, 2020, 1, 3);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_ERROR_CERT_NOT_VALID_YET);
+
+    // ... and so is Last Known Good Time.
+    Credentials::LastKnownGoodTimeCertificateValidityPolicyExample lastKnownGoodTimeValidityPolicy;
+    validContext.mValidityPolicy = &lastKnownGoodTimeValidityPolicy;
+    err                          = SetLastKnownGoodTime(validContext, 2040, 10, 15, 14, 23, 43);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_ERROR_CERT_EXPIRED);
+
+    err = SetLastKnownGoodTime(validContext, 2022, 02, 23, 12, 30, 01);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = certSet.ValidateCert(nodeCert, validContext);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0u);
+    EXPECT_FALSE(cache.Contains(*icaCert, *rootCert));
+
+    certSet.Release();
+}
+
+TEST_F(TestChipCert, TestChipCert_VerifiedCertificateCacheEviction)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    VerifiedCertificateCache cache;
+
+    err = certSet.Init(kStandardCertsCount);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    err = LoadTestCertSet01(certSet);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    const ChipCertificateData * icaCert  = &certSet.GetCertSet()[1];
+    const ChipCertificateData * nodeCert = &certSet.GetCertSet()[2];
+
+    // Fill the cache using the NOC signed by the ICAC as the first (and least recently used) entry,
+    // then other signer keys for the remaining slots.
+    EXPECT_EQ(cache.Add(*nodeCert, *icaCert), CHIP_NO_ERROR);
+    for (size_t i = 1; i < VerifiedCertificateCache::kCapacity; i++)
+    {
+        ChipCertificateData signer;
+        uint8_t publicKey[Crypto::kP256_PublicKey_Length] = { 0x04 };
+        publicKey[1]                                      = static_cast<uint8_t>(i);
+        signer.mPublicKey                                 = P256PublicKeySpan(publicKey);
+        EXPECT_EQ(cache.Add(*icaCert, signer), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(cache.Count(), VerifiedCertificateCache::kCapacity);
+    EXPECT_TRUE(cache.Contains(*nodeCert, *icaCert));
+
+    // The NOC entry was just refreshed, so adding a new pair evicts another one instead.
+    ChipCertificateData signer;
+    uint8_t publicKey[Crypto::kP256_PublicKey_Length] = { 0x04, 0xFF };
+    signer.mPublicKey                                 = P256PublicKeySpan(publicKey);
+    EXPECT_EQ(cache.Add(*icaCert, signer), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), VerifiedCertificateCache::kCapacity);
+    EXPECT_TRUE(cache.Contains(*nodeCert, *icaCert));
+    EXPECT_TRUE(cache.Contains(*icaCert, signer));
+
+    // Certificates without a TBS hash cannot be cached.
+    EXPECT_NE(cache.Add(certSet.GetCertSet()[0], *icaCert), CHIP_NO_ERROR);
+
+    certSet.Release();
+}
+
 TEST_F(TestChipCert, TestChipCert_ValidateChipRCAC)
 {
     struct RCACTestCase
@@ -38,7 +38,9 @@
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
+#include <system/SystemClock.h>
 
 #include <platform/ConfigurationManager.h>
 
@@ -60,24 +62,22 @@ public:
         mOpKeyStore.Finish();
     }
 
-    CHIP_ERROR Init(chip::TestPersistentStorageDelegate * storage)
+    CHIP_ERROR Init(chip::TestPersistentStorageDelegate * storage,
+                    bool lazyCertificateLoading = CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING)
     {
-        chip::FabricTable::InitParams initParams;
-        initParams.storage             = storage;
-        initParams.operationalKeystore = &mOpKeyStore;
-        initParams.opCertStore         = &mOpCertStore;
-
         ReturnErrorOnFailure(mOpKeyStore.Init(storage));
         ReturnErrorOnFailure(mOpCertStore.Init(storage));
-        return mFabricTable.Init(initParams);
+        return ReinitFabricTable(storage, lazyCertificateLoading);
     }
 
-    CHIP_ERROR ReinitFabricTable(chip::TestPersistentStorageDelegate * storage)
+    CHIP_ERROR ReinitFabricTable(chip::TestPersistentStorageDelegate * storage,
+                                 bool lazyCertificateLoading = CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING)
     {
         chip::FabricTable::InitParams initParams;
-        initParams.storage             = storage;
-        initParams.operationalKeystore = &mOpKeyStore;
-        initParams.opCertStore         = &mOpCertStore;
+        initParams.storage                = storage;
+        initParams.operationalKeystore    = &mOpKeyStore;
+        initParams.opCertStore            = &mOpCertStore;
+        initParams.lazyCertificateLoading = lazyCertificateLoading;
 
         return mFabricTable.Init(initParams);
     }
@@ -196,6 +196,23 @@ static CHIP_ERROR LoadTestFabric_Node02_01(FabricTable & fabricTable, bool doCom
     return err;
 }
 
+/**
+ * Add and commit a fabric whose NOC chain is issued by `certAuthority`.
+ */
+CHIP_ERROR AddFabricFromCertAuthority(FabricTable & fabricTable, Credentials::TestOnlyLocalCertificateAuthority & certAuthority,
+                                      FabricId fabricId, NodeId nodeId, FabricIndex & outFabricIndex)
+{
+    uint8_t csrBuf[chip::Crypto::kMIN_CSR_Buffer_Size];
+    MutableByteSpan csrSpan{ csrBuf };
+    ReturnErrorOnFailure(fabricTable.AllocatePendingOperationalKey(chip::NullOptional, csrSpan));
+    ReturnErrorOnFailure(certAuthority.GenerateNocChain(fabricId, nodeId, csrSpan).GetStatus());
+
+    ReturnErrorOnFailure(fabricTable.AddNewPendingTrustedRootCert(certAuthority.GetRcac()));
+    ReturnErrorOnFailure(fabricTable.AddNewPendingFabricWithOperationalKeystore(certAuthority.GetNoc(), certAuthority.GetIcac(),
+                                                                                VendorId::TestVendor1, &outFabricIndex));
+    return fabricTable.CommitPendingFabricData();
+}
+
 const FabricInfo * FindFabric(FabricTable & fabricTable, ByteSpan rootPublicKey, FabricId fabricId)
 {
     Crypto::P256PublicKey key;
@@ -3833,4 +3850,177 @@ TEST_F(TestFabricTable, VidVerificationSigningFailsOnBadInput)
     }
 }
 
+TEST_F(TestFabricTable, TestLazyCertificateLoading)
+{
+    Credentials::TestOnlyLocalCertificateAuthority fabricCertAuthority;
+    chip::TestPersistentStorageDelegate storage;
+    EXPECT_TRUE(fabricCertAuthority.Init().IsSuccess());
+
+    constexpr FabricIndex kFabricIndex1 = 1;
+    constexpr FabricIndex kFabricIndex2 = 2;
+
+    // Identity of each fabric, as derived from its certificates when it was added.
+    NodeId nodeIds[3]                         = {};
+    FabricId fabricIds[3]                     = {};
+    CompressedFabricId compressedFabricIds[3] = {};
+    Crypto::P256PublicKey rootPublicKeys[3];
+
+    auto expectFabricRestored = [&](FabricTable & fabricTable, FabricIndex fabricIndex) {
+        const auto * fabricInfo = fabricTable.FindFabricWithIndex(fabricIndex);
+        ASSERT_NE(fabricInfo, nullptr);
+        EXPECT_EQ(fabricInfo->GetNodeId(), nodeIds[fabricIndex]);
+        EXPECT_EQ(fabricInfo->GetFabricId(), fabricIds[fabricIndex]);
+        EXPECT_EQ(fabricInfo->GetCompressedFabricId(), compressedFabricIds[fabricIndex]);
+        EXPECT_EQ(fabricInfo->GetVendorId(), VendorId::TestVendor1);
+
+        Crypto::P256PublicKey rootPublicKey;
+        EXPECT_EQ(fabricInfo->FetchRootPubkey(rootPublicKey), CHIP_NO_ERROR);
+        EXPECT_TRUE(rootPublicKey.Matches(rootPublicKeys[fabricIndex]));
+
+        // The certificates are still there when they are needed.
+        uint8_t nocBuf[kMaxCHIPCertLength];
+        MutableByteSpan nocSpan{ nocBuf };
+        EXPECT_EQ(fabricTable.FetchNOCCert(fabricIndex, nocSpan), CHIP_NO_ERROR);
+
+        NodeId nocNodeId     = kUndefinedNodeId;
+        FabricId nocFabricId = kUndefinedFabricId;
+        EXPECT_EQ(ExtractNodeIdFabricIdFromOpCert(nocSpan, &nocNodeId, &nocFabricId), CHIP_NO_ERROR);
+        EXPECT_EQ(nocNodeId, nodeIds[fabricIndex]);
+        EXPECT_EQ(nocFabricId, fabricIds[fabricIndex]);
+    };
+
+    // First scope: add 2 fabrics, one of them without ICAC, with lazy loading enabled
+    {
+        ScopedFabricTable fabricTableHolder;
+        EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        fabricCertAuthority.SetIncludeIcac(true);
+        EXPECT_EQ(AddFabricFromCertAuthority(fabricTable, fabricCertAuthority, 1111, 55, fabricIndex), CHIP_NO_ERROR);
+        EXPECT_EQ(fabricIndex, kFabricIndex1);
+        fabricCertAuthority.SetIncludeIcac(false);
+        EXPECT_EQ(AddFabricFromCertAuthority(fabricTable, fabricCertAuthority, 2222, 66, fabricIndex), CHIP_NO_ERROR);
+        EXPECT_EQ(fabricIndex, kFabricIndex2);
+        EXPECT_EQ(fabricTable.SetFabricLabel(kFabricIndex1, "Lazy"_span), CHIP_NO_ERROR);
+
+        for (FabricIndex index : { kFabricIndex1, kFabricIndex2 })
+        {
+            const auto * fabricInfo = fabricTable.FindFabricWithIndex(index);
+            ASSERT_NE(fabricInfo, nullptr);
+            nodeIds[index]             = fabricInfo->GetNodeId();
+            fabricIds[index]           = fabricInfo->GetFabricId();
+            compressedFabricIds[index] = fabricInfo->GetCompressedFabricId();
+            EXPECT_EQ(fabricInfo->FetchRootPubkey(rootPublicKeys[index]), CHIP_NO_ERROR);
+
+            EXPECT_TRUE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(index).KeyName()));
+        }
+    }
+
+    // Second scope: both fabrics are restored from their summary
+    {
+        ScopedFabricTable fabricTableHolder;
+        EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        EXPECT_EQ(fabricTable.FabricCount(), 2);
+        expectFabricRestored(fabricTable, kFabricIndex1);
+        expectFabricRestored(fabricTable, kFabricIndex2);
+        EXPECT_TRUE(fabricTable.FindFabricWithIndex(kFabricIndex1)->GetFabricLabel().data_equal("Lazy"_span));
+    }
+
+    // Third scope: missing or corrupted summaries fall back to the certificates, and are written again
+    {
+        EXPECT_EQ(storage.SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex1).KeyName()), CHIP_NO_ERROR);
+        const uint8_t corruptedSummary[] = { 0x15, 0x24, 0x00 };
+        EXPECT_EQ(storage.SyncSetKeyValue(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex2).KeyName(), corruptedSummary,
+                                          sizeof(corruptedSummary)),
+                  CHIP_NO_ERROR);
+
+        ScopedFabricTable fabricTableHolder;
+        EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        EXPECT_EQ(fabricTable.FabricCount(), 2);
+        expectFabricRestored(fabricTable, kFabricIndex1);
+        expectFabricRestored(fabricTable, kFabricIndex2);
+
+        EXPECT_TRUE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex1).KeyName()));
+        EXPECT_EQ(fabricTableHolder.ReinitFabricTable(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+        EXPECT_EQ(fabricTable.FabricCount(), 2);
+        expectFabricRestored(fabricTable, kFabricIndex2);
+    }
+
+    // Fourth scope: without lazy loading, storing the metadata of a fabric removes its summary
+    {
+        ScopedFabricTable fabricTableHolder;
+        EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ false), CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        EXPECT_EQ(fabricTable.FabricCount(), 2);
+        expectFabricRestored(fabricTable, kFabricIndex1);
+        expectFabricRestored(fabricTable, kFabricIndex2);
+
+        EXPECT_EQ(fabricTable.SetFabricLabel(kFabricIndex1, "Eager"_span), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex1).KeyName()));
+        EXPECT_TRUE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex2).KeyName()));
+    }
+
+    // Fifth scope: a fabric without NOC is skipped even though it has a summary, and deleting a fabric
+    // deletes its summary
+    {
+        EXPECT_EQ(storage.SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricNOC(kFabricIndex2).KeyName()), CHIP_NO_ERROR);
+
+        ScopedFabricTable fabricTableHolder;
+        EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        EXPECT_EQ(fabricTable.FabricCount(), 1);
+        expectFabricRestored(fabricTable, kFabricIndex1);
+        EXPECT_TRUE(fabricTable.FindFabricWithIndex(kFabricIndex1)->GetFabricLabel().data_equal("Eager"_span));
+        EXPECT_EQ(fabricTable.FindFabricWithIndex(kFabricIndex2), nullptr);
+
+        EXPECT_TRUE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex1).KeyName()));
+        EXPECT_EQ(fabricTable.Delete(kFabricIndex1), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.HasKey(DefaultStorageKeyAllocator::FabricSummary(kFabricIndex1).KeyName()));
+    }
+}
+
+TEST_F(TestFabricTable, BenchmarkLazyCertificateLoading)
+{
+    constexpr unsigned kIterations = 20;
+
+    Credentials::TestOnlyLocalCertificateAuthority fabricCertAuthority;
+    chip::TestPersistentStorageDelegate storage;
+    EXPECT_TRUE(fabricCertAuthority.Init().IsSuccess());
+    fabricCertAuthority.SetIncludeIcac(true);
+
+    ScopedFabricTable fabricTableHolder;
+    EXPECT_EQ(fabricTableHolder.Init(&storage, /* lazyCertificateLoading = */ true), CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+    for (FabricId fabricId = 1; fabricId <= CHIP_CONFIG_MAX_FABRICS; fabricId++)
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        ASSERT_EQ(AddFabricFromCertAuthority(fabricTable, fabricCertAuthority, fabricId, 0x1000 + fabricId, fabricIndex),
+                  CHIP_NO_ERROR);
+    }
+
+    auto timeInit = [&](bool lazyCertificateLoading) {
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (unsigned i = 0; i < kIterations; i++)
+        {
+            EXPECT_EQ(fabricTableHolder.ReinitFabricTable(&storage, lazyCertificateLoading), CHIP_NO_ERROR);
+            EXPECT_EQ(fabricTable.FabricCount(), CHIP_CONFIG_MAX_FABRICS);
+        }
+        return (System::SystemClock().GetMonotonicMicroseconds64().count() - start) / kIterations;
+    };
+
+    uint64_t eagerUs = timeInit(false);
+    uint64_t lazyUs  = timeInit(true);
+
+    ChipLogProgress(Test, "FabricTable::Init with %u fabrics: eager %" PRIu64 " us, lazy %" PRIu64 " us",
+                    static_cast<unsigned>(CHIP_CONFIG_MAX_FABRICS), eagerUs, lazyUs);
+}
+
 } // namespace
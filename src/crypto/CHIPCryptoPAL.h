@@ -833,6 +833,77 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief AES-CCM key prepared once for repeated use in a single direction
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() set up a new cipher context, including the AES key
+ * schedule, for every message. This class keeps that state for the lifetime of a session key,
+ * so that per-message work is limited to processing the nonce, AAD and payload. Backends
+ * use the fastest AES implementation available to them (e.g. AES-NI on OpenSSL).
+ *
+ * The prepared state is specific to the direction given to Prepare() and to the Matter message
+ * parameters (kAES_CCM128_Nonce_Length nonce, kAES_CCM128_Tag_Length tag). Operations using
+ * other nonce or tag lengths are still supported, but go through the one-shot functions.
+ *
+ * The key handle passed to Prepare() must outlive this object or the next call to Release().
+ * Results are identical to the one-shot functions for any given input.
+ *
+ * Not thread-safe: a prepared key must not be used concurrently from multiple threads.
+ */
+class AesCcm128PreparedKey
+{
+public:
+    enum class Direction : uint8_t
+    {
+        kEncrypt,
+        kDecrypt,
+    };
+
+    AesCcm128PreparedKey() = default;
+    ~AesCcm128PreparedKey() { Release(); }
+
+    AesCcm128PreparedKey(const AesCcm128PreparedKey &)             = delete;
+    AesCcm128PreparedKey & operator=(const AesCcm128PreparedKey &) = delete;
+
+    /**
+     * @brief Expand `key` for use by subsequent Encrypt() or Decrypt() calls, depending on `direction`.
+     *
+     * Any previously prepared key is released first.
+     *
+     * @return CHIP_NO_ERROR on success, CHIP_ERROR_NO_MEMORY or CHIP_ERROR_INTERNAL on failure
+     */
+    CHIP_ERROR Prepare(const Aes128KeyHandle & key, Direction direction);
+
+    /**
+     * @brief Release the prepared key and any backend resources. Safe to call more than once.
+     */
+    void Release();
+
+    bool IsPrepared() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt() using the prepared key.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if no key is prepared for encryption, otherwise as AES_CCM_encrypt()
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length) const;
+
+    /**
+     * @brief Same as AES_CCM_decrypt() using the prepared key.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if no key is prepared for decryption, otherwise as AES_CCM_decrypt()
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                       uint8_t * plaintext) const;
+
+private:
+    const Aes128KeyHandle * mKey = nullptr; // Key passed to Prepare(), used for the one-shot path.
+    void * mBackendContext       = nullptr; // Backend-specific prepared cipher context, if any.
+    Direction mDirection         = Direction::kEncrypt;
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -146,19 +146,71 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
-CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
-                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
-                           uint8_t * tag, size_t tag_length)
+#if CHIP_CRYPTO_BORINGSSL
+using AesCcmContext = EVP_AEAD_CTX;
+#else
+using AesCcmContext = EVP_CIPHER_CTX;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+// Allocates a cipher context for a single AES_CCM_encrypt()/AES_CCM_decrypt() call.
+static AesCcmContext * _newAesCcmContext(const Aes128KeyHandle & key)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    // BoringSSL only supports the Matter nonce and tag lengths, so the key is bound at creation.
+    return EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                            sizeof(Symmetric128BitsKeyByteArray), kAES_CCM128_Tag_Length);
+#else
+    (void) key;
+    return EVP_CIPHER_CTX_new();
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+// Allocates a cipher context with the key schedule expanded for the Matter nonce and tag lengths.
+// OpenSSL binds both lengths and the direction when the key is set, so they cannot change afterwards.
+static AesCcmContext * _newPreparedAesCcmContext(const Aes128KeyHandle & key, bool encrypt)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    (void) encrypt;
+    return _newAesCcmContext(key);
+#else
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    const int enc = encrypt ? 1 : 0;
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(kAES_CCM128_Nonce_Length), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(kAES_CCM128_Tag_Length), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, enc) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+static void _freeAesCcmContext(AesCcmContext * context)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(context);
+#else
+    EVP_CIPHER_CTX_free(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+// Encrypts one message. When `key` is null, `context` must have been set up by _newPreparedAesCcmContext()
+// for encryption, and the nonce and tag lengths must match kAES_CCM128_Nonce_Length and kAES_CCM128_Tag_Length.
+// Otherwise `context` must be a freshly allocated context.
+static CHIP_ERROR _aesCcmEncrypt(AesCcmContext * context, const Aes128KeyHandle * key, const uint8_t * plaintext,
+                                 size_t plaintext_length, const uint8_t * aad, size_t aad_length, const uint8_t * nonce,
+                                 size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
 {
 #if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
     size_t written_tag_len = 0;
-    const EVP_AEAD * aead  = nullptr;
 #else
-    EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -202,37 +254,31 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 #endif // CHIP_CRYPTO_BORINGSSL
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
+    (void) key;
     result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
                                        plaintext_length, nullptr, 0, aad, aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
+    if (key != nullptr)
+    {
+        // Pass in cipher
+        result = EVP_EncryptInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
-    // Pass in key + nonce
+    // Pass in key (unless already prepared) + nonce
     static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, (key != nullptr) ? key->As<Symmetric128BitsKeyByteArray>() : nullptr,
+                                Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
@@ -268,31 +314,18 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
-    {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
-        context = nullptr;
-    }
-
     return error;
 }
 
-CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
-                           const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
-                           size_t nonce_length, uint8_t * plaintext)
+// Decrypts one message. When `key` is null, `context` must have been set up by _newPreparedAesCcmContext()
+// for decryption, and the nonce and tag lengths must match kAES_CCM128_Nonce_Length and kAES_CCM128_Tag_Length.
+// Otherwise `context` must be a freshly allocated context.
+static CHIP_ERROR _aesCcmDecrypt(AesCcmContext * context, const Aes128KeyHandle * key, const uint8_t * ciphertext,
+                                 size_t ciphertext_length, const uint8_t * aad, size_t aad_length, const uint8_t * tag,
+                                 size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext)
 {
-#if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
-    const EVP_AEAD * aead  = nullptr;
-#else
-
-    EVP_CIPHER_CTX * context = nullptr;
-    int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
+#if !CHIP_CRYPTO_BORINGSSL
+    int bytesOutput = 0;
 #endif // CHIP_CRYPTO_BORINGSSL
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -334,28 +367,22 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
+    (void) key;
     result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
                                       aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    if (key != nullptr)
+    {
+        // Pass in cipher
+        result = EVP_DecryptInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length
+        VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
     // Pass in expected tag
     // Removing "const" from |tag| here should hopefully be safe as
@@ -365,9 +392,10 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                                               const_cast<void *>(static_cast<const void *>(tag)));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
+    // Pass in key (unless already prepared) + nonce
     static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, (key != nullptr) ? key->As<Symmetric128BitsKeyByteArray>() : nullptr,
+                                Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
@@ -397,18 +425,91 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    return error;
+}
+
+CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
+                           uint8_t * tag, size_t tag_length)
+{
+    AesCcmContext * context = _newAesCcmContext(key);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR error = _aesCcmEncrypt(context, &key, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext,
+                                      tag, tag_length);
+    _freeAesCcmContext(context);
+
+    return error;
+}
+
+CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                           const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
+                           size_t nonce_length, uint8_t * plaintext)
+{
+    AesCcmContext * context = _newAesCcmContext(key);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR error = _aesCcmDecrypt(context, &key, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce,
+                                      nonce_length, plaintext);
+    _freeAesCcmContext(context);
+
+    return error;
+}
+
+CHIP_ERROR AesCcm128PreparedKey::Prepare(const Aes128KeyHandle & key, Direction direction)
+{
+    Release();
+
+    AesCcmContext * context = _newPreparedAesCcmContext(key, direction == Direction::kEncrypt);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mBackendContext = context;
+    mKey            = &key;
+    mDirection      = direction;
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcm128PreparedKey::Release()
+{
+    if (mBackendContext != nullptr)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
+        _freeAesCcmContext(static_cast<AesCcmContext *>(mBackendContext));
+        mBackendContext = nullptr;
+    }
+    mKey = nullptr;
+}
 
-        context = nullptr;
+CHIP_ERROR AesCcm128PreparedKey::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                         const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                         size_t tag_length) const
+{
+    VerifyOrReturnError(mKey != nullptr && mDirection == Direction::kEncrypt, CHIP_ERROR_INCORRECT_STATE);
+
+    if (nonce_length != kAES_CCM128_Nonce_Length || tag_length != kAES_CCM128_Tag_Length)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
     }
 
-    return error;
+    return _aesCcmEncrypt(static_cast<AesCcmContext *>(mBackendContext), nullptr, plaintext, plaintext_length, aad, aad_length,
+                          nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR AesCcm128PreparedKey::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                                         size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * nonce,
+                                         size_t nonce_length, uint8_t * plaintext) const
+{
+    VerifyOrReturnError(mKey != nullptr && mDirection == Direction::kDecrypt, CHIP_ERROR_INCORRECT_STATE);
+
+    if (nonce_length != kAES_CCM128_Nonce_Length || tag_length != kAES_CCM128_Tag_Length)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    return _aesCcmDecrypt(static_cast<AesCcmContext *>(mBackendContext), nullptr, ciphertext, ciphertext_length, aad, aad_length,
+                          tag, tag_length, nonce, nonce_length, plaintext);
 }
 
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
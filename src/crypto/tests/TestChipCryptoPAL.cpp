@@ -43,6 +43,7 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
 
 #include <stdarg.h>
 #include <stdint.h>
@@ -616,6 +617,125 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptInvalidNonceLen)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128PreparedKeyTestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestsRan = 0;
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        uint8_t * out_ct_ptr = nullptr;
+        uint8_t * out_pt_ptr = nullptr;
+        // for a zero-length payload, the output buffer must be a nullptr (for OpenSSL)
+        if (vector->ct_len > 0)
+        {
+            out_ct.Alloc(vector->ct_len);
+            out_pt.Alloc(vector->pt_len);
+            ASSERT_TRUE(out_ct && out_pt);
+            out_ct_ptr = out_ct.Get();
+            out_pt_ptr = out_pt.Get();
+        }
+        uint8_t out_tag[kAES_CCM128_Tag_Length];
+        ASSERT_LE(vector->tag_len, sizeof(out_tag));
+
+        TestAesKey key(vector->key, vector->key_len);
+        AesCcm128PreparedKey encryptionKey;
+        AesCcm128PreparedKey decryptionKey;
+        EXPECT_FALSE(encryptionKey.IsPrepared());
+        ASSERT_EQ(encryptionKey.Prepare(key.key, AesCcm128PreparedKey::Direction::kEncrypt), CHIP_NO_ERROR);
+        ASSERT_EQ(decryptionKey.Prepare(key.key, AesCcm128PreparedKey::Direction::kDecrypt), CHIP_NO_ERROR);
+        EXPECT_TRUE(encryptionKey.IsPrepared());
+        numOfTestsRan++;
+
+        // Run each vector twice so that the second round exercises reuse of the prepared state,
+        // including after a failed authentication.
+        for (int round = 0; round < 2; round++)
+        {
+            CHIP_ERROR err = encryptionKey.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                                   vector->nonce_len, out_ct_ptr, out_tag, vector->tag_len);
+            EXPECT_EQ(err, vector->result);
+
+            err = decryptionKey.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                        vector->nonce, vector->nonce_len, out_pt_ptr);
+            EXPECT_EQ(err, vector->result);
+
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_EQ(memcmp(out_ct_ptr, vector->ct, vector->ct_len), 0);
+                EXPECT_EQ(memcmp(out_tag, vector->tag, vector->tag_len), 0);
+                EXPECT_EQ(memcmp(out_pt_ptr, vector->pt, vector->pt_len), 0);
+
+                // A corrupted tag must be rejected without affecting later operations.
+                out_tag[0] = static_cast<uint8_t>(vector->tag[0] ^ 0x01);
+                err = decryptionKey.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag, vector->tag_len,
+                                            vector->nonce, vector->nonce_len, out_pt_ptr);
+                EXPECT_NE(err, CHIP_NO_ERROR);
+            }
+        }
+
+        // A key can only be used in the direction it was prepared for.
+        EXPECT_EQ(decryptionKey.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                        out_ct_ptr, out_tag, vector->tag_len),
+                  CHIP_ERROR_INCORRECT_STATE);
+
+        encryptionKey.Release();
+        EXPECT_FALSE(encryptionKey.IsPrepared());
+        EXPECT_EQ(encryptionKey.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                        out_ct_ptr, out_tag, vector->tag_len),
+                  CHIP_ERROR_INCORRECT_STATE);
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+// Compares per-message AES-CCM throughput of the one-shot API and of a prepared key for typical
+// Matter message sizes. Only logs the results; correctness is covered by the test vectors above.
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128PreparedKeyThroughput)
+{
+    constexpr size_t kPayloadSizes[] = { 64, 256, 1024 };
+    constexpr int kIterations        = 2000;
+    constexpr size_t kNonceLength    = 13;
+
+    const ccm_128_test_vector * vector = ccm_128_test_vectors[0];
+    TestAesKey key(vector->key, vector->key_len);
+    AesCcm128PreparedKey preparedKey;
+    ASSERT_EQ(preparedKey.Prepare(key.key, AesCcm128PreparedKey::Direction::kEncrypt), CHIP_NO_ERROR);
+
+    uint8_t nonce[kNonceLength] = { 0 };
+    uint8_t aad[16]             = { 0 };
+    uint8_t tag[kAES_CCM128_Tag_Length];
+    uint8_t buffer[1024] = { 0 };
+
+    for (size_t payloadSize : kPayloadSizes)
+    {
+        ASSERT_LE(payloadSize, sizeof(buffer));
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (int i = 0; i < kIterations; i++)
+        {
+            nonce[0] = static_cast<uint8_t>(i);
+            CHIP_ERROR err =
+                AES_CCM_encrypt(buffer, payloadSize, aad, sizeof(aad), key.key, nonce, sizeof(nonce), buffer, tag, sizeof(tag));
+            ASSERT_EQ(err, CHIP_NO_ERROR);
+        }
+        System::Clock::Microseconds64 oneShot = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (int i = 0; i < kIterations; i++)
+        {
+            nonce[0] = static_cast<uint8_t>(i);
+            CHIP_ERROR err =
+                preparedKey.Encrypt(buffer, payloadSize, aad, sizeof(aad), nonce, sizeof(nonce), buffer, tag, sizeof(tag));
+            ASSERT_EQ(err, CHIP_NO_ERROR);
+        }
+        System::Clock::Microseconds64 prepared = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(Crypto, "AES-CCM %u byte payload: one-shot %u us, prepared key %u us for %d messages",
+                        static_cast<unsigned>(payloadSize), static_cast<unsigned>(oneShot.count()),
+                        static_cast<unsigned>(prepared.count()), kIterations);
+    }
+}
+
 TEST_F(TestChipCryptoPAL, TestSensitiveDataBuffer)
 {
     HeapChecker heapChecker;
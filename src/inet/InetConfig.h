@@ -213,6 +213,24 @@
 #define INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC      500
 #endif // INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC
 
+/**
+ *  @def INET_CONFIG_TCP_SEND_MAX_IOVECS
+ *
+ *  @brief
+ *    The maximum number of queued packet buffers that the
+ *    sockets implementation of the TCP endpoint hands to the
+ *    kernel in a single sendmsg() call.
+ *
+ *  @details
+ *    Buffers queued on the endpoint are gathered into an
+ *    I/O vector, so that a burst of messages costs one
+ *    system call rather than one per message. Setting this
+ *    to 1 sends each buffer on its own.
+ */
+#ifndef INET_CONFIG_TCP_SEND_MAX_IOVECS
+#define INET_CONFIG_TCP_SEND_MAX_IOVECS                    16
+#endif // INET_CONFIG_TCP_SEND_MAX_IOVECS
+
 /**
  *  @def INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC
  *
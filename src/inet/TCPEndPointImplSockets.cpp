@@ -41,6 +41,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -485,9 +486,40 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Gather the head of the send queue into a single call, so that a burst of queued messages is handed to the
+        // kernel at once rather than one buffer at a time.
+        struct iovec iov[INET_CONFIG_TCP_SEND_MAX_IOVECS];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+        bool moreQueued = false;
+        {
+            System::PacketBufferHandle buf = mSendQueue.Retain();
+            while (!buf.IsNull() && iovCount < MATTER_ARRAY_SIZE(iov))
+            {
+                iov[iovCount].iov_base = buf->Start();
+                iov[iovCount].iov_len  = buf->DataLength();
+                bufLen += buf->DataLength();
+                iovCount++;
+                buf = buf->Next();
+            }
+            moreQueued = !buf.IsNull();
+        }
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = iov;
+        msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovCount);
+
+        int flags = sendFlags;
+#ifdef MSG_MORE
+        if (moreQueued)
+        {
+            // Let the kernel coalesce the tail of this batch with the next one.
+            flags |= MSG_MORE;
+        }
+#endif
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &msg, flags);
 
         if (lenSentRaw == -1)
         {
@@ -509,21 +541,20 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Release the buffers that were fully sent, including empty ones, and trim the one that was partially sent.
+        mSendQueue.Consume(lenSent);
+        while (lenSent == bufLen && !mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.FreeHead();
         }
-        else
+
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
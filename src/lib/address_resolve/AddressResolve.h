@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/IntrusiveList.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -226,8 +227,13 @@ public:
     /// on the listener implementation this can end up destroying the handle
     /// and/or the listener.
     ///
+    /// If the results of the handle came from an address cache of the
+    /// implementation and none is left, the implementation may instead start
+    /// a new lookup using the same handle, as LookupNode would. The listener
+    /// is then called at a later time.
+    ///
     /// This method will return CHIP_NO_ERROR if and only if it has called
-    /// OnNodeAddressResolved.
+    /// OnNodeAddressResolved or started such a lookup.
     ///
     /// This method will return CHIP_ERROR_INCORRECT_STATE if the handle is
     /// still active.
@@ -247,6 +253,11 @@ public:
     /// a clear decision if the callback should or should not be invoked.
     virtual CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) = 0;
 
+    /// Provide a storage to persist resolved node addresses across restarts,
+    /// for implementations that cache them. Addresses are loaded from the
+    /// storage right away, and saved on Shutdown.
+    virtual CHIP_ERROR SetPersistentStorage(PersistentStorageDelegate * storage) { return CHIP_NO_ERROR; }
+
     /// Shut down any active resolves
     ///
     /// Will immediately fail any scheduled resolve calls and will refuse to register
@@ -18,6 +18,10 @@
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 
 #include <lib/address_resolve/TracingStructs.h>
+#include <lib/core/TLV.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <tracing/macros.h>
 #include <transport/raw/PeerAddress.h>
 
@@ -28,6 +32,146 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+// Persisted address cache
+constexpr TLV::Tag kSaveTimeTag = TLV::ContextTag(1);
+constexpr TLV::Tag kEntriesTag  = TLV::ContextTag(2);
+
+// Persisted address cache entry
+constexpr TLV::Tag kCompressedFabricIdTag  = TLV::ContextTag(1);
+constexpr TLV::Tag kNodeIdTag              = TLV::ContextTag(2);
+constexpr TLV::Tag kAddressTag             = TLV::ContextTag(3);
+constexpr TLV::Tag kPortTag                = TLV::ContextTag(4);
+constexpr TLV::Tag kTtlTag                 = TLV::ContextTag(5);
+constexpr TLV::Tag kAgeTag                 = TLV::ContextTag(6);
+constexpr TLV::Tag kMrpIdleIntervalTag     = TLV::ContextTag(7);
+constexpr TLV::Tag kMrpActiveIntervalTag   = TLV::ContextTag(8);
+constexpr TLV::Tag kMrpActiveThresholdTag  = TLV::ContextTag(9);
+constexpr TLV::Tag kSupportsTcpServerTag   = TLV::ContextTag(10);
+constexpr TLV::Tag kSupportsTcpClientTag   = TLV::ContextTag(11);
+constexpr TLV::Tag kIsICDOperatingAsLITTag = TLV::ContextTag(12);
+
+constexpr size_t kIPAddressSize = 16;
+
+constexpr size_t kPersistedEntrySize =
+    TLV::EstimateStructOverhead(sizeof(uint64_t), sizeof(NodeId), kIPAddressSize, sizeof(uint16_t), sizeof(uint32_t),
+                                sizeof(uint32_t), sizeof(uint32_t), sizeof(uint32_t), sizeof(uint16_t), sizeof(bool), sizeof(bool),
+                                sizeof(bool));
+
+size_t PersistedCacheSize(size_t entryCount)
+{
+    return TLV::EstimateStructOverhead(sizeof(uint32_t), TLV::EstimateStructOverhead(kPersistedEntrySize * entryCount));
+}
+
+CHIP_ERROR GetRealTimeSeconds(uint32_t & seconds)
+{
+    System::Clock::Microseconds64 realTime;
+    ReturnErrorOnFailure(System::SystemClock().GetClock_RealTime(realTime));
+    seconds = std::chrono::duration_cast<System::Clock::Seconds32>(realTime).count();
+    return CHIP_NO_ERROR;
+}
+
+/// Fills in everything but the IP address
+ResolveResult ResolveResultFromNodeData(const Dnssd::ResolvedNodeData & nodeData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    return result;
+}
+
+CHIP_ERROR WritePersistedEntry(TLV::TLVWriter & writer, const AddressCache::Entry & entry, System::Clock::Timestamp now)
+{
+    uint8_t address[kIPAddressSize];
+    uint8_t * p = address;
+    entry.result.address.GetIPAddress().WriteAddress(p);
+
+    const auto & mrpConfig = entry.result.mrpRemoteConfig;
+    const auto age         = std::chrono::duration_cast<System::Clock::Seconds32>(now - entry.refreshTime);
+
+    TLV::TLVType entryType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entryType));
+    ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, entry.peerId.GetCompressedFabricId()));
+    ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+    ReturnErrorOnFailure(writer.Put(kAddressTag, ByteSpan(address)));
+    ReturnErrorOnFailure(writer.Put(kPortTag, entry.result.address.GetPort()));
+    ReturnErrorOnFailure(writer.Put(kTtlTag, entry.ttl.count()));
+    ReturnErrorOnFailure(writer.Put(kAgeTag, age.count()));
+    ReturnErrorOnFailure(writer.Put(kMrpIdleIntervalTag, mrpConfig.mIdleRetransTimeout.count()));
+    ReturnErrorOnFailure(writer.Put(kMrpActiveIntervalTag, mrpConfig.mActiveRetransTimeout.count()));
+    ReturnErrorOnFailure(writer.Put(kMrpActiveThresholdTag, mrpConfig.mActiveThresholdTime.count()));
+    ReturnErrorOnFailure(writer.PutBoolean(kSupportsTcpServerTag, entry.result.supportsTcpServer));
+    ReturnErrorOnFailure(writer.PutBoolean(kSupportsTcpClientTag, entry.result.supportsTcpClient));
+    ReturnErrorOnFailure(writer.PutBoolean(kIsICDOperatingAsLITTag, entry.result.isICDOperatingAsLIT));
+    return writer.EndContainer(entryType);
+}
+
+CHIP_ERROR ReadPersistedEntry(TLV::TLVReader & reader, PeerId & peerId, ResolveResult & result, uint32_t & ttl, uint32_t & age)
+{
+    TLV::TLVType entryType;
+    ReturnErrorOnFailure(reader.EnterContainer(entryType));
+
+    CompressedFabricId compressedFabricId;
+    ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+    ReturnErrorOnFailure(reader.Get(compressedFabricId));
+
+    NodeId nodeId;
+    ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+    ReturnErrorOnFailure(reader.Get(nodeId));
+    peerId = PeerId(compressedFabricId, nodeId);
+
+    ByteSpan addressBytes;
+    ReturnErrorOnFailure(reader.Next(kAddressTag));
+    ReturnErrorOnFailure(reader.Get(addressBytes));
+    VerifyOrReturnError(addressBytes.size() == kIPAddressSize, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    Inet::IPAddress address;
+    const uint8_t * p = addressBytes.data();
+    Inet::IPAddress::ReadAddress(p, address);
+    result.address.SetIPAddress(address);
+
+    uint16_t port;
+    ReturnErrorOnFailure(reader.Next(kPortTag));
+    ReturnErrorOnFailure(reader.Get(port));
+    result.address.SetPort(port);
+
+    ReturnErrorOnFailure(reader.Next(kTtlTag));
+    ReturnErrorOnFailure(reader.Get(ttl));
+    ReturnErrorOnFailure(reader.Next(kAgeTag));
+    ReturnErrorOnFailure(reader.Get(age));
+
+    uint32_t idleInterval;
+    uint32_t activeInterval;
+    uint16_t activeThreshold;
+    ReturnErrorOnFailure(reader.Next(kMrpIdleIntervalTag));
+    ReturnErrorOnFailure(reader.Get(idleInterval));
+    ReturnErrorOnFailure(reader.Next(kMrpActiveIntervalTag));
+    ReturnErrorOnFailure(reader.Get(activeInterval));
+    ReturnErrorOnFailure(reader.Next(kMrpActiveThresholdTag));
+    ReturnErrorOnFailure(reader.Get(activeThreshold));
+    result.mrpRemoteConfig = ReliableMessageProtocolConfig(System::Clock::Milliseconds32(idleInterval),
+                                                           System::Clock::Milliseconds32(activeInterval),
+                                                           System::Clock::Milliseconds16(activeThreshold));
+
+    ReturnErrorOnFailure(reader.Next(kSupportsTcpServerTag));
+    ReturnErrorOnFailure(reader.Get(result.supportsTcpServer));
+    ReturnErrorOnFailure(reader.Next(kSupportsTcpClientTag));
+    ReturnErrorOnFailure(reader.Get(result.supportsTcpClient));
+    ReturnErrorOnFailure(reader.Next(kIsICDOperatingAsLITTag));
+    ReturnErrorOnFailure(reader.Get(result.isICDOperatingAsLIT));
+
+    return reader.ExitContainer(entryType);
+}
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -35,6 +179,13 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mServedFromCache  = false;
+}
+
+void NodeLookupHandle::LookupCachedResult(const ResolveResult & result)
+{
+    mServedFromCache = true;
+    LookupResult(result);
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -66,6 +217,12 @@ System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timesta
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mServedFromCache && HasLookupResult())
+    {
+        // Cached results are reported right away.
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -104,6 +261,12 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
+    // A cached result does not need more searching.
+    if (mServedFromCache && HasLookupResult())
+    {
+        return NodeLookupAction::Success(TakeLookupResult());
+    }
+
     // We are still within the minimal search time. Wait for more results.
     if (elapsed < mRequest.GetMinLookupTime())
     {
@@ -198,14 +361,217 @@ bool NodeLookupResults::UpdateResults(const ResolveResult & result, const Dnssd:
     return true;
 }
 
+AddressCache::Entry * AddressCache::Find(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool AddressCache::Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr && entry->IsFresh(now), false);
+
+    entry->useTime = now;
+    result         = entry->result;
+    return true;
+}
+
+void AddressCache::Insert(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl,
+                          System::Clock::Timestamp now)
+{
+    VerifyOrReturn(!Refresh(peerId, result, ttl, now));
+
+    Entry * slot = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (!entry.inUse)
+        {
+            slot = &entry;
+            break;
+        }
+        if (slot == nullptr || entry.useTime < slot->useTime)
+        {
+            slot = &entry;
+        }
+    }
+    VerifyOrReturn(slot != nullptr);
+
+    slot->inUse       = true;
+    slot->peerId      = peerId;
+    slot->result      = result;
+    slot->ttl         = ttl;
+    slot->refreshTime = now;
+    slot->useTime     = now;
+}
+
+bool AddressCache::Refresh(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl,
+                           System::Clock::Timestamp now)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    entry->result      = result;
+    entry->ttl         = ttl;
+    entry->refreshTime = now;
+    return true;
+}
+
+void AddressCache::Remove(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    if (entry != nullptr)
+    {
+        entry->inUse = false;
+    }
+}
+
+void AddressCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.inUse = false;
+    }
+}
+
+size_t AddressCache::Count() const
+{
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += entry.inUse ? 1 : 0;
+    }
+    return count;
+}
+
+CHIP_ERROR AddressCache::Save(PersistentStorageDelegate & storage, System::Clock::Timestamp now) const
+{
+    VerifyOrReturnError(!mEntries.empty(), CHIP_NO_ERROR);
+
+    const size_t bufferSize = PersistedCacheSize(mEntries.size());
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Calloc(bufferSize), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer.Get(), bufferSize);
+
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+
+    // Allows accounting for the time the node was down in the age of the entries, when real time is known.
+    uint32_t saveTime;
+    if (GetRealTimeSeconds(saveTime) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(writer.Put(kSaveTimeTag, saveTime));
+    }
+
+    TLV::TLVType entriesType;
+    ReturnErrorOnFailure(writer.StartContainer(kEntriesTag, TLV::kTLVType_Array, entriesType));
+    for (const auto & entry : mEntries)
+    {
+        if (!entry.inUse || entry.result.address.GetIPAddress().IsIPv6LinkLocal())
+        {
+            continue;
+        }
+        ReturnErrorOnFailure(WritePersistedEntry(writer, entry, now));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(entriesType));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+
+    const auto length = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(length), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return storage.SyncSetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName(), buffer.Get(),
+                                   static_cast<uint16_t>(length));
+}
+
+CHIP_ERROR AddressCache::Load(PersistentStorageDelegate & storage, System::Clock::Timestamp now)
+{
+    VerifyOrReturnError(!mEntries.empty(), CHIP_NO_ERROR);
+
+    const size_t bufferSize = std::min<size_t>(PersistedCacheSize(mEntries.size()), UINT16_MAX);
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Calloc(bufferSize), CHIP_ERROR_NO_MEMORY);
+
+    uint16_t length = static_cast<uint16_t>(bufferSize);
+    CHIP_ERROR err =
+        storage.SyncGetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName(), buffer.Get(), length);
+    VerifyOrReturnError(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer.Get(), length);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+    ReturnErrorOnFailure(reader.Next());
+
+    // Time elapsed since the cache was saved
+    uint64_t downtime = 0;
+    if (reader.GetTag() == kSaveTimeTag)
+    {
+        uint32_t saveTime;
+        uint32_t loadTime;
+        ReturnErrorOnFailure(reader.Get(saveTime));
+        if (GetRealTimeSeconds(loadTime) == CHIP_NO_ERROR && loadTime > saveTime)
+        {
+            downtime = loadTime - saveTime;
+        }
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    VerifyOrReturnError(reader.GetTag() == kEntriesTag && reader.GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    TLV::TLVType entriesType;
+    ReturnErrorOnFailure(reader.EnterContainer(entriesType));
+
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        PeerId peerId;
+        ResolveResult result;
+        uint32_t ttl;
+        uint32_t age;
+        ReturnErrorOnFailure(ReadPersistedEntry(reader, peerId, result, ttl, age));
+
+        if (age + downtime > CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE)
+        {
+            continue;
+        }
+        Insert(peerId, result, System::Clock::Seconds32(ttl), now);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(reader.ExitContainer(entriesType));
+    return reader.ExitContainer(outerType);
+}
+
 CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle)
 {
     MATTER_LOG_NODE_LOOKUP(&request);
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    handle.ResetForLookup(now, request);
     auto & peerId = request.GetPeerId();
+
+    ResolveResult cachedResult;
+    if (mAddressCache.Lookup(peerId, now, cachedResult))
+    {
+        // No DNSSD query needed: the result is still reported from the timer,
+        // so that the listener is never called from within LookupNode.
+        handle.LookupCachedResult(cachedResult);
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup for " ChipLogFormatPeerId " served from the address cache", ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -216,6 +582,17 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 CHIP_ERROR Resolver::TryNextResult(Impl::NodeLookupHandle & handle)
 {
     VerifyOrReturnError(!mActiveLookups.Contains(&handle), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!handle.HasLookupResult() && handle.IsServedFromCache())
+    {
+        // The cached address did not work out: forget it and look the node up on the network.
+        const NodeLookupRequest request = handle.GetRequest();
+        ChipLogProgress(Discovery, "Cached address of " ChipLogFormatPeerId " failed, falling back to a DNSSD lookup",
+                        ChipLogValuePeerId(request.GetPeerId()));
+        mAddressCache.Remove(request.GetPeerId());
+        return LookupNode(request, handle);
+    }
+
     VerifyOrReturnError(handle.HasLookupResult(), CHIP_ERROR_NOT_FOUND);
 
     auto listener = handle.GetListener();
@@ -232,7 +609,10 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    if (!handle.IsServedFromCache())
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    }
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -261,6 +641,16 @@ CHIP_ERROR Resolver::Init(System::Layer * systemLayer)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR Resolver::SetPersistentStorage(PersistentStorageDelegate * storage)
+{
+    mStorage = storage;
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(mAddressCache.Load(*mStorage, mTimeSource.GetMonotonicTimestamp()));
+    ChipLogProgress(Discovery, "Restored %u cached operational addresses", static_cast<unsigned>(mAddressCache.Count()));
+    return CHIP_NO_ERROR;
+}
+
 void Resolver::Shutdown()
 {
     // mSystemLayer is set in ::Init, so if it's null that means the resolver
@@ -289,12 +679,65 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    if (mStorage != nullptr)
+    {
+        LogErrorOnFailure(mAddressCache.Save(*mStorage, mTimeSource.GetMonotonicTimestamp()));
+        mStorage = nullptr;
+    }
+    mAddressCache.Clear();
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
+void Resolver::UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData)
+{
+    const PeerId & peerId = nodeData.operationalData.peerId;
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // The node is leaving the network, or changing its address
+        mAddressCache.Remove(peerId);
+        return;
+    }
+
+    NodeLookupResults results;
+    ResolveResult result = ResolveResultFromNodeData(nodeData);
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+        const Inet::IPAddress & address = nodeData.resolutionData.ipAddress[i];
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!address.IsIPv6())
+        {
+            continue;
+        }
+#endif
+        result.address.SetIPAddress(address);
+        results.UpdateResults(result, Dnssd::IPAddressSorter::ScoreIpAddress(address, nodeData.resolutionData.interfaceId));
+    }
+    VerifyOrReturn(results.HasValidResult());
+
+    const System::Clock::Seconds32 ttl(nodeData.operationalData.ttlSeconds.value_or(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL));
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+
+    for (auto & lookup : mActiveLookups)
+    {
+        if (lookup.GetRequest().GetPeerId() == peerId)
+        {
+            mAddressCache.Insert(peerId, results.ConsumeResult(), ttl, now);
+            return;
+        }
+    }
+
+    // Records seen for a node that is not being looked up, e.g. from an
+    // announcement or a query of another controller, only refresh the cache.
+    mAddressCache.Refresh(peerId, results.ConsumeResult(), ttl, now);
+}
+
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+    UpdateAddressCache(nodeData);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -305,18 +748,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
+        ResolveResult result = ResolveResultFromNodeData(nodeData);
 
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
@@ -348,11 +780,15 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     }
 
     // final result, handle either success or failure
-    const PeerId peerId     = current->GetRequest().GetPeerId();
-    NodeListener * listener = current->GetListener();
+    const PeerId peerId        = current->GetRequest().GetPeerId();
+    NodeListener * listener    = current->GetListener();
+    const bool servedFromCache = current->IsServedFromCache();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    if (!servedFromCache)
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -19,9 +19,12 @@
 #include <lib/address_resolve/AddressResolve.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
+#include <lib/support/Span.h>
 #include <system/TimeSource.h>
 #include <transport/raw/PeerAddress.h>
 
+#include <array>
+
 namespace chip {
 namespace AddressResolve {
 namespace Impl {
@@ -136,6 +139,13 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Use an address from the address cache as the result of the lookup,
+    /// which then completes without waiting for the min lookup time.
+    void LookupCachedResult(const ResolveResult & result);
+
+    /// Were the results of the lookup taken from the address cache?
+    bool IsServedFromCache() const { return mServedFromCache; }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +171,71 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mServedFromCache = false;
+};
+
+/// Keeps the last address resolved for operational nodes, keyed by PeerId.
+///
+/// An entry is fresh for the TTL of the operational records it was resolved
+/// from, and its TTL starts over every time the records of the node are seen
+/// again. Entries restored from persistent storage are given a new TTL, as
+/// the node was reachable at that address before the restart: callers are
+/// expected to fall back to a live lookup if it is not anymore.
+class AddressCache
+{
+public:
+    struct Entry
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Seconds32 ttl{ 0 };
+        System::Clock::Timestamp refreshTime; // last time the records of the node were seen
+        System::Clock::Timestamp useTime;     // last time the entry was used, for eviction
+        bool inUse = false;
+
+        bool IsFresh(System::Clock::Timestamp now) const { return now - refreshTime < ttl; }
+    };
+
+    AddressCache(Span<Entry> entries) : mEntries(entries) {}
+
+    /// Returns true and fills `result` if a fresh entry exists for the node.
+    bool Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result);
+
+    /// Caches the address of the node, evicting the least recently used entry
+    /// if the cache is full.
+    void Insert(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl,
+                System::Clock::Timestamp now);
+
+    /// Updates the entry of the node if it is cached. Returns false otherwise.
+    bool Refresh(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl,
+                 System::Clock::Timestamp now);
+
+    void Remove(const PeerId & peerId);
+    void Clear();
+    size_t Count() const;
+
+    /// Persist the cached addresses, except for link-local ones which are
+    /// only valid along with an interface.
+    CHIP_ERROR Save(PersistentStorageDelegate & storage, System::Clock::Timestamp now) const;
+
+    /// Restore the addresses persisted by Save, unless they were last seen
+    /// more than CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE ago.
+    CHIP_ERROR Load(PersistentStorageDelegate & storage, System::Clock::Timestamp now);
+
+private:
+    Entry * Find(const PeerId & peerId);
+
+    Span<Entry> mEntries;
+};
+
+template <size_t kEntryCount>
+class AddressCacheWithStorage : public AddressCache
+{
+public:
+    AddressCacheWithStorage() : AddressCache(Span<Entry>(mStorage.data(), mStorage.size())) {}
+
+private:
+    std::array<Entry, kEntryCount> mStorage;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -174,6 +249,7 @@ public:
     CHIP_ERROR LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
+    CHIP_ERROR SetPersistentStorage(PersistentStorageDelegate * storage) override;
     void Shutdown() override;
 
     // Dnssd::OperationalResolveDelegate
@@ -200,9 +276,15 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Caches the best address of a node that is being looked up, and
+    /// refreshes the cached address of other nodes seen on the network.
+    void UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData);
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+    AddressCacheWithStorage<CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE> mAddressCache;
+    PersistentStorageDelegate * mStorage = nullptr;
 };
 
 } // namespace Impl
@@ -19,7 +19,9 @@
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/dnssd/IPAddressSorter.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/StringBuilder.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <system/SystemLayerImpl.h>
 #include <transport/raw/PeerAddress.h>
 
@@ -544,6 +546,106 @@ TEST(TestAddressResolveDefaultImpl, TestGivesUpAfterMaxLookupTimeIsReachedWithou
     System::Clock::Internal::SetSystemClockForTesting(realClock);
 }
 
+TEST(TestAddressResolveDefaultImpl, TestAddressCacheHonoursTtl)
+{
+    Impl::AddressCacheWithStorage<2> cache;
+
+    ResolveResult result;
+    result.address = GetAddressWithMediumScore();
+
+    ResolveResult cachedResult;
+    auto now = System::Clock::Timestamp(1000);
+
+    // Records seen for nodes that are not cached do not add them
+    EXPECT_FALSE(cache.Refresh(chip::PeerId(1, 2), result, System::Clock::Seconds32(120), now));
+    EXPECT_FALSE(cache.Lookup(chip::PeerId(1, 2), now, cachedResult));
+
+    cache.Insert(chip::PeerId(1, 2), result, System::Clock::Seconds32(120), now);
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 2), now + 119_s, cachedResult));
+    EXPECT_EQ(cachedResult.address, GetAddressWithMediumScore());
+    EXPECT_FALSE(cache.Lookup(chip::PeerId(1, 2), now + 120_s, cachedResult));
+
+    // Seeing the records again starts the TTL over
+    result.address = GetAddressWithLowScore();
+    EXPECT_TRUE(cache.Refresh(chip::PeerId(1, 2), result, System::Clock::Seconds32(120), now + 100_s));
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 2), now + 200_s, cachedResult));
+    EXPECT_EQ(cachedResult.address, GetAddressWithLowScore());
+
+    cache.Remove(chip::PeerId(1, 2));
+    EXPECT_FALSE(cache.Lookup(chip::PeerId(1, 2), now + 200_s, cachedResult));
+    EXPECT_EQ(cache.Count(), 0u);
+}
+
+TEST(TestAddressResolveDefaultImpl, TestAddressCacheEvictsLeastRecentlyUsed)
+{
+    Impl::AddressCacheWithStorage<2> cache;
+
+    ResolveResult result;
+    result.address = GetAddressWithMediumScore();
+
+    ResolveResult cachedResult;
+    auto now = System::Clock::Timestamp(1000);
+
+    cache.Insert(chip::PeerId(1, 2), result, System::Clock::Seconds32(120), now);
+    cache.Insert(chip::PeerId(1, 3), result, System::Clock::Seconds32(120), now + 1_s);
+
+    // Using the first entry makes the second one the least recently used
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 2), now + 2_s, cachedResult));
+
+    cache.Insert(chip::PeerId(1, 4), result, System::Clock::Seconds32(120), now + 3_s);
+    EXPECT_EQ(cache.Count(), 2u);
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 2), now + 4_s, cachedResult));
+    EXPECT_FALSE(cache.Lookup(chip::PeerId(1, 3), now + 4_s, cachedResult));
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 4), now + 4_s, cachedResult));
+}
+
+TEST(TestAddressResolveDefaultImpl, TestAddressCachePersistence)
+{
+    ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+
+    chip::TestPersistentStorageDelegate storage;
+    auto now = System::Clock::Timestamp(1000);
+
+    {
+        Impl::AddressCacheWithStorage<4> cache;
+        auto saveTime = now + System::Clock::Seconds32(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE) + 1_s;
+
+        // Too old to be restored once saved
+        ResolveResult result;
+        result.address = GetAddressWithLowScore();
+        cache.Insert(chip::PeerId(1, 4), result, System::Clock::Seconds32(120), now);
+
+        result.address           = GetAddressWithMediumScore(5541);
+        result.mrpRemoteConfig   = ReliableMessageProtocolConfig(500_ms32, 300_ms32, 4000_ms16);
+        result.supportsTcpServer = true;
+        cache.Insert(chip::PeerId(1, 2), result, System::Clock::Seconds32(120), saveTime - 1_s);
+
+        // Link-local addresses are not valid without their interface
+        result.address = GetAddressWithHighScore();
+        cache.Insert(chip::PeerId(1, 3), result, System::Clock::Seconds32(120), saveTime - 1_s);
+
+        EXPECT_EQ(cache.Count(), 3u);
+        EXPECT_EQ(cache.Save(storage, saveTime), CHIP_NO_ERROR);
+    }
+
+    Impl::AddressCacheWithStorage<4> cache;
+    EXPECT_EQ(cache.Load(storage, now), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    // Restored entries get a new TTL
+    ResolveResult result;
+    EXPECT_TRUE(cache.Lookup(chip::PeerId(1, 2), now + 119_s, result));
+    EXPECT_FALSE(cache.Lookup(chip::PeerId(1, 2), now + 120_s, result));
+    EXPECT_EQ(result.address, GetAddressWithMediumScore(5541));
+    EXPECT_EQ(result.mrpRemoteConfig.mIdleRetransTimeout, 500_ms32);
+    EXPECT_EQ(result.mrpRemoteConfig.mActiveRetransTimeout, 300_ms32);
+    EXPECT_EQ(result.mrpRemoteConfig.mActiveThresholdTime, 4000_ms16);
+    EXPECT_TRUE(result.supportsTcpServer);
+    EXPECT_FALSE(result.supportsTcpClient);
+
+    chip::Platform::MemoryShutdown();
+}
+
 class MockResolver : public chip::Dnssd::Resolver
 {
 public:
@@ -573,6 +675,9 @@ public:
 class TestAddressResolveDefaultImplWithSystemLayer : public ::testing::Test
 {
 public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
     void SetUp() { mSystemLayer.Init(); }
 
     void TearDown() { mSystemLayer.Shutdown(); }
@@ -904,4 +1009,132 @@ TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, ResolverShut
     System::Clock::Internal::SetSystemClockForTesting(realClock);
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, LookupIsServedFromCacheAndFallsBackToDnssd)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+
+    // Capture the resolver timer, to fire it from the test
+    System::TimerCompleteCallback timerCallback = nullptr;
+    void * timerContext                         = nullptr;
+    mSystemLayer.mStartTimerCallback = [&](System::Clock::Timeout, System::TimerCompleteCallback callback, void * context) {
+        timerCallback = callback;
+        timerContext  = context;
+        return CHIP_NO_ERROR;
+    };
+
+    int resolvedCount = 0;
+    chip::AddressResolve::ResolveResult resolvedResult;
+    mNodeListener.SetOnNodeAddressResolved([&](const chip::PeerId &, const chip::AddressResolve::ResolveResult & result) {
+        resolvedCount++;
+        resolvedResult = result;
+    });
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(100_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    Dnssd::ResolvedNodeData resolvedData;
+    resolvedData.resolutionData.numIPs       = 1;
+    resolvedData.resolutionData.ipAddress[0] = GetAddressWithMediumScore().GetIPAddress();
+    resolvedData.resolutionData.port         = CHIP_PORT;
+    resolvedData.operationalData.peerId      = request.GetPeerId();
+    resolvedData.operationalData.ttlSeconds  = 120;
+
+    // Records of a node that is not being looked up are not cached
+    resolver.OnOperationalNodeResolved(resolvedData);
+
+    AddressResolve::NodeLookupHandle handle;
+    handle.SetListener(&mNodeListener);
+    EXPECT_EQ(resolver.LookupNode(request, handle), CHIP_NO_ERROR);
+    EXPECT_FALSE(handle.IsServedFromCache());
+
+    clock.AdvanceMonotonic(150_ms64);
+    resolver.OnOperationalNodeResolved(resolvedData);
+    EXPECT_EQ(resolvedCount, 1);
+    EXPECT_FALSE(handle.IsActive());
+
+    // The next lookup needs no DNSSD query, and completes without waiting for the min lookup time
+    mockResolver.ResolveNodeIdStatus = CHIP_ERROR_INTERNAL;
+    EXPECT_EQ(resolver.LookupNode(request, handle), CHIP_NO_ERROR);
+    EXPECT_TRUE(handle.IsServedFromCache());
+    EXPECT_EQ(resolvedCount, 1);
+    ASSERT_NE(timerCallback, nullptr);
+    timerCallback(&mSystemLayer, timerContext);
+    EXPECT_EQ(resolvedCount, 2);
+    EXPECT_EQ(resolvedResult.address, GetAddressWithMediumScore());
+
+    // A failed cached address falls back to a DNSSD lookup on the same handle
+    mockResolver.ResolveNodeIdStatus = CHIP_NO_ERROR;
+    EXPECT_EQ(resolver.TryNextResult(handle), CHIP_NO_ERROR);
+    EXPECT_TRUE(handle.IsActive());
+    EXPECT_FALSE(handle.IsServedFromCache());
+    EXPECT_EQ(resolvedCount, 2);
+
+    clock.AdvanceMonotonic(150_ms64);
+    resolver.OnOperationalNodeResolved(resolvedData);
+    EXPECT_EQ(resolvedCount, 3);
+
+    // Goodbye packets drop the cached address
+
+    resolvedData.operationalData.hasZeroTTL = true;
+    resolver.OnOperationalNodeResolved(resolvedData);
+    EXPECT_EQ(resolver.LookupNode(request, handle), CHIP_NO_ERROR);
+    EXPECT_FALSE(handle.IsServedFromCache());
+    resolver.CancelLookup(handle, Resolver::FailureCallback::Skip);
+
+    resolver.Shutdown();
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, CachedAddressesArePersistedOnShutdown)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+    chip::TestPersistentStorageDelegate storage;
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(0_ms32);
+
+    Dnssd::ResolvedNodeData resolvedData;
+    resolvedData.resolutionData.numIPs       = 1;
+    resolvedData.resolutionData.ipAddress[0] = GetAddressWithMediumScore().GetIPAddress();
+    resolvedData.resolutionData.port         = CHIP_PORT;
+    resolvedData.operationalData.peerId      = request.GetPeerId();
+
+    AddressResolve::NodeLookupHandle handle;
+    handle.SetListener(&mNodeListener);
+
+    {
+        chip::AddressResolve::Impl::Resolver resolver;
+        ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+        EXPECT_EQ(resolver.SetPersistentStorage(&storage), CHIP_NO_ERROR);
+
+        EXPECT_EQ(resolver.LookupNode(request, handle), CHIP_NO_ERROR);
+        resolver.OnOperationalNodeResolved(resolvedData);
+        EXPECT_FALSE(handle.IsActive());
+
+        resolver.Shutdown();
+    }
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+    EXPECT_EQ(resolver.SetPersistentStorage(&storage), CHIP_NO_ERROR);
+
+    mockResolver.ResolveNodeIdStatus = CHIP_ERROR_INTERNAL;
+    EXPECT_EQ(resolver.LookupNode(request, handle), CHIP_NO_ERROR);
+    EXPECT_TRUE(handle.IsServedFromCache());
+
+    resolver.Shutdown();
+}
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 } // namespace
@@ -287,6 +287,19 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+ *
+ *  @brief
+ *    Number of buckets of the index used by the exchange manager to find
+ *    the exchange an incoming message belongs to.  Each bucket costs one
+ *    pointer.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
+#endif // CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+
 /**
  *  @def CHIP_CONFIG_MCSP_RECEIVE_TABLE_SIZE
  *
@@ -792,6 +805,43 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+ *
+ *  @brief
+ *    Default value of FabricTable::InitParams::lazyCertificateLoading.  When
+ *    enabled, FabricTable::Init() restores the node ID, fabric ID, compressed
+ *    fabric ID and root public key of each fabric from a compact summary record
+ *    instead of reading and parsing its NOC and RCAC.  The certificates are only
+ *    read from the OperationalCertificateStore when they are actually used.
+ *
+ *    The summary record is written along with the fabric metadata while this is
+ *    enabled, and removed when the metadata is stored while it is disabled.
+ *    Fabrics without one (e.g. committed by older firmware) are loaded from their
+ *    certificates and get one on that boot.
+ *
+ *    Firmware that predates the summary record does not remove it, so a product
+ *    that may be rolled back to such firmware and then upgraded again should
+ *    leave this disabled: a NOC updated while rolled back would otherwise be
+ *    shadowed by a stale summary.
+ */
+#ifndef CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+#define CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING 0
+#endif // CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of entries in a Credentials::VerifiedCertificateCache.  Each entry
+ *    remembers one successfully verified (certificate, signer) signature, such
+ *    as an ICAC signed by a fabric's RCAC, so that it does not need to be
+ *    ECDSA-verified again on every CASE handshake.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE 8
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -949,6 +999,78 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
+ *
+ * @brief Enables a per-ReadHandler cache of pre-encoded list items.
+ *
+ * When a list attribute does not fit in a single ReportData message, the items that did not fit are encoded into the cache
+ * until it is full, and the following chunks are copied from it instead of iterating and re-encoding the list from its start.
+ * Once the cached items are sent, the cache is filled again from the next item. This divides the work of chunking a list by
+ * the number of chunks the cache holds, at the cost of CHIP_CONFIG_LIST_ENCODE_CACHE_BUFFER_SIZE bytes of RAM per ReadHandler.
+ * Lists that fit in a single message are not cached.
+ */
+#ifndef CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE
+#define CHIP_CONFIG_ENABLE_LIST_ENCODE_CACHE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_LIST_ENCODE_CACHE_BUFFER_SIZE
+ *
+ * @brief Size, in bytes, of the pre-encoded list item cache of each ReadHandler.
+ */
+#ifndef CHIP_CONFIG_LIST_ENCODE_CACHE_BUFFER_SIZE
+#define CHIP_CONFIG_LIST_ENCODE_CACHE_BUFFER_SIZE 2048
+#endif
+
+/**
+ * @def CHIP_CONFIG_LIST_ENCODE_CACHE_MAX_ITEMS
+ *
+ * @brief Maximum number of list items the pre-encoded list item cache of each ReadHandler can hold.
+ */
+#ifndef CHIP_CONFIG_LIST_ENCODE_CACHE_MAX_ITEMS
+#define CHIP_CONFIG_LIST_ENCODE_CACHE_MAX_ITEMS 128
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+ *
+ * @brief Enables chunk planning when the reporting engine splits a report into several ReportData messages.
+ *
+ * When enabled:
+ *   - a chunk is ended without reading the next non-list attribute when not even the smallest report of its path fits in
+ *     the space left, instead of reading and encoding the attribute only to roll it back;
+ *   - the packet buffer of a chunk is kept by its ReadHandler and reused for the next chunk once the messaging layer has
+ *     released it, instead of allocating a new one for every chunk.
+ *
+ * The reports and their chunks are the same as without planning. Each ReadHandler holds one packet buffer while it is
+ * sending a chunked report.
+ *
+ * Set with the chip_im_report_chunk_planning GN argument.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING
+#define CHIP_CONFIG_IM_REPORT_CHUNK_PLANNING 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+ *
+ * @brief Enables encoding the reports of several ReadHandlers in parallel.
+ *
+ * When enabled, and when both a reporting::EncodingWorkerPool has been given to the reporting engine and the data model
+ * provider declares SupportsConcurrentReads(), the attribute data of the ReadHandlers that are reportable in the same engine
+ * run is encoded on the worker pool while the Matter thread waits for it. Buffer allocation, event data, sending and exchange
+ * management stay on the Matter thread.
+ *
+ * Access control checks and DataModelCallbacks for attribute reads are then made from the worker threads, one at a time: the
+ * engine serializes them with a System::Mutex.
+ *
+ * Can be enabled with the GN argument chip_im_parallel_report_encoding.
+ */
+#ifndef CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING
+#define CHIP_CONFIG_IM_PARALLEL_REPORT_ENCODING 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -1097,6 +1219,41 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE
+ *
+ * @brief Maximum number of peers for which CASESessionManager keeps a CASE session established ahead of use
+ *        (see CASESessionManager::AddWarmPeer). A value of 0 leaves the warm pool out of the build.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE
+#if CHIP_CONFIG_TEST
+#define CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE 4
+#else
+#define CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE 0
+#endif // CHIP_CONFIG_TEST
+#endif // CHIP_CONFIG_CASE_SESSION_WARM_POOL_SIZE
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief Maximum number of CASE handshakes run at the same time by the warm pool, so that re-establishing the
+ *        sessions of many peers, e.g. after a network outage, does not use up the CASE clients needed by other
+ *        interactions.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SESSION_WARM_POOL_MAX_CONCURRENT_HANDSHAKES 2
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS
+ *
+ * @brief Time, in milliseconds, after which the warm pool tries again to establish a session with a peer after a
+ *        failed attempt, or after a session that was released less than this time after it was established.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS
+#define CHIP_CONFIG_CASE_SESSION_WARM_POOL_RETRY_INTERVAL_MS 30000
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES
  *
@@ -1172,6 +1329,37 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE
+ *
+ * @brief Defines the number of groups for which the Interaction Model keeps the
+ *        member endpoints, and which of them implement the addressed clusters,
+ *        so that group commands and writes do not walk the group table on every
+ *        message. See app::GroupEndpointCache.
+ */
+#ifndef CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE 4
+#endif
+
+#if CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE < 1
+#error "Please ensure CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE > 0."
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS
+ *
+ * @brief Defines the maximum number of endpoints of a group held by an entry of
+ *        the group endpoint cache. Groups with more endpoints are not cached and
+ *        are read from the group table on every message. Must be at most 32.
+ */
+#ifndef CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS
+#define CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS 16
+#endif
+
+#if CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS < 1 || CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS > 32
+#error "Please ensure 0 < CHIP_CONFIG_GROUP_ENDPOINT_CACHE_MAX_ENDPOINTS <= 32."
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1481,6 +1669,38 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of operational node addresses kept by the default address
+ *        resolver, so that connecting again to a node does not require a new
+ *        DNSSD lookup while its records are still valid. A value of 0
+ *        disables the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL
+ *
+ * @brief Time for which a cached node address is used, in seconds, when the
+ *        DNSSD backend does not report the TTL of the operational records.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL 120
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE
+ *
+ * @brief Maximum time since a node address was last seen, in seconds, for it
+ *        to be restored from persistent storage into the address cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE (24 * 60 * 60)
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_RESTORE_AGE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1649,6 +1869,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #endif // CHIP_CONFIG_TEST
 #endif // CHIP_CONFIG_MAX_SCENES_TABLE_SIZE
 
+/**
+ * @def CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE
+ *
+ * @brief Defines how many scene positions the default scene table remembers across all endpoints and fabrics. A remembered
+ * scene is loaded with a single storage read, instead of first loading the scene map of its fabric. The least recently used
+ * position is evicted first. The table always remembers at least one position per Scenes cluster endpoint, static or dynamic,
+ * so that recalling a scene on every endpoint of a group keeps hitting the cache.
+ */
+#ifndef CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE
+#define CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE 16
+#endif // CHIP_CONFIG_SCENES_INDEX_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
  *
@@ -1828,6 +2060,42 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_COALESCED_REPORTS_ENABLED
+ *
+ * @brief Controls whether the server uses the coalescing report scheduler instead of the default one.
+ *
+ * The coalescing report scheduler drives all subscriptions from a single timer and emits the reports that are due within the
+ * same coalescing window in a single engine run. It is intended for devices serving many subscriptions, such as bridges.
+ */
+#ifndef CHIP_CONFIG_COALESCED_REPORTS_ENABLED
+#define CHIP_CONFIG_COALESCED_REPORTS_ENABLED 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_REPORT_SCHEDULER_COALESCING_WINDOW_MS
+ *
+ * @brief Width, in milliseconds, of a slot of the coalescing report scheduler timing wheel.
+ *
+ * Reports due within this window of an engine run are emitted in that run. Reports are never emitted before their min interval,
+ * but may be emitted up to one window before their max interval.
+ */
+#ifndef CHIP_CONFIG_REPORT_SCHEDULER_COALESCING_WINDOW_MS
+#define CHIP_CONFIG_REPORT_SCHEDULER_COALESCING_WINDOW_MS 1000
+#endif
+
+/**
+ * @def CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS
+ *
+ * @brief Number of slots in the coalescing report scheduler timing wheel.
+ *
+ * Deadlines further away than CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS * CHIP_CONFIG_REPORT_SCHEDULER_COALESCING_WINDOW_MS
+ * share slots with nearer ones and cause an extra wakeup per revolution of the wheel.
+ */
+#ifndef CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS
+#define CHIP_CONFIG_REPORT_SCHEDULER_WHEEL_SLOTS 64
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
@@ -1839,6 +2107,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW
+ *
+ * @brief Defines how many of the next Check-In counters of each registered ICD the default ICD client storage precomputes
+ *        the message nonce for
+ *
+ * A received Check-In message whose nonce matches one of these is decrypted with the keys of that ICD only. Messages from
+ * an ICD that has sent more Check-In messages than this since the last one that was processed fall back to trying the keys
+ * of every registered ICD.
+ */
+#ifndef CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW
+#define CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW 8
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_THREAD_NETWORK_DIRECTORY_STORAGE_CAPACITY
  *
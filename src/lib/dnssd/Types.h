@@ -209,8 +209,15 @@ struct CommonResolutionData
 struct OperationalNodeData
 {
     PeerId peerId;
-    bool hasZeroTTL;
-    void Reset() { peerId = PeerId(); }
+    bool hasZeroTTL = false;
+    // TTL of the SRV record, when known to the resolver backend.
+    std::optional<uint32_t> ttlSeconds;
+    void Reset()
+    {
+        peerId     = PeerId();
+        hasZeroTTL = false;
+        ttlSeconds.reset();
+    }
 };
 
 struct OperationalNodeBrowseData : public OperationalNodeData
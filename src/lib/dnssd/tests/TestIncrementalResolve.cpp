@@ -307,6 +307,7 @@ TEST(TestIncrementalResolve, TestParseOperational)
     EXPECT_EQ(nodeData.operationalData.peerId,
               PeerId().SetCompressedFabricId(0x1234567898765432LL).SetNodeId(0xABCDEFEDCBAABCDELL));
     EXPECT_FALSE(nodeData.operationalData.hasZeroTTL);
+    EXPECT_EQ(nodeData.operationalData.ttlSeconds, std::make_optional<uint32_t>(1));
     EXPECT_EQ(nodeData.resolutionData.numIPs, 1u);
     EXPECT_EQ(nodeData.resolutionData.port, 0x1234);
     EXPECT_FALSE(nodeData.resolutionData.supportsTcpServer);
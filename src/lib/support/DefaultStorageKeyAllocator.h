@@ -106,6 +106,7 @@ public:
     }
     static StorageKeyName FabricMetadata(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/m", fabric); }
     static StorageKeyName FabricOpKey(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/o", fabric); }
+    static StorageKeyName FabricSummary(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/fs", fabric); }
 
     // Fail-safe handling
     static StorageKeyName FabricTableCommitMarkerKey() { return StorageKeyName::FromConst("g/fs/c"); }
@@ -114,6 +115,9 @@ public:
     // LastKnownGoodTime
     static StorageKeyName LastKnownGoodTimeKey() { return StorageKeyName::FromConst("g/lkgt"); }
 
+    // Operational address cache
+    static StorageKeyName OperationalAddressCache() { return StorageKeyName::FromConst("g/oac"); }
+
     // Session resumption
     static StorageKeyName FabricSession(FabricIndex fabric, NodeId nodeId)
     {
@@ -224,6 +228,7 @@ public:
         return StorageKeyName::Formatted("g/su/%x", static_cast<unsigned>(index));
     }
     static StorageKeyName SubscriptionResumptionMaxCount() { return StorageKeyName::Formatted("g/sum"); }
+    static StorageKeyName SubscriptionResumptionIndex() { return StorageKeyName::FromConst("g/sui"); }
 
     // Number of scenes stored in a given endpoint's scene table, across all fabrics.
     static StorageKeyName EndpointSceneCountKey(EndpointId endpoint) { return StorageKeyName::Formatted("g/scc/e/%x", endpoint); }
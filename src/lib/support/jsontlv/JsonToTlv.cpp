@@ -16,9 +16,13 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <algorithm>
 #include <charconv>
+#include <cmath>
+#include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -396,6 +400,1010 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Streaming conversion
+ *
+ * The functions below accept the same documents and produce the same TLV as JsonToTlv(), but work directly on the
+ * JSON text instead of first building a Json::Value document. The accepted syntax is the one of Json::Reader: comments
+ * are allowed and any content after the root value is ignored.
+ */
+
+// Data model payloads are only a few levels deep; the limit keeps the recursion bounded on malformed input.
+constexpr size_t kStreamingMaxNestingDepth = 64;
+
+enum class JsonTokenType : uint8_t
+{
+    kObjectBegin,
+    kObjectEnd,
+    kArrayBegin,
+    kArrayEnd,
+    kString,
+    kNumber,
+    kTrue,
+    kFalse,
+    kNull,
+    kArraySeparator,
+    kMemberSeparator,
+    kComment,
+    kEndOfStream,
+    kError,
+};
+
+struct JsonToken
+{
+    JsonTokenType type = JsonTokenType::kError;
+    const char * start = nullptr;
+    const char * end   = nullptr;
+};
+
+/*
+ * A JSON number, kept in the representation Json::Reader would have chosen for it, with the conversion rules of
+ * Json::Value.
+ */
+struct JsonNumber
+{
+    enum class Type : uint8_t
+    {
+        kInt,
+        kUInt,
+        kReal,
+    };
+
+    Type type          = Type::kInt;
+    int64_t intValue   = 0;
+    uint64_t uintValue = 0;
+    double realValue   = 0;
+
+    static bool IsIntegral(double value)
+    {
+        double integralPart;
+        return modf(value, &integralPart) == 0.0;
+    }
+
+    bool IsUInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return intValue >= 0;
+        case Type::kUInt:
+            return true;
+        default:
+            return realValue >= 0 && realValue < 18446744073709551615.0 && IsIntegral(realValue);
+        }
+    }
+
+    bool IsInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return true;
+        case Type::kUInt:
+            return uintValue <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        default:
+            return realValue >= static_cast<double>(std::numeric_limits<int64_t>::min()) &&
+                realValue < static_cast<double>(std::numeric_limits<int64_t>::max()) && IsIntegral(realValue);
+        }
+    }
+
+    // Only valid when IsUInt64() is true.
+    uint64_t AsUInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<uint64_t>(intValue);
+        case Type::kUInt:
+            return uintValue;
+        default:
+            return static_cast<uint64_t>(realValue);
+        }
+    }
+
+    // Only valid when IsInt64() is true.
+    int64_t AsInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return intValue;
+        case Type::kUInt:
+            return static_cast<int64_t>(uintValue);
+        default:
+            return static_cast<int64_t>(realValue);
+        }
+    }
+
+    double AsDouble() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<double>(intValue);
+        case Type::kUInt:
+            return static_cast<double>(uintValue);
+        default:
+            return realValue;
+        }
+    }
+
+    float AsFloat() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<float>(intValue);
+        case Type::kUInt:
+            return static_cast<float>(uintValue);
+        default:
+            return static_cast<float>(realValue);
+        }
+    }
+};
+
+bool DecodeJsonNumber(const JsonToken & token, JsonNumber & number)
+{
+    const char * current = token.start;
+    bool isNegative      = (*current == '-');
+    if (isNegative)
+    {
+        ++current;
+    }
+
+    uint64_t maxIntegerValue =
+        isNegative ? static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1 : std::numeric_limits<uint64_t>::max();
+    uint64_t threshold = maxIntegerValue / 10;
+    uint64_t value     = 0;
+    bool isIntegral    = true;
+
+    while (current < token.end)
+    {
+        char c = *current++;
+        if (c < '0' || c > '9')
+        {
+            isIntegral = false;
+            break;
+        }
+
+        auto digit = static_cast<uint64_t>(c - '0');
+        if (value >= threshold)
+        {
+            // Values that do not fit a 64-bit integer are decoded as a double.
+            if (value > threshold || current != token.end || digit > maxIntegerValue % 10)
+            {
+                isIntegral = false;
+                break;
+            }
+        }
+        value = value * 10 + digit;
+    }
+
+    if (isIntegral)
+    {
+        if (isNegative && value == maxIntegerValue)
+        {
+            number.type     = JsonNumber::Type::kInt;
+            number.intValue = std::numeric_limits<int64_t>::min();
+        }
+        else if (isNegative)
+        {
+            number.type     = JsonNumber::Type::kInt;
+            number.intValue = -static_cast<int64_t>(value);
+        }
+        else if (value <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+        {
+            number.type     = JsonNumber::Type::kInt;
+            number.intValue = static_cast<int64_t>(value);
+        }
+        else
+        {
+            number.type      = JsonNumber::Type::kUInt;
+            number.uintValue = value;
+        }
+        return true;
+    }
+
+    // strtod() needs a null-terminated string. Numbers are usually short enough to be copied on the stack.
+    char shortBuffer[64];
+    std::string longBuffer;
+    const char * buffer = shortBuffer;
+    size_t length       = static_cast<size_t>(token.end - token.start);
+    if (length < sizeof(shortBuffer))
+    {
+        memcpy(shortBuffer, token.start, length);
+        shortBuffer[length] = '\0';
+    }
+    else
+    {
+        longBuffer.assign(token.start, token.end);
+        buffer = longBuffer.c_str();
+    }
+
+    char * parseEnd = nullptr;
+    double real     = strtod(buffer, &parseEnd);
+    VerifyOrReturnValue(parseEnd == buffer + length, false);
+    VerifyOrReturnValue(!std::isinf(real), false);
+
+    number.type      = JsonNumber::Type::kReal;
+    number.realValue = real;
+    return true;
+}
+
+bool DecodeHexQuad(const char *& current, const char * end, uint32_t & value)
+{
+    VerifyOrReturnValue(end - current >= 4, false);
+
+    value = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char c = *current++;
+        value <<= 4;
+        if (c >= '0' && c <= '9')
+        {
+            value += static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            value += static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            value += static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AppendUtf8(std::string & out, uint32_t codepoint)
+{
+    if (codepoint <= 0x7F)
+    {
+        out += static_cast<char>(codepoint);
+    }
+    else if (codepoint <= 0x7FF)
+    {
+        out += static_cast<char>(0xC0 | (0x1F & (codepoint >> 6)));
+        out += static_cast<char>(0x80 | (0x3F & codepoint));
+    }
+    else if (codepoint <= 0xFFFF)
+    {
+        out += static_cast<char>(0xE0 | (0xF & (codepoint >> 12)));
+        out += static_cast<char>(0x80 | (0x3F & (codepoint >> 6)));
+        out += static_cast<char>(0x80 | (0x3F & codepoint));
+    }
+    else if (codepoint <= 0x10FFFF)
+    {
+        out += static_cast<char>(0xF0 | (0x7 & (codepoint >> 18)));
+        out += static_cast<char>(0x80 | (0x3F & (codepoint >> 12)));
+        out += static_cast<char>(0x80 | (0x3F & (codepoint >> 6)));
+        out += static_cast<char>(0x80 | (0x3F & codepoint));
+    }
+}
+
+/*
+ * Decodes the escape sequences of a string token. When `decoded` is null the string is only validated.
+ */
+bool DecodeJsonString(const JsonToken & token, std::string * decoded)
+{
+    const char * current = token.start + 1; // Skip the opening quote
+    const char * end     = token.end - 1;   // Do not include the closing quote
+
+    while (current != end)
+    {
+        char c = *current++;
+        if (c != '\\')
+        {
+            if (decoded != nullptr)
+            {
+                *decoded += c;
+            }
+            continue;
+        }
+
+        VerifyOrReturnValue(current != end, false);
+        char escape = *current++;
+        char unescaped;
+        switch (escape)
+        {
+        case '"':
+        case '/':
+        case '\\':
+            unescaped = escape;
+            break;
+        case 'b':
+            unescaped = '\b';
+            break;
+        case 'f':
+            unescaped = '\f';
+            break;
+        case 'n':
+            unescaped = '\n';
+            break;
+        case 'r':
+            unescaped = '\r';
+            break;
+        case 't':
+            unescaped = '\t';
+            break;
+        case 'u': {
+            uint32_t codepoint;
+            VerifyOrReturnValue(DecodeHexQuad(current, end, codepoint), false);
+            if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+            {
+                // Surrogate pair: a second \uXXXX escape must follow.
+                uint32_t lowSurrogate;
+                VerifyOrReturnValue(end - current >= 6, false);
+                VerifyOrReturnValue(*(current++) == '\\' && *(current++) == 'u', false);
+                VerifyOrReturnValue(DecodeHexQuad(current, end, lowSurrogate), false);
+                codepoint = 0x10000 + ((codepoint & 0x3FF) << 10) + (lowSurrogate & 0x3FF);
+            }
+            if (decoded != nullptr)
+            {
+                AppendUtf8(*decoded, codepoint);
+            }
+            continue;
+        }
+        default:
+            return false;
+        }
+
+        if (decoded != nullptr)
+        {
+            *decoded += unescaped;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Returns the value of a (validated) string token. Strings without escape sequences are returned in place, so that
+ * most values do not need a copy.
+ */
+CharSpan GetJsonString(const JsonToken & token, std::string & storage)
+{
+    const char * begin = token.start + 1;
+    const char * end   = token.end - 1;
+
+    if (std::find(begin, end, '\\') == end)
+    {
+        return CharSpan(begin, static_cast<size_t>(end - begin));
+    }
+
+    storage.clear();
+    DecodeJsonString(token, &storage);
+    return CharSpan(storage.data(), storage.size());
+}
+
+struct StreamMember
+{
+    std::string name;
+    const char * value;
+};
+
+/*
+ * Members of every object of a document, collected while the document is validated so that each object is read only
+ * once: the conversion then jumps from an object to its member values instead of scanning the object again.
+ */
+class JsonObjectIndex
+{
+public:
+    struct Object
+    {
+        const char * begin = nullptr; // Opening brace
+        const char * end   = nullptr; // Past the closing brace
+        size_t firstMember = 0;
+        size_t memberCount = 0;
+    };
+
+    size_t OpenObject(const char * begin)
+    {
+        Object object;
+        object.begin = begin;
+        // Until the object is closed, firstMember is the position of its first member on the stack of open members.
+        object.firstMember = mOpenMembers.size();
+        mObjects.push_back(object);
+        return mObjects.size() - 1;
+    }
+
+    void AddMember(std::string && name, const char * value) { mOpenMembers.push_back({ std::move(name), value }); }
+
+    /*
+     * Moves the members of the object out of the stack of open members, in name order. Members with the same name
+     * stay in document order, so the last one of them is the value a Json::Value would keep.
+     */
+    void CloseObject(size_t index, const char * end)
+    {
+        Object & object = mObjects[index];
+        auto first      = mOpenMembers.begin() + static_cast<std::ptrdiff_t>(object.firstMember);
+
+        std::sort(first, mOpenMembers.end(), [](const StreamMember & a, const StreamMember & b) {
+            return (a.name != b.name) ? (a.name < b.name) : (a.value < b.value);
+        });
+
+        object.end         = end;
+        object.firstMember = mMembers.size();
+        object.memberCount = static_cast<size_t>(mOpenMembers.end() - first);
+        mMembers.insert(mMembers.end(), std::make_move_iterator(first), std::make_move_iterator(mOpenMembers.end()));
+        mOpenMembers.erase(first, mOpenMembers.end());
+    }
+
+    /*
+     * Returns the object whose opening brace is at `begin`. Objects are opened in document order, so they are
+     * sorted by position.
+     */
+    const Object * Find(const char * begin) const
+    {
+        auto it = std::lower_bound(mObjects.begin(), mObjects.end(), begin,
+                                   [](const Object & object, const char * position) { return object.begin < position; });
+        return (it != mObjects.end() && it->begin == begin) ? &*it : nullptr;
+    }
+
+    const StreamMember * Members(const Object & object) const { return mMembers.data() + object.firstMember; }
+
+private:
+    std::vector<Object> mObjects;
+    std::vector<StreamMember> mMembers;
+    std::vector<StreamMember> mOpenMembers;
+};
+
+/*
+ * Tokenizer over the JSON text. Copies of a cursor can be used to come back to a position in the document.
+ *
+ * A cursor created with `validated` set assumes that the document was already checked by SkipValue(), and skips
+ * strings and numbers without decoding them. When `index` is not null, SkipValue() records the members of the
+ * objects it reads into it.
+ */
+class JsonCursor
+{
+public:
+    JsonCursor(const char * position, const char * end, bool validated, JsonObjectIndex * index = nullptr) :
+        mPosition(position), mEnd(end), mValidated(validated), mIndex(index)
+    {}
+
+    JsonCursor At(const char * position) const { return JsonCursor(position, mEnd, mValidated, mIndex); }
+
+    const char * Position() const { return mPosition; }
+
+    JsonToken ReadToken()
+    {
+        JsonToken token;
+
+        SkipSpaces();
+        token.start = mPosition;
+
+        bool ok = true;
+        switch (GetNextChar())
+        {
+        case '{':
+            token.type = JsonTokenType::kObjectBegin;
+            break;
+        case '}':
+            token.type = JsonTokenType::kObjectEnd;
+            break;
+        case '[':
+            token.type = JsonTokenType::kArrayBegin;
+            break;
+        case ']':
+            token.type = JsonTokenType::kArrayEnd;
+            break;
+        case '"':
+            token.type = JsonTokenType::kString;
+            ok         = ReadString();
+            break;
+        case '/':
+            token.type = JsonTokenType::kComment;
+            ok         = ReadComment();
+            break;
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        case '-':
+            token.type = JsonTokenType::kNumber;
+            ReadNumber();
+            break;
+        case 't':
+            token.type = JsonTokenType::kTrue;
+            ok         = Match("rue", 3);
+            break;
+        case 'f':
+            token.type = JsonTokenType::kFalse;
+            ok         = Match("alse", 4);
+            break;
+        case 'n':
+            token.type = JsonTokenType::kNull;
+            ok         = Match("ull", 3);
+            break;
+        case ',':
+            token.type = JsonTokenType::kArraySeparator;
+            break;
+        case ':':
+            token.type = JsonTokenType::kMemberSeparator;
+            break;
+        case '\0':
+            token.type = JsonTokenType::kEndOfStream;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+
+        if (!ok)
+        {
+            token.type = JsonTokenType::kError;
+        }
+        token.end = mPosition;
+        return token;
+    }
+
+    // Reads the next token that is not a comment.
+    JsonToken ReadValueToken()
+    {
+        JsonToken token;
+        do
+        {
+            token = ReadToken();
+        } while (token.type == JsonTokenType::kComment);
+        return token;
+    }
+
+    /*
+     * Validates and skips one value.
+     */
+    bool SkipValue(size_t depth)
+    {
+        JsonToken token = ReadValueToken();
+        switch (token.type)
+        {
+        case JsonTokenType::kObjectBegin:
+            return ReadObjectMembers(depth + 1, token.start);
+        case JsonTokenType::kArrayBegin: {
+            VerifyOrReturnValue(depth + 1 <= kStreamingMaxNestingDepth, false);
+            if (ReadEmptyArrayEnd())
+            {
+                return true;
+            }
+            do
+            {
+                VerifyOrReturnValue(SkipValue(depth + 1), false);
+            } while (ReadArraySeparator());
+            return mLastSeparator.type == JsonTokenType::kArrayEnd;
+        }
+        case JsonTokenType::kString:
+            return mValidated || DecodeJsonString(token, nullptr);
+        case JsonTokenType::kNumber: {
+            JsonNumber number;
+            return mValidated || DecodeJsonNumber(token, number);
+        }
+        case JsonTokenType::kTrue:
+        case JsonTokenType::kFalse:
+        case JsonTokenType::kNull:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /*
+     * Reads the members of the object whose opening brace at `begin` was just consumed, up to and including the
+     * closing brace. Each member value is validated and skipped.
+     */
+    bool ReadObjectMembers(size_t depth, const char * begin)
+    {
+        VerifyOrReturnValue(depth <= kStreamingMaxNestingDepth, false);
+
+        size_t object = (mIndex != nullptr) ? mIndex->OpenObject(begin) : 0;
+
+        // Json::Reader accepts a closing brace in place of a member name as long as the previous name was empty.
+        bool lastNameEmpty = true;
+
+        for (;;)
+        {
+            JsonToken nameToken = ReadValueToken();
+            if (nameToken.type == JsonTokenType::kObjectEnd && lastNameEmpty)
+            {
+                return CloseObject(object);
+            }
+            VerifyOrReturnValue(nameToken.type == JsonTokenType::kString, false);
+            std::string name;
+            VerifyOrReturnValue(mValidated || DecodeJsonString(nameToken, (mIndex != nullptr) ? &name : nullptr), false);
+            lastNameEmpty = (nameToken.end - nameToken.start == 2);
+
+            VerifyOrReturnValue(ReadToken().type == JsonTokenType::kMemberSeparator, false);
+
+            const char * value = mPosition;
+            VerifyOrReturnValue(SkipValue(depth), false);
+            if (mIndex != nullptr)
+            {
+                mIndex->AddMember(std::move(name), value);
+            }
+
+            JsonToken separator = ReadToken();
+            VerifyOrReturnValue(separator.type == JsonTokenType::kObjectEnd || separator.type == JsonTokenType::kArraySeparator ||
+                                    separator.type == JsonTokenType::kComment,
+                                false);
+            while (separator.type == JsonTokenType::kComment)
+            {
+                separator = ReadToken();
+            }
+            if (separator.type == JsonTokenType::kObjectEnd)
+            {
+                return CloseObject(object);
+            }
+        }
+    }
+
+    /*
+     * Right after the opening bracket of an array, consumes the closing bracket if the array is empty.
+     */
+    bool ReadEmptyArrayEnd()
+    {
+        SkipSpaces();
+        VerifyOrReturnValue(mPosition != mEnd && *mPosition == ']', false);
+        ReadToken();
+        return true;
+    }
+
+    /*
+     * After an array element, reads the next separator. Returns true if another element follows; otherwise the array
+     * is complete if LastSeparator() is the closing bracket.
+     */
+    bool ReadArraySeparator()
+    {
+        do
+        {
+            mLastSeparator = ReadToken();
+        } while (mLastSeparator.type == JsonTokenType::kComment);
+        return mLastSeparator.type == JsonTokenType::kArraySeparator;
+    }
+
+    const JsonToken & LastSeparator() const { return mLastSeparator; }
+
+private:
+    char GetNextChar() { return (mPosition == mEnd) ? '\0' : *mPosition++; }
+
+    bool CloseObject(size_t object)
+    {
+        if (mIndex != nullptr)
+        {
+            mIndex->CloseObject(object, mPosition);
+        }
+        return true;
+    }
+
+    void SkipSpaces()
+    {
+        while (mPosition != mEnd && (*mPosition == ' ' || *mPosition == '\t' || *mPosition == '\r' || *mPosition == '\n'))
+        {
+            ++mPosition;
+        }
+    }
+
+    bool Match(const char * pattern, size_t length)
+    {
+        VerifyOrReturnValue(static_cast<size_t>(mEnd - mPosition) >= length, false);
+        VerifyOrReturnValue(memcmp(mPosition, pattern, length) == 0, false);
+        mPosition += length;
+        return true;
+    }
+
+    bool ReadString()
+    {
+        char c = '\0';
+        while (mPosition != mEnd)
+        {
+            c = GetNextChar();
+            if (c == '\\')
+            {
+                GetNextChar();
+            }
+            else if (c == '"')
+            {
+                break;
+            }
+        }
+        return c == '"';
+    }
+
+    bool ReadComment()
+    {
+        char c = GetNextChar();
+        if (c == '*')
+        {
+            while (mPosition + 1 < mEnd)
+            {
+                c = GetNextChar();
+                if (c == '*' && *mPosition == '/')
+                {
+                    break;
+                }
+            }
+            return GetNextChar() == '/';
+        }
+        if (c == '/')
+        {
+            while (mPosition != mEnd)
+            {
+                c = GetNextChar();
+                if (c == '\n')
+                {
+                    break;
+                }
+                if (c == '\r')
+                {
+                    if (mPosition != mEnd && *mPosition == '\n')
+                    {
+                        GetNextChar();
+                    }
+                    break;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void ReadNumber()
+    {
+        auto isDigit = [this]() { return mPosition != mEnd && *mPosition >= '0' && *mPosition <= '9'; };
+
+        while (isDigit())
+        {
+            ++mPosition;
+        }
+        if (mPosition != mEnd && *mPosition == '.')
+        {
+            ++mPosition;
+            while (isDigit())
+            {
+                ++mPosition;
+            }
+        }
+        if (mPosition != mEnd && (*mPosition == 'e' || *mPosition == 'E'))
+        {
+            ++mPosition;
+            if (mPosition != mEnd && (*mPosition == '+' || *mPosition == '-'))
+            {
+                ++mPosition;
+            }
+            while (isDigit())
+            {
+                ++mPosition;
+            }
+        }
+    }
+
+    const char * mPosition;
+    const char * mEnd;
+    bool mValidated;
+    JsonObjectIndex * mIndex;
+    JsonToken mLastSeparator;
+};
+
+struct StreamElementContext
+{
+    ElementContext ctx;
+    const char * value;
+};
+
+/*
+ * Encodes the JSON value at the cursor position as a TLV element, advancing the cursor past the value. The document
+ * must have been validated with JsonCursor::SkipValue() beforehand, which filled `index`.
+ */
+CHIP_ERROR StreamTlvElement(JsonCursor & cursor, const JsonObjectIndex & index, TLV::TLVWriter & writer,
+                            const ElementContext & elementCtx)
+{
+    TLV::Tag tag    = elementCtx.tag;
+    JsonToken token = cursor.ReadValueToken();
+    std::string storage;
+
+    switch (elementCtx.type.tlvType)
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v = 0;
+        JsonNumber number;
+        if (token.type == JsonTokenType::kNumber && DecodeJsonNumber(token, number) && number.IsUInt64())
+        {
+            v = number.AsUInt64();
+        }
+        else if (token.type == JsonTokenType::kString)
+        {
+            CharSpan str = GetJsonString(token, storage);
+            ReturnErrorOnFailure(ParseNumericalField(std::string(str.data(), str.size()), v));
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        ReturnErrorOnFailure(writer.Put(tag, v));
+        break;
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v = 0;
+        JsonNumber number;
+        if (token.type == JsonTokenType::kNumber && DecodeJsonNumber(token, number) && number.IsInt64())
+        {
+            v = number.AsInt64();
+        }
+        else if (token.type == JsonTokenType::kString)
+        {
+            CharSpan str = GetJsonString(token, storage);
+            ReturnErrorOnFailure(ParseNumericalField(std::string(str.data(), str.size()), v));
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        ReturnErrorOnFailure(writer.Put(tag, v));
+        break;
+    }
+
+    case TLV::kTLVType_Boolean: {
+        VerifyOrReturnError(token.type == JsonTokenType::kTrue || token.type == JsonTokenType::kFalse, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.Put(tag, token.type == JsonTokenType::kTrue));
+        break;
+    }
+
+    case TLV::kTLVType_FloatingPointNumber: {
+        JsonNumber number;
+        if (token.type == JsonTokenType::kNumber)
+        {
+            VerifyOrReturnError(DecodeJsonNumber(token, number), CHIP_ERROR_INTERNAL);
+            if (elementCtx.type.isDouble)
+            {
+                ReturnErrorOnFailure(writer.Put(tag, number.AsDouble()));
+            }
+            else
+            {
+                ReturnErrorOnFailure(writer.Put(tag, number.AsFloat()));
+            }
+        }
+        else if (token.type == JsonTokenType::kString)
+        {
+            CharSpan str            = GetJsonString(token, storage);
+            bool isPositiveInfinity = str.data_equal(CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+            bool isNegativeInfinity = str.data_equal(CharSpan::fromCharString(kFloatingPointNegativeInfinity));
+            VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
+            if (elementCtx.type.isDouble)
+            {
+                double infinity = std::numeric_limits<double>::infinity();
+                ReturnErrorOnFailure(writer.Put(tag, isPositiveInfinity ? infinity : -infinity));
+            }
+            else
+            {
+                float infinity = std::numeric_limits<float>::infinity();
+                ReturnErrorOnFailure(writer.Put(tag, isPositiveInfinity ? infinity : -infinity));
+            }
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        break;
+    }
+
+    case TLV::kTLVType_ByteString: {
+        VerifyOrReturnError(token.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        CharSpan str      = GetJsonString(token, storage);
+        size_t encodedLen = str.size();
+        VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
+
+        // Check if the length is a multiple of 4 as strict padding is required.
+        VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+        Platform::ScopedMemoryBuffer<uint8_t> byteString;
+        byteString.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)));
+        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        auto decodedLen = Base64Decode(str.data(), static_cast<uint16_t>(encodedLen), byteString.Get());
+        VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.PutBytes(tag, byteString.Get(), decodedLen));
+        break;
+    }
+
+    case TLV::kTLVType_UTF8String: {
+        VerifyOrReturnError(token.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        CharSpan str = GetJsonString(token, storage);
+        ReturnErrorOnFailure(writer.PutString(tag, str.data(), static_cast<uint32_t>(str.size())));
+        break;
+    }
+
+    case TLV::kTLVType_Null: {
+        VerifyOrReturnError(token.type == JsonTokenType::kNull, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.PutNull(tag));
+        break;
+    }
+
+    case TLV::kTLVType_Structure: {
+        TLV::TLVType containerType;
+        VerifyOrReturnError(token.type == JsonTokenType::kObjectBegin, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+
+        const JsonObjectIndex::Object * object = index.Find(token.start);
+        VerifyOrReturnError(object != nullptr, CHIP_ERROR_INTERNAL);
+        const StreamMember * members    = index.Members(*object);
+        const StreamMember * membersEnd = members + object->memberCount;
+
+        // The members are in name order: keep only the last value of a repeated name, as a Json::Value would.
+        std::vector<StreamElementContext> nestedElementsCtx;
+        nestedElementsCtx.reserve(object->memberCount);
+        for (const StreamMember * it = members; it != membersEnd; ++it)
+        {
+            const StreamMember * next = it + 1;
+            if (next != membersEnd && next->name == it->name)
+            {
+                continue;
+            }
+
+            StreamElementContext element;
+            ReturnErrorOnFailure(ParseJsonName(it->name, element.ctx, writer.ImplicitProfileId));
+            element.value = it->value;
+            nestedElementsCtx.push_back(std::move(element));
+        }
+
+        // Sort Json object elements by Tag number (low to high).
+        // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
+        std::sort(nestedElementsCtx.begin(), nestedElementsCtx.end(),
+                  [](const StreamElementContext & a, const StreamElementContext & b) { return CompareByTag(a.ctx, b.ctx); });
+
+        for (auto & element : nestedElementsCtx)
+        {
+            JsonCursor valueCursor = cursor.At(element.value);
+            ReturnErrorOnFailure(StreamTlvElement(valueCursor, index, writer, element.ctx));
+        }
+
+        ReturnErrorOnFailure(writer.EndContainer(containerType));
+        cursor = cursor.At(object->end);
+        break;
+    }
+
+    case TLV::kTLVType_Array: {
+        TLV::TLVType containerType;
+        VerifyOrReturnError(token.type == JsonTokenType::kArrayBegin, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
+
+        bool isEmpty = cursor.ReadEmptyArrayEnd();
+        if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
+        {
+            VerifyOrReturnError(isEmpty, CHIP_ERROR_INVALID_ARGUMENT);
+        }
+        else if (!isEmpty)
+        {
+            ElementContext nestedElementCtx;
+            nestedElementCtx.tag  = TLV::AnonymousTag();
+            nestedElementCtx.type = elementCtx.subType;
+            do
+            {
+                ReturnErrorOnFailure(StreamTlvElement(cursor, index, writer, nestedElementCtx));
+            } while (cursor.ReadArraySeparator());
+            VerifyOrReturnError(cursor.LastSeparator().type == JsonTokenType::kArrayEnd, CHIP_ERROR_INTERNAL);
+        }
+
+        ReturnErrorOnFailure(writer.EndContainer(containerType));
+        break;
+    }
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        break;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
@@ -430,6 +1438,41 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
     return EncodeTlvElement(json, writer, elementCtx);
 }
 
+CHIP_ERROR StreamingJsonToTlv(const CharSpan & json, MutableByteSpan & tlv)
+{
+    TLV::TLVWriter writer;
+    writer.Init(tlv);
+    writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    ReturnErrorOnFailure(StreamingJsonToTlv(json, writer));
+    ReturnErrorOnFailure(writer.Finalize());
+    tlv.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR StreamingJsonToTlv(const CharSpan & json, TLV::TLVWriter & writer)
+{
+    const char * begin = json.data();
+    const char * end   = json.data() + json.size();
+
+    // Syntax errors are reported before anything is written, as with JsonToTlv(). The same pass indexes the objects, so
+    // that the conversion below reads each of them only once.
+    JsonObjectIndex index;
+    JsonCursor validator(begin, end, /* validated = */ false, &index);
+    VerifyOrReturnError(validator.SkipValue(0), CHIP_ERROR_INTERNAL);
+
+    ElementContext elementCtx;
+    elementCtx.type = { TLV::kTLVType_Structure, false };
+
+    // Use kTemporaryImplicitProfileId as the default value, see JsonToTlv().
+    if (writer.ImplicitProfileId == TLV::kProfileIdNotSpecified)
+    {
+        writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    }
+
+    JsonCursor cursor(begin, end, /* validated = */ true);
+    return StreamTlvElement(cursor, index, writer, elementCtx);
+}
+
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
 {
     return InternalConvertTlvTag(tagNumber, tag);
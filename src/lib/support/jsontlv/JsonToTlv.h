@@ -32,6 +32,18 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv);
  */
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer);
 
+/*
+ * Same as JsonToTlv(), but converts the JSON text directly into TLV without first parsing it into a Json::Value
+ * document. The accepted input, the produced TLV and the returned errors are the same as for JsonToTlv(), except that
+ * documents nested deeper than 64 levels are rejected with CHIP_ERROR_INTERNAL.
+ */
+CHIP_ERROR StreamingJsonToTlv(const CharSpan & json, MutableByteSpan & tlv);
+
+/*
+ * Streaming counterpart of JsonToTlv(const std::string &, TLV::TLVWriter &).
+ */
+CHIP_ERROR StreamingJsonToTlv(const CharSpan & json, TLV::TLVWriter & writer);
+
 /*
  * Convert a uint32_t tagNumber (from MEI) to a TLV tag.
  * The upper 16 bits of tag_number represent the vendor_id.
@@ -17,7 +17,11 @@
 
 #include "lib/support/CHIPMemString.h"
 #include "lib/support/ScopedBuffer.h"
+#include <algorithm>
+#include <cmath>
 #include <json/json.h>
+#include <stdio.h>
+#include <vector>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
@@ -329,6 +333,511 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Streaming conversion
+ *
+ * The functions below produce exactly the same text as TlvToJson() followed by Json::StyledWriter, but write it
+ * directly from the TLVReader into the output string without building a Json::Value document.
+ */
+
+// Json::StyledWriter formatting parameters.
+constexpr size_t kStyledIndentSize      = 3;
+constexpr size_t kStyledRightMargin     = 74;
+constexpr uint32_t kReplacementCodepoint = 0xFFFD;
+
+/*
+ * Output state equivalent to the one kept by Json::StyledWriter: the document being produced and the current
+ * indentation.
+ */
+class StyledJsonOutput
+{
+public:
+    explicit StyledJsonOutput(std::string & document) : mDocument(document) {}
+
+    std::string & Document() { return mDocument; }
+
+    void WriteIndent()
+    {
+        if (!mDocument.empty())
+        {
+            char last = mDocument.back();
+            if (last == ' ')
+            {
+                // Already indented, e.g. right after "name" : 
+                return;
+            }
+            if (last != '\n')
+            {
+                mDocument += '\n';
+            }
+        }
+        mDocument += mIndentString;
+    }
+
+    void WriteWithIndent(const std::string & value)
+    {
+        WriteIndent();
+        mDocument += value;
+    }
+
+    void WriteWithIndent(char value)
+    {
+        WriteIndent();
+        mDocument += value;
+    }
+
+    void Indent() { mIndentString.append(kStyledIndentSize, ' '); }
+    void Unindent() { mIndentString.resize(mIndentString.size() - kStyledIndentSize); }
+
+private:
+    std::string & mDocument;
+    std::string mIndentString;
+};
+
+// Decodes one UTF-8 sequence the same way jsoncpp does, replacing invalid sequences with U+FFFD.
+// `c` is left on the last byte consumed.
+uint32_t Utf8ToCodepoint(const char *& c, const char * end)
+{
+    uint32_t firstByte = static_cast<unsigned char>(*c);
+
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        VerifyOrReturnValue(end - c >= 2, kReplacementCodepoint);
+        uint32_t codepoint = ((firstByte & 0x1F) << 6) | (static_cast<unsigned char>(c[1]) & 0x3F);
+        c += 1;
+        return (codepoint < 0x80) ? kReplacementCodepoint : codepoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        VerifyOrReturnValue(end - c >= 3, kReplacementCodepoint);
+        uint32_t codepoint = ((firstByte & 0x0F) << 12) | ((static_cast<unsigned char>(c[1]) & 0x3F) << 6) |
+            (static_cast<unsigned char>(c[2]) & 0x3F);
+        c += 2;
+        // Surrogates are not valid code points on their own.
+        VerifyOrReturnValue(codepoint < 0xD800 || codepoint > 0xDFFF, kReplacementCodepoint);
+        return (codepoint < 0x800) ? kReplacementCodepoint : codepoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        VerifyOrReturnValue(end - c >= 4, kReplacementCodepoint);
+        uint32_t codepoint = ((firstByte & 0x07) << 18) | ((static_cast<unsigned char>(c[1]) & 0x3F) << 12) |
+            ((static_cast<unsigned char>(c[2]) & 0x3F) << 6) | (static_cast<unsigned char>(c[3]) & 0x3F);
+        c += 3;
+        return (codepoint < 0x10000) ? kReplacementCodepoint : codepoint;
+    }
+
+    return kReplacementCodepoint;
+}
+
+void AppendUnicodeEscape(std::string & out, uint32_t codeUnit)
+{
+    char escape[7];
+    snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(codeUnit & 0xFFFF));
+    out += escape;
+}
+
+// Appends a quoted JSON string, escaping characters the same way as Json::StyledWriter (ASCII-only output).
+void AppendQuotedString(std::string & out, const char * str, size_t length)
+{
+    const char * end = str + length;
+
+    out += '"';
+    for (const char * c = str; c != end; ++c)
+    {
+        switch (*c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default: {
+            uint32_t codepoint = Utf8ToCodepoint(c, end);
+            if (codepoint >= 0x20 && codepoint < 0x80)
+            {
+                out += static_cast<char>(codepoint);
+            }
+            else if (codepoint < 0x10000)
+            {
+                AppendUnicodeEscape(out, codepoint);
+            }
+            else
+            {
+                // Characters outside of the Basic Multilingual Plane are written as a surrogate pair.
+                codepoint -= 0x10000;
+                AppendUnicodeEscape(out, 0xD800 + ((codepoint >> 10) & 0x3FF));
+                AppendUnicodeEscape(out, 0xDC00 + (codepoint & 0x3FF));
+            }
+            break;
+        }
+        }
+    }
+    out += '"';
+}
+
+void AppendQuotedString(std::string & out, const std::string & str)
+{
+    AppendQuotedString(out, str.data(), str.size());
+}
+
+void AppendDouble(std::string & out, double value)
+{
+    if (std::isnan(value))
+    {
+        out += "null";
+        return;
+    }
+
+    char buffer[36];
+    int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+    VerifyOrReturn(length > 0 && static_cast<size_t>(length) < sizeof(buffer));
+
+    // Keep the output locale-independent, and make sure the value reads back as a floating point number.
+    std::replace(buffer, buffer + length, ',', '.');
+    out.append(buffer, static_cast<size_t>(length));
+    if (strchr(buffer, '.') == nullptr && strchr(buffer, 'e') == nullptr)
+    {
+        out += ".0";
+    }
+}
+
+CHIP_ERROR StreamValue(TLV::TLVReader & reader, StyledJsonOutput & output);
+
+// Appends the JSON representation of a non-container element.
+CHIP_ERROR AppendScalar(TLV::TLVReader & reader, std::string & out)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<uint32_t>(v))
+        {
+            out += std::to_string(v);
+        }
+        else
+        {
+            AppendQuotedString(out, std::to_string(v));
+        }
+        break;
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<int32_t>(v))
+        {
+            out += std::to_string(v);
+        }
+        else
+        {
+            AppendQuotedString(out, std::to_string(v));
+        }
+        break;
+    }
+
+    case TLV::kTLVType_Boolean: {
+        bool v;
+        ReturnErrorOnFailure(reader.Get(v));
+        out += v ? "true" : "false";
+        break;
+    }
+
+    case TLV::kTLVType_FloatingPointNumber: {
+        double v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (v == std::numeric_limits<double>::infinity())
+        {
+            AppendQuotedString(out, kFloatingPointPositiveInfinity, strlen(kFloatingPointPositiveInfinity));
+        }
+        else if (v == -std::numeric_limits<double>::infinity())
+        {
+            AppendQuotedString(out, kFloatingPointNegativeInfinity, strlen(kFloatingPointNegativeInfinity));
+        }
+        else
+        {
+            AppendDouble(out, v);
+        }
+        break;
+    }
+
+    case TLV::kTLVType_ByteString: {
+        ByteSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+        VerifyOrReturnError(CanCastTo<uint32_t>(span.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+        // Base64 output never needs escaping, so encode straight into the document.
+        size_t start = out.size();
+        out.resize(start + BASE64_ENCODED_LEN(span.size()) + 2);
+        out[start] = '"';
+        uint32_t encodedLen = Base64Encode32(span.data(), static_cast<uint32_t>(span.size()), &out[start + 1]);
+        out.resize(start + 1 + encodedLen);
+        out += '"';
+        break;
+    }
+
+    case TLV::kTLVType_UTF8String: {
+        CharSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+        AppendQuotedString(out, span.data(), span.size());
+        break;
+    }
+
+    case TLV::kTLVType_Null:
+        out += "null";
+        break;
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+struct StreamStructMember
+{
+    std::string name;
+    TLV::TLVReader reader;
+};
+
+/*
+ * Given a TLVReader positioned at a TLV structure, writes the structure as a JSON object. Json::Value objects
+ * keep their members sorted by name, so the members are first indexed (name and reader position only) and then
+ * written in name order.
+ */
+CHIP_ERROR StreamStruct(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    std::vector<StreamStructMember> members;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+        {
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+        }
+
+        JsonObjectElementContext context(reader);
+        if (context.type.tlvType == TLV::kTLVType_Array)
+        {
+            // The name of an array carries the type of its elements, which is the type of the first one.
+            TLV::TLVReader arrayReader;
+            TLV::TLVType arrayContainerType;
+            arrayReader.Init(reader);
+            ReturnErrorOnFailure(arrayReader.EnterContainer(arrayContainerType));
+            if (arrayReader.Next() == CHIP_NO_ERROR)
+            {
+                context.subType.tlvType = arrayReader.GetType();
+                if (context.subType.tlvType == TLV::kTLVType_FloatingPointNumber)
+                {
+                    context.subType.isDouble = arrayReader.IsElementDouble();
+                }
+            }
+        }
+
+        members.push_back({ context.GenerateJsonElementName(), reader });
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    if (members.empty())
+    {
+        output.Document() += "{}";
+        return CHIP_NO_ERROR;
+    }
+
+    // When the same name appears more than once, the last element wins, as with Json::Value.
+    std::stable_sort(members.begin(), members.end(),
+                     [](const StreamStructMember & a, const StreamStructMember & b) { return a.name < b.name; });
+
+    output.WriteWithIndent('{');
+    output.Indent();
+    for (auto it = members.begin(); it != members.end(); ++it)
+    {
+        auto next = it + 1;
+        if (next != members.end() && next->name == it->name)
+        {
+            continue;
+        }
+
+        output.WriteIndent();
+        AppendQuotedString(output.Document(), it->name);
+        output.Document() += " : ";
+        ReturnErrorOnFailure(StreamValue(it->reader, output));
+        if (next != members.end())
+        {
+            output.Document() += ',';
+        }
+    }
+    output.Unindent();
+    output.WriteWithIndent('}');
+
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Given a TLVReader positioned at a TLV array, writes the array as a JSON array. As Json::StyledWriter does,
+ * arrays of short scalar values go on a single line and all other arrays are written one element per line.
+ */
+CHIP_ERROR StreamArray(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    TLV::TLVReader elementReader;
+    ElementTypeContext firstType;
+    size_t count          = 0;
+    bool hasNonEmptyChild = false;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    // First pass: validate the elements and find out whether any of them is a non-empty structure.
+    elementReader.Init(reader);
+    while ((err = elementReader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(elementReader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(elementReader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        ElementTypeContext type;
+        type.tlvType = elementReader.GetType();
+        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+        {
+            type.isDouble = elementReader.IsElementDouble();
+        }
+
+        if (count == 0)
+        {
+            firstType = type;
+        }
+        else
+        {
+            VerifyOrReturnError(firstType.tlvType == type.tlvType && firstType.isDouble == type.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
+
+        if (type.tlvType == TLV::kTLVType_Structure && !hasNonEmptyChild)
+        {
+            TLV::TLVReader structReader;
+            TLV::TLVType structContainerType;
+            structReader.Init(elementReader);
+            ReturnErrorOnFailure(structReader.EnterContainer(structContainerType));
+            hasNonEmptyChild = (structReader.Next() == CHIP_NO_ERROR);
+        }
+
+        count++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    if (count == 0)
+    {
+        output.Document() += "[]";
+        return reader.ExitContainer(containerType);
+    }
+
+    // Scalar elements are rendered up-front to decide whether the array fits on one line.
+    std::vector<std::string> childValues;
+    bool isMultiLine = (count * 3 >= kStyledRightMargin) || hasNonEmptyChild;
+    if (!isMultiLine)
+    {
+        size_t lineLength = 4 + (count - 1) * 2; // '[ ' + ', ' * (n - 1) + ' ]'
+        childValues.reserve(count);
+        elementReader.Init(reader);
+        while ((err = elementReader.Next()) == CHIP_NO_ERROR)
+        {
+            std::string childValue;
+            StyledJsonOutput childOutput(childValue);
+            ReturnErrorOnFailure(StreamValue(elementReader, childOutput));
+            lineLength += childValue.size();
+            childValues.push_back(std::move(childValue));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        isMultiLine = (lineLength >= kStyledRightMargin);
+    }
+
+    if (isMultiLine)
+    {
+        output.WriteWithIndent('[');
+        output.Indent();
+        for (size_t index = 0; index < count; index++)
+        {
+            if (childValues.empty())
+            {
+                ReturnErrorOnFailure(reader.Next());
+                output.WriteIndent();
+                ReturnErrorOnFailure(StreamValue(reader, output));
+            }
+            else
+            {
+                output.WriteWithIndent(childValues[index]);
+            }
+            if (index + 1 < count)
+            {
+                output.Document() += ',';
+            }
+        }
+        output.Unindent();
+        output.WriteWithIndent(']');
+    }
+    else
+    {
+        output.Document() += "[ ";
+        for (size_t index = 0; index < count; index++)
+        {
+            if (index > 0)
+            {
+                output.Document() += ", ";
+            }
+            output.Document() += childValues[index];
+        }
+        output.Document() += " ]";
+    }
+
+    // Skip whatever was not consumed above; ExitContainer() takes care of that.
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR StreamValue(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_Structure:
+        return StreamStruct(reader, output);
+    case TLV::kTLVType_Array:
+        return StreamArray(reader, output);
+    default:
+        return AppendScalar(reader, output.Document());
+    }
+}
+
 } // namespace
 
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
@@ -357,4 +866,32 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     jsonString = writer.write(jsonObject);
     return CHIP_NO_ERROR;
 }
+
+CHIP_ERROR StreamingTlvToJson(const ByteSpan & tlv, std::string & jsonString)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv);
+    reader.ImplicitProfileId = kTemporaryImplicitProfileId;
+
+    ReturnErrorOnFailure(reader.Next());
+    return StreamingTlvToJson(reader, jsonString);
+}
+
+CHIP_ERROR StreamingTlvToJson(TLV::TLVReader & reader, std::string & jsonString)
+{
+    // The top level element must be a TLV Structure of Anonymous type.
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    // During json conversion, a implicit profile ID is required
+    ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
+
+    std::string document;
+    StyledJsonOutput output(document);
+    ReturnErrorOnFailure(StreamStruct(reader, output));
+    document += '\n';
+
+    jsonString = std::move(document);
+    return CHIP_NO_ERROR;
+}
 } // namespace chip
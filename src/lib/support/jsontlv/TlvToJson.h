@@ -33,4 +33,15 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString);
  * Given a TLV encoded byte array, this function converts it into JSON object.
  */
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString);
+
+/*
+ * Same as TlvToJson(), but writes the JSON text directly from the TLV data without building a Json::Value document.
+ * The output is identical to the one of TlvToJson().
+ */
+CHIP_ERROR StreamingTlvToJson(TLV::TLVReader & reader, std::string & jsonString);
+
+/*
+ * Streaming counterpart of TlvToJson(const ByteSpan &, std::string &).
+ */
+CHIP_ERROR StreamingTlvToJson(const ByteSpan & tlv, std::string & jsonString);
 } // namespace chip
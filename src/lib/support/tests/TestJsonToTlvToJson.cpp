@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <string>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -27,6 +28,7 @@
 #include <lib/support/jsontlv/JsonToTlv.h>
 #include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
+#include <system/SystemClock.h>
 
 namespace {
 
@@ -100,6 +102,33 @@ void CheckValidConversion(const std::string & jsonOriginal, const ByteSpan & tlv
         PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
         PrintSpan("TLV Encoding Generated from Json Expected String: ", tlvEncodingLocal);
     }
+
+    // Verify that the streaming converters produce exactly the same TLV and Json text.
+    tlvEncodingLocal = MutableByteSpan(buf);
+    err              = StreamingJsonToTlv(CharSpan(jsonOriginal.data(), jsonOriginal.size()), tlvEncodingLocal);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    match = tlvEncodingLocal.data_equal(tlvEncoding);
+    EXPECT_TRUE(match);
+    if (!match)
+    {
+        printf("ERROR: Streaming TLV Encoding Doesn't Match!\n");
+        PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
+        PrintSpan("TLV Encoding Generated by Streaming Converter:    ", tlvEncodingLocal);
+    }
+
+    std::string streamedJsonString;
+    err = StreamingTlvToJson(tlvEncoding, streamedJsonString);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    match = (streamedJsonString == generatedJsonString);
+    EXPECT_TRUE(match);
+    if (!match)
+    {
+        printf("ERROR: Streaming Json String Doesn't Match!\n");
+        printf("Json String:\n%s\n", generatedJsonString.c_str());
+        printf("Streamed Json String:\n%s\n", streamedJsonString.c_str());
+    }
 }
 
 // Boolean true
@@ -1699,6 +1728,9 @@ TEST_F(TestJsonToTlvToJson, TestConverter_TlvToJson_ErrorCases)
         std::string jsonString;
         err = TlvToJson(testCase.nEncodedTlv, jsonString);
         EXPECT_EQ(err, testCase.mExpectedResult);
+
+        err = StreamingTlvToJson(testCase.nEncodedTlv, jsonString);
+        EXPECT_EQ(err, testCase.mExpectedResult);
     }
 }
 
@@ -1788,6 +1820,17 @@ TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_ErrorCases)
                                             "   \"1:FLOAT\" : \"1.1\"\n"
                                             "}\n";
 
+    std::string unterminatedStructure = "{\n"
+                                        "   \"1:UINT\" : 42\n";
+
+    std::string trailingCommaInStructure = "{\n"
+                                           "   \"1:UINT\" : 42,\n"
+                                           "}\n";
+
+    std::string invalidStringEscape = "{\n"
+                                      "   \"1:STRING\" : \"\\q\"\n"
+                                      "}\n";
+
     // clang-format off
     static const TestCase sTestCases[] = {
         // Json String                      Expected Error                Test Case String
@@ -1808,6 +1851,9 @@ TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_ErrorCases)
         {  invalidBytesBase64Padding3,      CHIP_ERROR_INVALID_ARGUMENT,  "Invalid Base64 Encoding: Invalid padding (start 3)"      },
         {  invalidPositiveInfinityValue,    CHIP_ERROR_INVALID_ARGUMENT,  "Invalid Double Positive Infinity Encoding"               },
         {  invalidFloatValueAsString,       CHIP_ERROR_INVALID_ARGUMENT,  "Invalid Float Value Encoding as a String"                },
+        {  unterminatedStructure,           CHIP_ERROR_INTERNAL,          "Unterminated Structure"                                  },
+        {  trailingCommaInStructure,        CHIP_ERROR_INTERNAL,          "Trailing Comma In Structure"                             },
+        {  invalidStringEscape,             CHIP_ERROR_INTERNAL,          "Invalid String Escape Sequence"                          },
     };
     // clang-format on
 
@@ -1817,6 +1863,10 @@ TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_ErrorCases)
         MutableByteSpan tlvSpan(buf);
         err = JsonToTlv(testCase.mJsonString, tlvSpan);
         EXPECT_EQ(err, testCase.mExpectedResult);
+
+        tlvSpan = MutableByteSpan(buf);
+        EXPECT_EQ(StreamingJsonToTlv(CharSpan(testCase.mJsonString.data(), testCase.mJsonString.size()), tlvSpan),
+                  testCase.mExpectedResult);
 #if CHIP_CONFIG_ERROR_FORMAT_AS_STRING
         if (err != testCase.mExpectedResult)
         {
@@ -1862,4 +1912,128 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Struct_MEITags)
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
     CheckValidConversion(jsonString, tlvSpan, jsonString);
 }
+
+// The streaming converters must accept and reject the same documents as the Json::Value based ones, and produce the
+// same output for them.
+TEST_F(TestJsonToTlvToJson, TestConverter_Streaming_MatchesJsonValue)
+{
+    static const char * const sJsonStrings[] = {
+        "{}",
+        "{ \"1:UINT\" : 42 } trailing content is ignored",
+        "/* comment */ { \"1:UINT\" : 42, // comment\n \"2:INT\" : -1 }",
+        "{ \"1:ARRAY-UINT\" : [ 1, /* comment */ 2 ], \"2:ARRAY-?\" : [ ] }",
+        "{ \"1:STRING\" : \"\\u00e9\\ud83d\\ude00\\\"\\\\\\/\\b\\f\\n\\r\\t\", \"2:STRING\" : \"caf\xc3\xa9\" }",
+        "{ \"1:UINT\" : 1.0, \"2:INT\" : -2e3, \"3:UINT\" : 4294967296, \"4:INT\" : -9223372036854775808 }",
+        "{ \"1:UINT\" : 18446744073709551615, \"2:UINT\" : 18446744073709551616, \"3:INT\" : 9223372036854775808 }",
+        "{ \"1:FLOAT\" : 16777217, \"2:DOUBLE\" : 1e-400, \"3:FLOAT\" : -0.1, \"4:DOUBLE\" : -0 }",
+        "{ \"1:DOUBLE\" : 1e400 }",
+        "{ \"1:UINT\" : 1, \"1:UINT\" : 2, \"0:INT\" : 3, \"1:INT\" : 4 }",
+        "{ \"1:UINT\" : \"42\", \"2:INT\" : \"-42\", \"3:BOOL\" : false, \"4:NULL\" : null }",
+        "{ \"1:STRUCT\" : { \"1:STRUCT\" : { \"1:ARRAY-STRUCT\" : [ {}, { \"0:BOOL\" : true } ] } } }",
+        "{ \"1:UINT\" : - }",
+        "{ \"1:UINT\" : 01 }",
+        "{ \"1:UINT\" : 1. }",
+        "{ \"1:UINT\" : 1e }",
+        "{ \"1:UINT\" /* comment */ : 1 }",
+        "{ \"1:STRING\" : \"\\ud83d\" }",
+        "{ \"1:STRING\" : \"\\u12\" }",
+        "{ \"1:BOOL\" : tru }",
+        "{ \"1:UINT\" : 1 ",
+        "[ 1, 2 ]",
+        "",
+    };
+
+    for (const char * json : sJsonStrings)
+    {
+        std::string jsonString(json);
+
+        uint8_t buf[256];
+        MutableByteSpan tlvSpan(buf);
+        CHIP_ERROR err = JsonToTlv(jsonString, tlvSpan);
+
+        uint8_t streamingBuf[256];
+        MutableByteSpan streamingTlvSpan(streamingBuf);
+        CHIP_ERROR streamingErr = StreamingJsonToTlv(CharSpan(jsonString.data(), jsonString.size()), streamingTlvSpan);
+
+        EXPECT_EQ(streamingErr, err) << "Json: " << jsonString;
+        if (err != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+        EXPECT_TRUE(streamingTlvSpan.data_equal(tlvSpan)) << "Json: " << jsonString;
+
+        std::string generatedJsonString;
+        std::string streamedJsonString;
+        EXPECT_EQ(TlvToJson(tlvSpan, generatedJsonString), CHIP_NO_ERROR);
+        EXPECT_EQ(StreamingTlvToJson(tlvSpan, streamedJsonString), CHIP_NO_ERROR);
+        EXPECT_EQ(streamedJsonString, generatedJsonString);
+    }
+}
+
+// Not a pass/fail test: logs the throughput of the Json::Value based and streaming converters on a
+// large attribute-report-like payload.
+TEST_F(TestJsonToTlvToJson, TestConverter_Streaming_Throughput)
+{
+    constexpr size_t kEntryCount = 200;
+    constexpr int kIterations    = 50;
+
+    std::vector<uint8_t> buf(64 * 1024);
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    TLV::TLVType arrayType;
+    TLV::TLVType structType;
+
+    writer.Init(buf.data(), buf.size());
+    ASSERT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ASSERT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, arrayType));
+    for (size_t i = 0; i < kEntryCount; i++)
+    {
+        const uint8_t bytes[] = { static_cast<uint8_t>(i), 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+        ASSERT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(0), static_cast<uint64_t>(i)));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(1), static_cast<int64_t>(i) * -1000));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::ContextTag(2), "Matter Device Label"));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.PutBytes(TLV::ContextTag(3), bytes, sizeof(bytes)));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(4), static_cast<double>(i) / 3));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(5), (i % 2) == 0));
+        ASSERT_EQ(CHIP_NO_ERROR, writer.EndContainer(structType));
+    }
+    ASSERT_EQ(CHIP_NO_ERROR, writer.EndContainer(arrayType));
+    ASSERT_EQ(CHIP_NO_ERROR, writer.EndContainer(outerType));
+    ASSERT_EQ(CHIP_NO_ERROR, writer.Finalize());
+    ByteSpan tlv(buf.data(), writer.GetLengthWritten());
+
+    std::string json;
+    std::string streamedJson;
+    ASSERT_EQ(CHIP_NO_ERROR, TlvToJson(tlv, json));
+    ASSERT_EQ(CHIP_NO_ERROR, StreamingTlvToJson(tlv, streamedJson));
+    EXPECT_EQ(json, streamedJson);
+
+    std::vector<uint8_t> outBuf(buf.size());
+    MutableByteSpan outTlv(outBuf.data(), outBuf.size());
+    ASSERT_EQ(CHIP_NO_ERROR, StreamingJsonToTlv(CharSpan(json.data(), json.size()), outTlv));
+    EXPECT_TRUE(outTlv.data_equal(tlv));
+
+    auto measure = [&](const char * label, auto && convert) {
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (int i = 0; i < kIterations; i++)
+        {
+            ASSERT_EQ(CHIP_NO_ERROR, convert());
+        }
+        uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+        printf("%-24s %u bytes of TLV, %d iterations: %llu us/iteration\n", label, static_cast<unsigned>(tlv.size()), kIterations,
+               static_cast<unsigned long long>(elapsed / kIterations));
+    };
+
+    measure("TlvToJson", [&]() { return TlvToJson(tlv, json); });
+    measure("StreamingTlvToJson", [&]() { return StreamingTlvToJson(tlv, streamedJson); });
+    measure("JsonToTlv", [&]() {
+        outTlv = MutableByteSpan(outBuf.data(), outBuf.size());
+        return JsonToTlv(json, outTlv);
+    });
+    measure("StreamingJsonToTlv", [&]() {
+        outTlv = MutableByteSpan(outBuf.data(), outBuf.size());
+        return StreamingJsonToTlv(CharSpan(json.data(), json.size()), outTlv);
+    });
+}
 } // namespace
@@ -108,7 +108,11 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        RemoveFromExchangeIndex(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -238,11 +242,43 @@ private:
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
 
+    // Active exchanges, chained per bucket of (exchange ID, role), so that incoming messages do not have to be matched against
+    // every exchange of mContextPool.  The session is not part of the key since an exchange may move to another session; it is
+    // checked by MatchExchange when walking a bucket.
+    static constexpr size_t kExchangeIndexBuckets = CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS;
+    static_assert(kExchangeIndexBuckets > 0, "CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS must be greater than zero");
+    ExchangeContext * mExchangeIndex[kExchangeIndexBuckets] = {};
+
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    template <typename... Args>
+    ExchangeContext * AllocateContext(Args &&... args)
+    {
+        ExchangeContext * ec = mContextPool.CreateObject(this, std::forward<Args>(args)...);
+        if (ec != nullptr)
+        {
+            AddToExchangeIndex(ec);
+        }
+        return ec;
+    }
+
+    static size_t ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator)
+    {
+        return ((static_cast<size_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u)) % kExchangeIndexBuckets;
+    }
+
+    void AddToExchangeIndex(ExchangeContext * ec);
+    void RemoveFromExchangeIndex(ExchangeContext * ec);
+
+    /**
+     *  Find the exchange an incoming message belongs to, if any.
+     */
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
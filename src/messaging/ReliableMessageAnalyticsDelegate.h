@@ -76,6 +76,13 @@ public:
         // that have elapsed between when the initial message was sent and when we received
         // acknowledgment for the message.
         std::optional<System::Clock::Milliseconds64> ackLatencyMs;
+        // When eventType is kAcknowledged and CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED is set, this will be populated
+        // with the smoothed round-trip time to the peer, once at least one message was acknowledged without
+        // being retransmitted.
+        std::optional<System::Clock::Milliseconds32> smoothedRttMs;
+        // When eventType is kInitialSend or kRetransmission and CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED is set, this
+        // will be populated with the base retry interval used to schedule the next retransmission.
+        std::optional<System::Clock::Milliseconds32> retryIntervalMs;
     };
 
     virtual void OnTransmitEvent(const TransmitEvent & event) = 0;
@@ -50,8 +50,11 @@ namespace Messaging {
 
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
+static_assert(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE < ReliableMessageMgr::kNotInRetransQueue,
+              "The retransmission queue index must fit in RetransTableEntry::retransQueueIndex");
+
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0), retransQueueIndex(kNotInRetransQueue)
 {
     ec->SetWaitingForAck(true);
 }
@@ -81,6 +84,7 @@ void ReliableMessageMgr::Shutdown()
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
     });
+    mRetransQueueSize = 0;
 
     mSystemLayer = nullptr;
 }
@@ -136,6 +140,17 @@ void ReliableMessageMgr::NotifyMessageSendAnalytics(const RetransTableEntry & en
         auto now           = System::SystemClock().GetMonotonicTimestamp();
         event.ackLatencyMs = now - entry.initialSentTime;
     }
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+    if (eventType == ReliableMessageAnalyticsDelegate::EventType::kAcknowledged && secureSession->GetRttEstimator().HasEstimate())
+    {
+        event.smoothedRttMs = secureSession->GetRttEstimator().GetSmoothedRtt();
+    }
+    if (eventType == ReliableMessageAnalyticsDelegate::EventType::kInitialSend ||
+        eventType == ReliableMessageAnalyticsDelegate::EventType::kRetransmission)
+    {
+        event.retryIntervalMs = GetBaseRetryInterval(entry);
+    }
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
 
     mAnalyticsDelegate->OnTransmitEvent(event);
 }
@@ -162,10 +177,16 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
+    // Retransmit / cancel anything in the retrans queue whose retrans timeout has expired.  Each due entry is taken off the
+    // queue, and put back with its next retrans time once it has been resent.  The count bounds the loop, so that it ends even
+    // if a resent entry is due again right away.
+    for (size_t remaining = mRetransQueueSize; remaining > 0 && mRetransQueueSize > 0; remaining--)
+    {
+        RetransTableEntry * entry = mRetransQueue[0];
         if (entry->nextRetransTime > now)
-            return Loop::Continue;
+            break;
+
+        UnscheduleRetransmission(*entry);
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -214,7 +235,7 @@ void ReliableMessageMgr::ExecuteActions()
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
             mRetransTable.ReleaseObject(entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -227,9 +248,7 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -329,8 +348,10 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     CalculateNextRetransTime(*entry);
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
     entry->initialSentTime = System::SystemClock().GetMonotonicTimestamp();
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     NotifyMessageSendAnalytics(*entry, entry->ec->GetSessionHandle(), ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     StartTimer();
@@ -342,6 +363,9 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+            UpdateRttEstimate(*entry);
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
             auto session = entry->ec->GetSessionHandle();
             NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
@@ -437,6 +461,7 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+    UnscheduleRetransmission(entry);
     mRetransTable.ReleaseObject(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
@@ -455,13 +480,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransQueueSize > 0 && mRetransQueue[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue[0]->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -538,7 +560,7 @@ void ReliableMessageMgr::SetAdditionalMRPBackoffTime(const Optional<System::Cloc
     sAdditionalMRPBackoffTime = additionalTime.ValueOr(CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST);
 }
 
-void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
+System::Clock::Timeout ReliableMessageMgr::GetBaseRetryInterval(const RetransTableEntry & entry) const
 {
     System::Clock::Timeout baseTimeout = System::Clock::Timeout(0);
     const auto sessionHandle           = entry.ec->GetSessionHandle();
@@ -556,10 +578,117 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = sessionHandle->GetMRPBaseTimeout();
     }
 
-    System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+    // The measured round trips say nothing about how long a sleepy peer stays idle, so only the active interval is tightened.
+    if (sessionHandle->IsSecureSession() && baseTimeout == sessionHandle->GetRemoteMRPConfig().mActiveRetransTimeout)
+    {
+        baseTimeout = sessionHandle->AsSecureSession()->GetRttEstimator().GetRetryInterval(baseTimeout);
+    }
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
+    return baseTimeout;
+}
+
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+void ReliableMessageMgr::UpdateRttEstimate(const RetransTableEntry & entry)
+{
+    const auto sessionHandle = entry.ec->GetSessionHandle();
+    VerifyOrReturn(entry.sendCount == 0 && sessionHandle->IsSecureSession());
+
+    auto rtt = System::SystemClock().GetMonotonicTimestamp() - entry.initialSentTime;
+    sessionHandle->AsSecureSession()->GetRttEstimator().AddSample(
+        std::chrono::duration_cast<System::Clock::Milliseconds32>(rtt));
+}
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
+void ReliableMessageMgr::ScheduleRetransmission(RetransTableEntry & entry)
+{
+    if (entry.retransQueueIndex == kNotInRetransQueue)
+    {
+        VerifyOrDie(mRetransQueueSize < MATTER_ARRAY_SIZE(mRetransQueue));
+        PlaceInRetransQueue(&entry, mRetransQueueSize++);
+        SiftUpRetransQueue(entry.retransQueueIndex);
+        return;
+    }
+
+    // The entry is already queued: its retrans time may have moved either way.
+    SiftUpRetransQueue(entry.retransQueueIndex);
+    SiftDownRetransQueue(entry.retransQueueIndex);
+}
+
+void ReliableMessageMgr::UnscheduleRetransmission(RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.retransQueueIndex != kNotInRetransQueue);
+
+    size_t index            = entry.retransQueueIndex;
+    entry.retransQueueIndex = kNotInRetransQueue;
+
+    RetransTableEntry * last = mRetransQueue[--mRetransQueueSize];
+    if (last == &entry)
+    {
+        return;
+    }
+
+    // Move the last entry of the heap to the freed slot, and restore the heap order from there.
+    PlaceInRetransQueue(last, index);
+    SiftUpRetransQueue(index);
+    SiftDownRetransQueue(last->retransQueueIndex);
+}
+
+void ReliableMessageMgr::SiftUpRetransQueue(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (mRetransQueue[parent]->nextRetransTime <= entry->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransQueue(mRetransQueue[parent], index);
+        index = parent;
+    }
+    PlaceInRetransQueue(entry, index);
+}
+
+void ReliableMessageMgr::SiftDownRetransQueue(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mRetransQueueSize)
+        {
+            break;
+        }
+        if (child + 1 < mRetransQueueSize && mRetransQueue[child + 1]->nextRetransTime < mRetransQueue[child]->nextRetransTime)
+        {
+            child++;
+        }
+        if (entry->nextRetransTime <= mRetransQueue[child]->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransQueue(mRetransQueue[child], index);
+        index = child;
+    }
+    PlaceInRetransQueue(entry, index);
+}
+
+void ReliableMessageMgr::PlaceInRetransQueue(RetransTableEntry * entry, size_t index)
+{
+    mRetransQueue[index]     = entry;
+    entry->retransQueueIndex = static_cast<uint16_t>(index);
+}
+
+void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
+{
+    System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(GetBaseRetryInterval(entry), entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    ScheduleRetransmission(entry);
 
 #if CHIP_PROGRESS_LOGGING
+    const auto sessionHandle = entry.ec->GetSessionHandle();
     const auto config       = sessionHandle->GetRemoteMRPConfig();
     uint32_t messageCounter = entry.retainedBuf.GetMessageCounter();
     auto fabricIndex        = sessionHandle->GetFabricIndex();
@@ -67,11 +67,15 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        uint16_t retransQueueIndex;               /**< Position of the entry in the retransmission queue, or
+                                                       kNotInRetransQueue while no retransmission is scheduled. */
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
     };
 
+    static constexpr uint16_t kNotInRetransQueue = UINT16_MAX;
+
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
 
@@ -79,9 +83,9 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Iterate through active exchange contexts and the retrans table entries that
+     * are due.  If an action needs to be triggered by ReliableMessageProtocol time
+     * facilities, execute that action.
      */
     void ExecuteActions();
 
@@ -243,6 +247,30 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Returns the base interval to compute the backoff of the entry from: the active or idle interval of the peer, tightened
+     * to the round-trip time estimate of the session when CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED is set and the peer is active.
+     */
+    System::Clock::Timeout GetBaseRetryInterval(const RetransTableEntry & entry) const;
+
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+    /**
+     * Feed the round-trip time of an acknowledged entry to the estimator of its session.  Entries that were retransmitted are
+     * ignored, since there is no telling which transmission the acknowledgment answers.
+     */
+    void UpdateRttEstimate(const RetransTableEntry & entry);
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
+    /**
+     * The retransmission queue is a binary min-heap on nextRetransTime of the entries waiting for a retransmission, so that
+     * the timer handler only looks at the entries that are due, and the next wake-up time is the top of the heap.
+     */
+    void ScheduleRetransmission(RetransTableEntry & entry);
+    void UnscheduleRetransmission(RetransTableEntry & entry);
+    void SiftUpRetransQueue(size_t index);
+    void SiftDownRetransQueue(size_t index);
+    void PlaceInRetransQueue(RetransTableEntry * entry, size_t index);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -265,6 +293,8 @@ private:
 
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    RetransTableEntry * mRetransQueue[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t mRetransQueueSize = 0;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
@@ -183,6 +183,39 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+ *
+ *  @brief
+ *    Enables a smoothed round-trip time estimator on secure sessions, fed by the
+ *    acknowledgments of messages that were not retransmitted.
+ *
+ *  When the peer is active, the estimate replaces the base retry interval it
+ *  announced whenever it is shorter, so that on fast links a lost message is
+ *  retransmitted after a few round trips instead of after the conservative
+ *  interval chosen for the slowest networks. The interval announced by the
+ *  peer is never lengthened, and the idle interval of a sleepy peer is never
+ *  shortened.
+ */
+#ifndef CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+#define CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED 0
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
+/**
+ *  @def CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL
+ *
+ *  @brief
+ *    The shortest base retry interval that the round-trip time estimator can
+ *    select.
+ *
+ *  The default matches CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT, so that a peer that
+ *  holds its standalone acknowledgment for as long as it is allowed to does
+ *  not trigger spurious retransmissions.
+ */
+#ifndef CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL (200_ms32)
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
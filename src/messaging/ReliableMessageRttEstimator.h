@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the round-trip time estimator used to tighten the
+ *      MRP retransmission timeout of a peer on fast links.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ *  @class ReliableMessageRttEstimator
+ *
+ *  @brief
+ *    Smoothed round-trip time estimator, computed as in RFC 6298 from the
+ *    time between the transmission of a reliable message and the reception of
+ *    its acknowledgment.
+ *
+ *    Only messages that were acknowledged without being retransmitted should
+ *    be sampled, since the acknowledgment of a retransmitted message cannot be
+ *    matched to a specific transmission.
+ *
+ *    The estimate is only ever used to shorten the base retransmission
+ *    interval announced by the peer, never to lengthen it.
+ */
+class ReliableMessageRttEstimator
+{
+public:
+    /**
+     *  Add a round-trip time sample to the estimate.
+     */
+    void AddSample(System::Clock::Milliseconds32 rtt)
+    {
+        uint32_t sample = rtt.count();
+
+        if (mSampleCount == 0)
+        {
+            // SRTT <- R, RTTVAR <- R/2
+            mScaledSmoothedRtt  = sample << kSmoothedRttShift;
+            mScaledRttVariation = (sample << kRttVariationShift) / 2;
+        }
+        else
+        {
+            // RTTVAR <- 3/4 * RTTVAR + 1/4 * |SRTT - R|
+            uint32_t smoothedRtt = GetSmoothedRtt().count();
+            uint32_t deviation   = (smoothedRtt > sample) ? smoothedRtt - sample : sample - smoothedRtt;
+            mScaledRttVariation  = mScaledRttVariation - (mScaledRttVariation >> kRttVariationShift) + deviation;
+
+            // SRTT <- 7/8 * SRTT + 1/8 * R
+            mScaledSmoothedRtt = mScaledSmoothedRtt - (mScaledSmoothedRtt >> kSmoothedRttShift) + sample;
+        }
+
+        if (mSampleCount < UINT8_MAX)
+        {
+            mSampleCount++;
+        }
+    }
+
+    /**
+     *  Drop the estimate, e.g. when the path to the peer may have changed.
+     */
+    void Reset()
+    {
+        mScaledSmoothedRtt  = 0;
+        mScaledRttVariation = 0;
+        mSampleCount        = 0;
+    }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+
+    System::Clock::Milliseconds32 GetSmoothedRtt() const
+    {
+        return System::Clock::Milliseconds32(mScaledSmoothedRtt >> kSmoothedRttShift);
+    }
+
+    System::Clock::Milliseconds32 GetRttVariation() const
+    {
+        return System::Clock::Milliseconds32(mScaledRttVariation >> kRttVariationShift);
+    }
+
+    /**
+     *  Compute the base retransmission interval to use for the peer.
+     *
+     *  @param[in] baseInterval  The base interval announced by the peer.
+     *
+     *  @return SRTT + 4 * RTTVAR, bounded by CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL, if that is shorter than
+     *          baseInterval, and baseInterval otherwise.
+     */
+    System::Clock::Milliseconds32 GetRetryInterval(System::Clock::Milliseconds32 baseInterval) const
+    {
+        using namespace System::Clock::Literals;
+
+        if (!HasEstimate())
+        {
+            return baseInterval;
+        }
+
+        System::Clock::Milliseconds32 estimate = GetSmoothedRtt() + 4 * GetRttVariation();
+        if (estimate < CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL)
+        {
+            estimate = CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL;
+        }
+
+        return (estimate < baseInterval) ? estimate : baseInterval;
+    }
+
+private:
+    // SRTT is kept scaled by 8 and RTTVAR by 4 so that the 1/8 and 1/4 gains can be applied without losing precision.
+    static constexpr unsigned kSmoothedRttShift  = 3;
+    static constexpr unsigned kRttVariationShift = 2;
+
+    uint32_t mScaledSmoothedRtt  = 0;
+    uint32_t mScaledRttVariation = 0;
+    uint8_t mSampleCount         = 0;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -20,6 +20,7 @@
  *    @file
  *      This file implements unit tests for the ExchangeManager implementation.
  */
+#include <algorithm>
 #include <errno.h>
 #include <utility>
 
@@ -29,11 +30,13 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <messaging/tests/MessagingContext.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
 
@@ -109,6 +112,57 @@ class ExpireSessionFromTimeoutDelegate : public WaitForTimeoutDelegate
     }
 };
 
+// Keeps the responder exchanges it receives messages on open, so that the test can reply on them.
+class KeepOpenResponderDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    static constexpr size_t kMaxExchanges = 8;
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        VerifyOrReturnError(mCount < kMaxExchanges, CHIP_ERROR_NO_MEMORY);
+        ec->WillSendMessage();
+        mExchanges[mCount++] = ec;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * mExchanges[kMaxExchanges] = {};
+    size_t mCount                               = 0;
+};
+
+// Records the exchanges it receives responses on.  The exchanges close once the response is handled, so only compare the
+// recorded pointers, never dereference them.
+class RecordingInitiatorDelegate : public ExchangeDelegate
+{
+public:
+    static constexpr size_t kMaxExchanges = KeepOpenResponderDelegate::kMaxExchanges;
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        VerifyOrReturnError(mCount < kMaxExchanges, CHIP_ERROR_NO_MEMORY);
+        mExchangeIds[mCount] = ec->GetExchangeId();
+        mExchanges[mCount++] = ec;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override { mTimedOut = true; }
+
+    ExchangeContext * mExchanges[kMaxExchanges] = {};
+    uint16_t mExchangeIds[kMaxExchanges]        = {};
+    size_t mCount                               = 0;
+    bool mTimedOut                              = false;
+};
+
 TEST_F(TestExchangeMgr, CheckNewContextTest)
 {
     MockAppDelegate mockAppDelegate;
@@ -260,4 +314,125 @@ TEST_F(TestExchangeMgr, CheckExchangeMessages)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 }
 
+TEST_F(TestExchangeMgr, CheckExchangeMatchingWithManyExchanges)
+{
+    // Initiator and responder exchanges live in the same exchange manager in this loopback setup, and share their exchange IDs,
+    // so each response is only delivered to the right exchange if both the role and the session are matched.
+    constexpr size_t kNumExchanges =
+        std::min<size_t>(KeepOpenResponderDelegate::kMaxExchanges, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2);
+
+    KeepOpenResponderDelegate responderDelegate;
+    RecordingInitiatorDelegate initiatorDelegate;
+    ExchangeContext * initiators[kNumExchanges];
+    uint16_t responderExchangeIds[kNumExchanges];
+
+    CHIP_ERROR err =
+        GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &responderDelegate);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    for (auto & initiator : initiators)
+    {
+        initiator = NewExchangeToAlice(&initiatorDelegate);
+        ASSERT_NE(initiator, nullptr);
+        err = initiator->SendMessage(
+            Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+            SendFlags(Messaging::SendMessageFlags::kExpectResponse).Set(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+    }
+
+    DrainAndServiceIO();
+    ASSERT_EQ(responderDelegate.mCount, kNumExchanges);
+
+    // Reply in reverse order, each response must land on the initiator exchange with the same ID.
+    for (size_t i = kNumExchanges; i > 0; i--)
+    {
+        ExchangeContext * responder = responderDelegate.mExchanges[i - 1];
+        EXPECT_FALSE(responder->IsInitiator());
+        responderExchangeIds[i - 1] = responder->GetExchangeId();
+        err = responder->SendMessage(Protocols::BDX::Id, kMsgType_TEST2,
+                                     System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+    }
+
+    DrainAndServiceIO();
+    ASSERT_EQ(initiatorDelegate.mCount, kNumExchanges);
+    EXPECT_FALSE(initiatorDelegate.mTimedOut);
+    for (size_t i = 0; i < kNumExchanges; i++)
+    {
+        EXPECT_EQ(initiatorDelegate.mExchanges[i], initiators[kNumExchanges - 1 - i]);
+        EXPECT_EQ(initiatorDelegate.mExchangeIds[i], responderExchangeIds[kNumExchanges - 1 - i]);
+    }
+
+    err = GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestExchangeMgr, BenchmarkDispatchLatencyVsLiveExchanges)
+{
+    // Not a pass/fail test: logs the cost of a request/response round trip as the number of idle live exchanges grows.
+    constexpr size_t kLiveExchangeCounts[] = { 0, 8, 32, 128 };
+    constexpr size_t kRoundTrips           = 32;
+
+    KeepOpenResponderDelegate responderDelegate;
+    WaitForTimeoutDelegate idleDelegate;
+    ExchangeContext * idleExchanges[128] = {};
+    size_t numIdleExchanges              = 0;
+
+    CHIP_ERROR err =
+        GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &responderDelegate);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    for (size_t liveExchanges : kLiveExchangeCounts)
+    {
+        while (numIdleExchanges < liveExchanges)
+        {
+            ExchangeContext * ec = NewExchangeToBob(&idleDelegate);
+            if (ec == nullptr)
+            {
+                break;
+            }
+            idleExchanges[numIdleExchanges++] = ec;
+        }
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kRoundTrips; i++)
+        {
+            RecordingInitiatorDelegate initiatorDelegate;
+            responderDelegate.mCount = 0;
+
+            ExchangeContext * initiator = NewExchangeToAlice(&initiatorDelegate);
+            ASSERT_NE(initiator, nullptr);
+            err = initiator->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                         System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                         SendFlags(Messaging::SendMessageFlags::kExpectResponse)
+                                             .Set(Messaging::SendMessageFlags::kNoAutoRequestAck));
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            DrainAndServiceIO();
+            ASSERT_EQ(responderDelegate.mCount, 1u);
+
+            err = responderDelegate.mExchanges[0]->SendMessage(Protocols::BDX::Id, kMsgType_TEST2,
+                                                               System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            DrainAndServiceIO();
+            EXPECT_EQ(initiatorDelegate.mCount, 1u);
+        }
+        uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        ChipLogProgress(ExchangeManager, "Dispatch with %u live exchanges: %u us per round trip",
+                        static_cast<unsigned>(numIdleExchanges), static_cast<unsigned>(elapsed / kRoundTrips));
+    }
+
+    for (size_t i = 0; i < numIdleExchanges; i++)
+    {
+        idleExchanges[i]->Close();
+    }
+
+    err = GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace
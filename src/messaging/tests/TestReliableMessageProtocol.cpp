@@ -572,6 +572,119 @@ TEST_F(TestReliableMessageProtocol, CheckCloseExchangeAndResendApplicationMessag
     EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
 }
 
+TEST_F(TestReliableMessageProtocol, CheckResendApplicationMessagesOnManyExchanges)
+{
+    constexpr unsigned kExchangeCount = 4;
+
+    MockAppDelegate mockSender(*this);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    // Drop the initial message of every exchange
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kExchangeCount;
+    loopback.mDroppedMessageCount = 0;
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (unsigned i = 0; i < kExchangeCount; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        EXPECT_FALSE(buffer.IsNull());
+
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+
+    // Every message was dropped and waits for its retransmission
+    EXPECT_EQ(loopback.mDroppedMessageCount, kExchangeCount);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kExchangeCount));
+
+    // Drop the first retransmission to go out too
+    loopback.mNumMessagesToDrop = 1;
+    GetIOContext().DriveIOUntil(1000_ms32, [&] { return loopback.mDroppedMessageCount >= kExchangeCount + 1; });
+    EXPECT_EQ(loopback.mDroppedMessageCount, kExchangeCount + 1);
+
+    // Every exchange should get its message acknowledged, including the one whose retransmission was dropped
+    GetIOContext().DriveIOUntil(1000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_GE(loopback.mSentMessageCount, 2 * kExchangeCount + 1);
+    EXPECT_EQ(loopback.mDroppedMessageCount, kExchangeCount + 1);
+}
+
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+TEST_F(TestReliableMessageProtocol, CheckRttEstimatorTightensActiveRetryInterval)
+{
+    constexpr auto kTestRetryInterval = System::Clock::Milliseconds32(2000_ms32);
+
+    MockAppDelegate mockSender(*this);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    auto * session = GetSessionBobToAlice()->AsSecureSession();
+    session->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        kTestRetryInterval, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        kTestRetryInterval, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    session->GetRttEstimator().Reset();
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+
+    // A message acknowledged on the first try gives the estimator its first sample
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    ExchangeContext * exchange              = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    ASSERT_TRUE(session->GetRttEstimator().HasEstimate());
+    EXPECT_LT(session->GetRttEstimator().GetSmoothedRtt(), CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL);
+    EXPECT_EQ(session->GetRttEstimator().GetRetryInterval(kTestRetryInterval), CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL);
+    const auto smoothedRtt = session->GetRttEstimator().GetSmoothedRtt();
+
+    // Drop the next message: it should be retransmitted well before the 2s interval announced by the peer
+    loopback.mNumMessagesToDrop = 1;
+    buffer                      = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    exchange                    = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(loopback.mDroppedMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    GetIOContext().DriveIOUntil(kTestRetryInterval, [&] { return rm->TestGetCountRetransTable() == 0; });
+    System::Clock::Timeout elapsed = System::SystemClock().GetMonotonicTimestamp() - startTime;
+    ChipLogProgress(Test, "Retransmitted and acknowledged after %" PRIu32 "ms", elapsed.count());
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_LT(elapsed, kTestRetryInterval);
+
+    // The acknowledgment of a retransmitted message must not be sampled
+    EXPECT_EQ(session->GetRttEstimator().GetSmoothedRtt(), smoothedRtt);
+
+    session->GetRttEstimator().Reset();
+}
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
 TEST_F(TestReliableMessageProtocol, CheckFailedMessageRetainOnSend)
 {
     chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
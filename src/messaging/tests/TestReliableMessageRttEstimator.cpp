@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <messaging/ReliableMessageRttEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+using namespace chip::System::Clock::Literals;
+
+TEST(TestReliableMessageRttEstimator, CheckNoEstimate)
+{
+    ReliableMessageRttEstimator estimator;
+
+    EXPECT_FALSE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetRetryInterval(300_ms32), 300_ms32);
+}
+
+TEST(TestReliableMessageRttEstimator, CheckFirstSample)
+{
+    ReliableMessageRttEstimator estimator;
+
+    // SRTT <- R, RTTVAR <- R/2
+    estimator.AddSample(100_ms32);
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 50_ms32);
+
+    // SRTT + 4 * RTTVAR
+    EXPECT_EQ(estimator.GetRetryInterval(2000_ms32), 300_ms32);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetRetryInterval(2000_ms32), 2000_ms32);
+}
+
+TEST(TestReliableMessageRttEstimator, CheckSmoothing)
+{
+    ReliableMessageRttEstimator estimator;
+
+    estimator.AddSample(100_ms32);
+
+    // RTTVAR <- 3/4 * 50 + 1/4 * |100 - 180| = 57.5, SRTT <- 7/8 * 100 + 1/8 * 180 = 110
+    estimator.AddSample(180_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 110_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 57_ms32);
+
+    // A steady round-trip time makes the variation decay, and the estimate converge
+    for (int i = 0; i < 64; i++)
+    {
+        estimator.AddSample(40_ms32);
+    }
+    EXPECT_LE(estimator.GetSmoothedRtt(), 41_ms32);
+    EXPECT_GE(estimator.GetSmoothedRtt(), 40_ms32);
+    EXPECT_LE(estimator.GetRttVariation(), 1_ms32);
+}
+
+TEST(TestReliableMessageRttEstimator, CheckRetryIntervalBounds)
+{
+    ReliableMessageRttEstimator estimator;
+
+    // A fast link never goes below the minimum interval
+    estimator.AddSample(2_ms32);
+    EXPECT_EQ(estimator.GetRetryInterval(2000_ms32), CHIP_CONFIG_MRP_RTT_ESTIMATOR_MIN_RETRY_INTERVAL);
+
+    // A slow link never lengthens the interval announced by the peer
+    estimator.Reset();
+    estimator.AddSample(1000_ms32);
+    EXPECT_EQ(estimator.GetRetryInterval(300_ms32), 300_ms32);
+}
+
+} // namespace
@@ -54,6 +54,15 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES
+ *
+ * The maximum number of DNS-SD resolves that can be in progress at the same time through Avahi.
+ */
+#ifndef CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES
+#define CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES 64
+#endif // CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
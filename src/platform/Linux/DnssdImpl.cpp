@@ -18,6 +18,7 @@
 #include "DnssdImpl.h"
 
 #include <algorithm>
+#include <limits>
 #include <sstream>
 #include <string.h>
 #include <string>
@@ -26,6 +27,8 @@
 
 #include <netinet/in.h>
 
+#include <avahi-common/timeval.h>
+
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/CodeUtils.h>
@@ -36,10 +39,6 @@ using chip::Dnssd::DnssdServiceProtocol;
 using chip::Dnssd::kDnssdTypeMaxSize;
 using chip::Dnssd::TextEntry;
 using chip::System::SocketEvents;
-using std::chrono::duration_cast;
-using std::chrono::microseconds;
-using std::chrono::seconds;
-using std::chrono::steady_clock;
 
 namespace {
 
@@ -157,32 +156,26 @@ Poller::Poller()
     mAvahiPoller.timeout_new    = TimeoutNew;
     mAvahiPoller.timeout_update = TimeoutUpdate;
     mAvahiPoller.timeout_free   = TimeoutFree;
-
-    mEarliestTimeout = std::chrono::steady_clock::time_point();
 }
 
 AvahiWatch * Poller::WatchNew(const struct AvahiPoll * poller, int fd, AvahiWatchEvent event, AvahiWatchCallback callback,
                               void * context)
-{
-    return reinterpret_cast<Poller *>(poller->userdata)->WatchNew(fd, event, callback, context);
-}
-
-AvahiWatch * Poller::WatchNew(int fd, AvahiWatchEvent event, AvahiWatchCallback callback, void * context)
 {
     VerifyOrDie(callback != nullptr && fd >= 0);
 
-    auto watch     = std::make_unique<AvahiWatch>();
-    watch->mSocket = fd;
+    AvahiWatch * watch = Platform::New<AvahiWatch>();
+    VerifyOrReturnValue(watch != nullptr, nullptr);
+
+    watch->mSocket    = fd;
+    watch->mCallback  = callback;
+    watch->mPendingIO = static_cast<AvahiWatchEvent>(0);
+    watch->mContext   = context;
     LogErrorOnFailure(DeviceLayer::SystemLayerSockets().StartWatchingSocket(fd, &watch->mSocketWatch));
     LogErrorOnFailure(DeviceLayer::SystemLayerSockets().SetCallback(watch->mSocketWatch, AvahiWatchCallbackTrampoline,
-                                                                    reinterpret_cast<intptr_t>(watch.get())));
-    WatchUpdate(watch.get(), event);
-    watch->mCallback = callback;
-    watch->mContext  = context;
-    watch->mPoller   = this;
-    mWatches.emplace_back(std::move(watch));
-
-    return mWatches.back().get();
+                                                                    reinterpret_cast<intptr_t>(watch)));
+    WatchUpdate(watch, event);
+
+    return watch;
 }
 
 void Poller::WatchUpdate(AvahiWatch * watch, AvahiWatchEvent event)
@@ -212,15 +205,8 @@ AvahiWatchEvent Poller::WatchGetEvents(AvahiWatch * watch)
 
 void Poller::WatchFree(AvahiWatch * watch)
 {
-    reinterpret_cast<Poller *>(watch->mPoller)->WatchFree(*watch);
-}
-
-void Poller::WatchFree(AvahiWatch & watch)
-{
-    DeviceLayer::SystemLayerSockets().StopWatchingSocket(&watch.mSocketWatch);
-    mWatches.erase(std::remove_if(mWatches.begin(), mWatches.end(),
-                                  [&watch](const std::unique_ptr<AvahiWatch> & aValue) { return aValue.get() == &watch; }),
-                   mWatches.end());
+    DeviceLayer::SystemLayerSockets().StopWatchingSocket(&watch->mSocketWatch);
+    Platform::Delete(watch);
 }
 
 AvahiTimeout * Poller::TimeoutNew(const AvahiPoll * poller, const struct timeval * timeout, AvahiTimeoutCallback callback,
@@ -228,100 +214,49 @@ AvahiTimeout * Poller::TimeoutNew(const AvahiPoll * poller, const struct timeval
 {
     VerifyOrDie(poller != nullptr && callback != nullptr);
 
-    return static_cast<Poller *>(poller->userdata)->TimeoutNew(timeout, callback, context);
-}
+    AvahiTimeout * timer = Platform::New<AvahiTimeout>();
+    VerifyOrReturnValue(timer != nullptr, nullptr);
 
-steady_clock::time_point GetAbsTimeout(const struct timeval * timeout)
-{
-    steady_clock::time_point now        = steady_clock::now();
-    steady_clock::time_point absTimeout = now;
+    timer->mCallback = callback;
+    timer->mContext  = context;
+    TimeoutUpdate(timer, timeout);
 
-    if (timeout != nullptr)
-    {
-        absTimeout += seconds(timeout->tv_sec);
-        absTimeout += microseconds(timeout->tv_usec);
-    }
-
-    return absTimeout;
-}
-
-AvahiTimeout * Poller::TimeoutNew(const struct timeval * timeout, AvahiTimeoutCallback callback, void * context)
-{
-    mTimers.emplace_back(new AvahiTimeout{ GetAbsTimeout(timeout), callback, timeout != nullptr, context, this });
-    AvahiTimeout * timer = mTimers.back().get();
-    SystemTimerUpdate(timer);
     return timer;
 }
 
 void Poller::TimeoutUpdate(AvahiTimeout * timer, const struct timeval * timeout)
 {
-    if (timeout)
+    if (timeout == nullptr)
     {
-        timer->mAbsTimeout = GetAbsTimeout(timeout);
-        timer->mEnabled    = true;
-        static_cast<Poller *>(timer->mPoller)->SystemTimerUpdate(timer);
+        DeviceLayer::SystemLayer().CancelTimer(SystemTimerCallback, timer);
+        return;
     }
-    else
+
+    // Avahi passes the absolute time at which the timeout expires, which may already be in the past. Round the delay up,
+    // so that the timer does not fire before Avahi considers it expired.
+    AvahiUsec delayUs = -avahi_age(timeout);
+    if (delayUs < 0)
     {
-        timer->mEnabled = false;
+        delayUs = 0;
     }
-}
+    System::Clock::Milliseconds32 delay(static_cast<uint32_t>(
+        std::min<AvahiUsec>((delayUs + 999) / 1000, std::numeric_limits<System::Clock::Milliseconds32::rep>::max())));
 
-void Poller::TimeoutFree(AvahiTimeout * timer)
-{
-    static_cast<Poller *>(timer->mPoller)->TimeoutFree(*timer);
+    // Starting the timer again replaces its previous expiry.
+    LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(delay, SystemTimerCallback, timer));
 }
 
-void Poller::TimeoutFree(AvahiTimeout & timer)
+void Poller::TimeoutFree(AvahiTimeout * timer)
 {
-    mTimers.erase(std::remove_if(mTimers.begin(), mTimers.end(),
-                                 [&timer](const std::unique_ptr<AvahiTimeout> & aValue) { return aValue.get() == &timer; }),
-                  mTimers.end());
+    DeviceLayer::SystemLayer().CancelTimer(SystemTimerCallback, timer);
+    Platform::Delete(timer);
 }
 
 void Poller::SystemTimerCallback(System::Layer * layer, void * data)
 {
-    static_cast<Poller *>(data)->HandleTimeout();
-}
-
-void Poller::HandleTimeout()
-{
-    mEarliestTimeout             = std::chrono::steady_clock::time_point();
-    steady_clock::time_point now = steady_clock::now();
-
-    AvahiTimeout * earliest = nullptr;
-    for (auto && timer : mTimers)
-    {
-        if (!timer->mEnabled)
-        {
-            continue;
-        }
-        if (timer->mAbsTimeout <= now)
-        {
-            timer->mCallback(timer.get(), timer->mContext);
-        }
-        else
-        {
-            if ((earliest == nullptr) || (timer->mAbsTimeout < earliest->mAbsTimeout))
-            {
-                earliest = timer.get();
-            }
-        }
-    }
-    if (earliest)
-    {
-        SystemTimerUpdate(earliest);
-    }
-}
-
-void Poller::SystemTimerUpdate(AvahiTimeout * timer)
-{
-    if ((mEarliestTimeout == std::chrono::steady_clock::time_point()) || (timer->mAbsTimeout < mEarliestTimeout))
-    {
-        mEarliestTimeout = timer->mAbsTimeout;
-        auto delay       = std::chrono::duration_cast<chip::System::Clock::Milliseconds32>(steady_clock::now() - mEarliestTimeout);
-        DeviceLayer::SystemLayer().StartTimer(delay, SystemTimerCallback, this);
-    }
+    AvahiTimeout * const timer = static_cast<AvahiTimeout *>(data);
+    // The callback may update or free the timer.
+    timer->mCallback(timer, timer->mContext);
 }
 
 CHIP_ERROR MdnsAvahi::Init(DnssdAsyncReturnCallback initCallback, DnssdAsyncReturnCallback errorCallback, void * context)
@@ -348,6 +283,14 @@ exit:
 void MdnsAvahi::Shutdown()
 {
     StopPublish();
+    // Resolvers belong to the client, so they must be freed first.
+    for (auto & resolve : mResolves)
+    {
+        if (resolve.IsInUse())
+        {
+            FreeResolveContext(resolve);
+        }
+    }
     if (mClient)
     {
         avahi_client_free(mClient);
@@ -728,7 +671,8 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
             chip::Platform::Delete(context);
             break;
         }
-        if (strcmp("local", domain) == 0)
+        // A service found on several protocols is only reported once.
+        if (strcmp("local", domain) == 0 && AddToBrowseCache(context, interface, protocol, name, type))
         {
             DnssdService service = {};
 
@@ -759,16 +703,16 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
     }
     case AVAHI_BROWSER_REMOVE:
         ChipLogProgress(DeviceLayer, "Avahi browse: remove");
-        if (strcmp("local", domain) == 0)
+        // A service is only removed once it is gone from all the protocols it was found on.
+        if (strcmp("local", domain) == 0 && RemoveFromBrowseCache(context, interface, protocol, name, type))
         {
-            // don't attempt to erase if vector has been cleared
-            if (context->mServices.size())
-            {
-                context->mServices.erase(std::remove_if(
-                    context->mServices.begin(), context->mServices.end(), [name, type](const DnssdService & service) {
-                        return strcmp(name, service.mName) == 0 && type == GetFullType(service.mType, service.mProtocol);
-                    }));
-            }
+            // Drop the service if it has not been passed to the application yet.
+            context->mServices.erase(std::remove_if(context->mServices.begin(), context->mServices.end(),
+                                                    [name, type](const DnssdService & service) {
+                                                        return strcmp(name, service.mName) == 0 &&
+                                                            type == GetFullType(service.mType, service.mProtocol);
+                                                    }),
+                                     context->mServices.end());
 
             if (context->mReceivedAllCached)
             {
@@ -798,57 +742,125 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
     }
 }
 
-MdnsAvahi::ResolveContext * MdnsAvahi::AllocateResolveContext()
+namespace {
+
+uint8_t ToProtocolMask(AvahiProtocol protocol)
 {
-    ResolveContext * context = chip::Platform::New<ResolveContext>();
-    if (context == nullptr)
+    switch (protocol)
     {
-        return nullptr;
+    case AVAHI_PROTO_INET:
+        return 1 << 0;
+    case AVAHI_PROTO_INET6:
+        return 1 << 1;
+    default:
+        return 1 << 2;
     }
+}
+
+} // namespace
 
-    context->mNumber = mResolveCount++;
-    mAllocatedResolves.push_back(context);
+bool MdnsAvahi::AddToBrowseCache(BrowseContext * context, AvahiIfIndex interface, AvahiProtocol protocol, const char * name,
+                                 const char * type)
+{
+    for (auto & entry : context->mCache)
+    {
+        if (entry.mInterface == interface && strcmp(entry.mName, name) == 0 && strcmp(entry.mType, type) == 0)
+        {
+            bool isNew = (entry.mProtocols == 0);
+            entry.mProtocols |= ToProtocolMask(protocol);
+            return isNew;
+        }
+    }
 
-    return context;
+    BrowseCacheEntry entry;
+    Platform::CopyString(entry.mName, name);
+    Platform::CopyString(entry.mType, type);
+    entry.mInterface = interface;
+    entry.mProtocols = ToProtocolMask(protocol);
+    context->mCache.push_back(entry);
+    return true;
 }
 
-MdnsAvahi::ResolveContext * MdnsAvahi::ResolveContextForHandle(size_t handle)
+bool MdnsAvahi::RemoveFromBrowseCache(BrowseContext * context, AvahiIfIndex interface, AvahiProtocol protocol,
+                                      const char * name, const char * type)
+{
+    auto entry = std::find_if(context->mCache.begin(), context->mCache.end(), [interface, name, type](const BrowseCacheEntry & e) {
+        return e.mInterface == interface && strcmp(e.mName, name) == 0 && strcmp(e.mType, type) == 0;
+    });
+    VerifyOrReturnValue(entry != context->mCache.end(), false);
+
+    entry->mProtocols &= static_cast<uint8_t>(~ToProtocolMask(protocol));
+    VerifyOrReturnValue(entry->mProtocols == 0, false);
+
+    context->mCache.erase(entry);
+    return true;
+}
+
+MdnsAvahi::ResolveContext * MdnsAvahi::AllocateResolveContext()
 {
-    for (auto it : mAllocatedResolves)
+    for (auto & context : mResolves)
     {
-        if (it->mNumber == handle)
+        if (!context.IsInUse())
         {
-            return it;
+            context         = ResolveContext();
+            context.mNumber = mResolveCount++;
+            if (mResolveCount == kFreeResolveNumber)
+            {
+                mResolveCount++;
+            }
+            return &context;
         }
     }
+
     return nullptr;
 }
 
-void MdnsAvahi::FreeResolveContext(size_t handle)
+MdnsAvahi::ResolveContext * MdnsAvahi::ResolveContextForHandle(size_t handle)
 {
-    for (auto it = mAllocatedResolves.begin(); it != mAllocatedResolves.end(); it++)
+    VerifyOrReturnValue(handle != kFreeResolveNumber, nullptr);
+
+    for (auto & context : mResolves)
     {
-        if ((*it)->mNumber == handle)
+        if (context.mNumber == handle)
         {
-            chip::Platform::Delete(*it);
-            mAllocatedResolves.erase(it);
-            return;
+            return &context;
         }
     }
+    return nullptr;
 }
 
-void MdnsAvahi::StopResolve(const char * name)
+void MdnsAvahi::FreeResolveContext(size_t handle)
 {
-    auto truncate_end = std::remove_if(mAllocatedResolves.begin(), mAllocatedResolves.end(),
-                                       [name](ResolveContext * ctx) { return strcmp(ctx->mName, name) == 0; });
+    ResolveContext * context = ResolveContextForHandle(handle);
+    if (context != nullptr)
+    {
+        FreeResolveContext(*context);
+    }
+}
 
-    for (auto it = truncate_end; it != mAllocatedResolves.end(); it++)
+void MdnsAvahi::FreeResolveContext(ResolveContext & context)
+{
+    if (context.mResolver != nullptr)
     {
-        (*it)->mCallback((*it)->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_CANCELLED);
-        chip::Platform::Delete(*it);
+        avahi_service_resolver_free(context.mResolver);
+        context.mResolver = nullptr;
     }
+    context.mNumber = kFreeResolveNumber;
+}
 
-    mAllocatedResolves.erase(truncate_end, mAllocatedResolves.end());
+void MdnsAvahi::StopResolve(const char * name)
+{
+    for (auto & context : mResolves)
+    {
+        if (context.IsInUse() && strcmp(context.mName, name) == 0)
+        {
+            // Free the context before the callback, which may start a new resolve.
+            DnssdResolveCallback callback = context.mCallback;
+            void * callbackContext        = context.mContext;
+            FreeResolveContext(context);
+            callback(callbackContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_CANCELLED);
+        }
+    }
 }
 
 CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdServiceProtocol protocol, Inet::IPAddressType addressType,
@@ -876,11 +888,11 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     resolveContext->mInterface   = avahiInterface;
     resolveContext->mTransport   = ToAvahiProtocol(transportType);
     resolveContext->mAddressType = ToAvahiProtocol(addressType);
-    resolveContext->mFullType    = GetFullType(type, protocol);
+    snprintf(resolveContext->mFullType, sizeof(resolveContext->mFullType), "%s.%s", type, GetProtocolString(protocol));
 
     resolveContext->mResolver =
-        avahi_service_resolver_new(mClient, avahiInterface, resolveContext->mTransport, name, resolveContext->mFullType.c_str(),
-                                   nullptr, resolveContext->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve,
+        avahi_service_resolver_new(mClient, avahiInterface, resolveContext->mTransport, name, resolveContext->mFullType, nullptr,
+                                   resolveContext->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve,
                                    reinterpret_cast<void *>(resolveContext->mNumber));
     // Otherwise the resolver will be freed in the callback
     if (resolveContext->mResolver == nullptr)
@@ -915,7 +927,7 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
             ChipLogProgress(DeviceLayer, "Re-trying resolve");
             avahi_service_resolver_free(resolver);
             context->mResolver = avahi_service_resolver_new(
-                context->mInstance->mClient, context->mInterface, context->mTransport, context->mName, context->mFullType.c_str(),
+                context->mInstance->mClient, context->mInterface, context->mTransport, context->mName, context->mFullType,
                 nullptr, context->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve, userdata);
             if (context->mResolver == nullptr)
             {
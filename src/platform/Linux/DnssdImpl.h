@@ -21,8 +21,6 @@
 #include <unistd.h>
 
 #include <atomic>
-#include <chrono>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -36,6 +34,7 @@
 #include <avahi-common/watch.h>
 
 #include <lib/dnssd/platform/Dnssd.h>
+#include <platform/CHIPDeviceConfig.h>
 #include <system/SystemLayer.h>
 
 struct AvahiWatch
@@ -45,58 +44,47 @@ struct AvahiWatch
     AvahiWatchCallback mCallback; ///< The function to be called when interested events happened on mFd.
     AvahiWatchEvent mPendingIO;   ///< The pending events from the currently active or most recent callback.
     void * mContext;              ///< A pointer to application-specific context.
-    void * mPoller;               ///< The poller created this watch.
 };
 
 struct AvahiTimeout
 {
-    std::chrono::steady_clock::time_point mAbsTimeout; ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback;                    ///< The function to be called when timeout.
-    bool mEnabled;                                     ///< Whether the timeout is enabled.
-    void * mContext;                                   ///< The pointer to application-specific context.
-    void * mPoller;                                    ///< The poller created this timer.
+    AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
+    void * mContext;                ///< The pointer to application-specific context.
 };
 
 namespace chip {
 namespace Dnssd {
 
+/**
+ * Implements the Avahi poll API on top of the System::Layer: each watch is a socket watch of the system layer, and
+ * each timeout is a system layer timer of its own, so Avahi events are dispatched directly by the CHIP event loop.
+ */
 class Poller
 {
 public:
     Poller(void);
 
-    void HandleTimeout();
-
     const AvahiPoll * GetAvahiPoll(void) const { return &mAvahiPoller; }
 
 private:
     static AvahiWatch * WatchNew(const struct AvahiPoll * poller, int fd, AvahiWatchEvent event, AvahiWatchCallback callback,
                                  void * context);
-    AvahiWatch * WatchNew(int fd, AvahiWatchEvent event, AvahiWatchCallback callback, void * context);
 
     static void WatchUpdate(AvahiWatch * watch, AvahiWatchEvent event);
 
     static AvahiWatchEvent WatchGetEvents(AvahiWatch * watch);
 
     static void WatchFree(AvahiWatch * watch);
-    void WatchFree(AvahiWatch & watch);
 
     static AvahiTimeout * TimeoutNew(const AvahiPoll * poller, const struct timeval * timeout, AvahiTimeoutCallback callback,
                                      void * context);
-    AvahiTimeout * TimeoutNew(const struct timeval * timeout, AvahiTimeoutCallback callback, void * context);
 
     static void TimeoutUpdate(AvahiTimeout * timer, const struct timeval * timeout);
 
     static void TimeoutFree(AvahiTimeout * timer);
-    void TimeoutFree(AvahiTimeout & timer);
 
-    void SystemTimerUpdate(AvahiTimeout * timer);
     static void SystemTimerCallback(System::Layer * layer, void * data);
 
-    std::vector<std::unique_ptr<AvahiWatch>> mWatches;
-    std::vector<std::unique_ptr<AvahiTimeout>> mTimers;
-    std::chrono::steady_clock::time_point mEarliestTimeout;
-
     AvahiPoll mAvahiPoller;
 };
 
@@ -124,6 +112,16 @@ public:
     static MdnsAvahi & GetInstance() { return sInstance; }
 
 private:
+    // A service found by a browse. Avahi reports services once per interface and protocol; the reports for the
+    // different protocols of an interface are merged, since they resolve to the same service.
+    struct BrowseCacheEntry
+    {
+        char mName[Common::kInstanceNameMaxLength + 1];
+        char mType[kDnssdTypeAndProtocolMaxSize + 1];
+        AvahiIfIndex mInterface;
+        uint8_t mProtocols; // Bit mask of the Avahi protocols the service is currently found on.
+    };
+
     struct BrowseContext
     {
         MdnsAvahi * mInstance;
@@ -131,6 +129,7 @@ private:
         void * mContext;
         Inet::IPAddressType mAddressType;
         std::vector<DnssdService> mServices;
+        std::vector<BrowseCacheEntry> mCache;
         bool mReceivedAllCached;
         AvahiIfIndex mInterface;
         std::string mProtocol;
@@ -138,9 +137,12 @@ private:
         AvahiServiceBrowser * mBrowser;
     };
 
+    // The number of the resolve context slots that are not in use.
+    static constexpr size_t kFreeResolveNumber = 0;
+
     struct ResolveContext
     {
-        size_t mNumber; // unique number for this context
+        size_t mNumber = kFreeResolveNumber; // unique number for this context
         MdnsAvahi * mInstance;
         DnssdResolveCallback mCallback;
         void * mContext;
@@ -148,29 +150,29 @@ private:
         AvahiIfIndex mInterface;
         AvahiProtocol mTransport;
         AvahiProtocol mAddressType;
-        std::string mFullType;
+        char mFullType[kDnssdTypeAndProtocolMaxSize + 1];
         uint8_t mAttempts                = 0;
         AvahiServiceResolver * mResolver = nullptr;
 
-        ~ResolveContext()
-        {
-            if (mResolver != nullptr)
-            {
-                avahi_service_resolver_free(mResolver);
-                mResolver = nullptr;
-            }
-        }
+        bool IsInUse() const { return mNumber != kFreeResolveNumber; }
     };
 
     MdnsAvahi() : mClient(nullptr) {}
     static MdnsAvahi sInstance;
 
-    /// Allocates a new resolve context with a unique `mNumber`
+    /// Allocates a new resolve context with a unique `mNumber`, or returns nullptr when all of them are in use.
     ResolveContext * AllocateResolveContext();
 
     ResolveContext * ResolveContextForHandle(size_t handle);
     void FreeResolveContext(size_t handle);
-    void FreeResolveContext(const char * name);
+    void FreeResolveContext(ResolveContext & context);
+
+    /// Records a service reported by a browse, and returns whether it was not known yet.
+    static bool AddToBrowseCache(BrowseContext * context, AvahiIfIndex interface, AvahiProtocol protocol, const char * name,
+                                 const char * type);
+    /// Forgets a service reported by a browse, and returns whether it is no longer found on any protocol.
+    static bool RemoveFromBrowseCache(BrowseContext * context, AvahiIfIndex interface, AvahiProtocol protocol, const char * name,
+                                      const char * type);
 
     static void HandleClientState(AvahiClient * client, AvahiClientState state, void * context);
     void HandleClientState(AvahiClient * client, AvahiClientState state);
@@ -197,8 +199,8 @@ private:
     static constexpr size_t kMaxBrowseRetries = 4;
 
     // Handling of allocated resolves
-    size_t mResolveCount = 0;
-    std::list<ResolveContext *> mAllocatedResolves;
+    size_t mResolveCount = kFreeResolveNumber + 1;
+    ResolveContext mResolves[CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES];
 };
 
 } // namespace Dnssd
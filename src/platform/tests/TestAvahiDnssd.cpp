@@ -0,0 +1,455 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    Tests the parts of the Avahi DNS-SD implementation that do not need an Avahi daemon: the Avahi poll API
+ *    implemented on top of System::Layer timers, and the pool of resolve contexts. The Avahi resolver functions
+ *    are replaced by fakes, so that resolves can be started and completed without a client.
+ */
+
+#include <sys/time.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <avahi-common/timeval.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/DnssdImpl.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+using namespace chip;
+using namespace chip::Dnssd;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+struct FakeResolver
+{
+    AvahiServiceResolverCallback mCallback;
+    void * mUserData;
+    bool mFreed;
+};
+
+std::vector<FakeResolver *> sResolvers;
+size_t sFreedResolvers = 0;
+
+} // namespace
+
+// Stand-ins for the Avahi resolver, which needs a client connected to the daemon.
+extern "C" AvahiServiceResolver * avahi_service_resolver_new(AvahiClient * client, AvahiIfIndex interface, AvahiProtocol protocol,
+                                                             const char * name, const char * type, const char * domain,
+                                                             AvahiProtocol aprotocol, AvahiLookupFlags flags,
+                                                             AvahiServiceResolverCallback callback, void * userdata)
+{
+    sResolvers.push_back(new FakeResolver{ callback, userdata, false });
+    return reinterpret_cast<AvahiServiceResolver *>(sResolvers.back());
+}
+
+extern "C" int avahi_service_resolver_free(AvahiServiceResolver * resolver)
+{
+    reinterpret_cast<FakeResolver *>(resolver)->mFreed = true;
+    sFreedResolvers++;
+    return 0;
+}
+
+namespace {
+
+// Runs the timers started by the poller from the mock clock instead of an event loop.
+class TimerAndMockClock : public System::Clock::Internal::MockClock, public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+    bool HasPendingTimers() const { return !mTimerList.Empty(); }
+
+    // Time left until the earliest timer fires.
+    System::Clock::Milliseconds64 GetNextTimerDelay()
+    {
+        return std::chrono::duration_cast<System::Clock::Milliseconds64>(mTimerList.Earliest()->AwakenTime() -
+                                                                         GetMonotonicTimestamp());
+    }
+
+    CHIP_ERROR StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        // Like the real system layers, starting a timer replaces the pending one with the same callback and state.
+        CancelTimer(aComplete, aAppState);
+        System::Clock::Timestamp awakenTime =
+            GetMonotonicMilliseconds64() + std::chrono::duration_cast<System::Clock::Milliseconds64>(aDelay);
+        mTimerList.Add(mTimerNodes.Create(*this, awakenTime, aComplete, aAppState));
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != System::Clock::Timeout(0);
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Like one iteration of the event loop: runs the timers that expired by the new time, but not the ones they start.
+    void AdvanceMonotonic(System::Clock::Milliseconds64 increment)
+    {
+        const System::Clock::Milliseconds64 timestamp = GetMonotonicMilliseconds64() + increment;
+        SetMonotonic(timestamp);
+
+        System::TimerList expired = mTimerList.ExtractEarlier(timestamp + 1_ms64);
+        System::TimerList::Node * node;
+        while ((node = expired.PopEarliest()) != nullptr)
+        {
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+// The absolute time, as Avahi passes it to the poll API, at the given offset from now.
+timeval Deadline(AvahiUsec fromNowUs)
+{
+    timeval tv;
+    gettimeofday(&tv, nullptr);
+    AvahiUsec usec = static_cast<AvahiUsec>(tv.tv_usec) + fromNowUs;
+    tv.tv_sec += static_cast<time_t>(usec / 1000000);
+    usec %= 1000000;
+    if (usec < 0)
+    {
+        tv.tv_sec--;
+        usec += 1000000;
+    }
+    tv.tv_usec = static_cast<suseconds_t>(usec);
+    return tv;
+}
+
+struct TimeoutRecord
+{
+    const AvahiPoll * mPoll = nullptr;
+    unsigned mCalls         = 0;
+    bool mFreeOnCall        = false;
+    timeval mRescheduleTo{};
+    bool mRescheduleOnCall = false;
+};
+
+void OnTimeout(AvahiTimeout * timeout, void * context)
+{
+    auto * record = static_cast<TimeoutRecord *>(context);
+    record->mCalls++;
+    if (record->mFreeOnCall)
+    {
+        record->mPoll->timeout_free(timeout);
+    }
+    else if (record->mRescheduleOnCall)
+    {
+        record->mRescheduleOnCall = false;
+        record->mPoll->timeout_update(timeout, &record->mRescheduleTo);
+    }
+}
+
+struct ResolveRecord
+{
+    std::vector<CHIP_ERROR> mErrors;
+    // Resolver frees seen when the callback was called.
+    size_t mFreedResolversOnCall = 0;
+    // Resolve to start from the callback, and its result.
+    const char * mResolveOnCall = nullptr;
+    CHIP_ERROR mResolveOnCallError = CHIP_ERROR_INTERNAL;
+};
+
+void OnResolve(void * context, DnssdService * result, const Span<Inet::IPAddress> & addresses, CHIP_ERROR error)
+{
+    auto * record = static_cast<ResolveRecord *>(context);
+    record->mErrors.push_back(error);
+    record->mFreedResolversOnCall = sFreedResolvers;
+    if (record->mResolveOnCall != nullptr)
+    {
+        record->mResolveOnCallError =
+            MdnsAvahi::GetInstance().Resolve(record->mResolveOnCall, "_matter", DnssdServiceProtocol::kDnssdProtocolTcp,
+                                             Inet::IPAddressType::kAny, Inet::IPAddressType::kAny, Inet::InterfaceId::Null(),
+                                             OnResolve, record);
+    }
+}
+
+CHIP_ERROR StartResolve(const std::string & name, ResolveRecord & record)
+{
+    return MdnsAvahi::GetInstance().Resolve(name.c_str(), "_matter", DnssdServiceProtocol::kDnssdProtocolTcp,
+                                            Inet::IPAddressType::kAny, Inet::IPAddressType::kAny, Inet::InterfaceId::Null(),
+                                            OnResolve, &record);
+}
+
+std::string ResolveName(size_t index)
+{
+    return "instance-" + std::to_string(index);
+}
+
+class TestAvahiDnssd : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        sSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&sTimerAndClock);
+        DeviceLayer::SetSystemLayerForTesting(&sTimerAndClock);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sTimerAndClock.Shutdown();
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        System::Clock::Internal::SetSystemClockForTesting(sSavedClock);
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        sTimerAndClock.Clear();
+        sFreedResolvers = 0;
+    }
+
+    void TearDown() override
+    {
+        for (auto * resolver : sResolvers)
+        {
+            delete resolver;
+        }
+        sResolvers.clear();
+    }
+
+protected:
+    static const AvahiPoll * GetPoll() { return MdnsAvahi::GetInstance().GetPoller().GetAvahiPoll(); }
+
+    static TimerAndMockClock sTimerAndClock;
+    static System::Clock::ClockBase * sSavedClock;
+};
+
+TimerAndMockClock TestAvahiDnssd::sTimerAndClock;
+System::Clock::ClockBase * TestAvahiDnssd::sSavedClock = nullptr;
+
+TEST_F(TestAvahiDnssd, TimeoutDoesNotFireBeforeItsDeadline)
+{
+    const AvahiPoll * poll = GetPoll();
+    TimeoutRecord record{ poll };
+
+    const timeval deadline = Deadline(10500);
+    AvahiTimeout * timeout = poll->timeout_new(poll, &deadline, OnTimeout, &record);
+    ASSERT_NE(timeout, nullptr);
+    const AvahiUsec leftUs = -avahi_age(&deadline);
+
+    // The delay is rounded up to whole milliseconds.
+    ASSERT_TRUE(sTimerAndClock.HasPendingTimers());
+    const System::Clock::Milliseconds64 delay = sTimerAndClock.GetNextTimerDelay();
+    EXPECT_GE(static_cast<AvahiUsec>(delay.count()) * 1000, leftUs);
+    EXPECT_LE(delay.count(), 11u);
+
+    sTimerAndClock.AdvanceMonotonic(delay - 1_ms64);
+    EXPECT_EQ(record.mCalls, 0u);
+    sTimerAndClock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(record.mCalls, 1u);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+
+    poll->timeout_free(timeout);
+}
+
+TEST_F(TestAvahiDnssd, ExpiredTimeoutFiresOnNextIteration)
+{
+    const AvahiPoll * poll = GetPoll();
+    TimeoutRecord record{ poll };
+
+    const timeval deadline = Deadline(-1000000);
+    AvahiTimeout * timeout = poll->timeout_new(poll, &deadline, OnTimeout, &record);
+    ASSERT_NE(timeout, nullptr);
+    EXPECT_EQ(sTimerAndClock.GetNextTimerDelay(), 0_ms64);
+
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(record.mCalls, 1u);
+
+    poll->timeout_free(timeout);
+}
+
+TEST_F(TestAvahiDnssd, FarTimeoutIsClampedToLongestTimer)
+{
+    const AvahiPoll * poll = GetPoll();
+    TimeoutRecord record{ poll };
+
+    // More than what fits in System::Clock::Milliseconds32.
+    const timeval deadline = Deadline(static_cast<AvahiUsec>(std::numeric_limits<uint32_t>::max()) * 1000 * 2);
+    AvahiTimeout * timeout = poll->timeout_new(poll, &deadline, OnTimeout, &record);
+    ASSERT_NE(timeout, nullptr);
+    EXPECT_EQ(sTimerAndClock.GetNextTimerDelay().count(), std::numeric_limits<uint32_t>::max());
+
+    poll->timeout_free(timeout);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+}
+
+TEST_F(TestAvahiDnssd, UpdateReplacesOrCancelsTimeout)
+{
+    const AvahiPoll * poll = GetPoll();
+    TimeoutRecord record{ poll };
+
+    // A timeout created without a deadline is disabled.
+    AvahiTimeout * timeout = poll->timeout_new(poll, nullptr, OnTimeout, &record);
+    ASSERT_NE(timeout, nullptr);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+
+    timeval deadline = Deadline(5000);
+    poll->timeout_update(timeout, &deadline);
+    ASSERT_TRUE(sTimerAndClock.HasPendingTimers());
+
+    // Moving the deadline replaces the pending timer rather than adding one.
+    deadline = Deadline(50000);
+    poll->timeout_update(timeout, &deadline);
+    sTimerAndClock.AdvanceMonotonic(10_ms64);
+    EXPECT_EQ(record.mCalls, 0u);
+    EXPECT_GE(sTimerAndClock.GetNextTimerDelay(), 30_ms64);
+
+    poll->timeout_update(timeout, nullptr);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+    sTimerAndClock.AdvanceMonotonic(100_ms64);
+    EXPECT_EQ(record.mCalls, 0u);
+
+    // Freeing a pending timeout cancels its timer.
+    deadline = Deadline(5000);
+    poll->timeout_update(timeout, &deadline);
+    poll->timeout_free(timeout);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+}
+
+TEST_F(TestAvahiDnssd, CallbackMayRescheduleOrFreeItsTimeout)
+{
+    const AvahiPoll * poll = GetPoll();
+    TimeoutRecord record{ poll };
+    record.mRescheduleOnCall = true;
+    record.mRescheduleTo     = Deadline(-1);
+
+    const timeval deadline = Deadline(0);
+    AvahiTimeout * timeout = poll->timeout_new(poll, &deadline, OnTimeout, &record);
+    ASSERT_NE(timeout, nullptr);
+
+    // The timer started again from the callback runs on the next iteration only.
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(record.mCalls, 1u);
+    EXPECT_TRUE(sTimerAndClock.HasPendingTimers());
+
+    record.mFreeOnCall = true;
+    sTimerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(record.mCalls, 2u);
+    EXPECT_FALSE(sTimerAndClock.HasPendingTimers());
+}
+
+TEST_F(TestAvahiDnssd, ResolvesAreLimitedByThePool)
+{
+    ResolveRecord record;
+
+    for (size_t i = 0; i < CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES; i++)
+    {
+        ASSERT_EQ(StartResolve(ResolveName(i), record), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(StartResolve("one-too-many", record), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(sResolvers.size(), static_cast<size_t>(CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES));
+
+    // A completed resolve gives its context back.
+    FakeResolver * first = sResolvers.front();
+    first->mCallback(reinterpret_cast<AvahiServiceResolver *>(first), AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6, AVAHI_RESOLVER_FOUND,
+                     ResolveName(0).c_str(), "_matter._tcp", "local", "host.local", nullptr, 5540, nullptr,
+                     static_cast<AvahiLookupResultFlags>(0), first->mUserData);
+    ASSERT_EQ(record.mErrors.size(), 1u);
+    EXPECT_EQ(record.mErrors.back(), CHIP_ERROR_INVALID_ADDRESS);
+    EXPECT_TRUE(first->mFreed);
+    EXPECT_EQ(StartResolve("one-too-many", record), CHIP_NO_ERROR);
+    EXPECT_EQ(StartResolve("two-too-many", record), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 1; i < CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES; i++)
+    {
+        MdnsAvahi::GetInstance().StopResolve(ResolveName(i).c_str());
+    }
+    MdnsAvahi::GetInstance().StopResolve("one-too-many");
+    EXPECT_EQ(record.mErrors.size(), static_cast<size_t>(CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES) + 1);
+    EXPECT_EQ(sFreedResolvers, sResolvers.size());
+}
+
+TEST_F(TestAvahiDnssd, StopResolveFreesTheContextBeforeTheCallback)
+{
+    ResolveRecord filler;
+    for (size_t i = 0; i < CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES - 1; i++)
+    {
+        ASSERT_EQ(StartResolve(ResolveName(i), filler), CHIP_NO_ERROR);
+    }
+
+    // The last context of the pool is handed over to a new resolve from the cancellation callback.
+    ResolveRecord record;
+    record.mResolveOnCall = "restarted";
+    ASSERT_EQ(StartResolve("stopped", record), CHIP_NO_ERROR);
+    FakeResolver * stopped = sResolvers.back();
+
+    MdnsAvahi::GetInstance().StopResolve("stopped");
+    ASSERT_EQ(record.mErrors.size(), 1u);
+    EXPECT_EQ(record.mErrors[0], CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(record.mFreedResolversOnCall, 1u);
+    EXPECT_TRUE(stopped->mFreed);
+    EXPECT_EQ(record.mResolveOnCallError, CHIP_NO_ERROR);
+
+    // A late result for the stopped resolve does not reach the resolve that reused its context.
+    record.mResolveOnCall = nullptr;
+    stopped->mCallback(reinterpret_cast<AvahiServiceResolver *>(stopped), AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6,
+                       AVAHI_RESOLVER_FAILURE, "stopped", "_matter._tcp", "local", nullptr, nullptr, 0, nullptr,
+                       static_cast<AvahiLookupResultFlags>(0), stopped->mUserData);
+    EXPECT_EQ(record.mErrors.size(), 1u);
+
+    MdnsAvahi::GetInstance().StopResolve("restarted");
+    EXPECT_EQ(record.mErrors.size(), 2u);
+    for (size_t i = 0; i < CHIP_DEVICE_CONFIG_AVAHI_MAX_RESOLVES - 1; i++)
+    {
+        MdnsAvahi::GetInstance().StopResolve(ResolveName(i).c_str());
+    }
+    EXPECT_EQ(sFreedResolvers, sResolvers.size());
+}
+
+} // namespace
@@ -458,7 +458,8 @@ CHIP_ERROR CASESession::Init(SessionManager & sessionManager, Credentials::Certi
     mValidContext.Reset();
     mValidContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
     mValidContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
-    mValidContext.mValidityPolicy = policy;
+    mValidContext.mValidityPolicy    = policy;
+    mValidContext.mVerifiedCertCache = mVerifiedCertCache;
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     mTCPConnCbCtxt.appContext     = this;
@@ -2017,6 +2018,8 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
         // Copy remaining needed data into work structure
         {
             data.validContext = mValidContext;
+            // The certificate chain is validated on a background thread and the cache is not thread-safe.
+            data.validContext.mVerifiedCertCache = nullptr;
 
             // initiatorNOC and initiatorICAC are spans into msgR3Encrypted
             // which is going away, so to save memory, redirect them to their
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/FabricTable.h>
 #include <credentials/GroupDataProvider.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/ScopedNodeId.h>
 #include <lib/core/TLV.h>
@@ -118,6 +119,17 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief Set an optional cache of already verified certificate signatures.
+     *
+     * When set, signatures of the peer's ICAC (and any other chain element) that were
+     * verified by a previous handshake are not verified again. Validity period checks
+     * are still applied. The cache is only consulted on the event loop thread.
+     *
+     * @param cache - Pointer to the cache, or nullptr to always verify every signature.
+     */
+    void SetVerifiedCertificateCache(Credentials::VerifiedCertificateCache * cache) { mVerifiedCertCache = cache; }
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -566,7 +578,8 @@ private:
     Crypto::P256Keypair * mEphemeralKey = nullptr;
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
-    Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    Credentials::GroupDataProvider * mGroupDataProvider        = nullptr;
+    Credentials::VerifiedCertificateCache * mVerifiedCertCache = nullptr;
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
@@ -55,6 +55,9 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+    mPreparedEncryptionKey.Release();
+    mPreparedDecryptionKey.Release();
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -87,6 +90,8 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     mSessionRole  = role;
     mKeystore     = &keystore;
 
+    PrepareSessionKeys();
+
     return CHIP_NO_ERROR;
 }
 
@@ -112,6 +117,8 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     mSessionRole  = role;
     mKeystore     = &keystore;
 
+    PrepareSessionKeys();
+
     return CHIP_NO_ERROR;
 }
 
@@ -128,6 +135,13 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(SessionKeystore & keystore, const Cryp
     return InitFromSecret(keystore, secret.Span(), salt, infoType, role);
 }
 
+void CryptoContext::PrepareSessionKeys()
+{
+    // Failing to prepare a key is not fatal: Encrypt() and Decrypt() fall back to the one-shot AES-CCM functions.
+    LogErrorOnFailure(mPreparedEncryptionKey.Prepare(mEncryptionKey, AesCcm128PreparedKey::Direction::kEncrypt));
+    LogErrorOnFailure(mPreparedDecryptionKey.Prepare(mDecryptionKey, AesCcm128PreparedKey::Direction::kDecrypt));
+}
+
 #if CHIP_CONFIG_SECURITY_TEST_MODE
 CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey,
                                        Crypto::Aes128KeyHandle & r2iKey)
@@ -220,8 +234,16 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+        if (mPreparedEncryptionKey.IsPrepared())
+        {
+            ReturnErrorOnFailure(mPreparedEncryptionKey.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(),
+                                                                output, tag, taglen));
+        }
+        else
+        {
+            ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(),
+                                                 output, tag, taglen));
+        }
     }
 
     mac.SetTag(&header, tag, taglen);
@@ -255,8 +277,16 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+        if (mPreparedDecryptionKey.IsPrepared())
+        {
+            ReturnErrorOnFailure(mPreparedDecryptionKey.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(),
+                                                                nonce.size(), output));
+        }
+        else
+        {
+            ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(),
+                                                 nonce.size(), output));
+        }
     }
     return CHIP_NO_ERROR;
 }
@@ -168,6 +168,7 @@ public:
     bool IsResponder() const { return mKeyAvailable && mSessionRole == SessionRole::kResponder; }
 
 private:
+    void PrepareSessionKeys();
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
 
     SessionRole mSessionRole;
@@ -175,6 +176,9 @@ private:
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+    // Session keys expanded once for the fast AES-CCM path; not used when mKeyContext is set.
+    Crypto::AesCcm128PreparedKey mPreparedEncryptionKey;
+    Crypto::AesCcm128PreparedKey mPreparedDecryptionKey;
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
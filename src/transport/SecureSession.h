@@ -25,6 +25,9 @@
 #include <ble/Ble.h>
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+#include <messaging/ReliableMessageRttEstimator.h>
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
 #include <transport/CryptoContext.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
@@ -272,6 +275,11 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+    Messaging::ReliableMessageRttEstimator & GetRttEstimator() { return mRttEstimator; }
+    const Messaging::ReliableMessageRttEstimator & GetRttEstimator() const { return mRttEstimator; }
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -351,6 +359,9 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+#if CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+    Messaging::ReliableMessageRttEstimator mRttEstimator;
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
 };
 
 } // namespace Transport
@@ -222,7 +222,14 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
-        return connection->mEndPoint->Send(std::move(msgBuf));
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+        // When earlier messages are still waiting for the socket to drain, only queue this one: the endpoint already
+        // waits for the socket to be writable, and then sends the whole burst with a single call.
+        const bool push = connection->mEndPoint->PendingSendLength() == 0;
+#else
+        const bool push = true;
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+        return connection->mEndPoint->Send(std::move(msgBuf), push);
     }
 
     return SendAfterConnect(address, std::move(msgBuf));
@@ -24,9 +24,11 @@
 #include "NetworkTestHelpers.h"
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <utility>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -37,6 +39,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/UnitTestUtils.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <transport/TransportMgr.h>
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -205,6 +208,54 @@ public:
         SetCallback(nullptr);
     }
 
+    void ThroughputTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port, int messageCount, int burstSize, size_t payloadSize)
+    {
+        std::vector<uint8_t> payload(payloadSize);
+        for (size_t i = 0; i < payloadSize; i++)
+        {
+            payload[i] = static_cast<uint8_t>(i);
+        }
+
+        SetCallback(
+            [](const uint8_t * message, size_t length, int count, void * data) {
+                return memcmp(message, static_cast<std::vector<uint8_t> *>(data)->data(), length);
+            },
+            &payload);
+        mReceiveHandlerCallCount = 0;
+
+        // Messages are sent in bursts queued without driving any I/O in between, the way several messages produced by
+        // the same event are, and each burst is drained before the next one so that the buffers in flight stay bounded.
+        const uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (int sent = 0; sent < messageCount;)
+        {
+            for (int i = 0; i < burstSize && sent < messageCount; i++, sent++)
+            {
+                System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(payload.data(), payload.size());
+                ASSERT_FALSE(buffer.IsNull());
+
+                PacketHeader header;
+                header.SetSourceNodeId(kSourceNodeId)
+                    .SetDestinationNodeId(kDestinationNodeId)
+                    .SetMessageCounter(kMessageCounter + static_cast<uint32_t>(sent));
+                EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+
+                EXPECT_EQ(tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer)), CHIP_NO_ERROR);
+            }
+
+            mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                                     [this, sent]() { return mReceiveHandlerCallCount == sent; });
+            ASSERT_EQ(mReceiveHandlerCallCount, sent);
+        }
+        const uint64_t elapsedUs = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        const uint64_t totalBytes = static_cast<uint64_t>(messageCount) * payloadSize;
+        ChipLogProgress(Inet, "TCP throughput: %d messages of %u bytes in bursts of %d in %" PRIu64 " us (%" PRIu64 " KB/s)",
+                        messageCount, static_cast<unsigned>(payloadSize), burstSize, elapsedUs,
+                        elapsedUs ? (totalBytes * 1000000 / 1024) / elapsedUs : 0);
+
+        SetCallback(nullptr);
+    }
+
     void ConnectTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
     {
         // Connect and wait for seeing active connection
@@ -494,6 +545,18 @@ protected:
         gMockTransportMgrDelegate.DisconnectTest(tcp, addr, port);
     }
 
+    void ThroughputTest(const IPAddress & addr)
+    {
+        TCPImpl tcp;
+
+        uint16_t port = GetRandomPort();
+        MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+        gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port);
+        gMockTransportMgrDelegate.ConnectTest(tcp, addr, port);
+        gMockTransportMgrDelegate.ThroughputTest(tcp, addr, port, 2000, 8, 1024);
+        gMockTransportMgrDelegate.DisconnectTest(tcp, addr, port);
+    }
+
     void HandleConnCompleteTest(const IPAddress & addr)
     {
         TCPImpl tcp;
@@ -633,6 +696,13 @@ TEST_F(TestTCP, ConnectSendMessageThenCloseTest6)
     ConnectSendMessageThenCloseTest(addr);
 }
 
+TEST_F(TestTCP, ThroughputTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    ThroughputTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCompleteCalledTest6)
 {
     IPAddress addr;
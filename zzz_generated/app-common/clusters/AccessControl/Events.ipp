@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -45,40 +45,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
-        {
-            err = DataModel::Decode(reader, adminNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAdminPasscodeID))
-        {
-            err = DataModel::Decode(reader, adminPasscodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kChangeType))
-        {
-            err = DataModel::Decode(reader, changeType);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestValue))
-        {
-            err = DataModel::Decode(reader, latestValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAdminNodeID, adminNodeID),
+                                          detail::StructField(Fields::kAdminPasscodeID, adminPasscodeID),
+                                          detail::StructField(Fields::kChangeType, changeType),
+                                          detail::StructField(Fields::kLatestValue, latestValue),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 } // namespace AccessControlEntryChanged.
 namespace AccessControlExtensionChanged {
@@ -96,40 +67,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
-        {
-            err = DataModel::Decode(reader, adminNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAdminPasscodeID))
-        {
-            err = DataModel::Decode(reader, adminPasscodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kChangeType))
-        {
-            err = DataModel::Decode(reader, changeType);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestValue))
-        {
-            err = DataModel::Decode(reader, latestValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAdminNodeID, adminNodeID),
+                                          detail::StructField(Fields::kAdminPasscodeID, adminPasscodeID),
+                                          detail::StructField(Fields::kChangeType, changeType),
+                                          detail::StructField(Fields::kLatestValue, latestValue),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 } // namespace AccessControlExtensionChanged.
 namespace FabricRestrictionReviewUpdate {
@@ -146,36 +88,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kToken))
-        {
-            err = DataModel::Decode(reader, token);
-        }
-        else if (__context_tag == to_underlying(Fields::kInstruction))
-        {
-            err = DataModel::Decode(reader, instruction);
-        }
-        else if (__context_tag == to_underlying(Fields::kARLRequestFlowUrl))
-        {
-            err = DataModel::Decode(reader, ARLRequestFlowUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kToken, token),
+                                          detail::StructField(Fields::kInstruction, instruction),
+                                          detail::StructField(Fields::kARLRequestFlowUrl, ARLRequestFlowUrl),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 } // namespace FabricRestrictionReviewUpdate.
 } // namespace Events
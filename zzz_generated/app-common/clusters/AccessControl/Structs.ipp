@@ -20,7 +20,7 @@
 
 #include <clusters/AccessControl/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kType, type), detail::StructField(Fields::kId, id) });
 }
 
 } // namespace AccessRestrictionStruct
@@ -75,29 +57,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kRestrictions))
-        {
-            err = DataModel::Decode(reader, restrictions);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEndpoint, endpoint),
+                                          detail::StructField(Fields::kCluster, cluster),
+                                          detail::StructField(Fields::kRestrictions, restrictions) });
 }
 
 } // namespace CommissioningAccessRestrictionEntryStruct
@@ -141,33 +103,10 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kRestrictions))
-        {
-            err = DataModel::Decode(reader, restrictions);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEndpoint, endpoint),
+                                          detail::StructField(Fields::kCluster, cluster),
+                                          detail::StructField(Fields::kRestrictions, restrictions),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace AccessRestrictionEntryStruct
@@ -184,29 +123,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCluster, cluster),
+                                          detail::StructField(Fields::kEndpoint, endpoint),
+                                          detail::StructField(Fields::kDeviceType, deviceType) });
 }
 
 } // namespace AccessControlTargetStruct
@@ -254,37 +173,11 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPrivilege))
-        {
-            err = DataModel::Decode(reader, privilege);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuthMode))
-        {
-            err = DataModel::Decode(reader, authMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubjects))
-        {
-            err = DataModel::Decode(reader, subjects);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargets))
-        {
-            err = DataModel::Decode(reader, targets);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPrivilege, privilege),
+                                          detail::StructField(Fields::kAuthMode, authMode),
+                                          detail::StructField(Fields::kSubjects, subjects),
+                                          detail::StructField(Fields::kTargets, targets),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace AccessControlEntryStruct
@@ -320,25 +213,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kData, data),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace AccessControlExtensionStruct
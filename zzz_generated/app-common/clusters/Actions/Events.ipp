@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -43,32 +43,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kActionID, actionID),
+                                          detail::StructField(Fields::kInvokeID, invokeID),
+                                          detail::StructField(Fields::kNewState, newState) });
 }
 } // namespace StateChanged.
 namespace ActionFailed {
@@ -85,36 +62,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else if (__context_tag == to_underlying(Fields::kError))
-        {
-            err = DataModel::Decode(reader, error);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kActionID, actionID),
+                                          detail::StructField(Fields::kInvokeID, invokeID),
+                                          detail::StructField(Fields::kNewState, newState),
+                                          detail::StructField(Fields::kError, error) });
 }
 } // namespace ActionFailed.
 } // namespace Events
@@ -20,7 +20,7 @@
 
 #include <clusters/Actions/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,41 +44,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpointListID))
-        {
-            err = DataModel::Decode(reader, endpointListID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedCommands))
-        {
-            err = DataModel::Decode(reader, supportedCommands);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kActionID, actionID),
+                                          detail::StructField(Fields::kName, name), detail::StructField(Fields::kType, type),
+                                          detail::StructField(Fields::kEndpointListID, endpointListID),
+                                          detail::StructField(Fields::kSupportedCommands, supportedCommands),
+                                          detail::StructField(Fields::kState, state) });
 }
 
 } // namespace ActionStruct
@@ -96,33 +66,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEndpointListID))
-        {
-            err = DataModel::Decode(reader, endpointListID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoints))
-        {
-            err = DataModel::Decode(reader, endpoints);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEndpointListID, endpointListID),
+                                          detail::StructField(Fields::kName, name), detail::StructField(Fields::kType, type),
+                                          detail::StructField(Fields::kEndpoints, endpoints) });
 }
 
 } // namespace EndpointListStruct
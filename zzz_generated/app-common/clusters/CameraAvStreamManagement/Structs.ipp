@@ -20,7 +20,7 @@
 
 #include <clusters/CameraAvStreamManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kWidth))
-        {
-            err = DataModel::Decode(reader, width);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeight))
-        {
-            err = DataModel::Decode(reader, height);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kWidth, width),
+                                          detail::StructField(Fields::kHeight, height) });
 }
 
 } // namespace VideoResolutionStruct
@@ -86,73 +69,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamUsage))
-        {
-            err = DataModel::Decode(reader, streamUsage);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoCodec))
-        {
-            err = DataModel::Decode(reader, videoCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFrameRate))
-        {
-            err = DataModel::Decode(reader, minFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxBitRate))
-        {
-            err = DataModel::Decode(reader, maxBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinKeyFrameInterval))
-        {
-            err = DataModel::Decode(reader, minKeyFrameInterval);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxKeyFrameInterval))
-        {
-            err = DataModel::Decode(reader, maxKeyFrameInterval);
-        }
-        else if (__context_tag == to_underlying(Fields::kWatermarkEnabled))
-        {
-            err = DataModel::Decode(reader, watermarkEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kOSDEnabled))
-        {
-            err = DataModel::Decode(reader, OSDEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kVideoStreamID, videoStreamID),
+                                          detail::StructField(Fields::kStreamUsage, streamUsage),
+                                          detail::StructField(Fields::kVideoCodec, videoCodec),
+                                          detail::StructField(Fields::kMinFrameRate, minFrameRate),
+                                          detail::StructField(Fields::kMaxFrameRate, maxFrameRate),
+                                          detail::StructField(Fields::kMinResolution, minResolution),
+                                          detail::StructField(Fields::kMaxResolution, maxResolution),
+                                          detail::StructField(Fields::kMinBitRate, minBitRate),
+                                          detail::StructField(Fields::kMaxBitRate, maxBitRate),
+                                          detail::StructField(Fields::kMinKeyFrameInterval, minKeyFrameInterval),
+                                          detail::StructField(Fields::kMaxKeyFrameInterval, maxKeyFrameInterval),
+                                          detail::StructField(Fields::kWatermarkEnabled, watermarkEnabled),
+                                          detail::StructField(Fields::kOSDEnabled, OSDEnabled),
+                                          detail::StructField(Fields::kReferenceCount, referenceCount) });
 }
 
 } // namespace VideoStreamStruct
@@ -177,61 +107,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kFrameRate))
-        {
-            err = DataModel::Decode(reader, frameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kQuality))
-        {
-            err = DataModel::Decode(reader, quality);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kEncodedPixels))
-        {
-            err = DataModel::Decode(reader, encodedPixels);
-        }
-        else if (__context_tag == to_underlying(Fields::kHardwareEncoder))
-        {
-            err = DataModel::Decode(reader, hardwareEncoder);
-        }
-        else if (__context_tag == to_underlying(Fields::kWatermarkEnabled))
-        {
-            err = DataModel::Decode(reader, watermarkEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kOSDEnabled))
-        {
-            err = DataModel::Decode(reader, OSDEnabled);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSnapshotStreamID, snapshotStreamID),
+                                          detail::StructField(Fields::kImageCodec, imageCodec),
+                                          detail::StructField(Fields::kFrameRate, frameRate),
+                                          detail::StructField(Fields::kMinResolution, minResolution),
+                                          detail::StructField(Fields::kMaxResolution, maxResolution),
+                                          detail::StructField(Fields::kQuality, quality),
+                                          detail::StructField(Fields::kReferenceCount, referenceCount),
+                                          detail::StructField(Fields::kEncodedPixels, encodedPixels),
+                                          detail::StructField(Fields::kHardwareEncoder, hardwareEncoder),
+                                          detail::StructField(Fields::kWatermarkEnabled, watermarkEnabled),
+                                          detail::StructField(Fields::kOSDEnabled, OSDEnabled) });
 }
 
 } // namespace SnapshotStreamStruct
@@ -250,37 +136,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequiresEncodedPixels))
-        {
-            err = DataModel::Decode(reader, requiresEncodedPixels);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequiresHardwareEncoder))
-        {
-            err = DataModel::Decode(reader, requiresHardwareEncoder);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kResolution, resolution),
+                                          detail::StructField(Fields::kMaxFrameRate, maxFrameRate),
+                                          detail::StructField(Fields::kImageCodec, imageCodec),
+                                          detail::StructField(Fields::kRequiresEncodedPixels, requiresEncodedPixels),
+                                          detail::StructField(Fields::kRequiresHardwareEncoder, requiresHardwareEncoder) });
 }
 
 } // namespace SnapshotCapabilitiesStruct
@@ -297,29 +157,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCodec))
-        {
-            err = DataModel::Decode(reader, codec);
-        }
-        else if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCodec, codec),
+                                          detail::StructField(Fields::kResolution, resolution),
+                                          detail::StructField(Fields::kMinBitRate, minBitRate) });
 }
 
 } // namespace RateDistortionTradeOffPointsStruct
@@ -337,33 +177,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMaxNumberOfChannels))
-        {
-            err = DataModel::Decode(reader, maxNumberOfChannels);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedCodecs))
-        {
-            err = DataModel::Decode(reader, supportedCodecs);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedSampleRates))
-        {
-            err = DataModel::Decode(reader, supportedSampleRates);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedBitDepths))
-        {
-            err = DataModel::Decode(reader, supportedBitDepths);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMaxNumberOfChannels, maxNumberOfChannels),
+                                          detail::StructField(Fields::kSupportedCodecs, supportedCodecs),
+                                          detail::StructField(Fields::kSupportedSampleRates, supportedSampleRates),
+                                          detail::StructField(Fields::kSupportedBitDepths, supportedBitDepths) });
 }
 
 } // namespace AudioCapabilitiesStruct
@@ -385,49 +202,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamUsage))
-        {
-            err = DataModel::Decode(reader, streamUsage);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioCodec))
-        {
-            err = DataModel::Decode(reader, audioCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelCount))
-        {
-            err = DataModel::Decode(reader, channelCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampleRate))
-        {
-            err = DataModel::Decode(reader, sampleRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitDepth))
-        {
-            err = DataModel::Decode(reader, bitDepth);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAudioStreamID, audioStreamID),
+                                          detail::StructField(Fields::kStreamUsage, streamUsage),
+                                          detail::StructField(Fields::kAudioCodec, audioCodec),
+                                          detail::StructField(Fields::kChannelCount, channelCount),
+                                          detail::StructField(Fields::kSampleRate, sampleRate),
+                                          detail::StructField(Fields::kBitRate, bitRate),
+                                          detail::StructField(Fields::kBitDepth, bitDepth),
+                                          detail::StructField(Fields::kReferenceCount, referenceCount) });
 }
 
 } // namespace AudioStreamStruct
@@ -445,33 +227,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSensorWidth))
-        {
-            err = DataModel::Decode(reader, sensorWidth);
-        }
-        else if (__context_tag == to_underlying(Fields::kSensorHeight))
-        {
-            err = DataModel::Decode(reader, sensorHeight);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFPS))
-        {
-            err = DataModel::Decode(reader, maxFPS);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxHDRFPS))
-        {
-            err = DataModel::Decode(reader, maxHDRFPS);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSensorWidth, sensorWidth),
+                                          detail::StructField(Fields::kSensorHeight, sensorHeight),
+                                          detail::StructField(Fields::kMaxFPS, maxFPS),
+                                          detail::StructField(Fields::kMaxHDRFPS, maxHDRFPS) });
 }
 
 } // namespace VideoSensorParamsStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/Channel/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kRole))
-        {
-            err = DataModel::Decode(reader, role);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kName, name), detail::StructField(Fields::kRole, role) });
 }
 
 } // namespace ProgramCastStruct
@@ -74,25 +56,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCategory))
-        {
-            err = DataModel::Decode(reader, category);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubCategory))
-        {
-            err = DataModel::Decode(reader, subCategory);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCategory, category),
+                                          detail::StructField(Fields::kSubCategory, subCategory) });
 }
 
 } // namespace ProgramCategoryStruct
@@ -108,25 +73,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSeason))
-        {
-            err = DataModel::Decode(reader, season);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpisode))
-        {
-            err = DataModel::Decode(reader, episode);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSeason, season),
+                                          detail::StructField(Fields::kEpisode, episode) });
 }
 
 } // namespace SeriesInfoStruct
@@ -147,45 +95,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMajorNumber))
-        {
-            err = DataModel::Decode(reader, majorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinorNumber))
-        {
-            err = DataModel::Decode(reader, minorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kCallSign))
-        {
-            err = DataModel::Decode(reader, callSign);
-        }
-        else if (__context_tag == to_underlying(Fields::kAffiliateCallSign))
-        {
-            err = DataModel::Decode(reader, affiliateCallSign);
-        }
-        else if (__context_tag == to_underlying(Fields::kIdentifier))
-        {
-            err = DataModel::Decode(reader, identifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMajorNumber, majorNumber),
+                                          detail::StructField(Fields::kMinorNumber, minorNumber),
+                                          detail::StructField(Fields::kName, name),
+                                          detail::StructField(Fields::kCallSign, callSign),
+                                          detail::StructField(Fields::kAffiliateCallSign, affiliateCallSign),
+                                          detail::StructField(Fields::kIdentifier, identifier),
+                                          detail::StructField(Fields::kType, type) });
 }
 
 } // namespace ChannelInfoStruct
@@ -218,93 +134,25 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kIdentifier))
-        {
-            err = DataModel::Decode(reader, identifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTime))
-        {
-            err = DataModel::Decode(reader, endTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kTitle))
-        {
-            err = DataModel::Decode(reader, title);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubtitle))
-        {
-            err = DataModel::Decode(reader, subtitle);
-        }
-        else if (__context_tag == to_underlying(Fields::kDescription))
-        {
-            err = DataModel::Decode(reader, description);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioLanguages))
-        {
-            err = DataModel::Decode(reader, audioLanguages);
-        }
-        else if (__context_tag == to_underlying(Fields::kRatings))
-        {
-            err = DataModel::Decode(reader, ratings);
-        }
-        else if (__context_tag == to_underlying(Fields::kThumbnailUrl))
-        {
-            err = DataModel::Decode(reader, thumbnailUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kPosterArtUrl))
-        {
-            err = DataModel::Decode(reader, posterArtUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kDvbiUrl))
-        {
-            err = DataModel::Decode(reader, dvbiUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kReleaseDate))
-        {
-            err = DataModel::Decode(reader, releaseDate);
-        }
-        else if (__context_tag == to_underlying(Fields::kParentalGuidanceText))
-        {
-            err = DataModel::Decode(reader, parentalGuidanceText);
-        }
-        else if (__context_tag == to_underlying(Fields::kRecordingFlag))
-        {
-            err = DataModel::Decode(reader, recordingFlag);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeriesInfo))
-        {
-            err = DataModel::Decode(reader, seriesInfo);
-        }
-        else if (__context_tag == to_underlying(Fields::kCategoryList))
-        {
-            err = DataModel::Decode(reader, categoryList);
-        }
-        else if (__context_tag == to_underlying(Fields::kCastList))
-        {
-            err = DataModel::Decode(reader, castList);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kIdentifier, identifier),
+                                          detail::StructField(Fields::kChannel, channel),
+                                          detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kEndTime, endTime),
+                                          detail::StructField(Fields::kTitle, title),
+                                          detail::StructField(Fields::kSubtitle, subtitle),
+                                          detail::StructField(Fields::kDescription, description),
+                                          detail::StructField(Fields::kAudioLanguages, audioLanguages),
+                                          detail::StructField(Fields::kRatings, ratings),
+                                          detail::StructField(Fields::kThumbnailUrl, thumbnailUrl),
+                                          detail::StructField(Fields::kPosterArtUrl, posterArtUrl),
+                                          detail::StructField(Fields::kDvbiUrl, dvbiUrl),
+                                          detail::StructField(Fields::kReleaseDate, releaseDate),
+                                          detail::StructField(Fields::kParentalGuidanceText, parentalGuidanceText),
+                                          detail::StructField(Fields::kRecordingFlag, recordingFlag),
+                                          detail::StructField(Fields::kSeriesInfo, seriesInfo),
+                                          detail::StructField(Fields::kCategoryList, categoryList),
+                                          detail::StructField(Fields::kCastList, castList),
+                                          detail::StructField(Fields::kExternalIDList, externalIDList) });
 }
 
 } // namespace ProgramStruct
@@ -321,29 +169,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLimit))
-        {
-            err = DataModel::Decode(reader, limit);
-        }
-        else if (__context_tag == to_underlying(Fields::kAfter))
-        {
-            err = DataModel::Decode(reader, after);
-        }
-        else if (__context_tag == to_underlying(Fields::kBefore))
-        {
-            err = DataModel::Decode(reader, before);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLimit, limit), detail::StructField(Fields::kAfter, after),
+                                          detail::StructField(Fields::kBefore, before) });
 }
 
 } // namespace PageTokenStruct
@@ -359,25 +186,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousToken))
-        {
-            err = DataModel::Decode(reader, previousToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextToken))
-        {
-            err = DataModel::Decode(reader, nextToken);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousToken, previousToken),
+                                          detail::StructField(Fields::kNextToken, nextToken) });
 }
 
 } // namespace ChannelPagingStruct
@@ -393,25 +203,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kName, name), detail::StructField(Fields::kValue, value) });
 }
 
 } // namespace AdditionalInfoStruct
@@ -429,33 +221,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kOperatorName))
-        {
-            err = DataModel::Decode(reader, operatorName);
-        }
-        else if (__context_tag == to_underlying(Fields::kLineupName))
-        {
-            err = DataModel::Decode(reader, lineupName);
-        }
-        else if (__context_tag == to_underlying(Fields::kPostalCode))
-        {
-            err = DataModel::Decode(reader, postalCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kLineupInfoType))
-        {
-            err = DataModel::Decode(reader, lineupInfoType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kOperatorName, operatorName),
+                                          detail::StructField(Fields::kLineupName, lineupName),
+                                          detail::StructField(Fields::kPostalCode, postalCode),
+                                          detail::StructField(Fields::kLineupInfoType, lineupInfoType) });
 }
 
 } // namespace LineupInfoStruct
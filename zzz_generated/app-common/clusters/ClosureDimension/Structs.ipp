@@ -20,7 +20,7 @@
 
 #include <clusters/ClosureDimension/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,29 +41,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPosition))
-        {
-            err = DataModel::Decode(reader, position);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatch))
-        {
-            err = DataModel::Decode(reader, latch);
-        }
-        else if (__context_tag == to_underlying(Fields::kSpeed))
-        {
-            err = DataModel::Decode(reader, speed);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPosition, position),
+                                          detail::StructField(Fields::kLatch, latch), detail::StructField(Fields::kSpeed, speed) });
 }
 
 } // namespace DimensionStateStruct
@@ -79,25 +58,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMin))
-        {
-            err = DataModel::Decode(reader, min);
-        }
-        else if (__context_tag == to_underlying(Fields::kMax))
-        {
-            err = DataModel::Decode(reader, max);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMin, min), detail::StructField(Fields::kMax, max) });
 }
 
 } // namespace RangePercent100thsStruct
@@ -113,25 +74,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMin))
-        {
-            err = DataModel::Decode(reader, min);
-        }
-        else if (__context_tag == to_underlying(Fields::kMax))
-        {
-            err = DataModel::Decode(reader, max);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMin, min), detail::StructField(Fields::kMax, max) });
 }
 
 } // namespace UnitRangeStruct
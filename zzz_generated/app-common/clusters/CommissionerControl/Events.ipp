@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,36 +44,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kRequestID))
-        {
-            err = DataModel::Decode(reader, requestID);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientNodeID))
-        {
-            err = DataModel::Decode(reader, clientNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kRequestID, requestID),
+                                          detail::StructField(Fields::kClientNodeID, clientNodeID),
+                                          detail::StructField(Fields::kStatusCode, statusCode),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 } // namespace CommissioningRequestResult.
 } // namespace Events
@@ -20,7 +20,7 @@
 
 #include <clusters/CommodityPrice/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kSource))
-        {
-            err = DataModel::Decode(reader, source);
-        }
-        else if (__context_tag == to_underlying(Fields::kDescription))
-        {
-            err = DataModel::Decode(reader, description);
-        }
-        else if (__context_tag == to_underlying(Fields::kTariffComponentID))
-        {
-            err = DataModel::Decode(reader, tariffComponentID);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPrice, price),
+                                          detail::StructField(Fields::kSource, source),
+                                          detail::StructField(Fields::kDescription, description),
+                                          detail::StructField(Fields::kTariffComponentID, tariffComponentID) });
 }
 
 } // namespace CommodityPriceComponentStruct
@@ -88,41 +65,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPeriodStart))
-        {
-            err = DataModel::Decode(reader, periodStart);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeriodEnd))
-        {
-            err = DataModel::Decode(reader, periodEnd);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriceLevel))
-        {
-            err = DataModel::Decode(reader, priceLevel);
-        }
-        else if (__context_tag == to_underlying(Fields::kDescription))
-        {
-            err = DataModel::Decode(reader, description);
-        }
-        else if (__context_tag == to_underlying(Fields::kComponents))
-        {
-            err = DataModel::Decode(reader, components);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPeriodStart, periodStart),
+                                          detail::StructField(Fields::kPeriodEnd, periodEnd),
+                                          detail::StructField(Fields::kPrice, price),
+                                          detail::StructField(Fields::kPriceLevel, priceLevel),
+                                          detail::StructField(Fields::kDescription, description),
+                                          detail::StructField(Fields::kComponents, components) });
 }
 
 } // namespace CommodityPriceStruct
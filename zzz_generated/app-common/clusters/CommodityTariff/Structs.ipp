@@ -20,7 +20,7 @@
 
 #include <clusters/CommodityTariff/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSeverity))
-        {
-            err = DataModel::Decode(reader, severity);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeakPeriod))
-        {
-            err = DataModel::Decode(reader, peakPeriod);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSeverity, severity),
+                                          detail::StructField(Fields::kPeakPeriod, peakPeriod) });
 }
 
 } // namespace PeakPeriodStruct
@@ -74,25 +57,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNumber))
-        {
-            err = DataModel::Decode(reader, number);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequiredState))
-        {
-            err = DataModel::Decode(reader, requiredState);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNumber, number),
+                                          detail::StructField(Fields::kRequiredState, requiredState) });
 }
 
 } // namespace AuxiliaryLoadSwitchSettingsStruct
@@ -109,29 +75,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPriceType))
-        {
-            err = DataModel::Decode(reader, priceType);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriceLevel))
-        {
-            err = DataModel::Decode(reader, priceLevel);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPriceType, priceType),
+                                          detail::StructField(Fields::kPrice, price),
+                                          detail::StructField(Fields::kPriceLevel, priceLevel) });
 }
 
 } // namespace TariffPriceStruct
@@ -154,53 +100,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTariffComponentID))
-        {
-            err = DataModel::Decode(reader, tariffComponentID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyCredit))
-        {
-            err = DataModel::Decode(reader, friendlyCredit);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuxiliaryLoad))
-        {
-            err = DataModel::Decode(reader, auxiliaryLoad);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeakPeriod))
-        {
-            err = DataModel::Decode(reader, peakPeriod);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerThreshold))
-        {
-            err = DataModel::Decode(reader, powerThreshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kThreshold))
-        {
-            err = DataModel::Decode(reader, threshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kPredicted))
-        {
-            err = DataModel::Decode(reader, predicted);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kTariffComponentID, tariffComponentID),
+                                          detail::StructField(Fields::kPrice, price),
+                                          detail::StructField(Fields::kFriendlyCredit, friendlyCredit),
+                                          detail::StructField(Fields::kAuxiliaryLoad, auxiliaryLoad),
+                                          detail::StructField(Fields::kPeakPeriod, peakPeriod),
+                                          detail::StructField(Fields::kPowerThreshold, powerThreshold),
+                                          detail::StructField(Fields::kThreshold, threshold),
+                                          detail::StructField(Fields::kLabel, label),
+                                          detail::StructField(Fields::kPredicted, predicted) });
 }
 
 } // namespace TariffComponentStruct
@@ -216,25 +124,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kStartDate))
-        {
-            err = DataModel::Decode(reader, startDate);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayPatternIDs))
-        {
-            err = DataModel::Decode(reader, dayPatternIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kStartDate, startDate),
+                                          detail::StructField(Fields::kDayPatternIDs, dayPatternIDs) });
 }
 
 } // namespace CalendarPeriodStruct
@@ -253,37 +144,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayEntryID))
-        {
-            err = DataModel::Decode(reader, dayEntryID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomizationOffset))
-        {
-            err = DataModel::Decode(reader, randomizationOffset);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomizationType))
-        {
-            err = DataModel::Decode(reader, randomizationType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDayEntryID, dayEntryID),
+                                          detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kDuration, duration),
+                                          detail::StructField(Fields::kRandomizationOffset, randomizationOffset),
+                                          detail::StructField(Fields::kRandomizationType, randomizationType) });
 }
 
 } // namespace DayEntryStruct
@@ -300,29 +165,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayPatternID))
-        {
-            err = DataModel::Decode(reader, dayPatternID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDaysOfWeek))
-        {
-            err = DataModel::Decode(reader, daysOfWeek);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDayPatternID, dayPatternID),
+                                          detail::StructField(Fields::kDaysOfWeek, daysOfWeek),
+                                          detail::StructField(Fields::kDayEntryIDs, dayEntryIDs) });
 }
 
 } // namespace DayPatternStruct
@@ -339,29 +184,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDate))
-        {
-            err = DataModel::Decode(reader, date);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayType))
-        {
-            err = DataModel::Decode(reader, dayType);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDate, date),
+                                          detail::StructField(Fields::kDayType, dayType),
+                                          detail::StructField(Fields::kDayEntryIDs, dayEntryIDs) });
 }
 
 } // namespace DayStruct
@@ -379,33 +204,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTariffLabel))
-        {
-            err = DataModel::Decode(reader, tariffLabel);
-        }
-        else if (__context_tag == to_underlying(Fields::kProviderName))
-        {
-            err = DataModel::Decode(reader, providerName);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-        else if (__context_tag == to_underlying(Fields::kBlockMode))
-        {
-            err = DataModel::Decode(reader, blockMode);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kTariffLabel, tariffLabel),
+                                          detail::StructField(Fields::kProviderName, providerName),
+                                          detail::StructField(Fields::kCurrency, currency),
+                                          detail::StructField(Fields::kBlockMode, blockMode) });
 }
 
 } // namespace TariffInformationStruct
@@ -422,29 +224,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-        else if (__context_tag == to_underlying(Fields::kTariffComponentIDs))
-        {
-            err = DataModel::Decode(reader, tariffComponentIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLabel, label),
+                                          detail::StructField(Fields::kDayEntryIDs, dayEntryIDs),
+                                          detail::StructField(Fields::kTariffComponentIDs, tariffComponentIDs) });
 }
 
 } // namespace TariffPeriodStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/ContentLauncher/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,29 +41,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kWidth))
-        {
-            err = DataModel::Decode(reader, width);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeight))
-        {
-            err = DataModel::Decode(reader, height);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetric))
-        {
-            err = DataModel::Decode(reader, metric);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kWidth, width),
+                                          detail::StructField(Fields::kHeight, height),
+                                          detail::StructField(Fields::kMetric, metric) });
 }
 
 } // namespace DimensionStruct
@@ -80,29 +60,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLanguageCode))
-        {
-            err = DataModel::Decode(reader, languageCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCharacteristics))
-        {
-            err = DataModel::Decode(reader, characteristics);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioOutputIndex))
-        {
-            err = DataModel::Decode(reader, audioOutputIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLanguageCode, languageCode),
+                                          detail::StructField(Fields::kCharacteristics, characteristics),
+                                          detail::StructField(Fields::kAudioOutputIndex, audioOutputIndex) });
 }
 
 } // namespace TrackPreferenceStruct
@@ -119,29 +79,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPlaybackPosition))
-        {
-            err = DataModel::Decode(reader, playbackPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kTextTrack))
-        {
-            err = DataModel::Decode(reader, textTrack);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioTracks))
-        {
-            err = DataModel::Decode(reader, audioTracks);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPlaybackPosition, playbackPosition),
+                                          detail::StructField(Fields::kTextTrack, textTrack),
+                                          detail::StructField(Fields::kAudioTracks, audioTracks) });
 }
 
 } // namespace PlaybackPreferencesStruct
@@ -157,25 +97,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kName, name), detail::StructField(Fields::kValue, value) });
 }
 
 } // namespace AdditionalInfoStruct
@@ -192,29 +114,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kType, type), detail::StructField(Fields::kValue, value),
+                                          detail::StructField(Fields::kExternalIDList, externalIDList) });
 }
 
 } // namespace ParameterStruct
@@ -229,21 +130,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kParameterList))
-        {
-            err = DataModel::Decode(reader, parameterList);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kParameterList, parameterList) });
 }
 
 } // namespace ContentSearchStruct
@@ -260,29 +147,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kImageURL))
-        {
-            err = DataModel::Decode(reader, imageURL);
-        }
-        else if (__context_tag == to_underlying(Fields::kColor))
-        {
-            err = DataModel::Decode(reader, color);
-        }
-        else if (__context_tag == to_underlying(Fields::kSize))
-        {
-            err = DataModel::Decode(reader, size);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kImageURL, imageURL),
+                                          detail::StructField(Fields::kColor, color), detail::StructField(Fields::kSize, size) });
 }
 
 } // namespace StyleInformationStruct
@@ -302,41 +168,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kProviderName))
-        {
-            err = DataModel::Decode(reader, providerName);
-        }
-        else if (__context_tag == to_underlying(Fields::kBackground))
-        {
-            err = DataModel::Decode(reader, background);
-        }
-        else if (__context_tag == to_underlying(Fields::kLogo))
-        {
-            err = DataModel::Decode(reader, logo);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgressBar))
-        {
-            err = DataModel::Decode(reader, progressBar);
-        }
-        else if (__context_tag == to_underlying(Fields::kSplash))
-        {
-            err = DataModel::Decode(reader, splash);
-        }
-        else if (__context_tag == to_underlying(Fields::kWaterMark))
-        {
-            err = DataModel::Decode(reader, waterMark);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kProviderName, providerName),
+                                          detail::StructField(Fields::kBackground, background),
+                                          detail::StructField(Fields::kLogo, logo),
+                                          detail::StructField(Fields::kProgressBar, progressBar),
+                                          detail::StructField(Fields::kSplash, splash),
+                                          detail::StructField(Fields::kWaterMark, waterMark) });
 }
 
 } // namespace BrandingInformationStruct
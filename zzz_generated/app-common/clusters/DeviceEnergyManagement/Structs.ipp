@@ -20,7 +20,7 @@
 
 #include <clusters/DeviceEnergyManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCostType))
-        {
-            err = DataModel::Decode(reader, costType);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kDecimalPoints))
-        {
-            err = DataModel::Decode(reader, decimalPoints);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCostType, costType),
+                                          detail::StructField(Fields::kValue, value),
+                                          detail::StructField(Fields::kDecimalPoints, decimalPoints),
+                                          detail::StructField(Fields::kCurrency, currency) });
 }
 
 } // namespace CostStruct
@@ -86,33 +63,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMinPower))
-        {
-            err = DataModel::Decode(reader, minPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPower))
-        {
-            err = DataModel::Decode(reader, maxPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinDuration))
-        {
-            err = DataModel::Decode(reader, minDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMinPower, minPower),
+                                          detail::StructField(Fields::kMaxPower, maxPower),
+                                          detail::StructField(Fields::kMinDuration, minDuration),
+                                          detail::StructField(Fields::kMaxDuration, maxDuration) });
 }
 
 } // namespace PowerAdjustStruct
@@ -128,25 +82,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPowerAdjustCapability))
-        {
-            err = DataModel::Decode(reader, powerAdjustCapability);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPowerAdjustCapability, powerAdjustCapability),
+                                          detail::StructField(Fields::kCause, cause) });
 }
 
 } // namespace PowerAdjustCapabilityStruct
@@ -178,89 +115,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMinDuration))
-        {
-            err = DataModel::Decode(reader, minDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kDefaultDuration))
-        {
-            err = DataModel::Decode(reader, defaultDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kElapsedSlotTime))
-        {
-            err = DataModel::Decode(reader, elapsedSlotTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kRemainingSlotTime))
-        {
-            err = DataModel::Decode(reader, remainingSlotTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kSlotIsPausable))
-        {
-            err = DataModel::Decode(reader, slotIsPausable);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPauseDuration))
-        {
-            err = DataModel::Decode(reader, minPauseDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPauseDuration))
-        {
-            err = DataModel::Decode(reader, maxPauseDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kManufacturerESAState))
-        {
-            err = DataModel::Decode(reader, manufacturerESAState);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPower))
-        {
-            err = DataModel::Decode(reader, minPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPower))
-        {
-            err = DataModel::Decode(reader, maxPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalEnergy))
-        {
-            err = DataModel::Decode(reader, nominalEnergy);
-        }
-        else if (__context_tag == to_underlying(Fields::kCosts))
-        {
-            err = DataModel::Decode(reader, costs);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPowerAdjustment))
-        {
-            err = DataModel::Decode(reader, minPowerAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPowerAdjustment))
-        {
-            err = DataModel::Decode(reader, maxPowerAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinDurationAdjustment))
-        {
-            err = DataModel::Decode(reader, minDurationAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDurationAdjustment))
-        {
-            err = DataModel::Decode(reader, maxDurationAdjustment);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMinDuration, minDuration),
+                                          detail::StructField(Fields::kMaxDuration, maxDuration),
+                                          detail::StructField(Fields::kDefaultDuration, defaultDuration),
+                                          detail::StructField(Fields::kElapsedSlotTime, elapsedSlotTime),
+                                          detail::StructField(Fields::kRemainingSlotTime, remainingSlotTime),
+                                          detail::StructField(Fields::kSlotIsPausable, slotIsPausable),
+                                          detail::StructField(Fields::kMinPauseDuration, minPauseDuration),
+                                          detail::StructField(Fields::kMaxPauseDuration, maxPauseDuration),
+                                          detail::StructField(Fields::kManufacturerESAState, manufacturerESAState),
+                                          detail::StructField(Fields::kNominalPower, nominalPower),
+                                          detail::StructField(Fields::kMinPower, minPower),
+                                          detail::StructField(Fields::kMaxPower, maxPower),
+                                          detail::StructField(Fields::kNominalEnergy, nominalEnergy),
+                                          detail::StructField(Fields::kCosts, costs),
+                                          detail::StructField(Fields::kMinPowerAdjustment, minPowerAdjustment),
+                                          detail::StructField(Fields::kMaxPowerAdjustment, maxPowerAdjustment),
+                                          detail::StructField(Fields::kMinDurationAdjustment, minDurationAdjustment),
+                                          detail::StructField(Fields::kMaxDurationAdjustment, maxDurationAdjustment) });
 }
 
 } // namespace SlotStruct
@@ -283,53 +155,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kForecastID))
-        {
-            err = DataModel::Decode(reader, forecastID);
-        }
-        else if (__context_tag == to_underlying(Fields::kActiveSlotNumber))
-        {
-            err = DataModel::Decode(reader, activeSlotNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTime))
-        {
-            err = DataModel::Decode(reader, endTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEarliestStartTime))
-        {
-            err = DataModel::Decode(reader, earliestStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestEndTime))
-        {
-            err = DataModel::Decode(reader, latestEndTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsPausable))
-        {
-            err = DataModel::Decode(reader, isPausable);
-        }
-        else if (__context_tag == to_underlying(Fields::kSlots))
-        {
-            err = DataModel::Decode(reader, slots);
-        }
-        else if (__context_tag == to_underlying(Fields::kForecastUpdateReason))
-        {
-            err = DataModel::Decode(reader, forecastUpdateReason);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kForecastID, forecastID),
+                                          detail::StructField(Fields::kActiveSlotNumber, activeSlotNumber),
+                                          detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kEndTime, endTime),
+                                          detail::StructField(Fields::kEarliestStartTime, earliestStartTime),
+                                          detail::StructField(Fields::kLatestEndTime, latestEndTime),
+                                          detail::StructField(Fields::kIsPausable, isPausable),
+                                          detail::StructField(Fields::kSlots, slots),
+                                          detail::StructField(Fields::kForecastUpdateReason, forecastUpdateReason) });
 }
 
 } // namespace ForecastStruct
@@ -348,37 +182,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumEnergy))
-        {
-            err = DataModel::Decode(reader, maximumEnergy);
-        }
-        else if (__context_tag == to_underlying(Fields::kLoadControl))
-        {
-            err = DataModel::Decode(reader, loadControl);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kDuration, duration),
+                                          detail::StructField(Fields::kNominalPower, nominalPower),
+                                          detail::StructField(Fields::kMaximumEnergy, maximumEnergy),
+                                          detail::StructField(Fields::kLoadControl, loadControl) });
 }
 
 } // namespace ConstraintsStruct
@@ -395,29 +203,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSlotIndex))
-        {
-            err = DataModel::Decode(reader, slotIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSlotIndex, slotIndex),
+                                          detail::StructField(Fields::kNominalPower, nominalPower),
+                                          detail::StructField(Fields::kDuration, duration) });
 }
 
 } // namespace SlotAdjustmentStruct
@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,24 +41,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAlarmCode))
-        {
-            err = DataModel::Decode(reader, alarmCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAlarmCode, alarmCode) });
 }
 } // namespace DoorLockAlarm.
 namespace DoorStateChange {
@@ -72,24 +55,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDoorState))
-        {
-            err = DataModel::Decode(reader, doorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDoorState, doorState) });
 }
 } // namespace DoorStateChange.
 namespace LockOperation {
@@ -108,44 +74,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
-        {
-            err = DataModel::Decode(reader, lockOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLockOperationType, lockOperationType),
+                                          detail::StructField(Fields::kOperationSource, operationSource),
+                                          detail::StructField(Fields::kUserIndex, userIndex),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex),
+                                          detail::StructField(Fields::kSourceNode, sourceNode),
+                                          detail::StructField(Fields::kCredentials, credentials) });
 }
 } // namespace LockOperation.
 namespace LockOperationError {
@@ -165,48 +99,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
-        {
-            err = DataModel::Decode(reader, lockOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationError))
-        {
-            err = DataModel::Decode(reader, operationError);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLockOperationType, lockOperationType),
+                                          detail::StructField(Fields::kOperationSource, operationSource),
+                                          detail::StructField(Fields::kOperationError, operationError),
+                                          detail::StructField(Fields::kUserIndex, userIndex),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex),
+                                          detail::StructField(Fields::kSourceNode, sourceNode),
+                                          detail::StructField(Fields::kCredentials, credentials) });
 }
 } // namespace LockOperationError.
 namespace LockUserChange {
@@ -226,48 +125,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLockDataType))
-        {
-            err = DataModel::Decode(reader, lockDataType);
-        }
-        else if (__context_tag == to_underlying(Fields::kDataOperationType))
-        {
-            err = DataModel::Decode(reader, dataOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDataIndex))
-        {
-            err = DataModel::Decode(reader, dataIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLockDataType, lockDataType),
+                                          detail::StructField(Fields::kDataOperationType, dataOperationType),
+                                          detail::StructField(Fields::kOperationSource, operationSource),
+                                          detail::StructField(Fields::kUserIndex, userIndex),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex),
+                                          detail::StructField(Fields::kSourceNode, sourceNode),
+                                          detail::StructField(Fields::kDataIndex, dataIndex) });
 }
 } // namespace LockUserChange.
 } // namespace Events
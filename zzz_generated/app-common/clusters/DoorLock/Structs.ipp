@@ -20,7 +20,7 @@
 
 #include <clusters/DoorLock/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCredentialType))
-        {
-            err = DataModel::Decode(reader, credentialType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialIndex))
-        {
-            err = DataModel::Decode(reader, credentialIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCredentialType, credentialType),
+                                          detail::StructField(Fields::kCredentialIndex, credentialIndex) });
 }
 
 } // namespace CredentialStruct
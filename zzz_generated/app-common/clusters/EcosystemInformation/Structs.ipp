@@ -20,7 +20,7 @@
 
 #include <clusters/EcosystemInformation/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-        else if (__context_tag == to_underlying(Fields::kRevision))
-        {
-            err = DataModel::Decode(reader, revision);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDeviceType, deviceType),
+                                          detail::StructField(Fields::kRevision, revision) });
 }
 
 } // namespace DeviceTypeStruct
@@ -118,49 +101,14 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDeviceName))
-        {
-            err = DataModel::Decode(reader, deviceName);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceNameLastEdit))
-        {
-            err = DataModel::Decode(reader, deviceNameLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kBridgedEndpoint))
-        {
-            err = DataModel::Decode(reader, bridgedEndpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kOriginalEndpoint))
-        {
-            err = DataModel::Decode(reader, originalEndpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceTypes))
-        {
-            err = DataModel::Decode(reader, deviceTypes);
-        }
-        else if (__context_tag == to_underlying(Fields::kUniqueLocationIDs))
-        {
-            err = DataModel::Decode(reader, uniqueLocationIDs);
-        }
-        else if (__context_tag == to_underlying(Fields::kUniqueLocationIDsLastEdit))
-        {
-            err = DataModel::Decode(reader, uniqueLocationIDsLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDeviceName, deviceName),
+                                          detail::StructField(Fields::kDeviceNameLastEdit, deviceNameLastEdit),
+                                          detail::StructField(Fields::kBridgedEndpoint, bridgedEndpoint),
+                                          detail::StructField(Fields::kOriginalEndpoint, originalEndpoint),
+                                          detail::StructField(Fields::kDeviceTypes, deviceTypes),
+                                          detail::StructField(Fields::kUniqueLocationIDs, uniqueLocationIDs),
+                                          detail::StructField(Fields::kUniqueLocationIDsLastEdit, uniqueLocationIDsLastEdit),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace EcosystemDeviceStruct
@@ -204,33 +152,10 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kUniqueLocationID))
-        {
-            err = DataModel::Decode(reader, uniqueLocationID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocationDescriptor))
-        {
-            err = DataModel::Decode(reader, locationDescriptor);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocationDescriptorLastEdit))
-        {
-            err = DataModel::Decode(reader, locationDescriptorLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kUniqueLocationID, uniqueLocationID),
+                                          detail::StructField(Fields::kLocationDescriptor, locationDescriptor),
+                                          detail::StructField(Fields::kLocationDescriptorLastEdit, locationDescriptorLastEdit),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace EcosystemLocationStruct
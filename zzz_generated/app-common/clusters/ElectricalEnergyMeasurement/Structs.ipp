@@ -20,7 +20,7 @@
 
 #include <clusters/ElectricalEnergyMeasurement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kImportedResetTimestamp))
-        {
-            err = DataModel::Decode(reader, importedResetTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kExportedResetTimestamp))
-        {
-            err = DataModel::Decode(reader, exportedResetTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kImportedResetSystime))
-        {
-            err = DataModel::Decode(reader, importedResetSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kExportedResetSystime))
-        {
-            err = DataModel::Decode(reader, exportedResetSystime);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kImportedResetTimestamp, importedResetTimestamp),
+                                          detail::StructField(Fields::kExportedResetTimestamp, exportedResetTimestamp),
+                                          detail::StructField(Fields::kImportedResetSystime, importedResetSystime),
+                                          detail::StructField(Fields::kExportedResetSystime, exportedResetSystime) });
 }
 
 } // namespace CumulativeEnergyResetStruct
@@ -89,45 +66,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEnergy))
-        {
-            err = DataModel::Decode(reader, energy);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTimestamp))
-        {
-            err = DataModel::Decode(reader, startTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTimestamp))
-        {
-            err = DataModel::Decode(reader, endTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartSystime))
-        {
-            err = DataModel::Decode(reader, startSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndSystime))
-        {
-            err = DataModel::Decode(reader, endSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kApparentEnergy))
-        {
-            err = DataModel::Decode(reader, apparentEnergy);
-        }
-        else if (__context_tag == to_underlying(Fields::kReactiveEnergy))
-        {
-            err = DataModel::Decode(reader, reactiveEnergy);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEnergy, energy),
+                                          detail::StructField(Fields::kStartTimestamp, startTimestamp),
+                                          detail::StructField(Fields::kEndTimestamp, endTimestamp),
+                                          detail::StructField(Fields::kStartSystime, startSystime),
+                                          detail::StructField(Fields::kEndSystime, endSystime),
+                                          detail::StructField(Fields::kApparentEnergy, apparentEnergy),
+                                          detail::StructField(Fields::kReactiveEnergy, reactiveEnergy) });
 }
 
 } // namespace EnergyMeasurementStruct
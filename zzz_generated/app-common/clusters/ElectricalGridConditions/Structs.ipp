@@ -20,7 +20,7 @@
 
 #include <clusters/ElectricalGridConditions/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,41 +44,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPeriodStart))
-        {
-            err = DataModel::Decode(reader, periodStart);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeriodEnd))
-        {
-            err = DataModel::Decode(reader, periodEnd);
-        }
-        else if (__context_tag == to_underlying(Fields::kGridCarbonIntensity))
-        {
-            err = DataModel::Decode(reader, gridCarbonIntensity);
-        }
-        else if (__context_tag == to_underlying(Fields::kGridCarbonLevel))
-        {
-            err = DataModel::Decode(reader, gridCarbonLevel);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalCarbonIntensity))
-        {
-            err = DataModel::Decode(reader, localCarbonIntensity);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalCarbonLevel))
-        {
-            err = DataModel::Decode(reader, localCarbonLevel);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPeriodStart, periodStart),
+                                          detail::StructField(Fields::kPeriodEnd, periodEnd),
+                                          detail::StructField(Fields::kGridCarbonIntensity, gridCarbonIntensity),
+                                          detail::StructField(Fields::kGridCarbonLevel, gridCarbonLevel),
+                                          detail::StructField(Fields::kLocalCarbonIntensity, localCarbonIntensity),
+                                          detail::StructField(Fields::kLocalCarbonLevel, localCarbonLevel) });
 }
 
 } // namespace ElectricalGridConditionsStruct
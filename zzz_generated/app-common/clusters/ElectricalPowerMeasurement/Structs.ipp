@@ -20,7 +20,7 @@
 
 #include <clusters/ElectricalPowerMeasurement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kOrder))
-        {
-            err = DataModel::Decode(reader, order);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeasurement))
-        {
-            err = DataModel::Decode(reader, measurement);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kOrder, order),
+                                          detail::StructField(Fields::kMeasurement, measurement) });
 }
 
 } // namespace HarmonicMeasurementStruct
@@ -83,61 +66,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
-        {
-            err = DataModel::Decode(reader, measurementType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMin))
-        {
-            err = DataModel::Decode(reader, min);
-        }
-        else if (__context_tag == to_underlying(Fields::kMax))
-        {
-            err = DataModel::Decode(reader, max);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTimestamp))
-        {
-            err = DataModel::Decode(reader, startTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTimestamp))
-        {
-            err = DataModel::Decode(reader, endTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinTimestamp))
-        {
-            err = DataModel::Decode(reader, minTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxTimestamp))
-        {
-            err = DataModel::Decode(reader, maxTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartSystime))
-        {
-            err = DataModel::Decode(reader, startSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndSystime))
-        {
-            err = DataModel::Decode(reader, endSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinSystime))
-        {
-            err = DataModel::Decode(reader, minSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxSystime))
-        {
-            err = DataModel::Decode(reader, maxSystime);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMeasurementType, measurementType),
+                                          detail::StructField(Fields::kMin, min), detail::StructField(Fields::kMax, max),
+                                          detail::StructField(Fields::kStartTimestamp, startTimestamp),
+                                          detail::StructField(Fields::kEndTimestamp, endTimestamp),
+                                          detail::StructField(Fields::kMinTimestamp, minTimestamp),
+                                          detail::StructField(Fields::kMaxTimestamp, maxTimestamp),
+                                          detail::StructField(Fields::kStartSystime, startSystime),
+                                          detail::StructField(Fields::kEndSystime, endSystime),
+                                          detail::StructField(Fields::kMinSystime, minSystime),
+                                          detail::StructField(Fields::kMaxSystime, maxSystime) });
 }
 
 } // namespace MeasurementRangeStruct
@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,24 +41,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSessionID, sessionID) });
 }
 } // namespace EVConnected.
 namespace EVNotDetected {
@@ -76,40 +59,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionDuration))
-        {
-            err = DataModel::Decode(reader, sessionDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionEnergyCharged))
-        {
-            err = DataModel::Decode(reader, sessionEnergyCharged);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionEnergyDischarged))
-        {
-            err = DataModel::Decode(reader, sessionEnergyDischarged);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSessionID, sessionID),
+                                          detail::StructField(Fields::kState, state),
+                                          detail::StructField(Fields::kSessionDuration, sessionDuration),
+                                          detail::StructField(Fields::kSessionEnergyCharged, sessionEnergyCharged),
+                                          detail::StructField(Fields::kSessionEnergyDischarged, sessionEnergyDischarged) });
 }
 } // namespace EVNotDetected.
 namespace EnergyTransferStarted {
@@ -126,36 +80,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumCurrent))
-        {
-            err = DataModel::Decode(reader, maximumCurrent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumDischargeCurrent))
-        {
-            err = DataModel::Decode(reader, maximumDischargeCurrent);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSessionID, sessionID),
+                                          detail::StructField(Fields::kState, state),
+                                          detail::StructField(Fields::kMaximumCurrent, maximumCurrent),
+                                          detail::StructField(Fields::kMaximumDischargeCurrent, maximumDischargeCurrent) });
 }
 } // namespace EnergyTransferStarted.
 namespace EnergyTransferStopped {
@@ -173,40 +101,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyTransferred))
-        {
-            err = DataModel::Decode(reader, energyTransferred);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyDischarged))
-        {
-            err = DataModel::Decode(reader, energyDischarged);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSessionID, sessionID),
+                                          detail::StructField(Fields::kState, state),
+                                          detail::StructField(Fields::kReason, reason),
+                                          detail::StructField(Fields::kEnergyTransferred, energyTransferred),
+                                          detail::StructField(Fields::kEnergyDischarged, energyDischarged) });
 }
 } // namespace EnergyTransferStopped.
 namespace Fault {
@@ -223,36 +122,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kFaultStatePreviousState))
-        {
-            err = DataModel::Decode(reader, faultStatePreviousState);
-        }
-        else if (__context_tag == to_underlying(Fields::kFaultStateCurrentState))
-        {
-            err = DataModel::Decode(reader, faultStateCurrentState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSessionID, sessionID),
+                                          detail::StructField(Fields::kState, state),
+                                          detail::StructField(Fields::kFaultStatePreviousState, faultStatePreviousState),
+                                          detail::StructField(Fields::kFaultStateCurrentState, faultStateCurrentState) });
 }
 } // namespace Fault.
 namespace Rfid {
@@ -266,24 +139,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kUid))
-        {
-            err = DataModel::Decode(reader, uid);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kUid, uid) });
 }
 } // namespace Rfid.
 } // namespace Events
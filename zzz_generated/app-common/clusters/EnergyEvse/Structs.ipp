@@ -20,7 +20,7 @@
 
 #include <clusters/EnergyEvse/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,29 +41,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTargetTimeMinutesPastMidnight))
-        {
-            err = DataModel::Decode(reader, targetTimeMinutesPastMidnight);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetSoC))
-        {
-            err = DataModel::Decode(reader, targetSoC);
-        }
-        else if (__context_tag == to_underlying(Fields::kAddedEnergy))
-        {
-            err = DataModel::Decode(reader, addedEnergy);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(
+        reader, { detail::StructField(Fields::kTargetTimeMinutesPastMidnight, targetTimeMinutesPastMidnight),
+                  detail::StructField(Fields::kTargetSoC, targetSoC), detail::StructField(Fields::kAddedEnergy, addedEnergy) });
 }
 
 } // namespace ChargingTargetStruct
@@ -79,25 +59,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
-        {
-            err = DataModel::Decode(reader, dayOfWeekForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kChargingTargets))
-        {
-            err = DataModel::Decode(reader, chargingTargets);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDayOfWeekForSequence, dayOfWeekForSequence),
+                                          detail::StructField(Fields::kChargingTargets, chargingTargets) });
 }
 
 } // namespace ChargingTargetScheduleStruct
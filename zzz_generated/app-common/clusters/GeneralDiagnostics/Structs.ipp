@@ -20,7 +20,7 @@
 
 #include <clusters/GeneralDiagnostics/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -46,49 +46,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsOperational))
-        {
-            err = DataModel::Decode(reader, isOperational);
-        }
-        else if (__context_tag == to_underlying(Fields::kOffPremiseServicesReachableIPv4))
-        {
-            err = DataModel::Decode(reader, offPremiseServicesReachableIPv4);
-        }
-        else if (__context_tag == to_underlying(Fields::kOffPremiseServicesReachableIPv6))
-        {
-            err = DataModel::Decode(reader, offPremiseServicesReachableIPv6);
-        }
-        else if (__context_tag == to_underlying(Fields::kHardwareAddress))
-        {
-            err = DataModel::Decode(reader, hardwareAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kIPv4Addresses))
-        {
-            err = DataModel::Decode(reader, IPv4Addresses);
-        }
-        else if (__context_tag == to_underlying(Fields::kIPv6Addresses))
-        {
-            err = DataModel::Decode(reader, IPv6Addresses);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(
+        reader, { detail::StructField(Fields::kName, name), detail::StructField(Fields::kIsOperational, isOperational),
+                  detail::StructField(Fields::kOffPremiseServicesReachableIPv4, offPremiseServicesReachableIPv4),
+                  detail::StructField(Fields::kOffPremiseServicesReachableIPv6, offPremiseServicesReachableIPv6),
+                  detail::StructField(Fields::kHardwareAddress, hardwareAddress),
+                  detail::StructField(Fields::kIPv4Addresses, IPv4Addresses),
+                  detail::StructField(Fields::kIPv6Addresses, IPv6Addresses), detail::StructField(Fields::kType, type) });
 }
 
 } // namespace NetworkInterface
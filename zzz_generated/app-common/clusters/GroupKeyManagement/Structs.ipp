@@ -20,7 +20,7 @@
 
 #include <clusters/GroupKeyManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -58,33 +58,10 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupId))
-        {
-            err = DataModel::Decode(reader, groupId);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoints))
-        {
-            err = DataModel::Decode(reader, endpoints);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupName))
-        {
-            err = DataModel::Decode(reader, groupName);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kGroupId, groupId),
+                                          detail::StructField(Fields::kEndpoints, endpoints),
+                                          detail::StructField(Fields::kGroupName, groupName),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace GroupInfoMapStruct
@@ -117,29 +94,9 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupId))
-        {
-            err = DataModel::Decode(reader, groupId);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kGroupId, groupId),
+                                          detail::StructField(Fields::kGroupKeySetID, groupKeySetID),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace GroupKeyMapStruct
@@ -161,49 +118,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySecurityPolicy))
-        {
-            err = DataModel::Decode(reader, groupKeySecurityPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey0))
-        {
-            err = DataModel::Decode(reader, epochKey0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime0))
-        {
-            err = DataModel::Decode(reader, epochStartTime0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey1))
-        {
-            err = DataModel::Decode(reader, epochKey1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime1))
-        {
-            err = DataModel::Decode(reader, epochStartTime1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey2))
-        {
-            err = DataModel::Decode(reader, epochKey2);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime2))
-        {
-            err = DataModel::Decode(reader, epochStartTime2);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kGroupKeySetID, groupKeySetID),
+                                          detail::StructField(Fields::kGroupKeySecurityPolicy, groupKeySecurityPolicy),
+                                          detail::StructField(Fields::kEpochKey0, epochKey0),
+                                          detail::StructField(Fields::kEpochStartTime0, epochStartTime0),
+                                          detail::StructField(Fields::kEpochKey1, epochKey1),
+                                          detail::StructField(Fields::kEpochStartTime1, epochStartTime1),
+                                          detail::StructField(Fields::kEpochKey2, epochKey2),
+                                          detail::StructField(Fields::kEpochStartTime2, epochStartTime2) });
 }
 
 } // namespace GroupKeySetStruct
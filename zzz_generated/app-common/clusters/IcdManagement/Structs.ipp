@@ -20,7 +20,7 @@
 
 #include <clusters/IcdManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -68,33 +68,10 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
-        {
-            err = DataModel::Decode(reader, checkInNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMonitoredSubject))
-        {
-            err = DataModel::Decode(reader, monitoredSubject);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientType))
-        {
-            err = DataModel::Decode(reader, clientType);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCheckInNodeID, checkInNodeID),
+                                          detail::StructField(Fields::kMonitoredSubject, monitoredSubject),
+                                          detail::StructField(Fields::kClientType, clientType),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace MonitoringRegistrationStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/JointFabricDatastore/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,29 +41,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kUpdateTimestamp))
-        {
-            err = DataModel::Decode(reader, updateTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kFailureCode))
-        {
-            err = DataModel::Decode(reader, failureCode);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kState, state),
+                                          detail::StructField(Fields::kUpdateTimestamp, updateTimestamp),
+                                          detail::StructField(Fields::kFailureCode, failureCode) });
 }
 
 } // namespace DatastoreStatusEntryStruct
@@ -80,29 +60,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusEntry))
-        {
-            err = DataModel::Decode(reader, statusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kGroupKeySetID, groupKeySetID),
+                                          detail::StructField(Fields::kStatusEntry, statusEntry) });
 }
 
 } // namespace DatastoreNodeKeySetEntryStruct
@@ -119,29 +79,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyName))
-        {
-            err = DataModel::Decode(reader, friendlyName);
-        }
-        else if (__context_tag == to_underlying(Fields::kCommissioningStatusEntry))
-        {
-            err = DataModel::Decode(reader, commissioningStatusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kFriendlyName, friendlyName),
+                                          detail::StructField(Fields::kCommissioningStatusEntry, commissioningStatusEntry) });
 }
 
 } // namespace DatastoreNodeInformationEntryStruct
@@ -159,33 +99,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpointID))
-        {
-            err = DataModel::Decode(reader, endpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusEntry))
-        {
-            err = DataModel::Decode(reader, statusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kEndpointID, endpointID),
+                                          detail::StructField(Fields::kGroupID, groupID),
+                                          detail::StructField(Fields::kStatusEntry, statusEntry) });
 }
 
 } // namespace DatastoreEndpointGroupIDEntryStruct
@@ -203,33 +120,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEndpointID))
-        {
-            err = DataModel::Decode(reader, endpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyName))
-        {
-            err = DataModel::Decode(reader, friendlyName);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusEntry))
-        {
-            err = DataModel::Decode(reader, statusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEndpointID, endpointID),
+                                          detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kFriendlyName, friendlyName),
+                                          detail::StructField(Fields::kStatusEntry, statusEntry) });
 }
 
 } // namespace DatastoreEndpointEntryStruct
@@ -247,33 +141,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNode))
-        {
-            err = DataModel::Decode(reader, node);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroup))
-        {
-            err = DataModel::Decode(reader, group);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNode, node), detail::StructField(Fields::kGroup, group),
+                                          detail::StructField(Fields::kEndpoint, endpoint),
+                                          detail::StructField(Fields::kCluster, cluster) });
 }
 
 } // namespace DatastoreBindingTargetStruct
@@ -292,37 +162,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpointID))
-        {
-            err = DataModel::Decode(reader, endpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kListID))
-        {
-            err = DataModel::Decode(reader, listID);
-        }
-        else if (__context_tag == to_underlying(Fields::kBinding))
-        {
-            err = DataModel::Decode(reader, binding);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusEntry))
-        {
-            err = DataModel::Decode(reader, statusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kEndpointID, endpointID),
+                                          detail::StructField(Fields::kListID, listID),
+                                          detail::StructField(Fields::kBinding, binding),
+                                          detail::StructField(Fields::kStatusEntry, statusEntry) });
 }
 
 } // namespace DatastoreEndpointBindingEntryStruct
@@ -339,29 +183,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCluster, cluster),
+                                          detail::StructField(Fields::kEndpoint, endpoint),
+                                          detail::StructField(Fields::kDeviceType, deviceType) });
 }
 
 } // namespace DatastoreAccessControlTargetStruct
@@ -379,33 +203,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPrivilege))
-        {
-            err = DataModel::Decode(reader, privilege);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuthMode))
-        {
-            err = DataModel::Decode(reader, authMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubjects))
-        {
-            err = DataModel::Decode(reader, subjects);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargets))
-        {
-            err = DataModel::Decode(reader, targets);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPrivilege, privilege),
+                                          detail::StructField(Fields::kAuthMode, authMode),
+                                          detail::StructField(Fields::kSubjects, subjects),
+                                          detail::StructField(Fields::kTargets, targets) });
 }
 
 } // namespace DatastoreAccessControlEntryStruct
@@ -423,33 +224,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kListID))
-        {
-            err = DataModel::Decode(reader, listID);
-        }
-        else if (__context_tag == to_underlying(Fields::kACLEntry))
-        {
-            err = DataModel::Decode(reader, ACLEntry);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusEntry))
-        {
-            err = DataModel::Decode(reader, statusEntry);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kListID, listID),
+                                          detail::StructField(Fields::kACLEntry, ACLEntry),
+                                          detail::StructField(Fields::kStatusEntry, statusEntry) });
 }
 
 } // namespace DatastoreACLEntryStruct
@@ -467,33 +245,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyName))
-        {
-            err = DataModel::Decode(reader, friendlyName);
-        }
-        else if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kIcac))
-        {
-            err = DataModel::Decode(reader, icac);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kFriendlyName, friendlyName),
+                                          detail::StructField(Fields::kVendorID, vendorID),
+                                          detail::StructField(Fields::kIcac, icac) });
 }
 
 } // namespace DatastoreAdministratorInformationEntryStruct
@@ -513,41 +268,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyName))
-        {
-            err = DataModel::Decode(reader, friendlyName);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupCAT))
-        {
-            err = DataModel::Decode(reader, groupCAT);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupCATVersion))
-        {
-            err = DataModel::Decode(reader, groupCATVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupPermission))
-        {
-            err = DataModel::Decode(reader, groupPermission);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kGroupID, groupID),
+                                          detail::StructField(Fields::kFriendlyName, friendlyName),
+                                          detail::StructField(Fields::kGroupKeySetID, groupKeySetID),
+                                          detail::StructField(Fields::kGroupCAT, groupCAT),
+                                          detail::StructField(Fields::kGroupCATVersion, groupCATVersion),
+                                          detail::StructField(Fields::kGroupPermission, groupPermission) });
 }
 
 } // namespace DatastoreGroupInformationEntryStruct
@@ -570,53 +296,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySecurityPolicy))
-        {
-            err = DataModel::Decode(reader, groupKeySecurityPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey0))
-        {
-            err = DataModel::Decode(reader, epochKey0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime0))
-        {
-            err = DataModel::Decode(reader, epochStartTime0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey1))
-        {
-            err = DataModel::Decode(reader, epochKey1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime1))
-        {
-            err = DataModel::Decode(reader, epochStartTime1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey2))
-        {
-            err = DataModel::Decode(reader, epochKey2);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime2))
-        {
-            err = DataModel::Decode(reader, epochStartTime2);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeyMulticastPolicy))
-        {
-            err = DataModel::Decode(reader, groupKeyMulticastPolicy);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kGroupKeySetID, groupKeySetID),
+                                          detail::StructField(Fields::kGroupKeySecurityPolicy, groupKeySecurityPolicy),
+                                          detail::StructField(Fields::kEpochKey0, epochKey0),
+                                          detail::StructField(Fields::kEpochStartTime0, epochStartTime0),
+                                          detail::StructField(Fields::kEpochKey1, epochKey1),
+                                          detail::StructField(Fields::kEpochStartTime1, epochStartTime1),
+                                          detail::StructField(Fields::kEpochKey2, epochKey2),
+                                          detail::StructField(Fields::kEpochStartTime2, epochStartTime2),
+                                          detail::StructField(Fields::kGroupKeyMulticastPolicy, groupKeyMulticastPolicy) });
 }
 
 } // namespace DatastoreGroupKeySetStruct
@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -49,56 +49,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCurrentState))
-        {
-            err = DataModel::Decode(reader, currentState);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampledPosition))
-        {
-            err = DataModel::Decode(reader, sampledPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kPlaybackSpeed))
-        {
-            err = DataModel::Decode(reader, playbackSpeed);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeekRangeEnd))
-        {
-            err = DataModel::Decode(reader, seekRangeEnd);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeekRangeStart))
-        {
-            err = DataModel::Decode(reader, seekRangeStart);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
-        {
-            err = DataModel::Decode(reader, audioAdvanceUnmuted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCurrentState, currentState),
+                                          detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kDuration, duration),
+                                          detail::StructField(Fields::kSampledPosition, sampledPosition),
+                                          detail::StructField(Fields::kPlaybackSpeed, playbackSpeed),
+                                          detail::StructField(Fields::kSeekRangeEnd, seekRangeEnd),
+                                          detail::StructField(Fields::kSeekRangeStart, seekRangeStart),
+                                          detail::StructField(Fields::kData, data),
+                                          detail::StructField(Fields::kAudioAdvanceUnmuted, audioAdvanceUnmuted) });
 }
 } // namespace StateChanged.
 } // namespace Events
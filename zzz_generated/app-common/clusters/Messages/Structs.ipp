@@ -20,7 +20,7 @@
 
 #include <clusters/Messages/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMessageResponseID))
-        {
-            err = DataModel::Decode(reader, messageResponseID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMessageResponseID, messageResponseID),
+                                          detail::StructField(Fields::kLabel, label) });
 }
 
 } // namespace MessageResponseOptionStruct
@@ -79,45 +62,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriority))
-        {
-            err = DataModel::Decode(reader, priority);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageControl))
-        {
-            err = DataModel::Decode(reader, messageControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageText))
-        {
-            err = DataModel::Decode(reader, messageText);
-        }
-        else if (__context_tag == to_underlying(Fields::kResponses))
-        {
-            err = DataModel::Decode(reader, responses);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMessageID, messageID),
+                                          detail::StructField(Fields::kPriority, priority),
+                                          detail::StructField(Fields::kMessageControl, messageControl),
+                                          detail::StructField(Fields::kStartTime, startTime),
+                                          detail::StructField(Fields::kDuration, duration),
+                                          detail::StructField(Fields::kMessageText, messageText),
+                                          detail::StructField(Fields::kResponses, responses) });
 }
 
 } // namespace MessageStruct
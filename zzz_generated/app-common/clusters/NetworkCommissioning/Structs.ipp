@@ -20,7 +20,7 @@
 
 #include <clusters/NetworkCommissioning/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNetworkID))
-        {
-            err = DataModel::Decode(reader, networkID);
-        }
-        else if (__context_tag == to_underlying(Fields::kConnected))
-        {
-            err = DataModel::Decode(reader, connected);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkIdentifier))
-        {
-            err = DataModel::Decode(reader, networkIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientIdentifier))
-        {
-            err = DataModel::Decode(reader, clientIdentifier);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNetworkID, networkID),
+                                          detail::StructField(Fields::kConnected, connected),
+                                          detail::StructField(Fields::kNetworkIdentifier, networkIdentifier),
+                                          detail::StructField(Fields::kClientIdentifier, clientIdentifier) });
 }
 
 } // namespace NetworkInfoStruct
@@ -90,49 +67,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPanId))
-        {
-            err = DataModel::Decode(reader, panId);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedPanId))
-        {
-            err = DataModel::Decode(reader, extendedPanId);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkName))
-        {
-            err = DataModel::Decode(reader, networkName);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kVersion))
-        {
-            err = DataModel::Decode(reader, version);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedAddress))
-        {
-            err = DataModel::Decode(reader, extendedAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kRssi))
-        {
-            err = DataModel::Decode(reader, rssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kLqi))
-        {
-            err = DataModel::Decode(reader, lqi);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPanId, panId),
+                                          detail::StructField(Fields::kExtendedPanId, extendedPanId),
+                                          detail::StructField(Fields::kNetworkName, networkName),
+                                          detail::StructField(Fields::kChannel, channel),
+                                          detail::StructField(Fields::kVersion, version),
+                                          detail::StructField(Fields::kExtendedAddress, extendedAddress),
+                                          detail::StructField(Fields::kRssi, rssi), detail::StructField(Fields::kLqi, lqi) });
 }
 
 } // namespace ThreadInterfaceScanResultStruct
@@ -152,41 +93,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSecurity))
-        {
-            err = DataModel::Decode(reader, security);
-        }
-        else if (__context_tag == to_underlying(Fields::kSsid))
-        {
-            err = DataModel::Decode(reader, ssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kBssid))
-        {
-            err = DataModel::Decode(reader, bssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kWiFiBand))
-        {
-            err = DataModel::Decode(reader, wiFiBand);
-        }
-        else if (__context_tag == to_underlying(Fields::kRssi))
-        {
-            err = DataModel::Decode(reader, rssi);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSecurity, security),
+                                          detail::StructField(Fields::kSsid, ssid), detail::StructField(Fields::kBssid, bssid),
+                                          detail::StructField(Fields::kChannel, channel),
+                                          detail::StructField(Fields::kWiFiBand, wiFiBand),
+                                          detail::StructField(Fields::kRssi, rssi) });
 }
 
 } // namespace WiFiInterfaceScanResultStruct
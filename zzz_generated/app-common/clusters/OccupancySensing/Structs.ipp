@@ -20,7 +20,7 @@
 
 #include <clusters/OccupancySensing/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,29 +41,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kHoldTimeMin))
-        {
-            err = DataModel::Decode(reader, holdTimeMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kHoldTimeMax))
-        {
-            err = DataModel::Decode(reader, holdTimeMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kHoldTimeDefault))
-        {
-            err = DataModel::Decode(reader, holdTimeDefault);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kHoldTimeMin, holdTimeMin),
+                                          detail::StructField(Fields::kHoldTimeMax, holdTimeMax),
+                                          detail::StructField(Fields::kHoldTimeDefault, holdTimeDefault) });
 }
 
 } // namespace HoldTimeLimitsStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/OperationalCredentials/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -61,45 +61,13 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kRootPublicKey))
-        {
-            err = DataModel::Decode(reader, rootPublicKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricID))
-        {
-            err = DataModel::Decode(reader, fabricID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kVIDVerificationStatement))
-        {
-            err = DataModel::Decode(reader, VIDVerificationStatement);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kRootPublicKey, rootPublicKey),
+                                          detail::StructField(Fields::kVendorID, vendorID),
+                                          detail::StructField(Fields::kFabricID, fabricID),
+                                          detail::StructField(Fields::kNodeID, nodeID),
+                                          detail::StructField(Fields::kLabel, label),
+                                          detail::StructField(Fields::kVIDVerificationStatement, VIDVerificationStatement),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace FabricDescriptorStruct
@@ -133,33 +101,9 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNoc))
-        {
-            err = DataModel::Decode(reader, noc);
-        }
-        else if (__context_tag == to_underlying(Fields::kIcac))
-        {
-            err = DataModel::Decode(reader, icac);
-        }
-        else if (__context_tag == to_underlying(Fields::kVvsc))
-        {
-            err = DataModel::Decode(reader, vvsc);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNoc, noc), detail::StructField(Fields::kIcac, icac),
+                                          detail::StructField(Fields::kVvsc, vvsc),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace NOCStruct
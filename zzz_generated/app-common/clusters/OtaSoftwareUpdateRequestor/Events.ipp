@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,36 +44,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousState))
-        {
-            err = DataModel::Decode(reader, previousState);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, targetSoftwareVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousState, previousState),
+                                          detail::StructField(Fields::kNewState, newState),
+                                          detail::StructField(Fields::kReason, reason),
+                                          detail::StructField(Fields::kTargetSoftwareVersion, targetSoftwareVersion) });
 }
 } // namespace StateTransition.
 namespace VersionApplied {
@@ -88,28 +62,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductID))
-        {
-            err = DataModel::Decode(reader, productID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSoftwareVersion, softwareVersion),
+                                          detail::StructField(Fields::kProductID, productID) });
 }
 } // namespace VersionApplied.
 namespace DownloadError {
@@ -126,36 +80,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kBytesDownloaded))
-        {
-            err = DataModel::Decode(reader, bytesDownloaded);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgressPercent))
-        {
-            err = DataModel::Decode(reader, progressPercent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPlatformCode))
-        {
-            err = DataModel::Decode(reader, platformCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSoftwareVersion, softwareVersion),
+                                          detail::StructField(Fields::kBytesDownloaded, bytesDownloaded),
+                                          detail::StructField(Fields::kProgressPercent, progressPercent),
+                                          detail::StructField(Fields::kPlatformCode, platformCode) });
 }
 } // namespace DownloadError.
 } // namespace Events
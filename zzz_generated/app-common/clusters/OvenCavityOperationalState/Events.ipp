@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -41,24 +41,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kErrorState))
-        {
-            err = DataModel::Decode(reader, errorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kErrorState, errorState) });
 }
 } // namespace OperationalError.
 namespace OperationCompletion {
@@ -74,32 +57,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
-        {
-            err = DataModel::Decode(reader, completionErrorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPausedTime))
-        {
-            err = DataModel::Decode(reader, pausedTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCompletionErrorCode, completionErrorCode),
+                                          detail::StructField(Fields::kTotalOperationalTime, totalOperationalTime),
+                                          detail::StructField(Fields::kPausedTime, pausedTime) });
 }
 } // namespace OperationCompletion.
 } // namespace Events
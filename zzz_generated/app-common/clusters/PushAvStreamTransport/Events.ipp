@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -43,32 +43,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kConnectionID))
-        {
-            err = DataModel::Decode(reader, connectionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTriggerType))
-        {
-            err = DataModel::Decode(reader, triggerType);
-        }
-        else if (__context_tag == to_underlying(Fields::kActivationReason))
-        {
-            err = DataModel::Decode(reader, activationReason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kConnectionID, connectionID),
+                                          detail::StructField(Fields::kTriggerType, triggerType),
+                                          detail::StructField(Fields::kActivationReason, activationReason) });
 }
 } // namespace PushTransportBegin.
 namespace PushTransportEnd {
@@ -84,32 +61,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kConnectionID))
-        {
-            err = DataModel::Decode(reader, connectionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTriggerType))
-        {
-            err = DataModel::Decode(reader, triggerType);
-        }
-        else if (__context_tag == to_underlying(Fields::kActivationReason))
-        {
-            err = DataModel::Decode(reader, activationReason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kConnectionID, connectionID),
+                                          detail::StructField(Fields::kTriggerType, triggerType),
+                                          detail::StructField(Fields::kActivationReason, activationReason) });
 }
 } // namespace PushTransportEnd.
 } // namespace Events
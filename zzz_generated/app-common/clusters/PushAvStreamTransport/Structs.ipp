@@ -20,7 +20,7 @@
 
 #include <clusters/PushAvStreamTransport/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kInitialDuration))
-        {
-            err = DataModel::Decode(reader, initialDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kAugmentationDuration))
-        {
-            err = DataModel::Decode(reader, augmentationDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kBlindDuration))
-        {
-            err = DataModel::Decode(reader, blindDuration);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kInitialDuration, initialDuration),
+                                          detail::StructField(Fields::kAugmentationDuration, augmentationDuration),
+                                          detail::StructField(Fields::kMaxDuration, maxDuration),
+                                          detail::StructField(Fields::kBlindDuration, blindDuration) });
 }
 
 } // namespace TransportMotionTriggerTimeControlStruct
@@ -84,25 +61,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kZone))
-        {
-            err = DataModel::Decode(reader, zone);
-        }
-        else if (__context_tag == to_underlying(Fields::kSensitivity))
-        {
-            err = DataModel::Decode(reader, sensitivity);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kZone, zone),
+                                          detail::StructField(Fields::kSensitivity, sensitivity) });
 }
 
 } // namespace TransportZoneOptionsStruct
@@ -121,37 +81,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTriggerType))
-        {
-            err = DataModel::Decode(reader, triggerType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMotionZones))
-        {
-            err = DataModel::Decode(reader, motionZones);
-        }
-        else if (__context_tag == to_underlying(Fields::kMotionSensitivity))
-        {
-            err = DataModel::Decode(reader, motionSensitivity);
-        }
-        else if (__context_tag == to_underlying(Fields::kMotionTimeControl))
-        {
-            err = DataModel::Decode(reader, motionTimeControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPreRollLen))
-        {
-            err = DataModel::Decode(reader, maxPreRollLen);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kTriggerType, triggerType),
+                                          detail::StructField(Fields::kMotionZones, motionZones),
+                                          detail::StructField(Fields::kMotionSensitivity, motionSensitivity),
+                                          detail::StructField(Fields::kMotionTimeControl, motionTimeControl),
+                                          detail::StructField(Fields::kMaxPreRollLen, maxPreRollLen) });
 }
 
 } // namespace TransportTriggerOptionsStruct
@@ -169,33 +103,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kChunkDuration))
-        {
-            err = DataModel::Decode(reader, chunkDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kCENCKey))
-        {
-            err = DataModel::Decode(reader, CENCKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataEnabled))
-        {
-            err = DataModel::Decode(reader, metadataEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kCENCKeyID))
-        {
-            err = DataModel::Decode(reader, CENCKeyID);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kChunkDuration, chunkDuration),
+                                          detail::StructField(Fields::kCENCKey, CENCKey),
+                                          detail::StructField(Fields::kMetadataEnabled, metadataEnabled),
+                                          detail::StructField(Fields::kCENCKeyID, CENCKeyID) });
 }
 
 } // namespace CMAFContainerOptionsStruct
@@ -211,25 +122,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kContainerType))
-        {
-            err = DataModel::Decode(reader, containerType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCMAFContainerOptions))
-        {
-            err = DataModel::Decode(reader, CMAFContainerOptions);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kContainerType, containerType),
+                                          detail::StructField(Fields::kCMAFContainerOptions, CMAFContainerOptions) });
 }
 
 } // namespace ContainerOptionsStruct
@@ -252,53 +146,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kStreamUsage))
-        {
-            err = DataModel::Decode(reader, streamUsage);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpointID))
-        {
-            err = DataModel::Decode(reader, endpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kUrl))
-        {
-            err = DataModel::Decode(reader, url);
-        }
-        else if (__context_tag == to_underlying(Fields::kTriggerOptions))
-        {
-            err = DataModel::Decode(reader, triggerOptions);
-        }
-        else if (__context_tag == to_underlying(Fields::kIngestMethod))
-        {
-            err = DataModel::Decode(reader, ingestMethod);
-        }
-        else if (__context_tag == to_underlying(Fields::kContainerOptions))
-        {
-            err = DataModel::Decode(reader, containerOptions);
-        }
-        else if (__context_tag == to_underlying(Fields::kExpiryTime))
-        {
-            err = DataModel::Decode(reader, expiryTime);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kStreamUsage, streamUsage),
+                                          detail::StructField(Fields::kVideoStreamID, videoStreamID),
+                                          detail::StructField(Fields::kAudioStreamID, audioStreamID),
+                                          detail::StructField(Fields::kEndpointID, endpointID),
+                                          detail::StructField(Fields::kUrl, url),
+                                          detail::StructField(Fields::kTriggerOptions, triggerOptions),
+                                          detail::StructField(Fields::kIngestMethod, ingestMethod),
+                                          detail::StructField(Fields::kContainerOptions, containerOptions),
+                                          detail::StructField(Fields::kExpiryTime, expiryTime) });
 }
 
 } // namespace TransportOptionsStruct
@@ -332,33 +188,10 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kConnectionID))
-        {
-            err = DataModel::Decode(reader, connectionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransportStatus))
-        {
-            err = DataModel::Decode(reader, transportStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransportOptions))
-        {
-            err = DataModel::Decode(reader, transportOptions);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kConnectionID, connectionID),
+                                          detail::StructField(Fields::kTransportStatus, transportStatus),
+                                          detail::StructField(Fields::kTransportOptions, transportOptions),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace TransportConfigurationStruct
@@ -374,25 +207,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kContainerFormat))
-        {
-            err = DataModel::Decode(reader, containerFormat);
-        }
-        else if (__context_tag == to_underlying(Fields::kIngestMethod))
-        {
-            err = DataModel::Decode(reader, ingestMethod);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kContainerFormat, containerFormat),
+                                          detail::StructField(Fields::kIngestMethod, ingestMethod) });
 }
 
 } // namespace SupportedFormatStruct
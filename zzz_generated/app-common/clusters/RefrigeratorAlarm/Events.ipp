@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,36 +44,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kActive))
-        {
-            err = DataModel::Decode(reader, active);
-        }
-        else if (__context_tag == to_underlying(Fields::kInactive))
-        {
-            err = DataModel::Decode(reader, inactive);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kMask))
-        {
-            err = DataModel::Decode(reader, mask);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kActive, active),
+                                          detail::StructField(Fields::kInactive, inactive),
+                                          detail::StructField(Fields::kState, state), detail::StructField(Fields::kMask, mask) });
 }
 } // namespace Notify.
 } // namespace Events
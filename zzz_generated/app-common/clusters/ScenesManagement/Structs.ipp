@@ -20,7 +20,7 @@
 
 #include <clusters/ScenesManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -47,53 +47,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAttributeID))
-        {
-            err = DataModel::Decode(reader, attributeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned8))
-        {
-            err = DataModel::Decode(reader, valueUnsigned8);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned8))
-        {
-            err = DataModel::Decode(reader, valueSigned8);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned16))
-        {
-            err = DataModel::Decode(reader, valueUnsigned16);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned16))
-        {
-            err = DataModel::Decode(reader, valueSigned16);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned32))
-        {
-            err = DataModel::Decode(reader, valueUnsigned32);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned32))
-        {
-            err = DataModel::Decode(reader, valueSigned32);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned64))
-        {
-            err = DataModel::Decode(reader, valueUnsigned64);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned64))
-        {
-            err = DataModel::Decode(reader, valueSigned64);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAttributeID, attributeID),
+                                          detail::StructField(Fields::kValueUnsigned8, valueUnsigned8),
+                                          detail::StructField(Fields::kValueSigned8, valueSigned8),
+                                          detail::StructField(Fields::kValueUnsigned16, valueUnsigned16),
+                                          detail::StructField(Fields::kValueSigned16, valueSigned16),
+                                          detail::StructField(Fields::kValueUnsigned32, valueUnsigned32),
+                                          detail::StructField(Fields::kValueSigned32, valueSigned32),
+                                          detail::StructField(Fields::kValueUnsigned64, valueUnsigned64),
+                                          detail::StructField(Fields::kValueSigned64, valueSigned64) });
 }
 
 } // namespace AttributeValuePairStruct
@@ -109,25 +71,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kClusterID))
-        {
-            err = DataModel::Decode(reader, clusterID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttributeValueList))
-        {
-            err = DataModel::Decode(reader, attributeValueList);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kClusterID, clusterID),
+                                          detail::StructField(Fields::kAttributeValueList, attributeValueList) });
 }
 
 } // namespace ExtensionFieldSetStruct
@@ -173,41 +118,12 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSceneCount))
-        {
-            err = DataModel::Decode(reader, sceneCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentScene))
-        {
-            err = DataModel::Decode(reader, currentScene);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentGroup))
-        {
-            err = DataModel::Decode(reader, currentGroup);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneValid))
-        {
-            err = DataModel::Decode(reader, sceneValid);
-        }
-        else if (__context_tag == to_underlying(Fields::kRemainingCapacity))
-        {
-            err = DataModel::Decode(reader, remainingCapacity);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSceneCount, sceneCount),
+                                          detail::StructField(Fields::kCurrentScene, currentScene),
+                                          detail::StructField(Fields::kCurrentGroup, currentGroup),
+                                          detail::StructField(Fields::kSceneValid, sceneValid),
+                                          detail::StructField(Fields::kRemainingCapacity, remainingCapacity),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace SceneInfoStruct
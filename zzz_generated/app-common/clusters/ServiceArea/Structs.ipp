@@ -20,7 +20,7 @@
 
 #include <clusters/ServiceArea/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLandmarkTag))
-        {
-            err = DataModel::Decode(reader, landmarkTag);
-        }
-        else if (__context_tag == to_underlying(Fields::kRelativePositionTag))
-        {
-            err = DataModel::Decode(reader, relativePositionTag);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLandmarkTag, landmarkTag),
+                                          detail::StructField(Fields::kRelativePositionTag, relativePositionTag) });
 }
 
 } // namespace LandmarkInfoStruct
@@ -74,25 +57,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLocationInfo))
-        {
-            err = DataModel::Decode(reader, locationInfo);
-        }
-        else if (__context_tag == to_underlying(Fields::kLandmarkInfo))
-        {
-            err = DataModel::Decode(reader, landmarkInfo);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLocationInfo, locationInfo),
+                                          detail::StructField(Fields::kLandmarkInfo, landmarkInfo) });
 }
 
 } // namespace AreaInfoStruct
@@ -109,29 +75,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAreaID))
-        {
-            err = DataModel::Decode(reader, areaID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMapID))
-        {
-            err = DataModel::Decode(reader, mapID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAreaInfo))
-        {
-            err = DataModel::Decode(reader, areaInfo);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAreaID, areaID),
+                                          detail::StructField(Fields::kMapID, mapID),
+                                          detail::StructField(Fields::kAreaInfo, areaInfo) });
 }
 
 } // namespace AreaStruct
@@ -147,25 +93,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMapID))
-        {
-            err = DataModel::Decode(reader, mapID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMapID, mapID), detail::StructField(Fields::kName, name) });
 }
 
 } // namespace MapStruct
@@ -183,33 +111,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAreaID))
-        {
-            err = DataModel::Decode(reader, areaID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEstimatedTime))
-        {
-            err = DataModel::Decode(reader, estimatedTime);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAreaID, areaID),
+                                          detail::StructField(Fields::kStatus, status),
+                                          detail::StructField(Fields::kTotalOperationalTime, totalOperationalTime),
+                                          detail::StructField(Fields::kEstimatedTime, estimatedTime) });
 }
 
 } // namespace ProgressStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/SoftwareDiagnostics/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -43,37 +43,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackFreeCurrent))
-        {
-            err = DataModel::Decode(reader, stackFreeCurrent);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackFreeMinimum))
-        {
-            err = DataModel::Decode(reader, stackFreeMinimum);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackSize))
-        {
-            err = DataModel::Decode(reader, stackSize);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kId, id), detail::StructField(Fields::kName, name),
+                                          detail::StructField(Fields::kStackFreeCurrent, stackFreeCurrent),
+                                          detail::StructField(Fields::kStackFreeMinimum, stackFreeMinimum),
+                                          detail::StructField(Fields::kStackSize, stackSize) });
 }
 
 } // namespace ThreadMetricsStruct
@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -43,32 +43,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTargetList))
-        {
-            err = DataModel::Decode(reader, targetList);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentTarget))
-        {
-            err = DataModel::Decode(reader, currentTarget);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kTargetList, targetList),
+                                          detail::StructField(Fields::kCurrentTarget, currentTarget),
+                                          detail::StructField(Fields::kData, data) });
 }
 } // namespace TargetUpdated.
 } // namespace Events
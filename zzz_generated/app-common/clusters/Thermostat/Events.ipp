@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,28 +42,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousSystemMode))
-        {
-            err = DataModel::Decode(reader, previousSystemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentSystemMode))
-        {
-            err = DataModel::Decode(reader, currentSystemMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousSystemMode, previousSystemMode),
+                                          detail::StructField(Fields::kCurrentSystemMode, currentSystemMode) });
 }
 } // namespace SystemModeChange.
 namespace LocalTemperatureChange {
@@ -77,24 +57,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCurrentLocalTemperature))
-        {
-            err = DataModel::Decode(reader, currentLocalTemperature);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCurrentLocalTemperature, currentLocalTemperature) });
 }
 } // namespace LocalTemperatureChange.
 namespace OccupancyChange {
@@ -109,28 +72,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousOccupancy))
-        {
-            err = DataModel::Decode(reader, previousOccupancy);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentOccupancy))
-        {
-            err = DataModel::Decode(reader, currentOccupancy);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousOccupancy, previousOccupancy),
+                                          detail::StructField(Fields::kCurrentOccupancy, currentOccupancy) });
 }
 } // namespace OccupancyChange.
 namespace SetpointChange {
@@ -147,36 +90,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kOccupancy))
-        {
-            err = DataModel::Decode(reader, occupancy);
-        }
-        else if (__context_tag == to_underlying(Fields::kPreviousSetpoint))
-        {
-            err = DataModel::Decode(reader, previousSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentSetpoint))
-        {
-            err = DataModel::Decode(reader, currentSetpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSystemMode, systemMode),
+                                          detail::StructField(Fields::kOccupancy, occupancy),
+                                          detail::StructField(Fields::kPreviousSetpoint, previousSetpoint),
+                                          detail::StructField(Fields::kCurrentSetpoint, currentSetpoint) });
 }
 } // namespace SetpointChange.
 namespace RunningStateChange {
@@ -191,28 +108,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousRunningState))
-        {
-            err = DataModel::Decode(reader, previousRunningState);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentRunningState))
-        {
-            err = DataModel::Decode(reader, currentRunningState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousRunningState, previousRunningState),
+                                          detail::StructField(Fields::kCurrentRunningState, currentRunningState) });
 }
 } // namespace RunningStateChange.
 namespace RunningModeChange {
@@ -227,28 +124,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousRunningMode))
-        {
-            err = DataModel::Decode(reader, previousRunningMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentRunningMode))
-        {
-            err = DataModel::Decode(reader, currentRunningMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousRunningMode, previousRunningMode),
+                                          detail::StructField(Fields::kCurrentRunningMode, currentRunningMode) });
 }
 } // namespace RunningModeChange.
 namespace ActiveScheduleChange {
@@ -263,28 +140,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousScheduleHandle))
-        {
-            err = DataModel::Decode(reader, previousScheduleHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentScheduleHandle))
-        {
-            err = DataModel::Decode(reader, currentScheduleHandle);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousScheduleHandle, previousScheduleHandle),
+                                          detail::StructField(Fields::kCurrentScheduleHandle, currentScheduleHandle) });
 }
 } // namespace ActiveScheduleChange.
 namespace ActivePresetChange {
@@ -299,28 +156,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPreviousPresetHandle))
-        {
-            err = DataModel::Decode(reader, previousPresetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentPresetHandle))
-        {
-            err = DataModel::Decode(reader, currentPresetHandle);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPreviousPresetHandle, previousPresetHandle),
+                                          detail::StructField(Fields::kCurrentPresetHandle, currentPresetHandle) });
 }
 } // namespace ActivePresetChange.
 } // namespace Events
@@ -20,7 +20,7 @@
 
 #include <clusters/Thermostat/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,41 +44,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayOfWeek))
-        {
-            err = DataModel::Decode(reader, dayOfWeek);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolingSetpoint))
-        {
-            err = DataModel::Decode(reader, coolingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSetpoint))
-        {
-            err = DataModel::Decode(reader, heatingSetpoint);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDayOfWeek, dayOfWeek),
+                                          detail::StructField(Fields::kTransitionTime, transitionTime),
+                                          detail::StructField(Fields::kPresetHandle, presetHandle),
+                                          detail::StructField(Fields::kSystemMode, systemMode),
+                                          detail::StructField(Fields::kCoolingSetpoint, coolingSetpoint),
+                                          detail::StructField(Fields::kHeatingSetpoint, heatingSetpoint) });
 }
 
 } // namespace ScheduleTransitionStruct
@@ -98,41 +69,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kScheduleHandle))
-        {
-            err = DataModel::Decode(reader, scheduleHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitions))
-        {
-            err = DataModel::Decode(reader, transitions);
-        }
-        else if (__context_tag == to_underlying(Fields::kBuiltIn))
-        {
-            err = DataModel::Decode(reader, builtIn);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kScheduleHandle, scheduleHandle),
+                                          detail::StructField(Fields::kSystemMode, systemMode),
+                                          detail::StructField(Fields::kName, name),
+                                          detail::StructField(Fields::kPresetHandle, presetHandle),
+                                          detail::StructField(Fields::kTransitions, transitions),
+                                          detail::StructField(Fields::kBuiltIn, builtIn) });
 }
 
 } // namespace ScheduleStruct
@@ -152,41 +94,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetScenario))
-        {
-            err = DataModel::Decode(reader, presetScenario);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolingSetpoint))
-        {
-            err = DataModel::Decode(reader, coolingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSetpoint))
-        {
-            err = DataModel::Decode(reader, heatingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kBuiltIn))
-        {
-            err = DataModel::Decode(reader, builtIn);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPresetHandle, presetHandle),
+                                          detail::StructField(Fields::kPresetScenario, presetScenario),
+                                          detail::StructField(Fields::kName, name),
+                                          detail::StructField(Fields::kCoolingSetpoint, coolingSetpoint),
+                                          detail::StructField(Fields::kHeatingSetpoint, heatingSetpoint),
+                                          detail::StructField(Fields::kBuiltIn, builtIn) });
 }
 
 } // namespace PresetStruct
@@ -203,29 +116,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPresetScenario))
-        {
-            err = DataModel::Decode(reader, presetScenario);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumberOfPresets))
-        {
-            err = DataModel::Decode(reader, numberOfPresets);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetTypeFeatures))
-        {
-            err = DataModel::Decode(reader, presetTypeFeatures);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPresetScenario, presetScenario),
+                                          detail::StructField(Fields::kNumberOfPresets, numberOfPresets),
+                                          detail::StructField(Fields::kPresetTypeFeatures, presetTypeFeatures) });
 }
 
 } // namespace PresetTypeStruct
@@ -242,29 +135,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumberOfSchedules))
-        {
-            err = DataModel::Decode(reader, numberOfSchedules);
-        }
-        else if (__context_tag == to_underlying(Fields::kScheduleTypeFeatures))
-        {
-            err = DataModel::Decode(reader, scheduleTypeFeatures);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kSystemMode, systemMode),
+                                          detail::StructField(Fields::kNumberOfSchedules, numberOfSchedules),
+                                          detail::StructField(Fields::kScheduleTypeFeatures, scheduleTypeFeatures) });
 }
 
 } // namespace ScheduleTypeStruct
@@ -282,33 +155,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kUniqueID))
-        {
-            err = DataModel::Decode(reader, uniqueID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kEffectiveTime))
-        {
-            err = DataModel::Decode(reader, effectiveTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kExpirationTime))
-        {
-            err = DataModel::Decode(reader, expirationTime);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kUniqueID, uniqueID),
+                                          detail::StructField(Fields::kPresetHandle, presetHandle),
+                                          detail::StructField(Fields::kEffectiveTime, effectiveTime),
+                                          detail::StructField(Fields::kExpirationTime, expirationTime) });
 }
 
 } // namespace ThermostatSuggestionStruct
@@ -325,29 +175,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatSetpoint))
-        {
-            err = DataModel::Decode(reader, heatSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolSetpoint))
-        {
-            err = DataModel::Decode(reader, coolSetpoint);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kTransitionTime, transitionTime),
+                                          detail::StructField(Fields::kHeatSetpoint, heatSetpoint),
+                                          detail::StructField(Fields::kCoolSetpoint, coolSetpoint) });
 }
 
 } // namespace WeeklyScheduleTransitionStruct
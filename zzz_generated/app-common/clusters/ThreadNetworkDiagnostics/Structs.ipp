@@ -20,7 +20,7 @@
 
 #include <clusters/ThreadNetworkDiagnostics/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -52,73 +52,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kExtAddress))
-        {
-            err = DataModel::Decode(reader, extAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kAge))
-        {
-            err = DataModel::Decode(reader, age);
-        }
-        else if (__context_tag == to_underlying(Fields::kRloc16))
-        {
-            err = DataModel::Decode(reader, rloc16);
-        }
-        else if (__context_tag == to_underlying(Fields::kLinkFrameCounter))
-        {
-            err = DataModel::Decode(reader, linkFrameCounter);
-        }
-        else if (__context_tag == to_underlying(Fields::kMleFrameCounter))
-        {
-            err = DataModel::Decode(reader, mleFrameCounter);
-        }
-        else if (__context_tag == to_underlying(Fields::kLqi))
-        {
-            err = DataModel::Decode(reader, lqi);
-        }
-        else if (__context_tag == to_underlying(Fields::kAverageRssi))
-        {
-            err = DataModel::Decode(reader, averageRssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kLastRssi))
-        {
-            err = DataModel::Decode(reader, lastRssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kFrameErrorRate))
-        {
-            err = DataModel::Decode(reader, frameErrorRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageErrorRate))
-        {
-            err = DataModel::Decode(reader, messageErrorRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kRxOnWhenIdle))
-        {
-            err = DataModel::Decode(reader, rxOnWhenIdle);
-        }
-        else if (__context_tag == to_underlying(Fields::kFullThreadDevice))
-        {
-            err = DataModel::Decode(reader, fullThreadDevice);
-        }
-        else if (__context_tag == to_underlying(Fields::kFullNetworkData))
-        {
-            err = DataModel::Decode(reader, fullNetworkData);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsChild))
-        {
-            err = DataModel::Decode(reader, isChild);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kExtAddress, extAddress),
+                                          detail::StructField(Fields::kAge, age), detail::StructField(Fields::kRloc16, rloc16),
+                                          detail::StructField(Fields::kLinkFrameCounter, linkFrameCounter),
+                                          detail::StructField(Fields::kMleFrameCounter, mleFrameCounter),
+                                          detail::StructField(Fields::kLqi, lqi),
+                                          detail::StructField(Fields::kAverageRssi, averageRssi),
+                                          detail::StructField(Fields::kLastRssi, lastRssi),
+                                          detail::StructField(Fields::kFrameErrorRate, frameErrorRate),
+                                          detail::StructField(Fields::kMessageErrorRate, messageErrorRate),
+                                          detail::StructField(Fields::kRxOnWhenIdle, rxOnWhenIdle),
+                                          detail::StructField(Fields::kFullThreadDevice, fullThreadDevice),
+                                          detail::StructField(Fields::kFullNetworkData, fullNetworkData),
+                                          detail::StructField(Fields::kIsChild, isChild) });
 }
 
 } // namespace NeighborTableStruct
@@ -144,65 +90,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kActiveTimestampPresent))
-        {
-            err = DataModel::Decode(reader, activeTimestampPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPendingTimestampPresent))
-        {
-            err = DataModel::Decode(reader, pendingTimestampPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMasterKeyPresent))
-        {
-            err = DataModel::Decode(reader, masterKeyPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkNamePresent))
-        {
-            err = DataModel::Decode(reader, networkNamePresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedPanIdPresent))
-        {
-            err = DataModel::Decode(reader, extendedPanIdPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeshLocalPrefixPresent))
-        {
-            err = DataModel::Decode(reader, meshLocalPrefixPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kDelayPresent))
-        {
-            err = DataModel::Decode(reader, delayPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPanIdPresent))
-        {
-            err = DataModel::Decode(reader, panIdPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelPresent))
-        {
-            err = DataModel::Decode(reader, channelPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPskcPresent))
-        {
-            err = DataModel::Decode(reader, pskcPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kSecurityPolicyPresent))
-        {
-            err = DataModel::Decode(reader, securityPolicyPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelMaskPresent))
-        {
-            err = DataModel::Decode(reader, channelMaskPresent);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kActiveTimestampPresent, activeTimestampPresent),
+                                          detail::StructField(Fields::kPendingTimestampPresent, pendingTimestampPresent),
+                                          detail::StructField(Fields::kMasterKeyPresent, masterKeyPresent),
+                                          detail::StructField(Fields::kNetworkNamePresent, networkNamePresent),
+                                          detail::StructField(Fields::kExtendedPanIdPresent, extendedPanIdPresent),
+                                          detail::StructField(Fields::kMeshLocalPrefixPresent, meshLocalPrefixPresent),
+                                          detail::StructField(Fields::kDelayPresent, delayPresent),
+                                          detail::StructField(Fields::kPanIdPresent, panIdPresent),
+                                          detail::StructField(Fields::kChannelPresent, channelPresent),
+                                          detail::StructField(Fields::kPskcPresent, pskcPresent),
+                                          detail::StructField(Fields::kSecurityPolicyPresent, securityPolicyPresent),
+                                          detail::StructField(Fields::kChannelMaskPresent, channelMaskPresent) });
 }
 
 } // namespace OperationalDatasetComponents
@@ -226,57 +125,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kExtAddress))
-        {
-            err = DataModel::Decode(reader, extAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kRloc16))
-        {
-            err = DataModel::Decode(reader, rloc16);
-        }
-        else if (__context_tag == to_underlying(Fields::kRouterId))
-        {
-            err = DataModel::Decode(reader, routerId);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextHop))
-        {
-            err = DataModel::Decode(reader, nextHop);
-        }
-        else if (__context_tag == to_underlying(Fields::kPathCost))
-        {
-            err = DataModel::Decode(reader, pathCost);
-        }
-        else if (__context_tag == to_underlying(Fields::kLQIIn))
-        {
-            err = DataModel::Decode(reader, LQIIn);
-        }
-        else if (__context_tag == to_underlying(Fields::kLQIOut))
-        {
-            err = DataModel::Decode(reader, LQIOut);
-        }
-        else if (__context_tag == to_underlying(Fields::kAge))
-        {
-            err = DataModel::Decode(reader, age);
-        }
-        else if (__context_tag == to_underlying(Fields::kAllocated))
-        {
-            err = DataModel::Decode(reader, allocated);
-        }
-        else if (__context_tag == to_underlying(Fields::kLinkEstablished))
-        {
-            err = DataModel::Decode(reader, linkEstablished);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kExtAddress, extAddress),
+                                          detail::StructField(Fields::kRloc16, rloc16),
+                                          detail::StructField(Fields::kRouterId, routerId),
+                                          detail::StructField(Fields::kNextHop, nextHop),
+                                          detail::StructField(Fields::kPathCost, pathCost),
+                                          detail::StructField(Fields::kLQIIn, LQIIn),
+                                          detail::StructField(Fields::kLQIOut, LQIOut), detail::StructField(Fields::kAge, age),
+                                          detail::StructField(Fields::kAllocated, allocated),
+                                          detail::StructField(Fields::kLinkEstablished, linkEstablished) });
 }
 
 } // namespace RouteTableStruct
@@ -292,25 +149,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kRotationTime))
-        {
-            err = DataModel::Decode(reader, rotationTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kFlags))
-        {
-            err = DataModel::Decode(reader, flags);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kRotationTime, rotationTime),
+                                          detail::StructField(Fields::kFlags, flags) });
 }
 
 } // namespace SecurityPolicy
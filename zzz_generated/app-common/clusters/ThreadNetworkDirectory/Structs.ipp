@@ -20,7 +20,7 @@
 
 #include <clusters/ThreadNetworkDirectory/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,33 +42,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
-        {
-            err = DataModel::Decode(reader, extendedPanID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkName))
-        {
-            err = DataModel::Decode(reader, networkName);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kActiveTimestamp))
-        {
-            err = DataModel::Decode(reader, activeTimestamp);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kExtendedPanID, extendedPanID),
+                                          detail::StructField(Fields::kNetworkName, networkName),
+                                          detail::StructField(Fields::kChannel, channel),
+                                          detail::StructField(Fields::kActiveTimestamp, activeTimestamp) });
 }
 
 } // namespace ThreadNetworkStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/TlsClientManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -61,45 +61,12 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kEndpointID))
-        {
-            err = DataModel::Decode(reader, endpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kHostname))
-        {
-            err = DataModel::Decode(reader, hostname);
-        }
-        else if (__context_tag == to_underlying(Fields::kPort))
-        {
-            err = DataModel::Decode(reader, port);
-        }
-        else if (__context_tag == to_underlying(Fields::kCaid))
-        {
-            err = DataModel::Decode(reader, caid);
-        }
-        else if (__context_tag == to_underlying(Fields::kCcdid))
-        {
-            err = DataModel::Decode(reader, ccdid);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kEndpointID, endpointID),
+                                          detail::StructField(Fields::kHostname, hostname),
+                                          detail::StructField(Fields::kPort, port), detail::StructField(Fields::kCaid, caid),
+                                          detail::StructField(Fields::kCcdid, ccdid),
+                                          detail::StructField(Fields::kStatus, status),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace TLSEndpointStruct
@@ -20,7 +20,7 @@
 
 #include <clusters/TotalVolatileOrganicCompoundsConcentrationMeasurement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
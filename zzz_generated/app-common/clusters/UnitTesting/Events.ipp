@@ -22,7 +22,7 @@
 
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -46,44 +46,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg3))
-        {
-            err = DataModel::Decode(reader, arg3);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg4))
-        {
-            err = DataModel::Decode(reader, arg4);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg5))
-        {
-            err = DataModel::Decode(reader, arg5);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg6))
-        {
-            err = DataModel::Decode(reader, arg6);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kArg1, arg1), detail::StructField(Fields::kArg2, arg2),
+                                          detail::StructField(Fields::kArg3, arg3), detail::StructField(Fields::kArg4, arg4),
+                                          detail::StructField(Fields::kArg5, arg5), detail::StructField(Fields::kArg6, arg6) });
 }
 } // namespace TestEvent.
 namespace TestFabricScopedEvent {
@@ -97,24 +62,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 } // namespace TestFabricScopedEvent.
 namespace TestDifferentVendorMeiEvent {
@@ -128,24 +76,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kArg1, arg1) });
 }
 } // namespace TestDifferentVendorMeiEvent.
 } // namespace Events
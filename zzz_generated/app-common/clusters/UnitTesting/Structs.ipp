@@ -20,7 +20,7 @@
 
 #include <clusters/UnitTesting/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -47,53 +47,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-        else if (__context_tag == to_underlying(Fields::kE))
-        {
-            err = DataModel::Decode(reader, e);
-        }
-        else if (__context_tag == to_underlying(Fields::kF))
-        {
-            err = DataModel::Decode(reader, f);
-        }
-        else if (__context_tag == to_underlying(Fields::kG))
-        {
-            err = DataModel::Decode(reader, g);
-        }
-        else if (__context_tag == to_underlying(Fields::kH))
-        {
-            err = DataModel::Decode(reader, h);
-        }
-        else if (__context_tag == to_underlying(Fields::kI))
-        {
-            err = DataModel::Decode(reader, i);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kA, a), detail::StructField(Fields::kB, b),
+                                          detail::StructField(Fields::kC, c), detail::StructField(Fields::kD, d),
+                                          detail::StructField(Fields::kE, e), detail::StructField(Fields::kF, f),
+                                          detail::StructField(Fields::kG, g), detail::StructField(Fields::kH, h),
+                                          detail::StructField(Fields::kI, i) });
 }
 
 } // namespace SimpleStruct
@@ -153,49 +111,15 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, optionalFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, nullableFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, nullableOptionalFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveCharString))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveCharString);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveStruct))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8uList))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveInt8uList);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(
+        reader, { detail::StructField(Fields::kFabricSensitiveInt8u, fabricSensitiveInt8u),
+                  detail::StructField(Fields::kOptionalFabricSensitiveInt8u, optionalFabricSensitiveInt8u),
+                  detail::StructField(Fields::kNullableFabricSensitiveInt8u, nullableFabricSensitiveInt8u),
+                  detail::StructField(Fields::kNullableOptionalFabricSensitiveInt8u, nullableOptionalFabricSensitiveInt8u),
+                  detail::StructField(Fields::kFabricSensitiveCharString, fabricSensitiveCharString),
+                  detail::StructField(Fields::kFabricSensitiveStruct, fabricSensitiveStruct),
+                  detail::StructField(Fields::kFabricSensitiveInt8uList, fabricSensitiveInt8uList),
+                  detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace TestFabricScoped
@@ -221,65 +145,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNullableInt))
-        {
-            err = DataModel::Decode(reader, nullableInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalInt))
-        {
-            err = DataModel::Decode(reader, optionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalInt))
-        {
-            err = DataModel::Decode(reader, nullableOptionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableString))
-        {
-            err = DataModel::Decode(reader, nullableString);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalString))
-        {
-            err = DataModel::Decode(reader, optionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalString))
-        {
-            err = DataModel::Decode(reader, nullableOptionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStruct))
-        {
-            err = DataModel::Decode(reader, nullableStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStruct))
-        {
-            err = DataModel::Decode(reader, optionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStruct))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableList))
-        {
-            err = DataModel::Decode(reader, nullableList);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalList))
-        {
-            err = DataModel::Decode(reader, optionalList);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalList))
-        {
-            err = DataModel::Decode(reader, nullableOptionalList);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kNullableInt, nullableInt),
+                                          detail::StructField(Fields::kOptionalInt, optionalInt),
+                                          detail::StructField(Fields::kNullableOptionalInt, nullableOptionalInt),
+                                          detail::StructField(Fields::kNullableString, nullableString),
+                                          detail::StructField(Fields::kOptionalString, optionalString),
+                                          detail::StructField(Fields::kNullableOptionalString, nullableOptionalString),
+                                          detail::StructField(Fields::kNullableStruct, nullableStruct),
+                                          detail::StructField(Fields::kOptionalStruct, optionalStruct),
+                                          detail::StructField(Fields::kNullableOptionalStruct, nullableOptionalStruct),
+                                          detail::StructField(Fields::kNullableList, nullableList),
+                                          detail::StructField(Fields::kOptionalList, optionalList),
+                                          detail::StructField(Fields::kNullableOptionalList, nullableOptionalList) });
 }
 
 } // namespace NullablesAndOptionalsStruct
@@ -297,33 +174,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kA, a), detail::StructField(Fields::kB, b),
+                                          detail::StructField(Fields::kC, c), detail::StructField(Fields::kD, d) });
 }
 
 } // namespace NestedStruct
@@ -344,45 +196,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-        else if (__context_tag == to_underlying(Fields::kE))
-        {
-            err = DataModel::Decode(reader, e);
-        }
-        else if (__context_tag == to_underlying(Fields::kF))
-        {
-            err = DataModel::Decode(reader, f);
-        }
-        else if (__context_tag == to_underlying(Fields::kG))
-        {
-            err = DataModel::Decode(reader, g);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kA, a), detail::StructField(Fields::kB, b),
+                                          detail::StructField(Fields::kC, c), detail::StructField(Fields::kD, d),
+                                          detail::StructField(Fields::kE, e), detail::StructField(Fields::kF, f),
+                                          detail::StructField(Fields::kG, g) });
 }
 
 } // namespace NestedStructList
@@ -397,21 +214,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kA, a) });
 }
 
 } // namespace DoubleNestedStructList
@@ -427,25 +230,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMember1))
-        {
-            err = DataModel::Decode(reader, member1);
-        }
-        else if (__context_tag == to_underlying(Fields::kMember2))
-        {
-            err = DataModel::Decode(reader, member2);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMember1, member1),
+                                          detail::StructField(Fields::kMember2, member2) });
 }
 
 } // namespace TestListStructOctet
@@ -20,7 +20,7 @@
 
 #include <clusters/WaterHeaterManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -44,41 +44,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kOneShot))
-        {
-            err = DataModel::Decode(reader, oneShot);
-        }
-        else if (__context_tag == to_underlying(Fields::kEmergencyBoost))
-        {
-            err = DataModel::Decode(reader, emergencyBoost);
-        }
-        else if (__context_tag == to_underlying(Fields::kTemporarySetpoint))
-        {
-            err = DataModel::Decode(reader, temporarySetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetPercentage))
-        {
-            err = DataModel::Decode(reader, targetPercentage);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetReheat))
-        {
-            err = DataModel::Decode(reader, targetReheat);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kDuration, duration),
+                                          detail::StructField(Fields::kOneShot, oneShot),
+                                          detail::StructField(Fields::kEmergencyBoost, emergencyBoost),
+                                          detail::StructField(Fields::kTemporarySetpoint, temporarySetpoint),
+                                          detail::StructField(Fields::kTargetPercentage, targetPercentage),
+                                          detail::StructField(Fields::kTargetReheat, targetReheat) });
 }
 
 } // namespace WaterHeaterBoostInfoStruct
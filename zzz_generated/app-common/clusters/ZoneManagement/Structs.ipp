@@ -20,7 +20,7 @@
 
 #include <clusters/ZoneManagement/Structs.h>
 
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -40,25 +40,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kX))
-        {
-            err = DataModel::Decode(reader, x);
-        }
-        else if (__context_tag == to_underlying(Fields::kY))
-        {
-            err = DataModel::Decode(reader, y);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kX, x), detail::StructField(Fields::kY, y) });
 }
 
 } // namespace TwoDCartesianVertexStruct
@@ -76,33 +58,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kUse))
-        {
-            err = DataModel::Decode(reader, use);
-        }
-        else if (__context_tag == to_underlying(Fields::kVertices))
-        {
-            err = DataModel::Decode(reader, vertices);
-        }
-        else if (__context_tag == to_underlying(Fields::kColor))
-        {
-            err = DataModel::Decode(reader, color);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kName, name), detail::StructField(Fields::kUse, use),
+                                          detail::StructField(Fields::kVertices, vertices),
+                                          detail::StructField(Fields::kColor, color) });
 }
 
 } // namespace TwoDCartesianZoneStruct
@@ -120,33 +78,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kZoneType))
-        {
-            err = DataModel::Decode(reader, zoneType);
-        }
-        else if (__context_tag == to_underlying(Fields::kZoneSource))
-        {
-            err = DataModel::Decode(reader, zoneSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kTwoDCartesianZone))
-        {
-            err = DataModel::Decode(reader, twoDCartesianZone);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kZoneID, zoneID),
+                                          detail::StructField(Fields::kZoneType, zoneType),
+                                          detail::StructField(Fields::kZoneSource, zoneSource),
+                                          detail::StructField(Fields::kTwoDCartesianZone, twoDCartesianZone) });
 }
 
 } // namespace ZoneInformationStruct
@@ -166,41 +101,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInitialDuration))
-        {
-            err = DataModel::Decode(reader, initialDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kAugmentationDuration))
-        {
-            err = DataModel::Decode(reader, augmentationDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kBlindDuration))
-        {
-            err = DataModel::Decode(reader, blindDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSensitivity))
-        {
-            err = DataModel::Decode(reader, sensitivity);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kZoneID, zoneID),
+                                          detail::StructField(Fields::kInitialDuration, initialDuration),
+                                          detail::StructField(Fields::kAugmentationDuration, augmentationDuration),
+                                          detail::StructField(Fields::kMaxDuration, maxDuration),
+                                          detail::StructField(Fields::kBlindDuration, blindDuration),
+                                          detail::StructField(Fields::kSensitivity, sensitivity) });
 }
 
 } // namespace ZoneTriggerControlStruct
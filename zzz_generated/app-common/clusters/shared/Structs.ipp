@@ -21,7 +21,7 @@
 #include <clusters/shared/Structs.h>
 
 #include <app/data-model/Decode.h>
-#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -42,25 +42,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMfgCode))
-        {
-            err = DataModel::Decode(reader, mfgCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMfgCode, mfgCode),
+                                          detail::StructField(Fields::kValue, value) });
 }
 
 } // namespace ModeTagStruct
@@ -77,29 +60,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kMode))
-        {
-            err = DataModel::Decode(reader, mode);
-        }
-        else if (__context_tag == to_underlying(Fields::kModeTags))
-        {
-            err = DataModel::Decode(reader, modeTags);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLabel, label), detail::StructField(Fields::kMode, mode),
+                                          detail::StructField(Fields::kModeTags, modeTags) });
 }
 
 } // namespace ModeOptionStruct
@@ -121,49 +83,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kRangeMin))
-        {
-            err = DataModel::Decode(reader, rangeMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kRangeMax))
-        {
-            err = DataModel::Decode(reader, rangeMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMax))
-        {
-            err = DataModel::Decode(reader, percentMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMin))
-        {
-            err = DataModel::Decode(reader, percentMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentTypical))
-        {
-            err = DataModel::Decode(reader, percentTypical);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMax))
-        {
-            err = DataModel::Decode(reader, fixedMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMin))
-        {
-            err = DataModel::Decode(reader, fixedMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedTypical))
-        {
-            err = DataModel::Decode(reader, fixedTypical);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kRangeMin, rangeMin),
+                                          detail::StructField(Fields::kRangeMax, rangeMax),
+                                          detail::StructField(Fields::kPercentMax, percentMax),
+                                          detail::StructField(Fields::kPercentMin, percentMin),
+                                          detail::StructField(Fields::kPercentTypical, percentTypical),
+                                          detail::StructField(Fields::kFixedMax, fixedMax),
+                                          detail::StructField(Fields::kFixedMin, fixedMin),
+                                          detail::StructField(Fields::kFixedTypical, fixedTypical) });
 }
 
 } // namespace MeasurementAccuracyRangeStruct
@@ -182,37 +109,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
-        {
-            err = DataModel::Decode(reader, measurementType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeasured))
-        {
-            err = DataModel::Decode(reader, measured);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinMeasuredValue))
-        {
-            err = DataModel::Decode(reader, minMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxMeasuredValue))
-        {
-            err = DataModel::Decode(reader, maxMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kAccuracyRanges))
-        {
-            err = DataModel::Decode(reader, accuracyRanges);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMeasurementType, measurementType),
+                                          detail::StructField(Fields::kMeasured, measured),
+                                          detail::StructField(Fields::kMinMeasuredValue, minMeasuredValue),
+                                          detail::StructField(Fields::kMaxMeasuredValue, maxMeasuredValue),
+                                          detail::StructField(Fields::kAccuracyRanges, accuracyRanges) });
 }
 
 } // namespace MeasurementAccuracyStruct
@@ -228,25 +129,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCatalogVendorID))
-        {
-            err = DataModel::Decode(reader, catalogVendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kApplicationID))
-        {
-            err = DataModel::Decode(reader, applicationID);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCatalogVendorID, catalogVendorID),
+                                          detail::StructField(Fields::kApplicationID, applicationID) });
 }
 
 } // namespace ApplicationStruct
@@ -263,29 +147,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kErrorStateID))
-        {
-            err = DataModel::Decode(reader, errorStateID);
-        }
-        else if (__context_tag == to_underlying(Fields::kErrorStateLabel))
-        {
-            err = DataModel::Decode(reader, errorStateLabel);
-        }
-        else if (__context_tag == to_underlying(Fields::kErrorStateDetails))
-        {
-            err = DataModel::Decode(reader, errorStateDetails);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kErrorStateID, errorStateID),
+                                          detail::StructField(Fields::kErrorStateLabel, errorStateLabel),
+                                          detail::StructField(Fields::kErrorStateDetails, errorStateDetails) });
 }
 
 } // namespace ErrorStateStruct
@@ -301,25 +165,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLabel, label), detail::StructField(Fields::kValue, value) });
 }
 
 } // namespace LabelStruct
@@ -335,25 +181,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kOperationalStateID))
-        {
-            err = DataModel::Decode(reader, operationalStateID);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationalStateLabel))
-        {
-            err = DataModel::Decode(reader, operationalStateLabel);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kOperationalStateID, operationalStateID),
+                                          detail::StructField(Fields::kOperationalStateLabel, operationalStateLabel) });
 }
 
 } // namespace OperationalStateStruct
@@ -375,25 +204,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-        else if (__context_tag == to_underlying(Fields::kDecimalPoints))
-        {
-            err = DataModel::Decode(reader, decimalPoints);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCurrency, currency),
+                                          detail::StructField(Fields::kDecimalPoints, decimalPoints) });
 }
 
 } // namespace CurrencyStruct
@@ -409,25 +221,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAmount))
-        {
-            err = DataModel::Decode(reader, amount);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAmount, amount),
+                                          detail::StructField(Fields::kCurrency, currency) });
 }
 
 } // namespace PriceStruct
@@ -449,49 +244,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kRangeMin))
-        {
-            err = DataModel::Decode(reader, rangeMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kRangeMax))
-        {
-            err = DataModel::Decode(reader, rangeMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMax))
-        {
-            err = DataModel::Decode(reader, percentMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMin))
-        {
-            err = DataModel::Decode(reader, percentMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentTypical))
-        {
-            err = DataModel::Decode(reader, percentTypical);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMax))
-        {
-            err = DataModel::Decode(reader, fixedMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMin))
-        {
-            err = DataModel::Decode(reader, fixedMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedTypical))
-        {
-            err = DataModel::Decode(reader, fixedTypical);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kRangeMin, rangeMin),
+                                          detail::StructField(Fields::kRangeMax, rangeMax),
+                                          detail::StructField(Fields::kPercentMax, percentMax),
+                                          detail::StructField(Fields::kPercentMin, percentMin),
+                                          detail::StructField(Fields::kPercentTypical, percentTypical),
+                                          detail::StructField(Fields::kFixedMax, fixedMax),
+                                          detail::StructField(Fields::kFixedMin, fixedMin),
+                                          detail::StructField(Fields::kFixedTypical, fixedTypical) });
 }
 
 } // namespace MeasurementAccuracyRangeStruct
@@ -510,37 +270,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
-        {
-            err = DataModel::Decode(reader, measurementType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeasured))
-        {
-            err = DataModel::Decode(reader, measured);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinMeasuredValue))
-        {
-            err = DataModel::Decode(reader, minMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxMeasuredValue))
-        {
-            err = DataModel::Decode(reader, maxMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kAccuracyRanges))
-        {
-            err = DataModel::Decode(reader, accuracyRanges);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kMeasurementType, measurementType),
+                                          detail::StructField(Fields::kMeasured, measured),
+                                          detail::StructField(Fields::kMinMeasuredValue, minMeasuredValue),
+                                          detail::StructField(Fields::kMaxMeasuredValue, maxMeasuredValue),
+                                          detail::StructField(Fields::kAccuracyRanges, accuracyRanges) });
 }
 
 } // namespace MeasurementAccuracyStruct
@@ -556,25 +290,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kAttributeID))
-        {
-            err = DataModel::Decode(reader, attributeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kAttributeID, attributeID),
+                                          detail::StructField(Fields::kStatusCode, statusCode) });
 }
 
 } // namespace AtomicAttributeStatusStruct
@@ -591,29 +308,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCandidate))
-        {
-            err = DataModel::Decode(reader, candidate);
-        }
-        else if (__context_tag == to_underlying(Fields::kSDPMid))
-        {
-            err = DataModel::Decode(reader, SDPMid);
-        }
-        else if (__context_tag == to_underlying(Fields::kSDPMLineIndex))
-        {
-            err = DataModel::Decode(reader, SDPMLineIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kCandidate, candidate),
+                                          detail::StructField(Fields::kSDPMid, SDPMid),
+                                          detail::StructField(Fields::kSDPMLineIndex, SDPMLineIndex) });
 }
 
 } // namespace ICECandidateStruct
@@ -631,33 +328,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kURLs))
-        {
-            err = DataModel::Decode(reader, URLs);
-        }
-        else if (__context_tag == to_underlying(Fields::kUsername))
-        {
-            err = DataModel::Decode(reader, username);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredential))
-        {
-            err = DataModel::Decode(reader, credential);
-        }
-        else if (__context_tag == to_underlying(Fields::kCaid))
-        {
-            err = DataModel::Decode(reader, caid);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kURLs, URLs),
+                                          detail::StructField(Fields::kUsername, username),
+                                          detail::StructField(Fields::kCredential, credential),
+                                          detail::StructField(Fields::kCaid, caid) });
 }
 
 } // namespace ICEServerStruct
@@ -674,29 +348,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLocationName))
-        {
-            err = DataModel::Decode(reader, locationName);
-        }
-        else if (__context_tag == to_underlying(Fields::kFloorNumber))
-        {
-            err = DataModel::Decode(reader, floorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kAreaType))
-        {
-            err = DataModel::Decode(reader, areaType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kLocationName, locationName),
+                                          detail::StructField(Fields::kFloorNumber, floorNumber),
+                                          detail::StructField(Fields::kAreaType, areaType) });
 }
 
 } // namespace LocationDescriptorStruct
@@ -713,29 +367,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPowerThreshold))
-        {
-            err = DataModel::Decode(reader, powerThreshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kApparentPowerThreshold))
-        {
-            err = DataModel::Decode(reader, apparentPowerThreshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerThresholdSource))
-        {
-            err = DataModel::Decode(reader, powerThresholdSource);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kPowerThreshold, powerThreshold),
+                                          detail::StructField(Fields::kApparentPowerThreshold, apparentPowerThreshold),
+                                          detail::StructField(Fields::kPowerThresholdSource, powerThresholdSource) });
 }
 
 } // namespace PowerThresholdStruct
@@ -752,29 +386,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kMyBitmap))
-        {
-            err = DataModel::Decode(reader, myBitmap);
-        }
-        else if (__context_tag == to_underlying(Fields::kMyEnum))
-        {
-            err = DataModel::Decode(reader, myEnum);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kName, name),
+                                          detail::StructField(Fields::kMyBitmap, myBitmap),
+                                          detail::StructField(Fields::kMyEnum, myEnum) });
 }
 
 } // namespace TestGlobalStruct
@@ -792,33 +406,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kX1))
-        {
-            err = DataModel::Decode(reader, x1);
-        }
-        else if (__context_tag == to_underlying(Fields::kY1))
-        {
-            err = DataModel::Decode(reader, y1);
-        }
-        else if (__context_tag == to_underlying(Fields::kX2))
-        {
-            err = DataModel::Decode(reader, x2);
-        }
-        else if (__context_tag == to_underlying(Fields::kY2))
-        {
-            err = DataModel::Decode(reader, y2);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kX1, x1), detail::StructField(Fields::kY1, y1),
+                                          detail::StructField(Fields::kX2, x2), detail::StructField(Fields::kY2, y2) });
 }
 
 } // namespace ViewportStruct
@@ -856,49 +445,14 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeerNodeID))
-        {
-            err = DataModel::Decode(reader, peerNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeerEndpointID))
-        {
-            err = DataModel::Decode(reader, peerEndpointID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamUsage))
-        {
-            err = DataModel::Decode(reader, streamUsage);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataEnabled))
-        {
-            err = DataModel::Decode(reader, metadataEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return detail::DecodeStruct(reader, { detail::StructField(Fields::kId, id),
+                                          detail::StructField(Fields::kPeerNodeID, peerNodeID),
+                                          detail::StructField(Fields::kPeerEndpointID, peerEndpointID),
+                                          detail::StructField(Fields::kStreamUsage, streamUsage),
+                                          detail::StructField(Fields::kVideoStreamID, videoStreamID),
+                                          detail::StructField(Fields::kAudioStreamID, audioStreamID),
+                                          detail::StructField(Fields::kMetadataEnabled, metadataEnabled),
+                                          detail::StructField(Fields::kFabricIndex, fabricIndex) });
 }
 
 } // namespace WebRTCSessionStruct